@@ -0,0 +1,21 @@
+# Compares k_effective and stored solution memory of the sood_1999 benchmarks
+# with and without mixed precision storage.
+# Usage: compare_mixed_precision.sh <path to bart executable>
+bart=$(realpath $1)
+benchmark_dir=$(dirname $(realpath $0))/sood_1999
+
+for deck_dir in $benchmark_dir/*/
+do
+    deck=$(basename $deck_dir)
+    cd $deck_dir
+    cp $deck.prm mixed_$deck.prm
+    echo "set mixed precision storage = true" >> mixed_$deck.prm
+    echo "set output file name base = mixed_$deck" >> mixed_$deck.prm
+    double_k=$($bart $deck.prm | grep "Final k_effective" | awk '{print $3}')
+    mixed_output=$($bart mixed_$deck.prm)
+    mixed_k=$(echo "$mixed_output" | grep "Final k_effective" | awk '{print $3}')
+    echo "$deck: double $double_k, mixed $mixed_k, difference" \
+         $(echo "$mixed_k - $double_k" | bc -l)
+    echo "$mixed_output" | grep "storage (single precision)"
+    rm mixed_$deck.prm
+done
@@ -1,5 +1,6 @@
 #include "convergence/final.h"
 
+#include "system/moments/moment_block.h"
 #include "system/moments/spherical_harmonic_types.h"
 
 #include <deal.II/base/exceptions.h>
@@ -8,8 +9,8 @@ namespace bart {
 
 namespace convergence {
 
-template <typename CompareType>
-Final<CompareType>& Final<CompareType>::SetMaxIterations(
+template <typename CompareType, typename PreviousType>
+Final<CompareType, PreviousType>& Final<CompareType, PreviousType>::SetMaxIterations(
     IterationNumber to_set) {
 
     AssertThrow(to_set > 0,
@@ -18,8 +19,8 @@ Final<CompareType>& Final<CompareType>::SetMaxIterations(
     return *this;
 }
 
-template <typename CompareType>
-Final<CompareType>& Final<CompareType>::SetIteration(
+template <typename CompareType, typename PreviousType>
+Final<CompareType, PreviousType>& Final<CompareType, PreviousType>::SetIteration(
     IterationNumber to_set) {
 
     AssertThrow(to_set >= 0,
@@ -31,6 +32,8 @@ Final<CompareType>& Final<CompareType>::SetIteration(
 template class Final<system::moments::MomentVector>;
 template class Final<system::moments::MomentsMap>;
 template class Final<const system::moments::MomentsMap>;
+template class Final<const system::moments::MomentsMap,
+                     const system::moments::SinglePrecisionMoments>;
 template class Final<double>;
 
 
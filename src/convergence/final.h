@@ -13,10 +13,10 @@ namespace convergence {
 /*! \brief Implements getters and setters for final convergence interface.
  *
  */
-template <typename CompareType>
-class Final : public FinalI<CompareType> {
+template <typename CompareType, typename PreviousType = CompareType>
+class Final : public FinalI<CompareType, PreviousType> {
  public:
-  using typename FinalI<CompareType>::IterationNumber;
+  using typename FinalI<CompareType, PreviousType>::IterationNumber;
 
   virtual ~Final() = default;
 
@@ -32,9 +32,9 @@ class Final : public FinalI<CompareType> {
   IterationNumber iteration() const override {
       return convergence_status_.iteration_number; };
 
-  Final<CompareType>& SetMaxIterations(IterationNumber to_set) override;
+  Final& SetMaxIterations(IterationNumber to_set) override;
 
-  Final<CompareType>& SetIteration(IterationNumber to_set) override;
+  Final& SetIteration(IterationNumber to_set) override;
 
   void Reset() override {
     Status convergence_status;
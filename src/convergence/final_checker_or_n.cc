@@ -1,5 +1,6 @@
 #include "convergence/final_checker_or_n.h"
 
+#include "system/moments/moment_block.h"
 #include "system/moments/spherical_harmonic_types.h"
 #include "convergence/moments/single_moment_checker_i.h"
 #include "convergence/moments/multi_moment_checker_i.h"
@@ -9,10 +10,29 @@ namespace bart {
 
 namespace convergence {
 
-template <typename CompareType, typename CheckerType>
-Status FinalCheckerOrN<CompareType, CheckerType>::CheckFinalConvergence(
+namespace {
+
+template <typename CheckerType, typename CompareType, typename PreviousType>
+bool CheckIfConverged(CheckerType& checker,
+                      CompareType& current_iteration,
+                      PreviousType& previous_iteration) {
+  return checker.CheckIfConverged(current_iteration, previous_iteration);
+}
+
+bool CheckIfConverged(
+    moments::MultiMomentCheckerI& checker,
+    const system::moments::MomentsMap& current_iteration,
+    const system::moments::SinglePrecisionMoments& previous_iteration) {
+  return checker.CheckIfConvergedToSinglePrecision(current_iteration,
+                                                   previous_iteration);
+}
+
+} // namespace
+
+template <typename CompareType, typename CheckerType, typename PreviousType>
+Status FinalCheckerOrN<CompareType, CheckerType, PreviousType>::CheckFinalConvergence(
     CompareType& current_iteration,
-    CompareType& previous_iteration) {
+    PreviousType& previous_iteration) {
 
   StatusDeltaAndIterate(current_iteration, previous_iteration);
   return convergence_status_;
@@ -29,13 +49,25 @@ Status FinalCheckerOrN<system::moments::MomentsMap ,
   return convergence_status_;
 }
 
-template<typename CompareType, typename CheckerType>
-void FinalCheckerOrN<CompareType, CheckerType>::StatusDeltaAndIterate(
+template <>
+Status FinalCheckerOrN<const system::moments::MomentsMap,
+                       moments::MultiMomentCheckerI,
+                       const system::moments::SinglePrecisionMoments>::CheckFinalConvergence(
+    const system::moments::MomentsMap& current_iteration,
+    const system::moments::SinglePrecisionMoments& previous_iteration) {
+
+  StatusDeltaAndIterate(current_iteration, previous_iteration);
+  convergence_status_.failed_index = checker_ptr_->failed_index();
+  return convergence_status_;
+}
+
+template<typename CompareType, typename CheckerType, typename PreviousType>
+void FinalCheckerOrN<CompareType, CheckerType, PreviousType>::StatusDeltaAndIterate(
     CompareType &current_iteration,
-    CompareType &previous_iteration) {
+    PreviousType &previous_iteration) {
 
   convergence_status_.is_complete =
-      checker_ptr_->CheckIfConverged(current_iteration, previous_iteration);
+      CheckIfConverged(*checker_ptr_, current_iteration, previous_iteration);
 
   convergence_status_.delta = checker_ptr_->delta();
 
@@ -53,6 +85,9 @@ template class FinalCheckerOrN<system::moments::MomentsMap,
                                moments::MultiMomentCheckerI>;
 template class FinalCheckerOrN<const system::moments::MomentsMap,
                                moments::MultiMomentCheckerI>;
+template class FinalCheckerOrN<const system::moments::MomentsMap,
+                               moments::MultiMomentCheckerI,
+                               const system::moments::SinglePrecisionMoments>;
 template class FinalCheckerOrN<double, parameters::SingleParameterChecker>;
 
 
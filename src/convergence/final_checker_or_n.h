@@ -15,10 +15,13 @@ namespace convergence {
  * \tparam CompareType the types of objects that will be compared to determine
  * convergence.
  * \tparam CheckerType type of checker used to determine convergence.
+ * \tparam PreviousType the type of the previous iteration, if it is stored
+ * differently from the current iteration.
  */
 
-template <typename CompareType, typename CheckerType>
-class FinalCheckerOrN : public Final<CompareType>{
+template <typename CompareType, typename CheckerType,
+          typename PreviousType = CompareType>
+class FinalCheckerOrN : public Final<CompareType, PreviousType>{
  public:
   /*! \brief Constructor.
    *
@@ -30,7 +33,7 @@ class FinalCheckerOrN : public Final<CompareType>{
   ~FinalCheckerOrN() = default;
 
   Status CheckFinalConvergence(CompareType& current_iteration,
-                               CompareType& previous_iteration) override;
+                               PreviousType& previous_iteration) override;
   CheckerType* checker_ptr() const { return checker_ptr_.get(); }
 
  protected:
@@ -43,9 +46,9 @@ class FinalCheckerOrN : public Final<CompareType>{
    * \param previous_iteration previous iteration
    */
   void StatusDeltaAndIterate(CompareType& current_iteration,
-                             CompareType& previous_iteration);
+                             PreviousType& previous_iteration);
 
-  using Final<CompareType>::convergence_status_;
+  using Final<CompareType, PreviousType>::convergence_status_;
   std::unique_ptr<CheckerType> checker_ptr_;
 };
 
@@ -17,10 +17,12 @@ namespace convergence {
  *
  * \tparam CompareType the types of the objects or values that will be compared
  * to determine final convergence. (i.e. fluxes, integers, etc).
+ * \tparam PreviousType the type of the previous iteration, if it is stored
+ * differently from the current iteration (i.e. in single precision).
  *
  */
 
-template <typename CompareType>
+template <typename CompareType, typename PreviousType = CompareType>
 class FinalI {
  public:
   //! Typedef for value used for indexing iterations
@@ -35,7 +37,7 @@ class FinalI {
    * system convergence
    */
   virtual Status CheckFinalConvergence(CompareType& current_iteration,
-                                       CompareType& previous_iteration) = 0;
+                                       PreviousType& previous_iteration) = 0;
 
   /*! \brief Get status of system convergence
    *
@@ -5,6 +5,7 @@
 #include <optional>
 
 #include "convergence/moments/single_moment_checker_i.h"
+#include "system/moments/moment_block.h"
 #include "system/moments/spherical_harmonic_types.h"
 
 namespace bart {
@@ -30,6 +31,18 @@ class MultiMomentCheckerI {
    */
   virtual bool CheckIfConverged(const system::moments::MomentsMap &current_iteration,
                                 const system::moments::MomentsMap &previous_iteration) = 0;
+
+  /*! \brief Identifies if all moments provided have converged to a previous
+   * iteration stored in single precision.
+   *
+   * \param current_iteration all moments for current iteration.
+   * \param previous_iteration all moments for previous iteration, stored in
+   * single precision in a contiguous block.
+   * \return bool indicating if convergence has been reached.
+   */
+  virtual bool CheckIfConvergedToSinglePrecision(
+      const system::moments::MomentsMap &current_iteration,
+      const system::moments::SinglePrecisionMoments &previous_iteration) = 0;
   
   /*! \brief Returns status of previous call to CheckIfConverged
    *
@@ -26,18 +26,9 @@ bool MultiMomentCheckerMax::CheckIfConverged(
     // Check that l = m = 0 (scalar flux)
     if (index[1] == 0 && index[2] == 0) {
       try {
-        auto current_moment = current_iteration.at(index);
-
-        if (!checker_->CheckIfConverged(current_moment, previous_moment)) {
-          is_converged_ = false;
-
-          double delta = checker_->delta().value_or(0);
-
-          if (delta > delta_.value_or(0)) {
-            delta_ = delta;
-            failed_index_ = index[0];
-          }
-        }
+        const auto& current_moment = current_iteration.at(index);
+        UpdateStatus(index[0], checker_->CheckIfConverged(current_moment,
+                                                          previous_moment));
       } catch (std::out_of_range &exc) {
         AssertThrow(false,
             dealii::ExcMessage("Current iteration lacks a group that previous"
@@ -46,6 +37,54 @@ bool MultiMomentCheckerMax::CheckIfConverged(
     }
   }
 
+  return FinishCheck();
+}
+
+bool MultiMomentCheckerMax::CheckIfConvergedToSinglePrecision(
+    const system::moments::MomentsMap &current_iteration,
+    const system::moments::SinglePrecisionMoments &previous_iteration) {
+  AssertThrow(current_iteration.size() > 0,
+              dealii::ExcMessage("Current iteration moments map is empty"));
+  AssertThrow(previous_iteration.size() > 0,
+              dealii::ExcMessage("Previous iteration moments are empty"));
+  // Moment indices are ordered by group first
+  AssertThrow(current_iteration.rbegin()->first[0] + 1 ==
+                  previous_iteration.total_groups(),
+              dealii::ExcMessage("Current and previous iterations must have "
+                                 "the same groups"));
+  is_converged_ = true;
+
+  // Scalar fluxes are the first moment of each group in the block
+  for (int group = 0; group < previous_iteration.total_groups(); ++group) {
+    try {
+      const auto& current_moment = current_iteration.at({group, 0, 0});
+      UpdateStatus(group, checker_->CheckIfConvergedToSinglePrecision(
+          current_moment, previous_iteration[{group, 0, 0}]));
+    } catch (std::out_of_range &exc) {
+      AssertThrow(false,
+          dealii::ExcMessage("Current iteration lacks a group that previous"
+                             "iteration had"));
+    }
+  }
+
+  return FinishCheck();
+}
+
+void MultiMomentCheckerMax::UpdateStatus(const int group,
+                                         const bool is_group_converged) {
+  if (!is_group_converged) {
+    is_converged_ = false;
+
+    double delta = checker_->delta().value_or(0);
+
+    if (delta > delta_.value_or(0)) {
+      delta_ = delta;
+      failed_index_ = group;
+    }
+  }
+}
+
+bool MultiMomentCheckerMax::FinishCheck() {
   if (is_converged_) {
     delta_ = std::nullopt;
     failed_index_ = std::nullopt;
@@ -54,8 +93,6 @@ bool MultiMomentCheckerMax::CheckIfConverged(
   return is_converged_;
 }
 
-
-
 } // namespace moments
 
 } // namespace convergence
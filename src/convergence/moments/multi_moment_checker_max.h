@@ -20,6 +20,15 @@ class MultiMomentCheckerMax : public MultiMomentChecker {
 
   bool CheckIfConverged(const system::moments::MomentsMap &current_iteration,
                         const system::moments::MomentsMap &previous_iteration) override;
+  bool CheckIfConvergedToSinglePrecision(
+      const system::moments::MomentsMap &current_iteration,
+      const system::moments::SinglePrecisionMoments &previous_iteration) override;
+
+ private:
+  //! Updates the status with the result of the check of a group scalar flux
+  void UpdateStatus(const int group, const bool is_group_converged);
+  //! Clears the delta and failed index if converged, returns convergence
+  bool FinishCheck();
 };
 
 } // namespace moments
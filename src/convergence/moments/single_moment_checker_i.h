@@ -19,6 +19,12 @@ class SingleMomentCheckerI : public SingleChecker<system::moments::MomentVector>
  public:
   virtual ~SingleMomentCheckerI() = default;
 
+  /*! \brief Checks for convergence to a previous iteration stored in single
+   * precision. */
+  virtual bool CheckIfConvergedToSinglePrecision(
+      const system::moments::MomentVector& current_iteration,
+      const system::moments::SinglePrecisionMomentView& previous_iteration) = 0;
+
  protected:
   using SingleChecker<system::moments::MomentVector>::max_delta_;
   using SingleChecker<system::moments::MomentVector>::delta_;
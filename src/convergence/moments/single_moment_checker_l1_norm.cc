@@ -1,5 +1,7 @@
 #include "convergence/moments/single_moment_checker_l1_norm.h"
 
+#include "system/moments/moment_functions.h"
+
 namespace bart {
 
 namespace convergence {
@@ -9,13 +11,39 @@ namespace moments {
 bool SingleMomentCheckerL1Norm::CheckIfConverged(
     const system::moments::MomentVector &current_iteration,
     const system::moments::MomentVector &previous_iteration) {
-  system::moments::MomentVector difference(current_iteration);
-  difference -= previous_iteration;
-  delta_ = difference.l1_norm()/current_iteration.l1_norm();
-  is_converged_ = delta_ <= max_delta_;
+  return CheckDelta(system::moments::L1NormOfDifference(current_iteration,
+                                                        previous_iteration),
+                    current_iteration);
+}
+
+bool SingleMomentCheckerL1Norm::CheckIfConvergedToSinglePrecision(
+    const system::moments::MomentVector &current_iteration,
+    const system::moments::SinglePrecisionMomentView &previous_iteration) {
+  return CheckDelta(system::moments::L1NormOfDifference(current_iteration,
+                                                        previous_iteration),
+                    current_iteration);
+}
+
+bool SingleMomentCheckerL1Norm::CheckDelta(
+    const double difference_norm,
+    const system::moments::MomentVector &current_iteration) {
+  const auto previous_delta = delta_;
+  delta_ = difference_norm / current_iteration.l1_norm();
+  is_stalled_ = delta_ > max_delta_ && delta_ <= precision_floor_ &&
+      previous_delta.has_value() && delta_ >= previous_delta.value();
+  is_converged_ = delta_ <= max_delta_ || is_stalled_;
   return is_converged_;
 }
 
+SingleMomentCheckerL1Norm& SingleMomentCheckerL1Norm::SetPrecisionFloor(
+    const double to_set) {
+  AssertThrow(to_set >= 0,
+              dealii::ExcMessage("Error in SingleMomentCheckerL1Norm, "
+                                 "precision floor must be >= 0"))
+  precision_floor_ = to_set;
+  return *this;
+}
+
 } // namespace moments
 
 } // namespace convergence
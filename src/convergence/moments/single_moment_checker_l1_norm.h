@@ -19,6 +19,12 @@ namespace moments {
  * \f]
  *
  * Convergence is achieved if \f$\Delta_i \leq \Delta_{\text{max}}\f$.
+ *
+ * If solutions are stored in reduced precision, \f$\Delta_i\f$ cannot be
+ * reduced below the rounding error of the stored values, and may stall above
+ * \f$\Delta_{\text{max}}\f$. If a precision floor is set, convergence is also
+ * achieved if \f$\Delta_i\f$ is at or below the floor and did not decrease
+ * from the previous check, \f$\Delta_i \geq \Delta_{i-1}\f$.
  * */
 
 class SingleMomentCheckerL1Norm : public SingleMomentCheckerI {
@@ -34,6 +40,26 @@ class SingleMomentCheckerL1Norm : public SingleMomentCheckerI {
   bool CheckIfConverged(
       const system::moments::MomentVector &current_iteration,
       const system::moments::MomentVector &previous_iteration) override;
+
+  bool CheckIfConvergedToSinglePrecision(
+      const system::moments::MomentVector &current_iteration,
+      const system::moments::SinglePrecisionMomentView &previous_iteration) override;
+
+  /*! \brief Sets the precision floor, the smallest delta that can be
+   * resolved by the stored solutions. */
+  SingleMomentCheckerL1Norm& SetPrecisionFloor(const double to_set);
+  double precision_floor() const { return precision_floor_; }
+  /*! \brief Returns true if the last check converged due to a stall at the
+   * precision floor. */
+  bool is_stalled() const { return is_stalled_; }
+
+ private:
+  //! Sets the delta and convergence status from the norm of the difference
+  bool CheckDelta(const double difference_norm,
+                  const system::moments::MomentVector &current_iteration);
+
+  double precision_floor_ = 0;
+  bool is_stalled_ = false;
 };
 
 } // namespace moments
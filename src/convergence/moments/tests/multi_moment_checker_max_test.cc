@@ -1,5 +1,6 @@
 #include "convergence/moments/multi_moment_checker_max.h"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 
@@ -145,8 +146,52 @@ TEST_F(MultiMomentCheckerMaxTest, ConvergeAfterBad) {
   EXPECT_EQ(test_checker.delta(), std::nullopt);
 }
 
+// Previous moments stored in single precision are checked by the single
+// precision check of the single moment checker, once for each group
+TEST_F(MultiMomentCheckerMaxTest, SinglePrecisionPrevious) {
+  // Only the scalar fluxes are checked, and copied to the block
+  bart::system::moments::SinglePrecisionMoments single_moments(5, 4, 5);
+  for (int group = 0; group < 5; ++group) {
+    const auto& moment = moments_map_two.at({group, 0, 0});
+    std::copy(moment.begin(), moment.end(),
+              single_moments[{group, 0, 0}].begin());
+  }
+
+  const int failing_group = 3;
+  bart::system::moments::MomentVector failing_moment(
+      moments_map_one.at({failing_group, 0, 0}));
+  EXPECT_CALL(*checker_ptr, CheckIfConverged(_,_)).Times(0);
+  EXPECT_CALL(*checker_ptr, CheckIfConvergedToSinglePrecision(_,_))
+      .Times(4)
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*checker_ptr,
+              CheckIfConvergedToSinglePrecision(failing_moment, _))
+      .WillOnce(Return(false));
+  EXPECT_CALL(*checker_ptr, delta())
+      .WillOnce(Return(std::make_optional<double>(0.123)));
+
+  MultiMomentCheckerMax test_checker(std::move(checker_ptr));
+
+  EXPECT_FALSE(test_checker.CheckIfConvergedToSinglePrecision(
+      moments_map_one, single_moments));
+  EXPECT_EQ(test_checker.failed_index().value_or(-1), failing_group);
+  EXPECT_EQ(test_checker.delta().value_or(-1), 0.123);
+}
+
 // -- ERRORS --
 
+// Previous moments stored in single precision with different groups should
+// throw an error
+TEST_F(MultiMomentCheckerMaxTest, SinglePrecisionWrongGroups) {
+  MultiMomentCheckerMax test_checker(std::move(checker_ptr));
+  bart::system::moments::SinglePrecisionMoments empty_moments;
+  EXPECT_ANY_THROW(test_checker.CheckIfConvergedToSinglePrecision(
+      moments_map_one, empty_moments));
+  bart::system::moments::SinglePrecisionMoments wrong_group_moments(4, 4, 5);
+  EXPECT_ANY_THROW(test_checker.CheckIfConvergedToSinglePrecision(
+      moments_map_one, wrong_group_moments));
+}
+
 // Passing empty moments map should throw an error
 TEST_F(MultiMomentCheckerMaxTest, EmptyMoments) {
   MultiMomentCheckerMax test_checker(std::move(checker_ptr));
@@ -17,6 +17,9 @@ class MultiMomentCheckerMock : public MultiMomentCheckerI {
  public:
   MOCK_METHOD2(CheckIfConverged, bool(const system::moments::MomentsMap&,
       const system::moments::MomentsMap&));
+  MOCK_METHOD2(CheckIfConvergedToSinglePrecision,
+               bool(const system::moments::MomentsMap&,
+                    const system::moments::SinglePrecisionMoments&));
   MOCK_CONST_METHOD0(is_converged, bool());
   MOCK_CONST_METHOD0(failed_index, std::optional<int>());
   MOCK_CONST_METHOD0(delta, std::optional<double>());
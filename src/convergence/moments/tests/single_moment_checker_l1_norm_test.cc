@@ -1,6 +1,8 @@
 #include "convergence/moments/single_moment_checker_l1_norm.h"
 
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "convergence/tests/single_checker_test.h"
@@ -77,4 +79,54 @@ TEST_F(SingleMomentCheckerL1NormTest, SetMaxDelta) {
 
 }
 
+TEST_F(SingleMomentCheckerL1NormTest, SetPrecisionFloor) {
+  EXPECT_EQ(checker.precision_floor(), 0);
+  checker.SetPrecisionFloor(1e-5);
+  EXPECT_EQ(checker.precision_floor(), 1e-5);
+  EXPECT_ANY_THROW(checker.SetPrecisionFloor(-1));
+}
+
+// A delta above the maximum but below the precision floor converges only once
+// it stops decreasing
+TEST_F(SingleMomentCheckerL1NormTest, PrecisionFloorStall) {
+  checker.SetPrecisionFloor(1e-5);
+  bart::system::moments::MomentVector moment_three(moment_one);
+  moment_two(2) += moment_one.l1_norm() * 4 * checker.max_delta();
+  moment_three(2) += moment_one.l1_norm() * 2 * checker.max_delta();
+
+  EXPECT_FALSE(checker.CheckIfConverged(moment_one, moment_two));
+  EXPECT_FALSE(checker.is_stalled());
+  EXPECT_FALSE(checker.CheckIfConverged(moment_one, moment_three));
+  EXPECT_FALSE(checker.is_stalled());
+  EXPECT_TRUE(checker.CheckIfConverged(moment_one, moment_three));
+  EXPECT_TRUE(checker.is_stalled());
+  EXPECT_TRUE(checker.is_converged());
+}
+
+TEST_F(SingleMomentCheckerL1NormTest, PrecisionFloorNoStallAboveFloor) {
+  checker.SetPrecisionFloor(1e-5);
+  moment_two(2) += moment_one.l1_norm() * 100 * checker.max_delta();
+
+  EXPECT_FALSE(checker.CheckIfConverged(moment_one, moment_two));
+  EXPECT_FALSE(checker.CheckIfConverged(moment_one, moment_two));
+  EXPECT_FALSE(checker.is_stalled());
+}
+
+TEST_F(SingleMomentCheckerL1NormTest, SinglePrecisionPrevious) {
+  const std::vector<float> single_moment_values(moment_one.begin(),
+                                                moment_one.end());
+  const bart::system::moments::SinglePrecisionMomentView single_moment_one(
+      single_moment_values);
+
+  EXPECT_TRUE(checker.CheckIfConvergedToSinglePrecision(moment_one,
+                                                        single_moment_one));
+  EXPECT_TRUE(checker.is_converged());
+
+  moment_two(2) += moment_one.l1_norm() * 2 * checker.max_delta();
+  EXPECT_FALSE(checker.CheckIfConvergedToSinglePrecision(moment_two,
+                                                         single_moment_one));
+  EXPECT_FALSE(checker.is_converged());
+  EXPECT_NEAR(2 * checker.max_delta(), checker.delta().value(), 1e-6);
+}
+
 } // namespace
\ No newline at end of file
@@ -14,6 +14,9 @@ class SingleMomentCheckerMock : public SingleMomentCheckerI {
  public:
   MOCK_METHOD2(CheckIfConverged, bool(const system::moments::MomentVector&,
       const system::moments::MomentVector&));
+  MOCK_METHOD2(CheckIfConvergedToSinglePrecision,
+               bool(const system::moments::MomentVector&,
+                    const system::moments::SinglePrecisionMomentView&));
   MOCK_CONST_METHOD0(is_converged, bool());
   MOCK_METHOD1(SetMaxDelta, void(const double to_set));
   MOCK_CONST_METHOD0(max_delta, double());
@@ -12,6 +12,8 @@ struct Status {
   bool is_complete = false;
   std::optional<int> failed_index = std::nullopt;
   std::optional<double> delta = std::nullopt;
+  //! Number of solves skipped because they were already converged, if tracked
+  std::optional<int> skipped_solves = std::nullopt;
 
   bool operator==(const Status& rhs) const {
     if (iteration_number != rhs.iteration_number) {
@@ -24,6 +26,8 @@ struct Status {
       return false;
     } else if (delta != rhs.delta) {
       return false;
+    } else if (skipped_solves != rhs.skipped_solves) {
+      return false;
     }
     return true;
   }
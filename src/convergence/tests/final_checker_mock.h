@@ -10,12 +10,12 @@ namespace bart {
 
 namespace convergence {
 
-template <typename CompareType>
-class FinalCheckerMock : public FinalI<CompareType> {
+template <typename CompareType, typename PreviousType = CompareType>
+class FinalCheckerMock : public FinalI<CompareType, PreviousType> {
  public:
-  using typename FinalI<CompareType>::IterationNumber;
+  using typename FinalI<CompareType, PreviousType>::IterationNumber;
   MOCK_METHOD(Status, CheckFinalConvergence, (CompareType& current_iteration,
-      CompareType& previous_iteration), (override));
+      PreviousType& previous_iteration), (override));
   MOCK_METHOD(Status, convergence_status, (), (override, const));
   MOCK_METHOD(bool, convergence_is_complete, (), (override, const));
   MOCK_METHOD(IterationNumber, max_iterations, (), (override, const));
@@ -8,6 +8,7 @@
 #include "convergence/status.hpp"
 #include "convergence/moments/tests/multi_moment_checker_mock.h"
 #include "convergence/tests/final_test.h"
+#include "system/moments/moment_block.h"
 #include "system/moments/spherical_harmonic_types.h"
 #include "test_helpers/gmock_wrapper.h"
 
@@ -147,6 +148,27 @@ TEST_F(ConvergenceFinalCheckerOrNMultiMomentTest, MaxIterationsReached) {
   EXPECT_TRUE(test_checker.convergence_is_complete());
 }
 
+TEST_F(ConvergenceFinalCheckerOrNMultiMomentTest, SinglePrecisionPrevious) {
+  using FinalSinglePrecisionChecker = FinalCheckerOrN<
+      const bart::system::moments::MomentsMap, moments::MultiMomentCheckerI,
+      const bart::system::moments::SinglePrecisionMoments>;
+  const bart::system::moments::SinglePrecisionMoments single_moments;
+  auto failed_index = std::make_optional<int>(2);
+
+  EXPECT_CALL(*checker_ptr, CheckIfConverged(_,_)).Times(0);
+  EXPECT_CALL(*checker_ptr, CheckIfConvergedToSinglePrecision(_,_))
+      .WillOnce(Return(false));
+  ON_CALL(*checker_ptr, failed_index())
+      .WillByDefault(Return(failed_index));
+
+  FinalSinglePrecisionChecker test_checker(std::move(checker_ptr));
+  Status expected = {1, 100, false, failed_index, std::nullopt};
+
+  auto result = test_checker.CheckFinalConvergence(moment_map_one,
+                                                   single_moments);
+  EXPECT_TRUE(CompareStatus(result, expected));
+}
+
 } // namespace
 
 
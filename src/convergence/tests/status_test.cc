@@ -74,4 +74,10 @@ TEST_F(ConvergenceStatusOperatorsTest, NonEquivalenceDelta) {
   EXPECT_TRUE(test_status_one != test_status_two);
 }
 
+TEST_F(ConvergenceStatusOperatorsTest, NonEquivalenceSkippedSolves) {
+  test_status_two.skipped_solves = 2;
+  EXPECT_FALSE(test_status_one == test_status_two);
+  EXPECT_TRUE(test_status_one != test_status_two);
+}
+
 } // namespace
\ No newline at end of file
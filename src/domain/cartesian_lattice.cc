@@ -0,0 +1,173 @@
+#include "domain/cartesian_lattice.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+
+namespace bart {
+
+namespace domain {
+
+template <int dim>
+CartesianLattice<dim>::CartesianLattice(const DefinitionI<dim>& domain) {
+  AssertThrow(dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) == 1,
+              dealii::ExcMessage("Error in constructor of CartesianLattice, "
+                                 "lattices are only available when running on "
+                                 "a single process"))
+  AssertThrow(domain.discretization_type() ==
+                  problem::DiscretizationType::kContinuousFEM,
+              dealii::ExcMessage("Error in constructor of CartesianLattice, "
+                                 "domain must use a continuous discretization"))
+  const auto& finite_element = domain.dof_handler().get_fe();
+  AssertThrow(finite_element.degree == 1 &&
+              finite_element.n_components() == 1 &&
+              static_cast<int>(finite_element.dofs_per_cell) == nodes_per_cell,
+              dealii::ExcMessage("Error in constructor of CartesianLattice, "
+                                 "finite element must be linear with one "
+                                 "degree of freedom at each vertex"))
+  const auto cells = domain.Cells();
+  AssertThrow(!cells.empty(),
+              dealii::ExcMessage("Error in constructor of CartesianLattice, "
+                                 "domain has no cells"))
+
+  // All cells must be the same size as the first, and aligned to a grid
+  const dealii::Tensor<1, dim> cell_size =
+      cells.front()->vertex(nodes_per_cell - 1) - cells.front()->vertex(0);
+  dealii::Point<dim> origin = cells.front()->vertex(0);
+  for (const auto& cell : cells) {
+    for (int d = 0; d < dim; ++d)
+      origin[d] = std::min(origin[d], cell->vertex(0)[d]);
+  }
+
+  const double tolerance = 1e-10;
+  bool is_uniform = true;
+  std::vector<std::array<int, dim>> cell_indices;
+  cell_indices.reserve(cells.size());
+  n_cells_.fill(0);
+  for (const auto& cell : cells) {
+    std::array<int, dim> index;
+    for (int d = 0; d < dim; ++d) {
+      index[d] = std::lround((cell->vertex(0)[d] - origin[d]) / cell_size[d]);
+      n_cells_[d] = std::max(n_cells_[d], index[d] + 1);
+    }
+    for (int vertex = 0; vertex < nodes_per_cell; ++vertex) {
+      for (int d = 0; d < dim; ++d) {
+        const double expected_position =
+            origin[d] + (index[d] + ((vertex >> d) & 1)) * cell_size[d];
+        is_uniform = is_uniform &&
+            std::abs(cell->vertex(vertex)[d] - expected_position) <=
+                tolerance * cell_size[d];
+      }
+    }
+    cell_indices.push_back(index);
+  }
+  std::size_t total_cells = 1;
+  for (const int n : n_cells_)
+    total_cells *= n;
+  AssertThrow(is_uniform && total_cells == cells.size(),
+              dealii::ExcMessage("Error in constructor of CartesianLattice, "
+                                 "mesh must be a uniform Cartesian mesh"))
+
+  // Lattice nodes are ordered lexicographically, x fastest
+  std::array<std::size_t, dim> node_strides;
+  node_strides[0] = 1;
+  for (int d = 1; d < dim; ++d)
+    node_strides[d] = node_strides[d - 1] * (n_cells_[d - 1] + 1);
+  const std::size_t n_lattice_nodes =
+      node_strides[dim - 1] * (n_cells_[dim - 1] + 1);
+  for (int vertex = 0; vertex < nodes_per_cell; ++vertex) {
+    node_offsets_[vertex] = 0;
+    for (int d = 0; d < dim; ++d)
+      node_offsets_[vertex] += ((vertex >> d) & 1) * node_strides[d];
+  }
+
+  // Linear finite element degrees of freedom are numbered as the cell vertices
+  lattice_to_dof_.assign(n_lattice_nodes, dealii::numbers::invalid_dof_index);
+  std::vector<dealii::types::global_dof_index> cell_dofs(nodes_per_cell);
+  std::vector<int> cell_class_by_cell(total_cells);
+  std::map<std::pair<int, std::vector<int>>, int> cell_class_ids;
+
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    const auto& cell = cells[i];
+    const auto& index = cell_indices[i];
+    std::size_t first_node = 0, cell_number = 0, cells_below = 1;
+    for (int d = 0; d < dim; ++d) {
+      first_node += index[d] * node_strides[d];
+      cell_number += index[d] * cells_below;
+      cells_below *= n_cells_[d];
+    }
+    cell->get_dof_indices(cell_dofs);
+    for (int vertex = 0; vertex < nodes_per_cell; ++vertex)
+      lattice_to_dof_[first_node + node_offsets_[vertex]] = cell_dofs[vertex];
+
+    std::vector<int> boundary_faces;
+    for (int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+      if (cell->face(face)->at_boundary())
+        boundary_faces.push_back(face);
+    }
+    const int material_id = cell->material_id();
+    auto [class_it, is_new_class] = cell_class_ids.try_emplace(
+        {material_id, boundary_faces}, cell_classes_.size());
+    if (is_new_class)
+      cell_classes_.push_back({material_id, cell, boundary_faces});
+    cell_class_by_cell[cell_number] = class_it->second;
+  }
+
+  // Split each row of cells along x into runs of the same cell class
+  const std::size_t n_rows = total_cells / n_cells_[0];
+  for (std::size_t row = 0; row < n_rows; ++row) {
+    std::size_t row_first_node = 0, remaining_row = row;
+    for (int d = 1; d < dim; ++d) {
+      row_first_node += (remaining_row % n_cells_[d]) * node_strides[d];
+      remaining_row /= n_cells_[d];
+    }
+    for (int i = 0; i < n_cells_[0]; ++i) {
+      const int cell_class = cell_class_by_cell[i + row * n_cells_[0]];
+      if (i == 0 || runs_.back().cell_class != cell_class) {
+        runs_.push_back({row_first_node + i, 1, cell_class});
+      } else {
+        ++runs_.back().n_cells;
+      }
+    }
+  }
+}
+
+template <int dim>
+void CartesianLattice<dim>::ToLattice(
+    const system::MPIVector& dof_vector,
+    dealii::Vector<double>& lattice_vector) const {
+  AssertThrow(dof_vector.size() == n_nodes(),
+              dealii::ExcMessage("Error in ToLattice, vector size does not "
+                                 "match the number of lattice nodes"))
+  if (lattice_vector.size() != n_nodes())
+    lattice_vector.reinit(n_nodes(), true);
+  dof_vector.extract_subvector_to(lattice_to_dof_.begin(),
+                                  lattice_to_dof_.end(),
+                                  lattice_vector.begin());
+}
+
+template <int dim>
+void CartesianLattice<dim>::FromLattice(
+    const dealii::Vector<double>& lattice_vector,
+    system::MPIVector& dof_vector) const {
+  AssertThrow(lattice_vector.size() == n_nodes() &&
+              dof_vector.size() == n_nodes(),
+              dealii::ExcMessage("Error in FromLattice, vector size does not "
+                                 "match the number of lattice nodes"))
+  const std::vector<double> values(lattice_vector.begin(), lattice_vector.end());
+  dof_vector.set(lattice_to_dof_, values);
+  dof_vector.compress(dealii::VectorOperation::insert);
+}
+
+template class CartesianLattice<1>;
+template class CartesianLattice<2>;
+template class CartesianLattice<3>;
+
+} // namespace domain
+
+} // namespace bart
@@ -0,0 +1,99 @@
+#ifndef BART_SRC_DOMAIN_CARTESIAN_LATTICE_H_
+#define BART_SRC_DOMAIN_CARTESIAN_LATTICE_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/lac/vector.h>
+
+#include "domain/definition_i.h"
+#include "domain/domain_types.h"
+#include "system/system_types.h"
+
+namespace bart {
+
+namespace domain {
+
+/*! \brief Tensor grid structure of a domain on a uniform Cartesian mesh.
+ *
+ * Cartesian meshes (such as those made by mesh::MeshCartesian) are regular
+ * tensor grids of identical, axis-aligned cells. For linear continuous finite
+ * elements, the degrees of freedom are the \f$\prod_d (N_d + 1)\f$ nodes of
+ * the grid, and the nodes of a cell are found from the node of its lowest
+ * corner using constant offsets. Structured operators can then be applied
+ * using the lattice (lexicographic, \f$x\f$ fastest) node ordering, without
+ * any cell or degree of freedom index arrays.
+ *
+ * Cells with the same material and the same faces on each boundary of the
+ * mesh have the same local operator, these are grouped into cell classes, each
+ * with a representative cell. Each row of cells along \f$x\f$ is split into
+ * runs of consecutive cells of the same class, so that material regions are
+ * stored as a small number of runs rather than per cell.
+ *
+ * The map between lattice nodes and degrees of freedom is only used to copy
+ * vectors to and from lattice ordering. Lattices are only available when
+ * running on a single process.
+ *
+ * @tparam dim spatial dimension.
+ */
+template <int dim>
+class CartesianLattice {
+ public:
+  static constexpr int nodes_per_cell = dealii::GeometryInfo<dim>::vertices_per_cell;
+
+  //! Consecutive cells along \f$x\f$ with the same cell class
+  struct Run {
+    //! Lattice index of the lowest node of the first cell
+    std::size_t first_node;
+    int n_cells;
+    int cell_class;
+  };
+
+  //! Cells with the same local operator
+  struct CellClass {
+    int material_id;
+    //! Cell used to calculate local operators for all cells in the class
+    domain::CellPtr<dim> cell;
+    //! Faces of the cells that are on the boundary of the mesh
+    std::vector<int> boundary_faces;
+  };
+
+  /*! \brief Constructor.
+   *
+   * @param domain domain with degrees of freedom set up, using linear
+   *        continuous finite elements on a uniform Cartesian mesh.
+   */
+  explicit CartesianLattice(const DefinitionI<dim>& domain);
+
+  /*! \brief Copies a vector from degree of freedom to lattice ordering. */
+  void ToLattice(const system::MPIVector& dof_vector,
+                 dealii::Vector<double>& lattice_vector) const;
+
+  /*! \brief Copies a vector from lattice to degree of freedom ordering. */
+  void FromLattice(const dealii::Vector<double>& lattice_vector,
+                   system::MPIVector& dof_vector) const;
+
+  std::array<int, dim> n_cells() const { return n_cells_; }
+  std::size_t n_nodes() const { return lattice_to_dof_.size(); }
+  //! Offset from the lowest node of a cell to each of its nodes
+  const std::array<std::size_t, nodes_per_cell>& node_offsets() const {
+    return node_offsets_; }
+  const std::vector<Run>& runs() const { return runs_; }
+  const std::vector<CellClass>& cell_classes() const { return cell_classes_; }
+
+ private:
+  std::array<int, dim> n_cells_;
+  std::array<std::size_t, nodes_per_cell> node_offsets_;
+  std::vector<Run> runs_;
+  std::vector<CellClass> cell_classes_;
+  //! Degree of freedom of each lattice node
+  std::vector<dealii::types::global_dof_index> lattice_to_dof_;
+};
+
+} // namespace domain
+
+} // namespace bart
+
+#endif //BART_SRC_DOMAIN_CARTESIAN_LATTICE_H_
@@ -1,9 +1,24 @@
 #include "definition.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <numeric>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/distributed/grid_refinement.h>
+#include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/dofs/dof_tools.h>
+#include <deal.II/lac/exceptions.h>
 #include <deal.II/lac/sparsity_tools.h>
+#include <deal.II/grid/grid_refinement.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/numerics/error_estimator.h>
+#include <deal.II/numerics/solution_transfer.h>
 
 namespace bart {
 
@@ -19,7 +34,8 @@ Definition<dim>::Definition(
       triangulation_(MPI_COMM_WORLD,
                      typename dealii::Triangulation<dim>::MeshSmoothing(
                          dealii::Triangulation<dim>::smoothing_on_refinement |
-                         dealii::Triangulation<dim>::smoothing_on_coarsening)),
+                         dealii::Triangulation<dim>::smoothing_on_coarsening),
+                     dealii::parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy),
       dof_handler_(triangulation_),
       discretization_type_(discretization) {
   std::string description{"Domain, " + std::to_string(dim) + "D"};
@@ -40,7 +56,8 @@ Definition<1>::Definition(
       finite_element_(finite_element),
       triangulation_(typename dealii::Triangulation<1>::MeshSmoothing(
                          dealii::Triangulation<1>::smoothing_on_refinement |
-                             dealii::Triangulation<1>::smoothing_on_coarsening)),
+                             dealii::Triangulation<1>::smoothing_on_coarsening |
+                             dealii::Triangulation<1>::limit_level_difference_at_vertices)),
       dof_handler_(triangulation_),
       discretization_type_(discretization) {
   std::string description{"Domain, 1D"};
@@ -69,10 +86,241 @@ Definition<dim>& Definition<dim>::SetUpMesh(const int global_refinements) {
   return *this;
 }
 
+template <int dim>
+dealii::Vector<float> Definition<dim>::EstimateError(
+    const system::moments::MomentsMap& moments) const {
+  dealii::Vector<float> cell_error(triangulation_.n_active_cells());
+  dealii::Vector<float> group_error(triangulation_.n_active_cells());
+  const dealii::QGauss<dim - 1> face_quadrature(
+      finite_element_->finite_element()->degree + 1);
+
+  for (const auto& [index, moment] : moments) {
+    if (index.at(1) != 0 || index.at(2) != 0)
+      continue;
+    const double norm = moment.l2_norm();
+    if (norm == 0)
+      continue;
+    if constexpr (dim == 1) {
+      dealii::KellyErrorEstimator<dim>::estimate(dof_handler_, face_quadrature,
+                                                 {}, moment, group_error);
+    } else {
+      system::MPIVector ghosted_moment;
+      FillGhostedVector(moment, ghosted_moment);
+      dealii::KellyErrorEstimator<dim>::estimate(dof_handler_, face_quadrature,
+                                                 {}, ghosted_moment,
+                                                 group_error);
+    }
+    for (unsigned int cell = 0; cell < cell_error.size(); ++cell)
+      cell_error[cell] += std::pow(group_error[cell] / norm, 2);
+  }
+
+  for (auto& error : cell_error)
+    error = std::sqrt(error);
+  return cell_error;
+}
+
+template <int dim>
+Definition<dim>& Definition<dim>::RefineAndCoarsen(
+    const dealii::Vector<float>& cell_error,
+    const double refine_fraction,
+    const double coarsen_fraction,
+    system::moments::MomentsMap& moments) {
+  AssertThrow(cell_error.size() == triangulation_.n_active_cells(),
+              dealii::ExcMessage("Error in RefineAndCoarsen, cell error size "
+                                 "does not match the number of active cells"))
+  AssertThrow(refine_fraction >= 0 && coarsen_fraction >= 0 &&
+              refine_fraction + coarsen_fraction <= 1,
+              dealii::ExcMessage("Error in RefineAndCoarsen, refine and "
+                                 "coarsen fractions must be non-negative and "
+                                 "sum to at most 1"))
+
+  if constexpr (dim == 1) {
+    dealii::GridRefinement::refine_and_coarsen_fixed_number(
+        triangulation_, cell_error, refine_fraction, coarsen_fraction);
+  } else {
+    dealii::parallel::distributed::GridRefinement::refine_and_coarsen_fixed_number(
+        triangulation_, cell_error, refine_fraction, coarsen_fraction);
+  }
+  ExecuteRefinement(moments);
+  return *this;
+}
+
+template <int dim>
+Definition<dim>& Definition<dim>::RefineGlobal(
+    system::moments::MomentsMap& moments) {
+  for (const auto& cell : triangulation_.active_cell_iterators()) {
+    if (cell->is_locally_owned())
+      cell->set_refine_flag();
+  }
+  ExecuteRefinement(moments);
+  return *this;
+}
+
+template <int dim>
+void Definition<dim>::ExecuteRefinement(system::moments::MomentsMap& moments) {
+  if constexpr (dim == 1) {
+    std::vector<dealii::Vector<double>> old_moments;
+    for (const auto& [index, moment] : moments)
+      old_moments.push_back(moment);
+
+    dealii::SolutionTransfer<dim, dealii::Vector<double>> solution_transfer(
+        dof_handler_);
+    triangulation_.prepare_coarsening_and_refinement();
+    solution_transfer.prepare_for_coarsening_and_refinement(old_moments);
+    triangulation_.execute_coarsening_and_refinement();
+    SetUpDOF();
+
+    std::vector<dealii::Vector<double>> new_moments(
+        old_moments.size(), dealii::Vector<double>(dof_handler_.n_dofs()));
+    solution_transfer.interpolate(old_moments, new_moments);
+
+    auto new_moment_it = new_moments.begin();
+    for (auto& [index, moment] : moments) {
+      constraint_matrix_.distribute(*new_moment_it);
+      moment = *new_moment_it++;
+    }
+  } else {
+    // Transferred vectors must hold the values of all locally relevant dofs
+    std::vector<system::MPIVector> old_moments(moments.size());
+    std::vector<const system::MPIVector*> old_moment_ptrs;
+    auto old_moment_it = old_moments.begin();
+    for (const auto& [index, moment] : moments) {
+      FillGhostedVector(moment, *old_moment_it);
+      old_moment_ptrs.push_back(&(*old_moment_it++));
+    }
+
+    dealii::parallel::distributed::SolutionTransfer<dim, system::MPIVector>
+        solution_transfer(dof_handler_);
+    triangulation_.prepare_coarsening_and_refinement();
+    solution_transfer.prepare_for_coarsening_and_refinement(old_moment_ptrs);
+    triangulation_.execute_coarsening_and_refinement();
+    SetUpDOF();
+
+    std::vector<system::MPIVector> new_moments(moments.size());
+    std::vector<system::MPIVector*> new_moment_ptrs;
+    for (auto& new_moment : new_moments) {
+      new_moment.reinit(locally_owned_dofs_, MPI_COMM_WORLD);
+      new_moment_ptrs.push_back(&new_moment);
+    }
+    solution_transfer.interpolate(new_moment_ptrs);
+
+    auto new_moment_it = new_moments.begin();
+    for (auto& [index, moment] : moments) {
+      constraint_matrix_.distribute(*new_moment_it);
+      // Moments are stored on all processes
+      moment = dealii::Vector<double>(*new_moment_it++);
+    }
+  }
+}
+
+template <int dim>
+std::vector<std::shared_ptr<system::MPISparseMatrix>>
+Definition<dim>::MakeProlongationMatrices() {
+  const int n_levels = triangulation_.n_global_levels();
+  AssertThrow(n_levels > 1,
+              dealii::ExcMessage("Error in MakeProlongationMatrices, mesh "
+                                 "must be refined at least once"))
+  int is_uniform = 1;
+  for (const auto& cell : triangulation_.active_cell_iterators()) {
+    if (!cell->is_artificial() && cell->level() != n_levels - 1)
+      is_uniform = 0;
+  }
+  AssertThrow(dealii::Utilities::MPI::min(is_uniform, MPI_COMM_WORLD) == 1,
+              dealii::ExcMessage("Error in MakeProlongationMatrices, mesh "
+                                 "must be uniformly refined"))
+  AssertThrow(dim > 1 ||
+              dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) == 1,
+              dealii::ExcMessage("Error in MakeProlongationMatrices, 1D "
+                                 "prolongation is only available when running "
+                                 "on a single process"))
+
+  dof_handler_.distribute_mg_dofs();
+  const auto& finite_element = *(finite_element_->finite_element());
+  const int dofs_per_cell = finite_element.dofs_per_cell;
+  std::vector<dealii::types::global_dof_index> coarse_dofs(dofs_per_cell),
+      fine_dofs(dofs_per_cell);
+
+  std::vector<std::shared_ptr<system::MPISparseMatrix>> prolongation_matrices;
+  for (int level = 1; level < n_levels; ++level) {
+    // Children on the finest level are the active cells, and use the active
+    // (possibly renumbered) degrees of freedom
+    const bool is_finest = (level == n_levels - 1);
+    const dealii::IndexSet fine_owned_dofs = is_finest ? locally_owned_dofs_ :
+        dof_handler_.locally_owned_mg_dofs(level);
+    const dealii::IndexSet coarse_owned_dofs =
+        dof_handler_.locally_owned_mg_dofs(level - 1);
+
+    std::map<std::pair<dealii::types::global_dof_index,
+                       dealii::types::global_dof_index>, double> entries;
+    dealii::IndexSet fine_relevant_dofs(fine_owned_dofs);
+    for (const auto& cell : dof_handler_.mg_cell_iterators_on_level(level - 1)) {
+      if (!cell->has_children() || !cell->is_locally_owned_on_level())
+        continue;
+      cell->get_mg_dof_indices(coarse_dofs);
+      for (unsigned int child = 0; child < cell->n_children(); ++child) {
+        if (is_finest) {
+          cell->child(child)->get_dof_indices(fine_dofs);
+        } else {
+          cell->child(child)->get_mg_dof_indices(fine_dofs);
+        }
+        const auto& cell_prolongation = finite_element.get_prolongation_matrix(
+            child, cell->refinement_case());
+        for (int i = 0; i < dofs_per_cell; ++i) {
+          for (int j = 0; j < dofs_per_cell; ++j) {
+            if (std::abs(cell_prolongation(i, j)) > 1e-13) {
+              entries[{fine_dofs[i], coarse_dofs[j]}] = cell_prolongation(i, j);
+              fine_relevant_dofs.add_index(fine_dofs[i]);
+            }
+          }
+        }
+      }
+    }
+
+    dealii::DynamicSparsityPattern sparsity_pattern(fine_owned_dofs.size(),
+                                                    coarse_owned_dofs.size(),
+                                                    fine_relevant_dofs);
+    for (const auto& [dofs, value] : entries)
+      sparsity_pattern.add(dofs.first, dofs.second);
+    dealii::SparsityTools::distribute_sparsity_pattern(
+        sparsity_pattern, fine_owned_dofs, MPI_COMM_WORLD, fine_relevant_dofs);
+
+    auto prolongation_ptr = std::make_shared<system::MPISparseMatrix>();
+    prolongation_ptr->reinit(fine_owned_dofs, coarse_owned_dofs,
+                             sparsity_pattern, MPI_COMM_WORLD);
+    // Entries shared by neighboring children are equal, so they are inserted
+    for (const auto& [dofs, value] : entries)
+      prolongation_ptr->set(dofs.first, dofs.second, value);
+    prolongation_ptr->compress(dealii::VectorOperation::insert);
+    prolongation_matrices.push_back(prolongation_ptr);
+  }
+  return prolongation_matrices;
+}
+
+template <int dim>
+void Definition<dim>::FillGhostedVector(
+    const system::moments::MomentVector& moment,
+    system::MPIVector& to_fill) const {
+  system::MPIVector owned_vector(locally_owned_dofs_, MPI_COMM_WORLD);
+  for (const auto dof : locally_owned_dofs_)
+    owned_vector[dof] = moment[dof];
+  owned_vector.compress(dealii::VectorOperation::insert);
+  to_fill.reinit(locally_owned_dofs_, locally_relevant_dofs_, MPI_COMM_WORLD);
+  to_fill = owned_vector;
+}
+
 template <int dim>
 Definition<dim>& Definition<dim>::SetUpDOF() {
+  sparsity_matrix_ptr_ = nullptr;
+  symmetric_sparsity_matrix_ptr_ = nullptr;
+  boundary_sparsity_matrix_ptr_ = nullptr;
+  symmetric_boundary_sparsity_matrix_ptr_ = nullptr;
+  material_sparsity_matrix_ptrs_.clear();
+  // Set up may be repeated after the mesh is adapted
+  local_cells_.clear();
+  total_degrees_of_freedom_ = 0;
   // Setup dof Handler
   dof_handler_.distribute_dofs(*(finite_element_->finite_element()));
+  RenumberDoFs();
   // Populate dof IndexSets
   locally_owned_dofs_ = dof_handler_.locally_owned_dofs();
   dealii::DoFTools::extract_locally_relevant_dofs(dof_handler_,
@@ -89,6 +337,7 @@ Definition<dim>& Definition<dim>::SetUpDOF() {
     if (cell->is_locally_owned())
       local_cells_.push_back(cell);
   }
+  SortLocalCells();
 
   // Set up dynamic sparsity pattern
   dynamic_sparsity_pattern_.reinit(locally_relevant_dofs_.size(),
@@ -115,18 +364,29 @@ Definition<dim>& Definition<dim>::SetUpDOF() {
 
 template <>
 Definition<1>& Definition<1>::SetUpDOF() {
+  sparsity_matrix_ptr_ = nullptr;
+  symmetric_sparsity_matrix_ptr_ = nullptr;
+  boundary_sparsity_matrix_ptr_ = nullptr;
+  symmetric_boundary_sparsity_matrix_ptr_ = nullptr;
+  material_sparsity_matrix_ptrs_.clear();
+  // Set up may be repeated after the mesh is adapted
+  local_cells_.clear();
+  total_degrees_of_freedom_ = 0;
   auto n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
   auto this_process = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
 
   dealii::GridTools::partition_triangulation(n_mpi_processes, triangulation_);
   dof_handler_.distribute_dofs(*(finite_element_)->finite_element());
   dealii::DoFRenumbering::subdomain_wise(dof_handler_);
+  if (n_mpi_processes == 1)
+    RenumberDoFs();
 
   for (auto cell = dof_handler_.begin_active();
        cell != dof_handler_.end(); ++cell) {
     if (cell->is_locally_owned())
       local_cells_.push_back(cell);
   }
+  SortLocalCells();
 
   auto locally_owned_dofs_vector =
       dealii::DoFTools::locally_owned_dofs_per_subdomain(dof_handler_);
@@ -150,16 +410,275 @@ Definition<1>& Definition<1>::SetUpDOF() {
   return *this;
 }
 
+template <int dim>
+Definition<dim>& Definition<dim>::SetDoFRenumbering(
+    const problem::DoFRenumberingType renumbering,
+    const dealii::Tensor<1, dim>& downstream_direction) {
+  AssertThrow(renumbering != problem::DoFRenumberingType::kDownstream ||
+              downstream_direction.norm() > 0,
+              dealii::ExcMessage("Error in SetDoFRenumbering, downstream "
+                                 "renumbering requires a non-zero direction"))
+  dof_renumbering_ = renumbering;
+  downstream_direction_ = downstream_direction;
+  return *this;
+}
+
+template <int dim>
+void Definition<dim>::RenumberDoFs() {
+  switch (dof_renumbering_) {
+    case problem::DoFRenumberingType::kCuthillMcKee: {
+      dealii::DoFRenumbering::Cuthill_McKee(dof_handler_);
+      break;
+    }
+    case problem::DoFRenumberingType::kHilbert: {
+      if constexpr (dim == 1) {
+        // In 1D the curve is the ordering of cells along the line
+        dealii::Tensor<1, dim> x_direction;
+        x_direction[0] = 1;
+        dealii::DoFRenumbering::downstream(dof_handler_, x_direction);
+      } else {
+        // Order locally owned cells by the Hilbert curve index of their centers,
+        // 16 bits per dimension so the packed index fits in 64 bits
+        const int bits_per_dim = 16;
+        std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> cells;
+        std::vector<dealii::Point<dim>> cell_centers;
+        for (const auto& cell : dof_handler_.active_cell_iterators()) {
+          if (cell->is_locally_owned()) {
+            cells.push_back(cell);
+            cell_centers.push_back(cell->center());
+          }
+        }
+        std::vector<std::uint64_t> curve_index;
+        if (!cell_centers.empty()) {
+          for (const auto& index : dealii::Utilities::inverse_Hilbert_space_filling_curve(
+              cell_centers, bits_per_dim))
+            curve_index.push_back(
+                dealii::Utilities::pack_integers<dim>(index, bits_per_dim));
+        }
+
+        std::vector<std::size_t> order(cells.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&curve_index](const std::size_t lhs, const std::size_t rhs) {
+                           return curve_index[lhs] < curve_index[rhs]; });
+
+        std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> ordered_cells;
+        ordered_cells.reserve(cells.size());
+        for (const auto i : order)
+          ordered_cells.push_back(cells[i]);
+        dealii::DoFRenumbering::cell_wise(dof_handler_, ordered_cells);
+      }
+      break;
+    }
+    case problem::DoFRenumberingType::kDownstream: {
+      dealii::DoFRenumbering::downstream(dof_handler_, downstream_direction_);
+      break;
+    }
+    case problem::DoFRenumberingType::kNone:
+    default:
+      break;
+  }
+}
+
+template <int dim>
+void Definition<dim>::SortLocalCells() {
+  if (dof_renumbering_ == problem::DoFRenumberingType::kNone)
+    return;
+
+  std::vector<dealii::types::global_dof_index> cell_dofs(
+      dof_handler_.get_fe().dofs_per_cell);
+  std::vector<std::pair<dealii::types::global_dof_index,
+                        typename CellRange::value_type>> keyed_cells;
+  keyed_cells.reserve(local_cells_.size());
+  for (const auto& cell : local_cells_) {
+    cell->get_dof_indices(cell_dofs);
+    keyed_cells.emplace_back(
+        *std::min_element(cell_dofs.begin(), cell_dofs.end()), cell);
+  }
+  std::stable_sort(keyed_cells.begin(), keyed_cells.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs.first < rhs.first; });
+  for (std::size_t i = 0; i < keyed_cells.size(); ++i)
+    local_cells_[i] = keyed_cells[i].second;
+}
+
 template<int dim>
 std::shared_ptr<system::MPISparseMatrix> Definition<dim>::MakeSystemMatrix() const {
-  auto system_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
-  system_matrix_ptr->reinit(locally_owned_dofs_,
-      locally_owned_dofs_,
-      dynamic_sparsity_pattern_,
-      MPI_COMM_WORLD);
+  // The PETSc matrix structure is built from the dynamic sparsity pattern only
+  // once, all system matrices are duplicates that share its row and column
+  // index arrays and only allocate their own values.
+  if (sparsity_matrix_ptr_ == nullptr)
+    sparsity_matrix_ptr_ = MakeSparsityMatrix(dynamic_sparsity_pattern_);
+  return DuplicateMatrix(*sparsity_matrix_ptr_);
+}
+
+template<int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::MakeSymmetricSystemMatrix() const {
+  if (symmetric_sparsity_matrix_ptr_ == nullptr) {
+    symmetric_sparsity_matrix_ptr_ =
+        MakeSymmetricSparsityMatrix(dynamic_sparsity_pattern_);
+  }
+  return DuplicateSymmetricMatrix(*symmetric_sparsity_matrix_ptr_);
+}
+
+template<int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::MakeBoundarySystemMatrix(
+    const bool is_symmetric) const {
+  auto& structure_ptr = is_symmetric ? symmetric_boundary_sparsity_matrix_ptr_
+                                     : boundary_sparsity_matrix_ptr_;
+  if (structure_ptr == nullptr) {
+    const auto boundary_sparsity_pattern = MakeCellSparsityPattern(
+        [](const auto& cell) { return cell->at_boundary(); });
+    structure_ptr = is_symmetric
+        ? MakeSymmetricSparsityMatrix(boundary_sparsity_pattern)
+        : MakeSparsityMatrix(boundary_sparsity_pattern);
+  }
+  return is_symmetric ? DuplicateSymmetricMatrix(*structure_ptr)
+                      : DuplicateMatrix(*structure_ptr);
+}
+
+template<int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::MakeMaterialSystemMatrix(
+    const int material_id) const {
+  auto& structure_ptr = material_sparsity_matrix_ptrs_[material_id];
+  if (structure_ptr == nullptr) {
+    structure_ptr = MakeSparsityMatrix(MakeCellSparsityPattern(
+        [material_id](const auto& cell) {
+          return static_cast<int>(cell->material_id()) == material_id; }));
+  }
+  return DuplicateMatrix(*structure_ptr);
+}
+
+template <int dim>
+dealii::DynamicSparsityPattern Definition<dim>::MakeCellSparsityPattern(
+    const std::function<bool(const CellPtr<dim>&)>& include_cell) const {
+  // The 1D triangulation is not distributed, all cells are used so that the
+  // locally owned rows are complete without exchanging entries
+  dealii::DynamicSparsityPattern cell_sparsity_pattern;
+  if (dim == 1) {
+    cell_sparsity_pattern.reinit(dof_handler_.n_dofs(), dof_handler_.n_dofs());
+  } else {
+    cell_sparsity_pattern.reinit(locally_relevant_dofs_.size(),
+                                 locally_relevant_dofs_.size(),
+                                 locally_relevant_dofs_);
+  }
+
+  std::vector<dealii::types::global_dof_index> cell_dofs(
+      finite_element_->dofs_per_cell());
+  for (const auto& cell : dof_handler_.active_cell_iterators()) {
+    if ((dim == 1 || cell->is_locally_owned()) && include_cell(cell)) {
+      cell->get_dof_indices(cell_dofs);
+      for (const auto row : cell_dofs) {
+        for (const auto column : cell_dofs)
+          cell_sparsity_pattern.add(row, column);
+      }
+    }
+  }
+
+  if (dim > 1) {
+    dealii::SparsityTools::distribute_sparsity_pattern(
+        cell_sparsity_pattern, locally_owned_dofs_, MPI_COMM_WORLD,
+        locally_relevant_dofs_);
+  }
+  constraint_matrix_.condense(cell_sparsity_pattern);
+  return cell_sparsity_pattern;
+}
+
+template <int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::MakeSparsityMatrix(
+    const dealii::DynamicSparsityPattern& sparsity_pattern) const {
+  auto sparsity_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  sparsity_matrix_ptr->reinit(locally_owned_dofs_,
+                              locally_owned_dofs_,
+                              sparsity_pattern,
+                              MPI_COMM_WORLD);
+  return sparsity_matrix_ptr;
+}
+
+template <int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::MakeSymmetricSparsityMatrix(
+    const dealii::DynamicSparsityPattern& sparsity_pattern) const {
+  PetscErrorCode ierr;
+  // Upper triangle of the locally owned rows of the sparsity pattern, in
+  // compressed row format with global column indices
+  std::vector<PetscInt> row_offsets{0}, column_indices;
+  row_offsets.reserve(locally_owned_dofs_.n_elements() + 1);
+  for (const auto row : locally_owned_dofs_) {
+    for (auto entry = sparsity_pattern.begin(row);
+         entry != sparsity_pattern.end(row); ++entry) {
+      if (entry->column() >= row)
+        column_indices.push_back(entry->column());
+    }
+    row_offsets.push_back(column_indices.size());
+  }
+
+  const PetscInt n_local_rows = locally_owned_dofs_.n_elements();
+  const PetscInt n_rows = locally_owned_dofs_.size();
+  Mat symmetric_matrix;
+  ierr = MatCreate(MPI_COMM_WORLD, &symmetric_matrix);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = MatSetSizes(symmetric_matrix, n_local_rows, n_local_rows, n_rows,
+                     n_rows);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = MatSetType(symmetric_matrix, MATSBAIJ);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  // Only the call matching the sequential or parallel type has an effect
+  ierr = MatSeqSBAIJSetPreallocationCSR(symmetric_matrix, 1,
+                                        row_offsets.data(),
+                                        column_indices.data(), nullptr);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = MatMPISBAIJSetPreallocationCSR(symmetric_matrix, 1,
+                                        row_offsets.data(),
+                                        column_indices.data(), nullptr);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+
+  return WrapMatrix(symmetric_matrix);
+}
+
+template <int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::DuplicateSymmetricMatrix(
+    const system::MPISparseMatrix& to_duplicate) const {
+  auto system_matrix_ptr = DuplicateMatrix(to_duplicate);
+  // Stampers add full cell matrices, the lower triangular part is redundant
+  for (const auto option : {MAT_SYMMETRIC, MAT_SYMMETRY_ETERNAL,
+                            MAT_IGNORE_LOWER_TRIANGULAR}) {
+    PetscErrorCode ierr = MatSetOption(system_matrix_ptr->petsc_matrix(),
+                                       option, PETSC_TRUE);
+    AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  }
   return system_matrix_ptr;
 }
 
+template <int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::DuplicateMatrix(
+    const system::MPISparseMatrix& to_duplicate) const {
+  Mat duplicate_matrix;
+  PetscErrorCode ierr = MatDuplicate(static_cast<Mat>(to_duplicate),
+                                     MAT_SHARE_NONZERO_PATTERN,
+                                     &duplicate_matrix);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  return WrapMatrix(duplicate_matrix);
+}
+
+template <int dim>
+std::shared_ptr<system::MPISparseMatrix> Definition<dim>::WrapMatrix(
+    Mat matrix) const {
+  /* Initializing the wrapper with an empty pattern sets its communicator and
+   * row distribution without allocating entries, its matrix is then replaced.
+   * This avoids the constructor taking a Mat, which needs deal.II 9.5. */
+  auto matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  dealii::DynamicSparsityPattern empty_pattern(locally_owned_dofs_.size(),
+                                               locally_owned_dofs_.size(),
+                                               locally_owned_dofs_);
+  matrix_ptr->reinit(locally_owned_dofs_, locally_owned_dofs_, empty_pattern,
+                     MPI_COMM_WORLD);
+  Mat& wrapped_matrix = matrix_ptr->petsc_matrix();
+  const PetscErrorCode ierr = MatDestroy(&wrapped_matrix);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  wrapped_matrix = matrix;
+  return matrix_ptr;
+}
+
 template<int dim>
 std::shared_ptr<system::MPIVector> Definition<dim>::MakeSystemVector() const {
   auto system_vector_ptr = std::make_shared<system::MPIVector>();
@@ -1,19 +1,24 @@
 #ifndef BART_SRC_DOMAIN_DEFINITION_H_
 #define BART_SRC_DOMAIN_DEFINITION_H_
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <vector>
 
 #include <deal.II/base/index_set.h>
 #include <deal.II/base/iterator_range.h>
+#include <deal.II/base/tensor.h>
 #include <deal.II/distributed/tria.h>
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
 
 #include "domain/definition_i.h"
 #include "domain/finite_element/finite_element_i.h"
 #include "domain/mesh/mesh_i.h"
 #include "problem/parameter_types.h"
+#include "system/moments/spherical_harmonic_types.h"
 #include "system/system_types.h"
 
 namespace bart {
@@ -73,9 +78,86 @@ class Definition : public DefinitionI<dim> {
   ~Definition() = default;
 
   Definition<dim>& SetUpDOF() override;
+
+  /*! \brief Sets the renumbering of degrees of freedom applied by SetUpDOF.
+   *
+   * Locally owned cells returned by Cells() are also ordered by their lowest
+   * degree of freedom, so that cell traversal during assembly follows the new
+   * numbering. In 1D the renumbering is only applied when running on a single
+   * process, as the degrees of freedom must be numbered subdomain-wise.
+   *
+   * @param renumbering renumbering to apply.
+   * @param downstream_direction direction to order degrees of freedom along,
+   *        only used (and required) for downstream renumbering.
+   */
+  Definition<dim>& SetDoFRenumbering(
+      const problem::DoFRenumberingType renumbering,
+      const dealii::Tensor<1, dim>& downstream_direction = dealii::Tensor<1, dim>());
   Definition<dim>& SetUpMesh() override;
   Definition<dim>& SetUpMesh(const int global_refinements) override;
 
+  /*! \brief Estimates the discretization error in each active cell.
+   *
+   * The Kelly error estimator is applied to the scalar flux (moment
+   * \f$[g, 0, 0]\f$) of each group. Group estimates are normalized by the
+   * \f$\ell_2\f$ norm of the group scalar flux, so that all groups contribute
+   * equally, and combined as
+   * \f[
+   * \eta_K = \sqrt{\sum_g \left(\frac{\eta_{g,K}}{\|\phi_g\|}\right)^2}.
+   * \f]
+   * Only entries for locally owned cells are calculated.
+   *
+   * @param moments flux moments on the current mesh.
+   * @return estimated error, indexed by active cell index.
+   */
+  dealii::Vector<float> EstimateError(
+      const system::moments::MomentsMap& moments) const;
+
+  /*! \brief Refines and coarsens the mesh using estimated cell errors.
+   *
+   * The given fractions of cells with the largest and smallest errors are
+   * flagged for refinement and coarsening, the mesh is adapted and the degrees
+   * of freedom are set up again. Flux moments are interpolated onto the new
+   * mesh so that they may be used as the initial guess for the next solve.
+   *
+   * @param cell_error estimated error, indexed by active cell index.
+   * @param refine_fraction fraction of cells to refine.
+   * @param coarsen_fraction fraction of cells to coarsen.
+   * @param moments flux moments on the current mesh, replaced by the moments
+   *        interpolated onto the adapted mesh.
+   */
+  Definition<dim>& RefineAndCoarsen(const dealii::Vector<float>& cell_error,
+                                    const double refine_fraction,
+                                    const double coarsen_fraction,
+                                    system::moments::MomentsMap& moments);
+
+  /*! \brief Refines all cells once, interpolating flux moments onto the
+   * refined mesh.
+   *
+   * Repeated calls give the same mesh as SetUpMesh with the total number of
+   * global refinements, so this can be used to solve a problem on a sequence
+   * of nested meshes.
+   *
+   * @param moments flux moments on the current mesh, replaced by the moments
+   *        interpolated onto the refined mesh.
+   */
+  Definition<dim>& RefineGlobal(system::moments::MomentsMap& moments);
+
+  /*! \brief Makes the prolongation matrices between the levels of a globally
+   * refined mesh.
+   *
+   * The mesh must be uniformly refined, so that each coarser level of the
+   * mesh hierarchy is a complete mesh. Degrees of freedom on the coarser levels
+   * are distributed by this function. Entry \f$l\f$ of the returned vector
+   * maps degrees of freedom on level \f$l\f$ to level \f$l + 1\f$. The last
+   * matrix maps to the active degrees of freedom, so that its rows match
+   * system matrices and vectors. In 1D this is only available when running on
+   * a single process.
+   *
+   * @return prolongation matrices, ordered from coarsest to finest level.
+   */
+  std::vector<std::shared_ptr<system::MPISparseMatrix>> MakeProlongationMatrices();
+
   dealii::FullMatrix<double> GetCellMatrix() const override {
     int cell_dofs = finite_element_->dofs_per_cell();
     dealii::FullMatrix<double> full_matrix(cell_dofs, cell_dofs);
@@ -90,6 +172,14 @@ class Definition : public DefinitionI<dim> {
 
   std::shared_ptr<system::MPISparseMatrix> MakeSystemMatrix() const override;
 
+  std::shared_ptr<system::MPISparseMatrix> MakeSymmetricSystemMatrix() const override;
+
+  std::shared_ptr<system::MPISparseMatrix> MakeBoundarySystemMatrix(
+      bool is_symmetric) const override;
+
+  std::shared_ptr<system::MPISparseMatrix> MakeMaterialSystemMatrix(
+      int material_id) const override;
+
   std::shared_ptr<system::MPIVector> MakeSystemVector() const override;
 
   CellRange Cells() const override { return local_cells_; };
@@ -102,11 +192,59 @@ class Definition : public DefinitionI<dim> {
   dealii::IndexSet locally_owned_dofs() const override {
     return locally_owned_dofs_; }
 
+  dealii::IndexSet locally_relevant_dofs() const override {
+    return locally_relevant_dofs_; }
+
 
   const dealii::DoFHandler<dim>& dof_handler() const override {
     return dof_handler_; }
+
+  const dealii::AffineConstraints<double>& constraints() const override {
+    return constraint_matrix_; }
+
+  problem::DoFRenumberingType dof_renumbering() const {
+    return dof_renumbering_; }
   
  private:
+  //! Applies the set renumbering to the degrees of freedom
+  void RenumberDoFs();
+
+  //! Orders the locally owned cells by their lowest degree of freedom
+  void SortLocalCells();
+
+  /*! \brief Wraps a PETSc matrix of the locally owned rows, the wrapper takes
+   * ownership of the matrix. */
+  std::shared_ptr<system::MPISparseMatrix> WrapMatrix(Mat matrix) const;
+
+  //! Duplicates a matrix, sharing its nonzero pattern but not its values
+  std::shared_ptr<system::MPISparseMatrix> DuplicateMatrix(
+      const system::MPISparseMatrix& to_duplicate) const;
+
+  //! Duplicates a symmetric storage matrix and sets its symmetry options
+  std::shared_ptr<system::MPISparseMatrix> DuplicateSymmetricMatrix(
+      const system::MPISparseMatrix& to_duplicate) const;
+
+  //! Builds a PETSc matrix structure for the locally owned rows of a pattern
+  std::shared_ptr<system::MPISparseMatrix> MakeSparsityMatrix(
+      const dealii::DynamicSparsityPattern& sparsity_pattern) const;
+
+  /*! \brief Builds a symmetric (upper triangular) storage PETSc matrix
+   * structure for the locally owned rows of a pattern. */
+  std::shared_ptr<system::MPISparseMatrix> MakeSymmetricSparsityMatrix(
+      const dealii::DynamicSparsityPattern& sparsity_pattern) const;
+
+  /*! \brief Sparsity pattern of the couplings between dofs of the locally
+   * owned cells selected by a function. */
+  dealii::DynamicSparsityPattern MakeCellSparsityPattern(
+      const std::function<bool(const CellPtr<dim>&)>& include_cell) const;
+
+  /*! \brief Refines and coarsens flagged cells, interpolates moments onto
+   * the new mesh and sets up the degrees of freedom again. */
+  void ExecuteRefinement(system::moments::MomentsMap& moments);
+
+  //! Fills a vector with ghost entries for locally relevant dofs from moments
+  void FillGhostedVector(const system::moments::MomentVector& moment,
+                         system::MPIVector& to_fill) const;
 
   //! Internal owned mesh object.
   std::unique_ptr<domain::mesh::MeshI<dim>> mesh_;
@@ -138,9 +276,33 @@ class Definition : public DefinitionI<dim> {
   /*! Dynamic sparsity pattern for MPI matrices */
   dealii::DynamicSparsityPattern dynamic_sparsity_pattern_;
 
+  /*! Matrix holding the PETSc sparsity structure shared by all system matrices,
+   * built on the first call to MakeSystemMatrix */
+  mutable std::shared_ptr<system::MPISparseMatrix> sparsity_matrix_ptr_ = nullptr;
+
+  /*! Symmetric (upper triangular) storage version of the shared sparsity
+   * structure, built from the upper triangle of the dynamic sparsity pattern
+   * on the first call to MakeSymmetricSystemMatrix */
+  mutable std::shared_ptr<system::MPISparseMatrix> symmetric_sparsity_matrix_ptr_ = nullptr;
+
+  /*! Sparsity structures shared by boundary matrices, in full and symmetric
+   * storage, built on the first call to MakeBoundarySystemMatrix */
+  mutable std::shared_ptr<system::MPISparseMatrix> boundary_sparsity_matrix_ptr_ = nullptr;
+  mutable std::shared_ptr<system::MPISparseMatrix> symmetric_boundary_sparsity_matrix_ptr_ = nullptr;
+
+  /*! Sparsity structures shared by the matrices of each material, built on the
+   * first call to MakeMaterialSystemMatrix for that material */
+  mutable std::map<int, std::shared_ptr<system::MPISparseMatrix>> material_sparsity_matrix_ptrs_;
+
   /*! local cells */
   CellRange local_cells_;
 
+  /*! Renumbering of degrees of freedom and cells */
+  problem::DoFRenumberingType dof_renumbering_ = problem::DoFRenumberingType::kNone;
+
+  /*! Direction used for downstream renumbering */
+  dealii::Tensor<1, dim> downstream_direction_;
+
   /*! Discretization type */
   const problem::DiscretizationType discretization_type_;
 };
@@ -5,6 +5,7 @@
 
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
 
@@ -73,9 +74,26 @@ class DefinitionI : public utility::HasDescription {
    */
   virtual dealii::Vector<double> GetCellVector() const = 0;
 
-  /*! Get an MPI matrix suitable for the system */
+  /*! Get an MPI matrix suitable for the system, all returned matrices share the
+   * same sparsity structure but have independent values */
   virtual std::shared_ptr<bart::system::MPISparseMatrix> MakeSystemMatrix() const = 0;
 
+  /*! Get an MPI matrix suitable for a symmetric system, only the upper
+   * triangular part is stored and entries added below the diagonal are
+   * ignored */
+  virtual std::shared_ptr<bart::system::MPISparseMatrix> MakeSymmetricSystemMatrix() const = 0;
+
+  /*! Get an MPI matrix for terms on boundary faces, only couplings between the
+   * dofs of cells on the boundary are stored. If symmetric, the storage
+   * matches MakeSymmetricSystemMatrix so the two can be added */
+  virtual std::shared_ptr<bart::system::MPISparseMatrix> MakeBoundarySystemMatrix(
+      bool is_symmetric) const = 0;
+
+  /*! Get an MPI matrix for terms of a single material, only couplings between
+   * the dofs of cells with the given material id are stored */
+  virtual std::shared_ptr<bart::system::MPISparseMatrix> MakeMaterialSystemMatrix(
+      int material_id) const = 0;
+
   /*! Get an MPI vector suitable for the system */
   virtual std::shared_ptr<bart::system::MPIVector> MakeSystemVector() const = 0;
 
@@ -88,11 +106,21 @@ class DefinitionI : public utility::HasDescription {
   /*! Get locally owned degrees of freedom */
   virtual dealii::IndexSet locally_owned_dofs() const = 0;
 
+  /*! Get locally relevant degrees of freedom, locally owned degrees of freedom
+   * and those of ghost cells */
+  virtual dealii::IndexSet locally_relevant_dofs() const = 0;
+
   /*! Get internal DOF object */
   virtual const dealii::DoFHandler<dim>& dof_handler() const = 0;
 
   /*! Get total degrees of freedom */
   virtual int total_degrees_of_freedom() const = 0;
+
+  /*! Get the constraints on the degrees of freedom, such as hanging node
+   * constraints on adaptively refined meshes. Cell terms should be added to
+   * system matrices and vectors using these constraints, and solutions
+   * distributed with them after solving. */
+  virtual const dealii::AffineConstraints<double>& constraints() const = 0;
 };
 
 } // namespace domain
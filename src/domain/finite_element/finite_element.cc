@@ -45,7 +45,7 @@ bool FiniteElement<dim>::SetFace(const domain::CellPtr<dim> &to_set,
 }
 template<int dim>
 std::vector<double> FiniteElement<dim>::ValueAtQuadrature(
-    const system::moments::MomentVector moment) const {
+    const system::moments::MomentVector& moment) const {
 
   std::vector<double> return_vector(n_cell_quad_pts(), 0);
 
@@ -54,6 +54,14 @@ std::vector<double> FiniteElement<dim>::ValueAtQuadrature(
   return return_vector;
 }
 
+template<int dim>
+void FiniteElement<dim>::ValueAtQuadrature(
+    const system::moments::MomentVector& moment,
+    std::vector<double>& to_fill) const {
+  to_fill.resize(n_cell_quad_pts());
+  values_->get_function_values(moment, to_fill);
+}
+
 template<int dim>
 std::vector<double> FiniteElement<dim>::ValueAtFaceQuadrature(
     const dealii::Vector<double>& values_at_dofs) const {
@@ -74,7 +74,10 @@ class FiniteElement : public FiniteElementI<dim> {
   };
 
   std::vector<double> ValueAtQuadrature(
-      const system::moments::MomentVector moment) const override;
+      const system::moments::MomentVector& moment) const override;
+
+  void ValueAtQuadrature(const system::moments::MomentVector& moment,
+                         std::vector<double>& to_fill) const override;
 
   std::vector<double> ValueAtFaceQuadrature(
       const dealii::Vector<double>& values_at_dofs) const override;
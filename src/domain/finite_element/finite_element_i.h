@@ -136,7 +136,21 @@ class FiniteElementI {
    * \return a vector holding the value of the moment at each quadrature point.
    */
   virtual std::vector<double> ValueAtQuadrature(
-      const system::moments::MomentVector moment) const = 0;
+      const system::moments::MomentVector& moment) const = 0;
+
+  /*! \brief Fill a vector with the value of a flux moment at the interior
+   * cell quadrature points.
+   *
+   * Storage of the vector is reused, so no allocation is required if it
+   * already has one entry per cell quadrature point.
+   *
+   * \param moment flux moment to get the value of.
+   * \param to_fill vector to fill with the value at each quadrature point.
+   */
+  virtual void ValueAtQuadrature(const system::moments::MomentVector& moment,
+                                 std::vector<double>& to_fill) const {
+    to_fill = ValueAtQuadrature(moment);
+  }
 
   /*! \brief Get the value of an MPI Vector at the cell face quadrature points.
    *
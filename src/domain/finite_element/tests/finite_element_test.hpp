@@ -112,6 +112,11 @@ void FiniteElementBaseClassTest<dim>::TestValueAtQuadrature(
   auto result_vector = test_fe->ValueAtQuadrature(test_moment);
 
   EXPECT_TRUE(bart::test_helpers::AreEqual(expected_vector, result_vector));
+
+  std::vector<double> filled_vector(test_fe->n_cell_quad_pts(), 0);
+  test_fe->ValueAtQuadrature(test_moment, filled_vector);
+
+  EXPECT_TRUE(bart::test_helpers::AreEqual(expected_vector, filled_vector));
 }
 
 template <int dim>
@@ -0,0 +1,155 @@
+#include "domain/cartesian_lattice.h"
+
+#include <functional>
+#include <memory>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include "domain/definition.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "domain/mesh/tests/mesh_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::_, ::testing::NiceMock, ::testing::Return;
+
+template <typename DimensionWrapper>
+class DomainCartesianLatticeTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+  using Domain = domain::Definition<dim>;
+  using Lattice = domain::CartesianLattice<dim>;
+
+  DomainCartesianLatticeTest() : fe_(1) {}
+
+  dealii::FE_Q<dim> fe_;
+  std::shared_ptr<domain::finite_element::FiniteElementMock<dim>> fe_ptr_;
+
+  void SetUp() override;
+  /*! \brief Makes a domain on the unit hypercube, with material 1 for
+   * \f$x < 0.5\f$ and material 0 elsewhere. */
+  std::unique_ptr<Domain> MakeDomain(
+      std::function<void(dealii::Triangulation<dim>&)> fill_triangulation,
+      const int global_refinements);
+  static void SetTriangulation(dealii::Triangulation<dim>& to_fill) {
+    dealii::GridGenerator::hyper_cube(to_fill, 0, 1);
+  }
+  static void SetNonUniformTriangulation(dealii::Triangulation<dim>& to_fill) {
+    const std::vector<std::vector<double>> step_sizes(dim, {0.25, 0.75});
+    dealii::GridGenerator::subdivided_hyper_rectangle(
+        to_fill, step_sizes, dealii::Point<dim>(), UnitPoint());
+  }
+  static void SetMaterialID(dealii::Triangulation<dim>& to_fill) {
+    for (auto& cell : to_fill.active_cell_iterators())
+      cell->set_material_id(cell->center()[0] < 0.5 ? 1 : 0);
+  }
+  static dealii::Point<dim> UnitPoint() {
+    dealii::Point<dim> point;
+    for (int d = 0; d < dim; ++d)
+      point[d] = 1;
+    return point;
+  }
+};
+
+TYPED_TEST_CASE(DomainCartesianLatticeTest, bart::testing::AllDimensions);
+
+template <typename DimensionWrapper>
+void DomainCartesianLatticeTest<DimensionWrapper>::SetUp() {
+  fe_ptr_ = std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  ON_CALL(*fe_ptr_, finite_element()).WillByDefault(Return(&fe_));
+}
+
+template <typename DimensionWrapper>
+auto DomainCartesianLatticeTest<DimensionWrapper>::MakeDomain(
+    std::function<void(dealii::Triangulation<dim>&)> fill_triangulation,
+    const int global_refinements) -> std::unique_ptr<Domain> {
+  auto mesh_ptr = std::make_unique<NiceMock<domain::mesh::MeshMock<dim>>>();
+  ON_CALL(*mesh_ptr, has_material_mapping()).WillByDefault(Return(true));
+  ON_CALL(*mesh_ptr, FillTriangulation(_))
+      .WillByDefault(::testing::Invoke(fill_triangulation));
+  ON_CALL(*mesh_ptr, FillMaterialID(_))
+      .WillByDefault(::testing::Invoke(SetMaterialID));
+  auto domain_ptr = std::make_unique<Domain>(std::move(mesh_ptr), fe_ptr_);
+  domain_ptr->SetUpMesh(global_refinements);
+  domain_ptr->SetUpDOF();
+  return domain_ptr;
+}
+
+TYPED_TEST(DomainCartesianLatticeTest, Constructor) {
+  constexpr int dim = this->dim;
+  const int n_cells = 8;
+  auto domain_ptr = this->MakeDomain(TestFixture::SetTriangulation, 3);
+  typename TestFixture::Lattice test_lattice(*domain_ptr);
+
+  int expected_nodes = 1, expected_cell_classes = 4, expected_rows = 1;
+  for (int d = 0; d < dim; ++d) {
+    EXPECT_EQ(test_lattice.n_cells().at(d), n_cells);
+    expected_nodes *= n_cells + 1;
+    if (d > 0) {
+      // Cells on the lower boundary, in the interior and on the upper boundary
+      expected_cell_classes *= 3;
+      expected_rows *= n_cells;
+    }
+  }
+  EXPECT_EQ(test_lattice.n_nodes(), expected_nodes);
+  EXPECT_EQ(test_lattice.n_nodes(), domain_ptr->total_degrees_of_freedom());
+  // Along x: boundary and interior cells of each material
+  EXPECT_EQ(test_lattice.cell_classes().size(), expected_cell_classes);
+  ASSERT_EQ(test_lattice.runs().size(), 4 * expected_rows);
+
+  int total_cells = 0;
+  for (const auto& run : test_lattice.runs()) {
+    const auto& cell_class = test_lattice.cell_classes().at(run.cell_class);
+    const bool is_left = run.first_node % (n_cells + 1) < n_cells / 2;
+    EXPECT_EQ(cell_class.material_id, is_left ? 1 : 0);
+    EXPECT_EQ(cell_class.cell->material_id(), cell_class.material_id);
+    total_cells += run.n_cells;
+  }
+  EXPECT_EQ(total_cells, domain_ptr->Cells().size());
+  EXPECT_EQ(test_lattice.node_offsets().at(0), 0);
+  EXPECT_EQ(test_lattice.node_offsets().at(1), 1);
+}
+
+TYPED_TEST(DomainCartesianLatticeTest, LatticeOrdering) {
+  constexpr int dim = this->dim;
+  const int n_cells = 4;
+  auto domain_ptr = this->MakeDomain(TestFixture::SetTriangulation, 2);
+  typename TestFixture::Lattice test_lattice(*domain_ptr);
+
+  // Dof vector is set to the x coordinate of each node
+  auto dof_vector_ptr = domain_ptr->MakeSystemVector();
+  std::vector<dealii::types::global_dof_index> cell_dofs(
+      dealii::GeometryInfo<dim>::vertices_per_cell);
+  for (const auto& cell : domain_ptr->Cells()) {
+    cell->get_dof_indices(cell_dofs);
+    for (unsigned int v = 0; v < cell_dofs.size(); ++v)
+      (*dof_vector_ptr)[cell_dofs[v]] = cell->vertex(v)[0];
+  }
+  dof_vector_ptr->compress(dealii::VectorOperation::insert);
+
+  dealii::Vector<double> lattice_vector;
+  test_lattice.ToLattice(*dof_vector_ptr, lattice_vector);
+  ASSERT_EQ(lattice_vector.size(), test_lattice.n_nodes());
+  for (unsigned int node = 0; node < lattice_vector.size(); ++node) {
+    EXPECT_NEAR(lattice_vector[node],
+                static_cast<double>(node % (n_cells + 1)) / n_cells, 1e-12);
+  }
+
+  auto result_ptr = domain_ptr->MakeSystemVector();
+  test_lattice.FromLattice(lattice_vector, *result_ptr);
+  for (unsigned int dof = 0; dof < result_ptr->size(); ++dof)
+    EXPECT_DOUBLE_EQ((*result_ptr)[dof], (*dof_vector_ptr)[dof]);
+}
+
+TYPED_TEST(DomainCartesianLatticeTest, NonUniformMesh) {
+  auto domain_ptr = this->MakeDomain(TestFixture::SetNonUniformTriangulation, 1);
+  EXPECT_ANY_THROW({
+    typename TestFixture::Lattice test_lattice(*domain_ptr);
+  });
+}
+
+} // namespace
@@ -3,6 +3,7 @@
 
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
 
@@ -27,6 +28,12 @@ class DefinitionMock : public DefinitionI<dim> {
   MOCK_METHOD(dealii::Vector<double>, GetCellVector, (), (override, const));
   MOCK_METHOD(std::shared_ptr<bart::system::MPISparseMatrix>, MakeSystemMatrix,
       (), (const, override));
+  MOCK_METHOD(std::shared_ptr<bart::system::MPISparseMatrix>,
+              MakeSymmetricSystemMatrix, (), (const, override));
+  MOCK_METHOD(std::shared_ptr<bart::system::MPISparseMatrix>,
+              MakeBoundarySystemMatrix, (bool), (const, override));
+  MOCK_METHOD(std::shared_ptr<bart::system::MPISparseMatrix>,
+              MakeMaterialSystemMatrix, (int), (const, override));
   MOCK_METHOD(std::shared_ptr<bart::system::MPIVector>, MakeSystemVector,
               (), (const, override));
   MOCK_METHOD(typename DefinitionI<dim>::CellRange, Cells, (), (override, const));
@@ -34,6 +41,9 @@ class DefinitionMock : public DefinitionI<dim> {
   MOCK_METHOD(int, total_degrees_of_freedom, (), (override, const));
   MOCK_METHOD(const dealii::DoFHandler<dim>&, dof_handler, (), (override, const));
   MOCK_METHOD(dealii::IndexSet, locally_owned_dofs, (), (override, const));
+  MOCK_METHOD(dealii::IndexSet, locally_relevant_dofs, (), (override, const));
+  MOCK_METHOD(const dealii::AffineConstraints<double>&, constraints, (),
+              (override, const));
 
   };
 
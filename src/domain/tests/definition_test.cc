@@ -1,12 +1,17 @@
 #include "domain/definition.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <memory>
 
 #include <gtest/gtest.h>
 
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_tools.h>
 #include <deal.II/grid/tria.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/grid/grid_generator.h>
 
@@ -124,6 +129,12 @@ TYPED_TEST(DomainDefinitionDOFTest, SetUpDOFTestMPI) {
   EXPECT_EQ(test_domain.total_degrees_of_freedom(),
             test_domain.dof_handler().n_dofs());
 
+  const auto locally_owned_dofs = test_domain.locally_owned_dofs();
+  const auto locally_relevant_dofs = test_domain.locally_relevant_dofs();
+  EXPECT_EQ(locally_relevant_dofs.size(), locally_owned_dofs.size());
+  for (const auto dof : locally_owned_dofs)
+    EXPECT_TRUE(locally_relevant_dofs.is_element(dof));
+
   int total_cells = 0;
   for (auto cell = test_domain.dof_handler().begin_active();
        cell != test_domain.dof_handler().end(); ++cell) {
@@ -165,6 +176,309 @@ TYPED_TEST(DomainDefinitionDOFTest, SystemMatrixMPI) {
   EXPECT_EQ(system_matrix_ptr->m(), test_domain.locally_owned_dofs().size());
 }
 
+TYPED_TEST(DomainDefinitionDOFTest, SystemMatrixSharedSparsityMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Definition<this->dim> test_domain(std::move(this->nice_mesh_ptr),
+                                                  this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  auto first_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto second_matrix_ptr = test_domain.MakeSystemMatrix();
+
+  ASSERT_NE(first_matrix_ptr, nullptr);
+  ASSERT_NE(second_matrix_ptr, nullptr);
+  ASSERT_NE(first_matrix_ptr, second_matrix_ptr);
+  EXPECT_EQ(second_matrix_ptr->n(), test_domain.locally_owned_dofs().size());
+  EXPECT_EQ(second_matrix_ptr->m(), test_domain.locally_owned_dofs().size());
+  EXPECT_EQ(first_matrix_ptr->n_nonzero_elements(),
+            second_matrix_ptr->n_nonzero_elements());
+
+  // Values are not shared between matrices
+  const auto first_dof = *test_domain.locally_owned_dofs().begin();
+  first_matrix_ptr->set(first_dof, first_dof, 2.0);
+  first_matrix_ptr->compress(dealii::VectorOperation::insert);
+  second_matrix_ptr->compress(dealii::VectorOperation::insert);
+  EXPECT_DOUBLE_EQ((*first_matrix_ptr)(first_dof, first_dof), 2.0);
+  EXPECT_DOUBLE_EQ((*second_matrix_ptr)(first_dof, first_dof), 0.0);
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, SymmetricSystemMatrixMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+  EXPECT_CALL(*this->fe_ptr, dofs_per_cell())
+      .WillRepeatedly(::testing::Return(this->fe.dofs_per_cell));
+
+  bart::domain::Definition<this->dim> test_domain(std::move(this->nice_mesh_ptr),
+                                                  this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  auto full_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto symmetric_matrix_ptr = test_domain.MakeSymmetricSystemMatrix();
+  ASSERT_NE(symmetric_matrix_ptr, nullptr);
+  EXPECT_EQ(symmetric_matrix_ptr->n(), test_domain.locally_owned_dofs().size());
+  EXPECT_EQ(symmetric_matrix_ptr->m(), test_domain.locally_owned_dofs().size());
+
+  // Stamp the same symmetric cell matrix into both matrices
+  auto cell_matrix = test_domain.GetCellMatrix();
+  for (unsigned int i = 0; i < cell_matrix.m(); ++i) {
+    for (unsigned int j = 0; j < cell_matrix.n(); ++j)
+      cell_matrix(i, j) = 1.0 + i + j;
+  }
+  std::vector<dealii::types::global_dof_index> local_dof_indices(
+      cell_matrix.m());
+  for (const auto& cell : test_domain.Cells()) {
+    cell->get_dof_indices(local_dof_indices);
+    full_matrix_ptr->add(local_dof_indices, local_dof_indices, cell_matrix);
+    symmetric_matrix_ptr->add(local_dof_indices, local_dof_indices, cell_matrix);
+  }
+  full_matrix_ptr->compress(dealii::VectorOperation::add);
+  symmetric_matrix_ptr->compress(dealii::VectorOperation::add);
+
+  auto ones_ptr = test_domain.MakeSystemVector();
+  auto full_result_ptr = test_domain.MakeSystemVector();
+  auto symmetric_result_ptr = test_domain.MakeSystemVector();
+  *ones_ptr = 1.0;
+  full_matrix_ptr->vmult(*full_result_ptr, *ones_ptr);
+  symmetric_matrix_ptr->vmult(*symmetric_result_ptr, *ones_ptr);
+
+  for (const auto dof : test_domain.locally_owned_dofs())
+    EXPECT_NEAR((*symmetric_result_ptr)(dof), (*full_result_ptr)(dof), 1e-12);
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, SystemMatrixMultiRankMPIOnly) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+  EXPECT_CALL(*this->fe_ptr, dofs_per_cell())
+      .WillRepeatedly(::testing::Return(this->fe.dofs_per_cell));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+  const auto& locally_owned_dofs = test_domain.locally_owned_dofs();
+
+  // Reference matrix built directly from a sparsity pattern, the 1D
+  // triangulation is not distributed and all cells are available
+  const auto n_dofs = test_domain.dof_handler().n_dofs();
+  dealii::DynamicSparsityPattern sparsity_pattern(n_dofs, n_dofs);
+  dealii::DoFTools::make_sparsity_pattern(test_domain.dof_handler(),
+                                          sparsity_pattern);
+  if (dim > 1) {
+    dealii::SparsityTools::distribute_sparsity_pattern(
+        sparsity_pattern, locally_owned_dofs, MPI_COMM_WORLD,
+        test_domain.locally_relevant_dofs());
+  }
+  system::MPISparseMatrix reference_matrix;
+  reference_matrix.reinit(locally_owned_dofs, locally_owned_dofs,
+                          sparsity_pattern, MPI_COMM_WORLD);
+
+  auto full_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto symmetric_matrix_ptr = test_domain.MakeSymmetricSystemMatrix();
+  for (const auto& matrix_ptr : {full_matrix_ptr, symmetric_matrix_ptr}) {
+    int comparison;
+    MPI_Comm_compare(matrix_ptr->get_mpi_communicator(), MPI_COMM_WORLD,
+                     &comparison);
+    EXPECT_NE(comparison, MPI_UNEQUAL);
+    const auto [first_row, last_row] = matrix_ptr->local_range();
+    EXPECT_EQ(last_row - first_row, locally_owned_dofs.n_elements());
+    EXPECT_TRUE(locally_owned_dofs.is_element(first_row));
+  }
+
+  // Stamp the same symmetric cell matrix into all matrices, across ranks
+  auto cell_matrix = test_domain.GetCellMatrix();
+  for (unsigned int i = 0; i < cell_matrix.m(); ++i) {
+    for (unsigned int j = 0; j < cell_matrix.n(); ++j)
+      cell_matrix(i, j) = 1.0 + i + j;
+  }
+  std::vector<dealii::types::global_dof_index> local_dof_indices(
+      cell_matrix.m());
+  for (const auto& cell : test_domain.Cells()) {
+    cell->get_dof_indices(local_dof_indices);
+    reference_matrix.add(local_dof_indices, local_dof_indices, cell_matrix);
+    full_matrix_ptr->add(local_dof_indices, local_dof_indices, cell_matrix);
+    symmetric_matrix_ptr->add(local_dof_indices, local_dof_indices, cell_matrix);
+  }
+  reference_matrix.compress(dealii::VectorOperation::add);
+  full_matrix_ptr->compress(dealii::VectorOperation::add);
+  symmetric_matrix_ptr->compress(dealii::VectorOperation::add);
+
+  auto source_ptr = test_domain.MakeSystemVector();
+  auto reference_result_ptr = test_domain.MakeSystemVector();
+  auto full_result_ptr = test_domain.MakeSystemVector();
+  auto symmetric_result_ptr = test_domain.MakeSystemVector();
+  for (const auto dof : locally_owned_dofs)
+    (*source_ptr)(dof) = std::sin(1.0 + dof);
+  source_ptr->compress(dealii::VectorOperation::insert);
+  reference_matrix.vmult(*reference_result_ptr, *source_ptr);
+  full_matrix_ptr->vmult(*full_result_ptr, *source_ptr);
+  symmetric_matrix_ptr->vmult(*symmetric_result_ptr, *source_ptr);
+
+  for (const auto dof : locally_owned_dofs) {
+    EXPECT_NEAR((*full_result_ptr)(dof), (*reference_result_ptr)(dof), 1e-12);
+    EXPECT_NEAR((*symmetric_result_ptr)(dof), (*reference_result_ptr)(dof),
+                1e-12);
+  }
+  // Symmetric storage holds only the upper triangle
+  EXPECT_LT(symmetric_matrix_ptr->n_nonzero_elements(),
+            full_matrix_ptr->n_nonzero_elements());
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, BoundarySystemMatrixMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+  EXPECT_CALL(*this->fe_ptr, dofs_per_cell())
+      .WillRepeatedly(::testing::Return(this->fe.dofs_per_cell));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+  const auto& locally_owned_dofs = test_domain.locally_owned_dofs();
+
+  auto full_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto boundary_matrix_ptr = test_domain.MakeBoundarySystemMatrix(false);
+  auto symmetric_full_matrix_ptr = test_domain.MakeSymmetricSystemMatrix();
+  auto symmetric_boundary_matrix_ptr = test_domain.MakeBoundarySystemMatrix(true);
+  for (const auto& matrix_ptr : {boundary_matrix_ptr,
+                                 symmetric_boundary_matrix_ptr}) {
+    const auto [first_row, last_row] = matrix_ptr->local_range();
+    EXPECT_EQ(last_row - first_row, locally_owned_dofs.n_elements());
+  }
+
+  // Stamp the same symmetric cell matrix on boundary cells only
+  auto cell_matrix = test_domain.GetCellMatrix();
+  for (unsigned int i = 0; i < cell_matrix.m(); ++i) {
+    for (unsigned int j = 0; j < cell_matrix.n(); ++j)
+      cell_matrix(i, j) = 1.0 + i + j;
+  }
+  std::vector<dealii::types::global_dof_index> local_dof_indices(
+      cell_matrix.m());
+  for (const auto& cell : test_domain.Cells()) {
+    if (!cell->at_boundary())
+      continue;
+    cell->get_dof_indices(local_dof_indices);
+    for (const auto& matrix_ptr : {full_matrix_ptr, boundary_matrix_ptr,
+                                   symmetric_full_matrix_ptr,
+                                   symmetric_boundary_matrix_ptr})
+      matrix_ptr->add(local_dof_indices, local_dof_indices, cell_matrix);
+  }
+  for (const auto& matrix_ptr : {full_matrix_ptr, boundary_matrix_ptr,
+                                 symmetric_full_matrix_ptr,
+                                 symmetric_boundary_matrix_ptr})
+    matrix_ptr->compress(dealii::VectorOperation::add);
+
+  auto source_ptr = test_domain.MakeSystemVector();
+  for (const auto dof : locally_owned_dofs)
+    (*source_ptr)(dof) = std::sin(1.0 + dof);
+  source_ptr->compress(dealii::VectorOperation::insert);
+  auto reference_result_ptr = test_domain.MakeSystemVector();
+  full_matrix_ptr->vmult(*reference_result_ptr, *source_ptr);
+  for (const auto& matrix_ptr : {boundary_matrix_ptr, symmetric_boundary_matrix_ptr}) {
+    auto result_ptr = test_domain.MakeSystemVector();
+    matrix_ptr->vmult(*result_ptr, *source_ptr);
+    for (const auto dof : locally_owned_dofs)
+      EXPECT_NEAR((*result_ptr)(dof), (*reference_result_ptr)(dof), 1e-12);
+  }
+
+  // Boundary matrices can be added to system matrices of the same storage
+  symmetric_full_matrix_ptr->add(1.0, *symmetric_boundary_matrix_ptr);
+  auto symmetric_result_ptr = test_domain.MakeSystemVector();
+  symmetric_full_matrix_ptr->vmult(*symmetric_result_ptr, *source_ptr);
+  for (const auto dof : locally_owned_dofs) {
+    EXPECT_NEAR((*symmetric_result_ptr)(dof), 2 * (*reference_result_ptr)(dof),
+                1e-12);
+  }
+
+  // Couplings of interior cells are not stored
+  EXPECT_LT(boundary_matrix_ptr->n_nonzero_elements(),
+            full_matrix_ptr->n_nonzero_elements());
+  EXPECT_LT(symmetric_boundary_matrix_ptr->n_nonzero_elements(),
+            boundary_matrix_ptr->n_nonzero_elements());
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, MaterialSystemMatrixMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke([](dealii::Triangulation<dim>& to_fill) {
+        dealii::GridGenerator::subdivided_hyper_cube(to_fill, 2, -1, 1); }));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillMaterialID(_))
+      .WillOnce(::testing::Invoke([](dealii::Triangulation<dim>& to_fill) {
+        for (auto& cell : to_fill.active_cell_iterators())
+          cell->set_material_id(cell->center()[0] < 0 ? 1 : 0); }));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+  EXPECT_CALL(*this->fe_ptr, dofs_per_cell())
+      .WillRepeatedly(::testing::Return(this->fe.dofs_per_cell));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+  const auto& locally_owned_dofs = test_domain.locally_owned_dofs();
+
+  auto cell_matrix = test_domain.GetCellMatrix();
+  for (unsigned int i = 0; i < cell_matrix.m(); ++i) {
+    for (unsigned int j = 0; j < cell_matrix.n(); ++j)
+      cell_matrix(i, j) = 1.0 + i + j;
+  }
+  std::vector<dealii::types::global_dof_index> local_dof_indices(
+      cell_matrix.m());
+  auto source_ptr = test_domain.MakeSystemVector();
+  for (const auto dof : locally_owned_dofs)
+    (*source_ptr)(dof) = std::sin(1.0 + dof);
+  source_ptr->compress(dealii::VectorOperation::insert);
+
+  // Stamp the cells of each material into a full and a material matrix
+  for (const int material_id : {0, 1}) {
+    auto full_matrix_ptr = test_domain.MakeSystemMatrix();
+    auto material_matrix_ptr = test_domain.MakeMaterialSystemMatrix(material_id);
+    for (const auto& cell : test_domain.Cells()) {
+      if (static_cast<int>(cell->material_id()) != material_id)
+        continue;
+      cell->get_dof_indices(local_dof_indices);
+      full_matrix_ptr->add(local_dof_indices, local_dof_indices, cell_matrix);
+      material_matrix_ptr->add(local_dof_indices, local_dof_indices,
+                               cell_matrix);
+    }
+    full_matrix_ptr->compress(dealii::VectorOperation::add);
+    material_matrix_ptr->compress(dealii::VectorOperation::add);
+
+    auto expected_ptr = test_domain.MakeSystemVector();
+    auto result_ptr = test_domain.MakeSystemVector();
+    full_matrix_ptr->vmult(*expected_ptr, *source_ptr);
+    material_matrix_ptr->vmult(*result_ptr, *source_ptr);
+    for (const auto dof : locally_owned_dofs)
+      EXPECT_NEAR((*result_ptr)(dof), (*expected_ptr)(dof), 1e-12);
+    // Couplings of cells of the other material are not stored
+    EXPECT_LT(material_matrix_ptr->n_nonzero_elements(),
+              full_matrix_ptr->n_nonzero_elements());
+  }
+}
+
 TYPED_TEST(DomainDefinitionDOFTest, SystemVectorMPI) {
   EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
       WillOnce(::testing::Return(true));
@@ -184,4 +498,303 @@ TYPED_TEST(DomainDefinitionDOFTest, SystemVectorMPI) {
   EXPECT_EQ(system_vector_ptr->size(), test_domain.locally_owned_dofs().size());
 }
 
-} // namespace
\ No newline at end of file
+TYPED_TEST(DomainDefinitionDOFTest, SetUpDOFRenumberingMPI) {
+  constexpr int dim = this->dim;
+  using Renumbering = problem::DoFRenumberingType;
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  const unsigned int expected_n_dofs = std::pow(
+      std::pow(2, this->global_refinements_) + 1, dim);
+  dealii::Tensor<1, dim> direction;
+  direction[0] = 1;
+
+  for (const auto renumbering : {Renumbering::kNone,
+                                 Renumbering::kCuthillMcKee,
+                                 Renumbering::kHilbert,
+                                 Renumbering::kDownstream}) {
+    auto mesh_ptr = std::make_unique<NiceMock<domain::mesh::MeshMock<dim>>>();
+    ON_CALL(*mesh_ptr, has_material_mapping())
+        .WillByDefault(::testing::Return(true));
+    ON_CALL(*mesh_ptr, FillTriangulation(_))
+        .WillByDefault(::testing::Invoke(this->SetTriangulation));
+
+    bart::domain::Definition<dim> test_domain(std::move(mesh_ptr),
+                                              this->fe_ptr);
+    test_domain.SetDoFRenumbering(renumbering, direction);
+    EXPECT_EQ(test_domain.dof_renumbering(), renumbering);
+    test_domain.SetUpMesh(this->global_refinements_);
+    test_domain.SetUpDOF();
+
+    ASSERT_EQ(test_domain.dof_handler().n_dofs(), expected_n_dofs);
+
+    // Every locally owned cell is traversed once
+    int total_cells = 0;
+    for (const auto& cell : test_domain.dof_handler().active_cell_iterators()) {
+      if (cell->is_locally_owned())
+        ++total_cells;
+    }
+    EXPECT_EQ(test_domain.Cells().size(), total_cells);
+
+    if (renumbering != Renumbering::kNone) {
+      // Cells are traversed in order of their lowest degree of freedom
+      std::vector<dealii::types::global_dof_index> cell_dofs(this->fe.dofs_per_cell);
+      dealii::types::global_dof_index last_lowest_dof = 0;
+      for (const auto& cell : test_domain.Cells()) {
+        cell->get_dof_indices(cell_dofs);
+        const auto lowest_dof = *std::min_element(cell_dofs.begin(),
+                                                  cell_dofs.end());
+        EXPECT_GE(lowest_dof, last_lowest_dof);
+        last_lowest_dof = lowest_dof;
+      }
+    }
+  }
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, SetDoFRenumberingBadDirection) {
+  bart::domain::Definition<this->dim> test_domain(std::move(this->nice_mesh_ptr),
+                                                  this->fe_ptr);
+  EXPECT_ANY_THROW({
+    test_domain.SetDoFRenumbering(problem::DoFRenumberingType::kDownstream);
+  });
+  EXPECT_NO_THROW({
+    test_domain.SetDoFRenumbering(problem::DoFRenumberingType::kCuthillMcKee);
+  });
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, EstimateErrorMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  const int n_dofs = test_domain.dof_handler().n_dofs();
+  const int n_cells = test_domain.dof_handler().get_triangulation().n_active_cells();
+
+  // Constant fluxes have no gradient jumps across faces
+  system::moments::MomentsMap moments;
+  moments[{0, 0, 0}] = dealii::Vector<double>(n_dofs);
+  moments[{0, 0, 0}] = 1.0;
+  moments[{1, 0, 0}] = dealii::Vector<double>(n_dofs);
+  moments[{1, 0, 0}] = 2.0;
+
+  auto cell_error = test_domain.EstimateError(moments);
+  ASSERT_EQ(cell_error.size(), n_cells);
+  EXPECT_NEAR(cell_error.l2_norm(), 0, 1e-6);
+
+  // Higher moments are not used to estimate the error
+  moments[{0, 1, 0}] = dealii::Vector<double>(n_dofs);
+  for (int i = 0; i < n_dofs; ++i)
+    moments[{0, 1, 0}][i] = i % 2;
+  cell_error = test_domain.EstimateError(moments);
+  EXPECT_NEAR(cell_error.l2_norm(), 0, 1e-6);
+
+  for (int i = 0; i < n_dofs; ++i)
+    moments[{1, 0, 0}][i] = i % 2;
+  cell_error = test_domain.EstimateError(moments);
+  EXPECT_GT(cell_error.l2_norm(), 0);
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, RefineAndCoarsenMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  const int initial_n_dofs = test_domain.total_degrees_of_freedom();
+  const auto& triangulation = test_domain.dof_handler().get_triangulation();
+  const int initial_n_cells = triangulation.n_active_cells();
+
+  system::moments::MomentsMap moments;
+  moments[{0, 0, 0}] = dealii::Vector<double>(initial_n_dofs);
+  moments[{0, 0, 0}] = 1.0;
+  moments[{1, 0, 0}] = dealii::Vector<double>(initial_n_dofs);
+  moments[{1, 0, 0}] = 2.0;
+
+  dealii::Vector<float> cell_error(initial_n_cells);
+  for (int cell = 0; cell < initial_n_cells; ++cell)
+    cell_error[cell] = cell;
+
+  test_domain.RefineAndCoarsen(cell_error, 0.3, 0.0, moments);
+
+  EXPECT_GT(triangulation.n_active_cells(), initial_n_cells);
+  EXPECT_GT(test_domain.dof_handler().n_dofs(), initial_n_dofs);
+  EXPECT_EQ(test_domain.total_degrees_of_freedom(),
+            test_domain.dof_handler().n_dofs());
+
+  // Cells are not duplicated when degrees of freedom are set up again
+  int total_cells = 0;
+  for (const auto& cell : test_domain.dof_handler().active_cell_iterators()) {
+    if (cell->is_locally_owned())
+      ++total_cells;
+  }
+  EXPECT_EQ(test_domain.Cells().size(), total_cells);
+
+  // Constant moments are interpolated exactly
+  for (const auto& [index, moment] : moments) {
+    ASSERT_EQ(moment.size(), test_domain.dof_handler().n_dofs());
+    const double expected_value = index.at(0) == 0 ? 1.0 : 2.0;
+    for (const auto value : moment)
+      EXPECT_NEAR(value, expected_value, 1e-12);
+  }
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, RefineAndCoarsenBadParameters) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  bart::domain::Definition<this->dim> test_domain(std::move(this->nice_mesh_ptr),
+                                                  this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  const int n_cells =
+      test_domain.dof_handler().get_triangulation().n_active_cells();
+  system::moments::MomentsMap moments;
+
+  dealii::Vector<float> bad_cell_error(n_cells + 1);
+  EXPECT_ANY_THROW({
+    test_domain.RefineAndCoarsen(bad_cell_error, 0.3, 0.0, moments);
+  });
+  dealii::Vector<float> cell_error(n_cells);
+  EXPECT_ANY_THROW({
+    test_domain.RefineAndCoarsen(cell_error, 0.8, 0.3, moments);
+  });
+  EXPECT_ANY_THROW({
+    test_domain.RefineAndCoarsen(cell_error, -0.1, 0.0, moments);
+  });
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, RefineGlobalMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_ - 1);
+  test_domain.SetUpDOF();
+
+  system::moments::MomentsMap moments;
+  moments[{0, 0, 0}] = dealii::Vector<double>(
+      test_domain.total_degrees_of_freedom());
+  moments[{0, 0, 0}] = 3.0;
+
+  test_domain.RefineGlobal(moments);
+
+  // Same mesh as global refinement during set up
+  const unsigned int expected_n_dofs = std::pow(
+      std::pow(2, this->global_refinements_) + 1, dim);
+  EXPECT_EQ(test_domain.dof_handler().n_dofs(), expected_n_dofs);
+  EXPECT_EQ(test_domain.total_degrees_of_freedom(), expected_n_dofs);
+
+  int total_cells = 0;
+  for (const auto& cell : test_domain.dof_handler().active_cell_iterators()) {
+    if (cell->is_locally_owned())
+      ++total_cells;
+  }
+  EXPECT_EQ(test_domain.Cells().size(), total_cells);
+
+  const auto& moment = moments.at({0, 0, 0});
+  ASSERT_EQ(moment.size(), expected_n_dofs);
+  for (const auto value : moment)
+    EXPECT_NEAR(value, 3.0, 1e-12);
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, MakeProlongationMatricesMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  if (dim == 1 && dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) > 1) {
+    EXPECT_ANY_THROW(test_domain.MakeProlongationMatrices());
+    return;
+  }
+
+  auto prolongation_matrices = test_domain.MakeProlongationMatrices();
+  ASSERT_EQ(prolongation_matrices.size(), this->global_refinements_);
+
+  for (int level = 0; level < this->global_refinements_; ++level) {
+    auto& prolongation = *prolongation_matrices.at(level);
+    const unsigned int expected_coarse_dofs = std::pow(std::pow(2, level) + 1, dim);
+    const unsigned int expected_fine_dofs = std::pow(std::pow(2, level + 1) + 1, dim);
+    EXPECT_EQ(prolongation.m(), expected_fine_dofs);
+    EXPECT_EQ(prolongation.n(), expected_coarse_dofs);
+
+    // Prolongation of a constant function is exact
+    system::MPIVector coarse_vector(prolongation.locally_owned_domain_indices(),
+                                    MPI_COMM_WORLD);
+    system::MPIVector fine_vector(prolongation.locally_owned_range_indices(),
+                                  MPI_COMM_WORLD);
+    coarse_vector = 2.0;
+    prolongation.vmult(fine_vector, coarse_vector);
+    for (const auto dof : prolongation.locally_owned_range_indices())
+      EXPECT_NEAR(fine_vector[dof], 2.0, 1e-12);
+  }
+
+  // Rows of the finest prolongation are the active degrees of freedom
+  EXPECT_EQ(prolongation_matrices.back()->locally_owned_range_indices(),
+            test_domain.locally_owned_dofs());
+}
+
+TYPED_TEST(DomainDefinitionDOFTest, MakeProlongationMatricesNonUniformMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).
+      WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_))
+      .WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element())
+      .WillRepeatedly(::testing::Return(&this->fe));
+
+  bart::domain::Definition<dim> test_domain(std::move(this->nice_mesh_ptr),
+                                            this->fe_ptr);
+  test_domain.SetUpMesh(0);
+  test_domain.SetUpDOF();
+  EXPECT_ANY_THROW(test_domain.MakeProlongationMatrices());
+
+  system::moments::MomentsMap moments;
+  moments[{0, 0, 0}] = dealii::Vector<double>(
+      test_domain.total_degrees_of_freedom());
+  test_domain.RefineGlobal(moments);
+  dealii::Vector<float> cell_error(
+      test_domain.dof_handler().get_triangulation().n_active_cells());
+  for (unsigned int cell = 0; cell < cell_error.size(); ++cell)
+    cell_error[cell] = cell + 1;
+  test_domain.RefineAndCoarsen(cell_error, 0.5, 0, moments);
+  EXPECT_ANY_THROW(test_domain.MakeProlongationMatrices());
+}
+
+} // namespace
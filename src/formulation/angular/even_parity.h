@@ -0,0 +1,106 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_H_
+#define BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_H_
+
+#include "data/cross_sections.h"
+#include "domain/finite_element/finite_element_i.h"
+#include "formulation/angular/even_parity_i.h"
+#include "quadrature/quadrature_set_i.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Default implementation of the even-parity formulation.
+ *
+ * Only continuous finite elements are supported, as no interior face terms are
+ * integrated.
+ */
+template <int dim>
+class EvenParity : public EvenParityI<dim> {
+ public:
+  EvenParity(
+      std::shared_ptr<domain::finite_element::FiniteElementI<dim>>,
+      std::shared_ptr<data::CrossSections>,
+      std::shared_ptr<quadrature::QuadratureSetI<dim>>);
+
+  void FillBoundaryBilinearTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) override;
+
+  void FillCellStreamingTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::EnergyGroup group_number) override;
+
+  void FillCellCollisionTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) override;
+
+  void FillCellFixedSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) override;
+
+  void FillCellScatteringSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) override;
+
+  void FillCellFissionSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) override;
+
+  // Dependency getters
+  domain::finite_element::FiniteElementI<dim>* finite_element_ptr() const {
+    return finite_element_ptr_.get(); }
+  data::CrossSections* cross_sections_ptr() const {
+    return cross_sections_ptr_.get(); }
+  quadrature::QuadratureSetI<dim>* quadrature_set_ptr() const {
+    return quadrature_set_ptr_.get(); }
+
+ protected:
+  // Validation Functions
+  void ValidateAndSetCell(const domain::CellPtr<dim>& cell_ptr,
+                          std::string called_function_name);
+  void ValidateAndSetFace(const domain::CellPtr<dim>& cell_ptr,
+                          const domain::FaceIndex face_number,
+                          std::string called_function_name);
+  void ValidateMatrixSize(const FullMatrix&, std::string called_function_name);
+  void ValidateVectorSize(const Vector&, std::string called_function_name);
+
+  // Combined implementation functions
+  void FillCellSourceTerm(Vector& to_fill, const std::vector<double>& source);
+
+  // Dependencies
+  std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr_;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr_;
+  std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr_;
+  // Geometric properties
+  const int cell_degrees_of_freedom_ = 0; //!< Degrees of freedom per cell
+  const int cell_quadrature_points_ = 0; //!< Quadrature points per cell
+  const int face_quadrature_points_ = 0; //!< Quadrature points per face
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} //namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_H_
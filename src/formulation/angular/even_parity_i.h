@@ -0,0 +1,149 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_I_H_
+#define BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_I_H_
+
+#include <memory>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/dofs/dof_accessor.h>
+
+#include "domain/domain_types.h"
+#include "formulation/formulation_types.h"
+#include "quadrature/quadrature_point_i.h"
+#include "system/system_types.h"
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Interface for even-parity transport formulations.
+ *
+ * The even-parity angular flux is the average of the angular flux in a
+ * direction and its reflection across the origin,
+ * \f[
+ * \psi^+(\vec{r}, \vec{\Omega}) = \frac{1}{2}\left[\psi(\vec{r}, \vec{\Omega})
+ * + \psi(\vec{r}, -\vec{\Omega})\right]
+ * \f]
+ * For isotropic sources, it satisfies the second-order equation
+ * \f[
+ * -\vec{\Omega}\cdot\nabla\left(\frac{1}{\sigma_t(\vec{r})}\vec{\Omega}\cdot
+ * \nabla\psi^+(\vec{r})\right) + \sigma_t(\vec{r})\psi^+(\vec{r}) = q(\vec{r})
+ * \f]
+ * which is the same for \f$\vec{\Omega}\f$ and \f$-\vec{\Omega}\f$, so only
+ * half of the angles of a quadrature set must be solved. The scalar flux is
+ * the integral of the even-parity angular flux over all angles, so the
+ * quadrature set used must contain one direction of each pair of reflections,
+ * with the weight of both (see
+ * quadrature::factory::FillEvenParityQuadratureSet).
+ *
+ * The weak form, with vacuum boundaries, is
+ * \f[
+ * \int_V\frac{1}{\sigma_t}(\vec{\Omega}\cdot\nabla\psi^+)
+ * (\vec{\Omega}\cdot\nabla\varphi_i)dV
+ * + \int_V\sigma_t\psi^+\varphi_i dV
+ * + \int_{\partial V}|\hat{n}\cdot\vec{\Omega}|\psi^+\varphi_i dS
+ * = \int_V q\varphi_i dV
+ * \f]
+ *
+ * Sources are isotropic, so the source terms do not depend on angle.
+ */
+template <int dim>
+class EvenParityI {
+ public:
+  virtual ~EvenParityI() = default;
+
+  /*! \brief Integrates the bilinear vacuum boundary term and fills a given
+   * matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K} = \mathbf{A}(i,j)_{K} + \int_{\partial K}
+   * |\hat{n}\cdot\vec{\Omega}|\varphi_i(\vec{r})\varphi_j(\vec{r})dS
+   * \f]
+   */
+  virtual void FillBoundaryBilinearTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Integrates the cell streaming term and fills a given matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{K}\frac{1}{\sigma_{t,g}(\vec{r})}
+   * (\vec{\Omega}\cdot\nabla\varphi_i(\vec{r}))
+   * (\vec{\Omega}\cdot\nabla\varphi_j(\vec{r}))dV
+   * \f]
+   */
+  virtual void FillCellStreamingTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the cell collision term and fills a given matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{K}\sigma_{t,g}(\vec{r})\varphi_i(\vec{r})\varphi_j(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellCollisionTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the isotropic fixed source and fills a given vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\frac{Q_g(\vec{r})}{4\pi}\varphi_i(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellFixedSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the isotropic scattering source and fills a given
+   * vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\sum_{g'}\frac{\sigma_{s,g'\to g}(\vec{r})}{4\pi}\phi_{g'}(\vec{r})
+   * \varphi_i(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellScatteringSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) = 0;
+
+  /*! \brief Integrates the isotropic fission source and fills a given vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\sum_{g'}\frac{\chi_g\nu\sigma_{f,g'}(\vec{r})}{4\pi k_{\mathrm{eff}}}
+   * \phi_{g'}(\vec{r})\varphi_i(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellFissionSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) = 0;
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_EVEN_PARITY_I_H_
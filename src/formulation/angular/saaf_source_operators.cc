@@ -0,0 +1,222 @@
+#include "formulation/angular/saaf_source_operators.h"
+
+#include <set>
+#include <vector>
+
+#include <deal.II/lac/full_matrix.h>
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+template<int dim>
+SAAFSourceOperators<dim>::SAAFSourceOperators(
+    std::shared_ptr<domain::DefinitionI<dim>> domain_ptr,
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr,
+    std::shared_ptr<data::CrossSections> cross_sections_ptr,
+    std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr)
+    : domain_ptr_(domain_ptr),
+      finite_element_ptr_(finite_element_ptr),
+      cross_sections_ptr_(cross_sections_ptr),
+      quadrature_set_ptr_(quadrature_set_ptr) {
+  AssertThrow(domain_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SAAFSourceOperators, "
+                                 "domain pointer passed is null"))
+  AssertThrow(finite_element_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SAAFSourceOperators, "
+                                 "finite element pointer passed is null"))
+  AssertThrow(cross_sections_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SAAFSourceOperators, "
+                                 "cross-sections pointer passed is null"))
+  AssertThrow(quadrature_set_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SAAFSourceOperators, "
+                                 "quadrature set pointer passed is null"))
+  this->set_description("Self-adjoint angular flux precomputed source "
+                        "operators",
+                        utility::DefaultImplementation(true));
+}
+
+template<int dim>
+void SAAFSourceOperators<dim>::Initialize() {
+  const auto cells = domain_ptr_->Cells();
+  const auto angle_indices = quadrature_set_ptr_->quadrature_point_indices();
+
+  std::set<MaterialID> material_ids;
+  for (const auto& cell : cells)
+    material_ids.insert(cell->material_id());
+
+  mass_matrix_by_material_.clear();
+  streaming_matrix_by_material_and_angle_.clear();
+  for (const auto material_id : material_ids) {
+    // Matrices of a material only store couplings of its own cells
+    mass_matrix_by_material_.insert_or_assign(
+        material_id, domain_ptr_->MakeMaterialSystemMatrix(material_id));
+    for (const int angle : angle_indices) {
+      streaming_matrix_by_material_and_angle_.insert_or_assign(
+          {material_id, angle},
+          domain_ptr_->MakeMaterialSystemMatrix(material_id));
+    }
+  }
+
+  std::vector<dealii::Tensor<1, dim>> omegas;
+  for (const int angle : angle_indices) {
+    omegas.push_back(quadrature_set_ptr_->GetQuadraturePoint(
+        quadrature::QuadraturePointIndex(angle))->cartesian_position_tensor());
+  }
+
+  const int cell_dofs = finite_element_ptr_->dofs_per_cell();
+  const int cell_quadrature_points = finite_element_ptr_->n_cell_quad_pts();
+  auto cell_matrix = domain_ptr_->GetCellMatrix();
+  std::vector<dealii::types::global_dof_index> local_dof_indices(cell_dofs);
+  const auto& constraints = domain_ptr_->constraints();
+
+  // Finite element values are set once per cell for all angles
+  for (const auto& cell : cells) {
+    finite_element_ptr_->SetCell(cell);
+    cell->get_dof_indices(local_dof_indices);
+    const MaterialID material_id = cell->material_id();
+
+    cell_matrix = 0;
+    for (int q = 0; q < cell_quadrature_points; ++q) {
+      const double jacobian = finite_element_ptr_->Jacobian(q);
+      for (int i = 0; i < cell_dofs; ++i) {
+        for (int j = 0; j < cell_dofs; ++j) {
+          cell_matrix(i, j) += finite_element_ptr_->ShapeValue(i, q)
+              * finite_element_ptr_->ShapeValue(j, q) * jacobian;
+        }
+      }
+    }
+    constraints.distribute_local_to_global(
+        cell_matrix, local_dof_indices,
+        *mass_matrix_by_material_.at(material_id));
+
+    int omega_index = 0;
+    for (const int angle : angle_indices) {
+      const auto& omega = omegas.at(omega_index++);
+      cell_matrix = 0;
+      for (int q = 0; q < cell_quadrature_points; ++q) {
+        const double jacobian = finite_element_ptr_->Jacobian(q);
+        for (int i = 0; i < cell_dofs; ++i) {
+          const double omega_dot_gradient =
+              omega * finite_element_ptr_->ShapeGradient(i, q);
+          for (int j = 0; j < cell_dofs; ++j) {
+            cell_matrix(i, j) += omega_dot_gradient
+                * finite_element_ptr_->ShapeValue(j, q) * jacobian;
+          }
+        }
+      }
+      constraints.distribute_local_to_global(
+          cell_matrix, local_dof_indices,
+          *streaming_matrix_by_material_and_angle_.at({material_id, angle}));
+    }
+  }
+
+  for (auto& [material_id, matrix_ptr] : mass_matrix_by_material_)
+    matrix_ptr->compress(dealii::VectorOperation::add);
+  for (auto& [index, matrix_ptr] : streaming_matrix_by_material_and_angle_)
+    matrix_ptr->compress(dealii::VectorOperation::add);
+
+  source_ptr_ = domain_ptr_->MakeSystemVector();
+  product_ptr_ = domain_ptr_->MakeSystemVector();
+  is_initialized_ = true;
+}
+
+template<int dim>
+void SAAFSourceOperators<dim>::AddScatteringSource(
+    system::MPIVector& to_fill,
+    const system::EnergyGroup group_number,
+    const quadrature::QuadraturePointIndex angle_index,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentsMap& group_moments) const {
+  VerifyInitialized(__FUNCTION__);
+  const int group = group_number.get();
+
+  for (const auto& [material_id, mass_matrix_ptr] : mass_matrix_by_material_) {
+    const auto& sigma_s_per_ster =
+        cross_sections_ptr_->sigma_s_per_ster.at(material_id);
+    // Reinitializing to the same size only zeroes the work vector
+    material_source_.reinit(in_group_moment.size());
+
+    for (const auto& [index, moment] : group_moments) {
+      const auto& [group_in, harmonic_l, harmonic_m] = index;
+      if ((harmonic_l == 0) && (harmonic_m == 0)) {
+        material_source_.add(sigma_s_per_ster(group, group_in),
+                   group_in == group ? in_group_moment : moment);
+      }
+    }
+    AddSource(to_fill, group_number, angle_index, material_id,
+              material_source_);
+  }
+}
+
+template<int dim>
+void SAAFSourceOperators<dim>::AddFissionSource(
+    system::MPIVector& to_fill,
+    const system::EnergyGroup group_number,
+    const quadrature::QuadraturePointIndex angle_index,
+    const double k_effective,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentsMap& group_moments) const {
+  VerifyInitialized(__FUNCTION__);
+  const int group = group_number.get();
+
+  for (const auto& [material_id, mass_matrix_ptr] : mass_matrix_by_material_) {
+    if (!cross_sections_ptr_->is_material_fissile.at(material_id))
+      continue;
+    const auto& fission_xfer_per_ster =
+        cross_sections_ptr_->fiss_transfer_per_ster.at(material_id);
+    // Reinitializing to the same size only zeroes the work vector
+    material_source_.reinit(in_group_moment.size());
+
+    for (const auto& [index, moment] : group_moments) {
+      const auto& [group_in, harmonic_l, harmonic_m] = index;
+      if ((harmonic_l == 0) && (harmonic_m == 0)) {
+        material_source_.add(fission_xfer_per_ster(group_in, group) / k_effective,
+                   group_in == group ? in_group_moment : moment);
+      }
+    }
+    AddSource(to_fill, group_number, angle_index, material_id,
+              material_source_);
+  }
+}
+
+template<int dim>
+void SAAFSourceOperators<dim>::AddSource(
+    system::MPIVector& to_fill,
+    const system::EnergyGroup group_number,
+    const quadrature::QuadraturePointIndex angle_index,
+    const MaterialID material_id,
+    const system::moments::MomentVector& source) const {
+  const double inverse_sigma_t =
+      cross_sections_ptr_->inverse_sigma_t.at(material_id).at(group_number.get());
+
+  for (const auto index : source_ptr_->locally_owned_elements())
+    (*source_ptr_)[index] = source[index];
+  source_ptr_->compress(dealii::VectorOperation::insert);
+
+  mass_matrix_by_material_.at(material_id)->vmult_add(to_fill, *source_ptr_);
+  streaming_matrix_by_material_and_angle_.at(
+      {material_id, angle_index.get()})->vmult(*product_ptr_, *source_ptr_);
+  to_fill.add(inverse_sigma_t, *product_ptr_);
+}
+
+template<int dim>
+void SAAFSourceOperators<dim>::VerifyInitialized(
+    std::string called_function_name) const {
+  AssertThrow(is_initialized_,
+              dealii::ExcMessage("Error in SAAFSourceOperators function " +
+                  called_function_name + ": source operators have not been "
+                  "initialized, call Initialize before adding any sources."))
+}
+
+template class SAAFSourceOperators<1>;
+template class SAAFSourceOperators<2>;
+template class SAAFSourceOperators<3>;
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
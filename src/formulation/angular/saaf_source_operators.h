@@ -0,0 +1,125 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_SAAF_SOURCE_OPERATORS_H_
+#define BART_SRC_FORMULATION_ANGULAR_SAAF_SOURCE_OPERATORS_H_
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#include "data/cross_sections.h"
+#include "domain/definition_i.h"
+#include "domain/finite_element/finite_element_i.h"
+#include "formulation/angular/saaf_source_operators_i.h"
+#include "quadrature/quadrature_set_i.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Default implementation of the precomputed SAAF source operators.
+ *
+ * The source operator of a material and angle is split into a mass matrix,
+ * \f$\mathbf{M}_m(i,j) = \int_{K \in m}\varphi_i\varphi_j\,dV\f$, and a
+ * streaming matrix,
+ * \f$\mathbf{G}_{m,\Omega}(i,j) = \int_{K \in m}(\vec{\Omega}\cdot\nabla
+ * \varphi_i)\varphi_j\,dV\f$, so that they do not depend on the group. For
+ * each material the group moments are combined into the source
+ * \f$S_m = \sum_{g'}\sigma_{s,m}^{g'\to g}\phi_{g'}\f$ and the right hand
+ * side is
+ * \f[
+ * \sum_m\left(\mathbf{M}_m + \frac{1}{\sigma_{t,m,g}}\mathbf{G}_{m,\Omega}
+ * \right)S_m
+ * \f]
+ * Only isotropic (\f$\ell = 0\f$) moments contribute, as in
+ * SelfAdjointAngularFlux.
+ *
+ * The matrices of a material only store the couplings between the degrees of
+ * freedom of its own cells, so the storage and the cost of applying the
+ * operators summed over all materials are close to those of a single system
+ * matrix per angle.
+ *
+ * \tparam dim spatial dimension.
+ */
+template <int dim>
+class SAAFSourceOperators : public SAAFSourceOperatorsI<dim> {
+ public:
+  using MaterialID = int;
+
+  SAAFSourceOperators(
+      std::shared_ptr<domain::DefinitionI<dim>> domain_ptr,
+      std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr,
+      std::shared_ptr<data::CrossSections> cross_sections_ptr,
+      std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr);
+
+  void Initialize() override;
+
+  void AddScatteringSource(
+      system::MPIVector& to_fill,
+      const system::EnergyGroup group_number,
+      const quadrature::QuadraturePointIndex angle_index,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) const override;
+
+  void AddFissionSource(
+      system::MPIVector& to_fill,
+      const system::EnergyGroup group_number,
+      const quadrature::QuadraturePointIndex angle_index,
+      const double k_effective,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) const override;
+
+  bool is_initialized() const override { return is_initialized_; }
+
+  /*! \brief Mass matrix of a material */
+  const system::MPISparseMatrix& mass_matrix(const MaterialID material_id) const {
+    return *mass_matrix_by_material_.at(material_id); }
+  /*! \brief Streaming matrix of a material and angle */
+  const system::MPISparseMatrix& streaming_matrix(
+      const MaterialID material_id,
+      const quadrature::QuadraturePointIndex angle_index) const {
+    return *streaming_matrix_by_material_and_angle_.at(
+        {material_id, angle_index.get()}); }
+
+  domain::DefinitionI<dim>* domain_ptr() const { return domain_ptr_.get(); }
+  domain::finite_element::FiniteElementI<dim>* finite_element_ptr() const {
+    return finite_element_ptr_.get(); }
+  data::CrossSections* cross_sections_ptr() const {
+    return cross_sections_ptr_.get(); }
+  quadrature::QuadratureSetI<dim>* quadrature_set_ptr() const {
+    return quadrature_set_ptr_.get(); }
+
+ private:
+  /*! \brief Adds the right hand side for a combined isotropic source in one
+   * material. */
+  void AddSource(system::MPIVector& to_fill,
+                 const system::EnergyGroup group_number,
+                 const quadrature::QuadraturePointIndex angle_index,
+                 const MaterialID material_id,
+                 const system::moments::MomentVector& source) const;
+  void VerifyInitialized(std::string called_function_name) const;
+
+  std::shared_ptr<domain::DefinitionI<dim>> domain_ptr_;
+  std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr_;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr_;
+  std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr_;
+
+  std::unordered_map<MaterialID, std::shared_ptr<system::MPISparseMatrix>>
+      mass_matrix_by_material_;
+  std::map<std::pair<MaterialID, int>, std::shared_ptr<system::MPISparseMatrix>>
+      streaming_matrix_by_material_and_angle_;
+  //! Work vectors for the combined source and matrix-vector products
+  std::shared_ptr<system::MPIVector> source_ptr_, product_ptr_;
+  //! Work vector for the combined moments of one material
+  mutable system::moments::MomentVector material_source_;
+
+  bool is_initialized_ = false;
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_SAAF_SOURCE_OPERATORS_H_
@@ -0,0 +1,79 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_SAAF_SOURCE_OPERATORS_I_H_
+#define BART_SRC_FORMULATION_ANGULAR_SAAF_SOURCE_OPERATORS_I_H_
+
+#include "quadrature/quadrature_types.h"
+#include "system/system_types.h"
+#include "system/moments/spherical_harmonic_types.h"
+#include "utility/has_description.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Interface for precomputed self-adjoint angular flux source operators.
+ *
+ * For an isotropic source \f$S\f$ in a material with total cross-section
+ * \f$\sigma_t\f$, the SAAF right hand side for angle \f$\vec{\Omega}\f$ is
+ * \f[
+ * \int_K\left(\varphi_i + \frac{1}{\sigma_t}\vec{\Omega}\cdot\nabla\varphi_i
+ * \right)S\,dV
+ * \f]
+ * and is linear in the degrees of freedom of \f$S\f$. Implementations assemble
+ * these maps once as sparse matrices, so that sources can be updated by
+ * matrix-vector products with the group moments instead of cell assembly.
+ *
+ * \tparam dim spatial dimension.
+ */
+template <int dim>
+class SAAFSourceOperatorsI : public utility::HasDescription {
+ public:
+  virtual ~SAAFSourceOperatorsI() = default;
+
+  /*! \brief Assembles the source operators, must be called after the domain
+   * degrees of freedom are set up. */
+  virtual void Initialize() = 0;
+
+  /*! \brief Adds the scattering source for a group and angle.
+   *
+   * \param to_fill vector to add the source to.
+   * \param group_number group of the source.
+   * \param angle_index quadrature point index of the angle.
+   * \param in_group_moment scalar flux for the in-group.
+   * \param group_moments moments for all groups.
+   */
+  virtual void AddScatteringSource(
+      system::MPIVector& to_fill,
+      const system::EnergyGroup group_number,
+      const quadrature::QuadraturePointIndex angle_index,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) const = 0;
+
+  /*! \brief Adds the fission source for a group and angle.
+   *
+   * \param to_fill vector to add the source to.
+   * \param group_number group of the source.
+   * \param angle_index quadrature point index of the angle.
+   * \param k_effective current value of \f$k_\text{eff}\f$.
+   * \param in_group_moment scalar flux for the in-group.
+   * \param group_moments moments for all groups.
+   */
+  virtual void AddFissionSource(
+      system::MPIVector& to_fill,
+      const system::EnergyGroup group_number,
+      const quadrature::QuadraturePointIndex angle_index,
+      const double k_effective,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) const = 0;
+
+  virtual bool is_initialized() const = 0;
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_SAAF_SOURCE_OPERATORS_I_H_
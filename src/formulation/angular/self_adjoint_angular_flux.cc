@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <string>
 
 namespace bart {
 
@@ -29,10 +30,14 @@ void SelfAdjointAngularFlux<dim>::Initialize(const domain::CellPtr<dim> &cell_pt
 
   finite_element_ptr_->SetCell(cell_ptr);
   shape_squared_ = {};
-  omega_dot_gradient_ = {};
+  auto& omega_dot_gradient = omega_dot_gradient_[cell_ptr->level()];
+  auto& omega_dot_gradient_squared = omega_dot_gradient_squared_[cell_ptr->level()];
+  omega_dot_gradient = {};
+  omega_dot_gradient_squared = {};
 
   /* Precalculated values are held in maps that are indexed by the cell
-   * quadrature point where they are valid */
+   * quadrature point where they are valid, gradient terms are only valid for
+   * cells on the same refinement level */
   for (int cell_quad_index = 0; cell_quad_index < cell_quadrature_points_;
        ++cell_quad_index) {
     formulation::FullMatrix shape_squared(cell_degrees_of_freedom_,
@@ -59,16 +64,16 @@ void SelfAdjointAngularFlux<dim>::Initialize(const domain::CellPtr<dim> &cell_pt
             finite_element_ptr_->ShapeGradient(i, cell_quad_index);
       }
 
-      omega_dot_gradient_.insert_or_assign({cell_quad_index, angle_index},
-                                           omega_dot_gradient_vector);
+      omega_dot_gradient.insert_or_assign({cell_quad_index, angle_index},
+                                          omega_dot_gradient_vector);
 
-      FullMatrix omega_dot_gradient_squared(cell_degrees_of_freedom_,
-                                            cell_degrees_of_freedom_);
-      omega_dot_gradient_squared.outer_product(omega_dot_gradient_vector,
-                                               omega_dot_gradient_vector);
-      omega_dot_gradient_squared_.insert_or_assign(
+      FullMatrix omega_dot_gradient_squared_matrix(cell_degrees_of_freedom_,
+                                                   cell_degrees_of_freedom_);
+      omega_dot_gradient_squared_matrix.outer_product(omega_dot_gradient_vector,
+                                                      omega_dot_gradient_vector);
+      omega_dot_gradient_squared.insert_or_assign(
           {cell_quad_index, angle_index},
-          omega_dot_gradient_squared);
+          omega_dot_gradient_squared_matrix);
     }
   }
   is_initialized_ = true;
@@ -113,11 +118,15 @@ void SelfAdjointAngularFlux<dim>::FillReflectiveBoundaryLinearTerm(
     const domain::CellPtr<dim>& cell_ptr,
     domain::FaceIndex face_number,
     const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
-    const dealii::Vector<double>& incoming_flux) {
+    const std::vector<double>& incoming_flux) {
   VerifyInitialized(__FUNCTION__);
   ValidateVectorSize(to_fill, __FUNCTION__);
   AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
               dealii::ExcMessage("Bad cell given to FillReflectiveBoundaryLinearTerm"))
+  AssertThrow(static_cast<int>(incoming_flux.size()) == cell_degrees_of_freedom_,
+              dealii::ExcMessage("Error in FillReflectiveBoundaryLinearTerm, "
+                                 "incoming flux must have a value for each "
+                                 "cell degree of freedom"))
   finite_element_ptr_->SetFace(cell_ptr, face_number);
 
   auto normal_vector = finite_element_ptr_->FaceNormal();
@@ -126,20 +135,55 @@ void SelfAdjointAngularFlux<dim>::FillReflectiveBoundaryLinearTerm(
   const double normal_dot_omega = normal_vector * omega;
 
   if (normal_dot_omega < 0) {
-    const auto incoming_angular_flux = finite_element_ptr_->ValueAtFaceQuadrature(
-        incoming_flux);
     for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
       const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
+      double incoming_angular_flux = 0;
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        incoming_angular_flux +=
+            incoming_flux[j] * finite_element_ptr_->FaceShapeValue(j, f_q);
+      }
       for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
         to_fill(i) -= normal_dot_omega
             * finite_element_ptr_->FaceShapeValue(i, f_q)
-            * incoming_angular_flux.at(f_q)
+            * incoming_angular_flux
             * jacobian;
       }
     }
   }
 }
 
+template<int dim>
+void SelfAdjointAngularFlux<dim>::FillReflectiveBoundaryBilinearTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    domain::FaceIndex face_number,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) {
+  VerifyInitialized(__FUNCTION__);
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+  AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
+              dealii::ExcMessage("Bad cell given to FillReflectiveBoundaryBilinearTerm"))
+  finite_element_ptr_->SetFace(cell_ptr, face_number);
+
+  auto normal_vector = finite_element_ptr_->FaceNormal();
+  auto omega = quadrature_point->cartesian_position_tensor();
+
+  const double normal_dot_omega = normal_vector * omega;
+
+  if (normal_dot_omega < 0) {
+    for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
+      const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
+      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+        for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+          to_fill(i,j) += normal_dot_omega
+              * finite_element_ptr_->FaceShapeValue(i, f_q)
+              * finite_element_ptr_->FaceShapeValue(j, f_q)
+              * jacobian;
+        }
+      }
+    }
+  }
+}
+
 template<int dim>
 void SelfAdjointAngularFlux<dim>::FillCellCollisionTerm(
     FullMatrix &to_fill,
@@ -184,7 +228,9 @@ void SelfAdjointAngularFlux<dim>::FillCellFissionSourceTerm(
      * scattering source terms in SAAF, specifically scalar flux times the
      * scattering cross-section per steradian */
 
-    std::vector<double> fission_source(cell_quadrature_points_);
+    std::vector<double> owned_source, owned_scalar_flux;
+    auto& fission_source = SourceAtQuadrature(owned_source);
+    auto& scalar_flux = MomentAtQuadrature(owned_scalar_flux);
 
     // Get the contribution from each group
     for (const auto &moment_pair : group_moments) {
@@ -192,13 +238,8 @@ void SelfAdjointAngularFlux<dim>::FillCellFissionSourceTerm(
       const auto &[group_in, harmonic_l, harmonic_m] = index;
 
       if ((harmonic_l == 0) && (harmonic_m == 0)) {
-        std::vector<double> scalar_flux(cell_quadrature_points_);
-
-        if (group_in == group) {
-          scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
-        } else {
-          scalar_flux = finite_element_ptr_->ValueAtQuadrature(moment);
-        }
+        finite_element_ptr_->ValueAtQuadrature(
+            group_in == group ? in_group_moment : moment, scalar_flux);
 
         const auto fission_xfer_per_ster =
             cross_sections_ptr_->fiss_transfer_per_ster.at(material_id)(group_in,
@@ -211,8 +252,8 @@ void SelfAdjointAngularFlux<dim>::FillCellFissionSourceTerm(
       }
     }
 
-    FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
-                       fission_source);
+    FillCellSourceTerm(to_fill, material_id, cell_ptr->level(),
+                       quadrature_point, group_number, fission_source);
   }
 }
 
@@ -233,11 +274,12 @@ void SelfAdjointAngularFlux<dim>::FillCellFixedSourceTerm(
     return;
   }
 
-  std::vector<double> fixed_source(cell_degrees_of_freedom_);
+  std::vector<double> owned_source;
+  auto& fixed_source = SourceAtQuadrature(owned_source);
   std::fill(fixed_source.begin(), fixed_source.end(), q_per_ster);
 
-  FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
-                     fixed_source);
+  FillCellSourceTerm(to_fill, material_id, cell_ptr->level(),
+                     quadrature_point, group_number, fixed_source);
 }
 
 template<int dim>
@@ -258,7 +300,9 @@ void SelfAdjointAngularFlux<dim>::FillCellScatteringSourceTerm(
    * scattering source terms in SAAF, specifically scalar flux times the
    * scattering cross-section per steradian */
 
-  std::vector<double> scattering_source(cell_quadrature_points_);
+  std::vector<double> owned_source, owned_scalar_flux;
+  auto& scattering_source = SourceAtQuadrature(owned_source);
+  auto& scalar_flux = MomentAtQuadrature(owned_scalar_flux);
 
   // Get the contribution from each group
   for (const auto& moment_pair : group_moments) {
@@ -266,13 +310,8 @@ void SelfAdjointAngularFlux<dim>::FillCellScatteringSourceTerm(
     const auto &[group_in, harmonic_l, harmonic_m] = index;
 
     if ((harmonic_l == 0) && (harmonic_m == 0)) {
-      std::vector<double> scalar_flux(cell_quadrature_points_);
-
-      if (group_in == group) {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
-      } else {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(moment);
-      }
+      finite_element_ptr_->ValueAtQuadrature(
+          group_in == group ? in_group_moment : moment, scalar_flux);
 
       const auto sigma_s_per_ster =
           cross_sections_ptr_->sigma_s_per_ster.at(material_id)(group, group_in);
@@ -283,8 +322,8 @@ void SelfAdjointAngularFlux<dim>::FillCellScatteringSourceTerm(
     }
   }
 
-  FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
-                     scattering_source);
+  FillCellSourceTerm(to_fill, material_id, cell_ptr->level(),
+                     quadrature_point, group_number, scattering_source);
 }
 
 template<int dim>
@@ -301,11 +340,15 @@ void SelfAdjointAngularFlux<dim>::FillCellStreamingTerm(
       cross_sections_ptr_->inverse_sigma_t.at(material_id).at(group_number.get());
   const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
       quadrature_point);
+  const int refinement_level = cell_ptr->level();
+  VerifyLevelInitialized(refinement_level, __FUNCTION__);
+  const auto& level_omega_dot_gradient_squared =
+      omega_dot_gradient_squared_.at(refinement_level);
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_ptr_->Jacobian(q);
-    const FullMatrix omega_dot_gradient_squared = OmegaDotGradientSquared(
-        q, quadrature::QuadraturePointIndex(angle_index));
+    const auto& omega_dot_gradient_squared =
+        level_omega_dot_gradient_squared.at({q, angle_index});
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
         to_fill(i, j) +=
@@ -318,31 +361,53 @@ void SelfAdjointAngularFlux<dim>::FillCellStreamingTerm(
 template <int dim>
 std::vector<double> SelfAdjointAngularFlux<dim>::OmegaDotGradient(
     int cell_quadrature_point,
-    quadrature::QuadraturePointIndex angular_index) const {
+    quadrature::QuadraturePointIndex angular_index,
+    int refinement_level) const {
+  VerifyLevelInitialized(refinement_level, __FUNCTION__);
   std::vector<double> return_vector(cell_degrees_of_freedom_);
   std::pair<int, int> index{cell_quadrature_point, angular_index.get()};
+  const auto& omega_dot_gradient =
+      omega_dot_gradient_.at(refinement_level).at(index);
   for (int i = 0; i < cell_degrees_of_freedom_; ++i)
-    return_vector.at(i) = omega_dot_gradient_.at(index)[i];
+    return_vector.at(i) = omega_dot_gradient[i];
   return return_vector;
 }
 
 template <int dim>
 FullMatrix SelfAdjointAngularFlux<dim>::OmegaDotGradientSquared(
     int cell_quadrature_point,
-    quadrature::QuadraturePointIndex angular_index) const {
-  return omega_dot_gradient_squared_.at(
+    quadrature::QuadraturePointIndex angular_index,
+    int refinement_level) const {
+  VerifyLevelInitialized(refinement_level, __FUNCTION__);
+  return omega_dot_gradient_squared_.at(refinement_level).at(
       {cell_quadrature_point, angular_index.get()});
 }
 
 // PRIVATE FUNCTIONS ===========================================================
+template <int dim>
+std::vector<double>& SelfAdjointAngularFlux<dim>::SourceAtQuadrature(
+    std::vector<double>& owned_storage) {
+  auto& source = workspace_ptr_ == nullptr ?
+      owned_storage : workspace_ptr_->source_at_quadrature();
+  source.assign(cell_quadrature_points_, 0);
+  return source;
+}
+
+template <int dim>
+std::vector<double>& SelfAdjointAngularFlux<dim>::MomentAtQuadrature(
+    std::vector<double>& owned_storage) {
+  return workspace_ptr_ == nullptr ?
+      owned_storage : workspace_ptr_->moment_at_quadrature();
+}
+
 template <int dim>
 void SelfAdjointAngularFlux<dim>::ValidateAndSetCell(
     const bart::domain::CellPtr<dim> &cell_ptr,
     std::string function_name) {
-  std::string error{"Error in SelfAdjointAngularFlux function " +
-      function_name + ": passed cell pointer is invalid"};
+  // Error messages are only built on failure to avoid allocating on each call
   AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
-              dealii::ExcMessage(error))
+              dealii::ExcMessage("Error in SelfAdjointAngularFlux function " +
+                  function_name + ": passed cell pointer is invalid"))
   finite_element_ptr_->SetCell(cell_ptr);
 }
 
@@ -352,16 +417,13 @@ void SelfAdjointAngularFlux<dim>::ValidateMatrixSize(
     std::string called_function_name) {
   auto [rows, cols] = std::pair{to_validate.n_rows(), to_validate.n_cols()};
 
-  std::ostringstream error_string;
-  error_string << "Error in SelfAdjointAngularFlux function "
-               << called_function_name
-               <<": passed matrix size is invalid, expected size ("
-               << cell_degrees_of_freedom_ << ", " << cell_degrees_of_freedom_
-               << "), actual size: (" << rows << ", " << cols << ")";
-
   AssertThrow((static_cast<int>(rows) == cell_degrees_of_freedom_) &&
       (static_cast<int>(cols) == cell_degrees_of_freedom_),
-      dealii::ExcMessage(error_string.str()))
+      dealii::ExcMessage("Error in SelfAdjointAngularFlux function " +
+          called_function_name + ": passed matrix size is invalid, expected "
+          "size (" + std::to_string(cell_degrees_of_freedom_) + ", " +
+          std::to_string(cell_degrees_of_freedom_) + "), actual size: (" +
+          std::to_string(rows) + ", " + std::to_string(cols) + ")"))
 }
 
 template <int dim>
@@ -371,45 +433,53 @@ void SelfAdjointAngularFlux<dim>::ValidateVectorSize(
 
   int rows = to_validate.size();
 
-  std::ostringstream error_string;
-  error_string << "Error in SelfAdjointAngularFlux function "
-               << called_function_name
-               <<": passed vector size is invalid, expected size ("
-               << cell_degrees_of_freedom_ << ", 1), actual size: (" << rows
-               << ", 1)";
-
   AssertThrow((static_cast<int>(rows) == cell_degrees_of_freedom_),
-              dealii::ExcMessage(error_string.str()))
+              dealii::ExcMessage("Error in SelfAdjointAngularFlux function " +
+                  called_function_name + ": passed vector size is invalid, "
+                  "expected size (" + std::to_string(cell_degrees_of_freedom_) +
+                  ", 1), actual size: (" + std::to_string(rows) + ", 1)"))
 }
 
-
-
 template <int dim>
 void SelfAdjointAngularFlux<dim>::FillCellSourceTerm(
     bart::formulation::Vector &to_fill,
     const int material_id,
+    const int refinement_level,
     const std::shared_ptr<bart::quadrature::QuadraturePointI<dim>> quadrature_point,
     const bart::system::EnergyGroup group_number,
-    std::vector<double> source) {
+    const std::vector<double>& source) {
   const double inverse_sigma_t =
       cross_sections_ptr_->inverse_sigma_t.at(material_id).at(group_number.get());
   const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
       quadrature_point);
+  VerifyLevelInitialized(refinement_level, __FUNCTION__);
+  const auto& level_omega_dot_gradient =
+      omega_dot_gradient_.at(refinement_level);
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_ptr_->Jacobian(q);
-    const auto omega_dot_gradient = OmegaDotGradient(
-        q, quadrature::QuadraturePointIndex(angle_index));
+    const auto& omega_dot_gradient =
+        level_omega_dot_gradient.at({q, angle_index});
 
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       to_fill(i) += jacobian * source.at(q) * (
           finite_element_ptr_->ShapeValue(i, q) +
-              omega_dot_gradient.at(i) * inverse_sigma_t
+              omega_dot_gradient[i] * inverse_sigma_t
       );
     }
   }
 }
 
+template <int dim>
+void SelfAdjointAngularFlux<dim>::VerifyLevelInitialized(
+    const int refinement_level, std::string called_function_name) const {
+  AssertThrow(omega_dot_gradient_.count(refinement_level) > 0,
+              dealii::ExcMessage("Error in SelfAdjointAngularFlux function " +
+                  called_function_name + ": gradient terms have not been "
+                  "initialized for refinement level " +
+                  std::to_string(refinement_level)))
+}
+
 template<int dim>
 void SelfAdjointAngularFlux<dim>::VerifyInitialized(
     std::string called_function_name) {
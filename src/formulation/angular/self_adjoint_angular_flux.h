@@ -5,7 +5,9 @@
 #include "domain/finite_element/finite_element_i.h"
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
 #include "quadrature/quadrature_set_i.h"
+#include "system/workspace.h"
 
+#include <map>
 #include <memory>
 
 namespace bart {
@@ -39,7 +41,13 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
       const domain::CellPtr<dim> &cell_ptr,
       domain::FaceIndex face_number,
       const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
-      const dealii::Vector<double>& incoming_flux) override;
+      const std::vector<double>& incoming_flux) override;
+
+  void FillReflectiveBoundaryBilinearTerm(
+      FullMatrix &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) override;
 
   void FillCellCollisionTerm(
       FullMatrix &to_fill,
@@ -76,11 +84,14 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
       const system::EnergyGroup group_number) override;
 
 
-  // Getters for pre-calculated values
+  // Getters for pre-calculated values, gradient terms are stored for each
+  // initialized refinement level
   std::vector<double> OmegaDotGradient(int cell_quadrature_point,
-                                       quadrature::QuadraturePointIndex) const;
+                                       quadrature::QuadraturePointIndex,
+                                       int refinement_level) const;
   FullMatrix OmegaDotGradientSquared(int cell_quadrature_point,
-                                     quadrature::QuadraturePointIndex) const;
+                                     quadrature::QuadraturePointIndex,
+                                     int refinement_level) const;
   // Dependency getters
   domain::finite_element::FiniteElementI<dim>* finite_element_ptr() const {
     return finite_element_ptr_.get(); }
@@ -94,6 +105,15 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
 
   bool is_initialized() const { return is_initialized_; }
 
+  /*! \brief Use preallocated source buffers from a workspace instead of
+   * making them for each cell. */
+  SelfAdjointAngularFlux& SetWorkspace(
+      std::shared_ptr<system::Workspace> workspace_ptr) {
+    workspace_ptr_ = workspace_ptr;
+    return *this;
+  }
+  system::Workspace* workspace_ptr() const { return workspace_ptr_.get(); }
+
  protected:
   // Validation Functions
   void ValidateMatrixSizeAndSetCell(const domain::CellPtr<dim>& cell_ptr,
@@ -113,30 +133,44 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
   void ValidateMatrixSize(const FullMatrix&, std::string called_function_name);
   void ValidateVectorSize(const Vector&, std::string called_function_name);
   void VerifyInitialized(std::string called_function_name);
+  /*! \brief Throws if gradient terms have not been pre-calculated for a
+   * refinement level. */
+  void VerifyLevelInitialized(const int refinement_level,
+                              std::string called_function_name) const;
 
   // Combined implementation functions
   void FillCellSourceTerm(
       Vector& to_fill,
       const int material_id,
+      const int refinement_level,
       const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
       const system::EnergyGroup group_number,
-      std::vector<double> source);
+      const std::vector<double>& source);
+  /*! \brief Returns a zeroed source buffer with one entry per cell quadrature
+   * point, from the workspace if one is set, otherwise the owned storage. */
+  std::vector<double>& SourceAtQuadrature(std::vector<double>& owned_storage);
+  /*! \brief Returns a buffer for moment values at the cell quadrature points,
+   * from the workspace if one is set, otherwise the owned storage. */
+  std::vector<double>& MomentAtQuadrature(std::vector<double>& owned_storage);
 
   // Dependencies
   std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr_;
   std::shared_ptr<data::CrossSections> cross_sections_ptr_;
   std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr_;
+  std::shared_ptr<system::Workspace> workspace_ptr_ = nullptr;
   // Geometric properties
   const int cell_degrees_of_freedom_ = 0; //!< Degrees of freedom per cell
   const int cell_quadrature_points_ = 0; //!< Quadrature points per cell
   const int face_quadrature_points_ = 0; //!< Quadrature points per face
-  // Precalculated matrices and vectors
+  // Precalculated matrices and vectors, gradient terms scale with the cell
+  // size and are held for each refinement level
   using CellQuadratureIndex = int;
   using AngleIndex = int;
-  std::map<std::pair<CellQuadratureIndex, AngleIndex>,
-           dealii::Vector<double>> omega_dot_gradient_;
-  std::map<std::pair<CellQuadratureIndex, AngleIndex>,
-           FullMatrix> omega_dot_gradient_squared_;
+  using RefinementLevel = int;
+  std::map<RefinementLevel, std::map<std::pair<CellQuadratureIndex, AngleIndex>,
+                                     dealii::Vector<double>>> omega_dot_gradient_;
+  std::map<RefinementLevel, std::map<std::pair<CellQuadratureIndex, AngleIndex>,
+                                     FullMatrix>> omega_dot_gradient_squared_;
   std::map<CellQuadratureIndex, FullMatrix> shape_squared_ = {};
   bool is_initialized_ = false;
 };
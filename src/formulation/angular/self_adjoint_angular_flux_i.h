@@ -4,6 +4,8 @@
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/dofs/dof_accessor.h>
 
+#include <vector>
+
 #include "domain/domain_types.h"
 #include "formulation/formulation_types.h"
 #include "quadrature/quadrature_point_i.h"
@@ -51,13 +53,39 @@ class SelfAdjointAngularFluxI {
 
   /*! \brief Fills the linear boundary term for reflective boundary conditions.
    *
+   * The incoming angular flux is given at the degrees of freedom of the cell,
+   * only values at the degrees of freedom on the face are used.
    */
    virtual void FillReflectiveBoundaryLinearTerm(
        Vector& to_fill,
        const domain::CellPtr<dim>& cell_ptr,
        const domain::FaceIndex face_number,
        const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
-       const dealii::Vector<double>& incoming_flux) = 0;
+       const std::vector<double>& incoming_flux) = 0;
+
+  /*! \brief Fills the bilinear boundary term coupling a reflective boundary to
+   * the reflected angle.
+   *
+   * Used when reflective boundaries are treated implicitly. For the case
+   * \f$(\vec{n} \cdot \vec{\Omega}) < 0\f$ the incoming angular flux is the
+   * angular flux of the reflected direction, \f$\Psi(\vec{r},\vec{\Omega}')\f$,
+   * and the following term is integrated into the matrix that couples
+   * \f$\vec{\Omega}\f$ to \f$\vec{\Omega}'\f$:
+   * \f[
+   * \mathbf{C}(i,j)_{K}' = \mathbf{C}(i,j)_{K} +
+   * \int_{\partial K}
+   * (\hat{n}\cdot\vec{\Omega})\varphi_i(\vec{r})
+   * \varphi_j(\vec{r})
+   * dS
+   * \f]
+   *
+   * \return No values returned, modifies input parameter \f$\mathbf{C}\to \mathbf{C}'\f$.
+   */
+  virtual void FillReflectiveBoundaryBilinearTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
 
   /*!
    * \brief Integrates the bilinear collision term and fills a given matrix.
@@ -206,8 +234,10 @@ class SelfAdjointAngularFluxI {
 
 
   /*! \brief Initialize the formulation.
-   * In general, this will pre-calculate matrix terms. The cell pointer is only
-   * used to initialize the finite element object.
+   * In general, this will pre-calculate matrix terms. The cell pointer is used
+   * to initialize the finite element object, terms that depend on the cell
+   * size are pre-calculated for its refinement level, so this should be called
+   * with a cell of each refinement level of the mesh.
    * @param cell_ptr cell pointer for initialization.
    */
   virtual void Initialize(const domain::CellPtr<dim>&) = 0;
@@ -0,0 +1,133 @@
+#include "formulation/angular/self_adjoint_angular_flux_kernel.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+template <int dim, int degree>
+SelfAdjointAngularFluxKernel<dim, degree>::SelfAdjointAngularFluxKernel(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr,
+    std::shared_ptr<data::CrossSections> cross_sections_ptr,
+    std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr)
+    : SelfAdjointAngularFlux<dim>(finite_element_ptr, cross_sections_ptr,
+                                  quadrature_set_ptr) {
+  AssertThrow(Kernel::IsSupported(*finite_element_ptr),
+              dealii::ExcMessage("Error in constructor of "
+                                 "SelfAdjointAngularFluxKernel, finite element "
+                                 "does not match the kernel degree"))
+}
+
+template <int dim, int degree>
+void SelfAdjointAngularFluxKernel<dim, degree>::Initialize(
+    const domain::CellPtr<dim>& cell_ptr) {
+  SelfAdjointAngularFlux<dim>::Initialize(cell_ptr);
+  Kernel::ToQuadratureMatrices(this->shape_squared_, kernel_shape_squared_);
+
+  // Matrices of each angle are overwritten in place on later cells of the
+  // same refinement level
+  const int refinement_level = cell_ptr->level();
+  const auto& level_omega_dot_gradient_squared =
+      this->omega_dot_gradient_squared_.at(refinement_level);
+  auto& kernel_level_omega_dot_gradient_squared =
+      kernel_omega_dot_gradient_squared_[refinement_level];
+  for (const int angle_index :
+      this->quadrature_set_ptr_->quadrature_point_indices()) {
+    auto& omega_dot_gradient_squared =
+        kernel_level_omega_dot_gradient_squared[angle_index];
+    for (int q = 0; q < Kernel::n_quadrature_points; ++q) {
+      Kernel::ToLocalMatrix(
+          level_omega_dot_gradient_squared.at({q, angle_index}),
+          omega_dot_gradient_squared[q]);
+    }
+  }
+}
+
+template <int dim, int degree>
+void SelfAdjointAngularFluxKernel<dim, degree>::FillCellCollisionTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const system::EnergyGroup group_number) {
+  this->VerifyInitialized(__FUNCTION__);
+  this->ValidateMatrixSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
+
+  const int material_id = cell_ptr->material_id();
+  const double sigma_t =
+      this->cross_sections_ptr_->sigma_t.at(material_id).at(group_number.get());
+
+  Kernel::AddIntegral(to_fill, sigma_t,
+                      Kernel::Jacobians(*this->finite_element_ptr_),
+                      kernel_shape_squared_);
+}
+
+template <int dim, int degree>
+void SelfAdjointAngularFluxKernel<dim, degree>::FillCellStreamingTerm(
+    FullMatrix& to_fill,
+    const domain::CellPtr<dim>& cell_ptr,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const system::EnergyGroup group_number) {
+  this->VerifyInitialized(__FUNCTION__);
+  this->ValidateMatrixSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
+
+  const int material_id = cell_ptr->material_id();
+  const double inverse_sigma_t = this->cross_sections_ptr_->inverse_sigma_t
+      .at(material_id).at(group_number.get());
+  const int angle_index =
+      this->quadrature_set_ptr_->GetQuadraturePointIndex(quadrature_point);
+  const int refinement_level = cell_ptr->level();
+  this->VerifyLevelInitialized(refinement_level, __FUNCTION__);
+
+  Kernel::AddIntegral(to_fill, inverse_sigma_t,
+                      Kernel::Jacobians(*this->finite_element_ptr_),
+                      kernel_omega_dot_gradient_squared_.at(refinement_level)
+                          .at(angle_index));
+}
+
+template <int dim>
+std::unique_ptr<SelfAdjointAngularFluxI<dim>> MakeSelfAdjointAngularFluxKernelPtr(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr,
+    std::shared_ptr<data::CrossSections> cross_sections_ptr,
+    std::shared_ptr<quadrature::QuadratureSetI<dim>> quadrature_set_ptr) {
+  switch (finite_element_ptr->polynomial_degree()) {
+    case 1:
+      return std::make_unique<SelfAdjointAngularFluxKernel<dim, 1>>(
+          finite_element_ptr, cross_sections_ptr, quadrature_set_ptr);
+    case 2:
+      return std::make_unique<SelfAdjointAngularFluxKernel<dim, 2>>(
+          finite_element_ptr, cross_sections_ptr, quadrature_set_ptr);
+    default:
+      break;
+  }
+  return std::make_unique<SelfAdjointAngularFlux<dim>>(
+      finite_element_ptr, cross_sections_ptr, quadrature_set_ptr);
+}
+
+template class SelfAdjointAngularFluxKernel<1, 1>;
+template class SelfAdjointAngularFluxKernel<2, 1>;
+template class SelfAdjointAngularFluxKernel<3, 1>;
+template class SelfAdjointAngularFluxKernel<1, 2>;
+template class SelfAdjointAngularFluxKernel<2, 2>;
+template class SelfAdjointAngularFluxKernel<3, 2>;
+
+template std::unique_ptr<SelfAdjointAngularFluxI<1>>
+MakeSelfAdjointAngularFluxKernelPtr<1>(
+    std::shared_ptr<domain::finite_element::FiniteElementI<1>>,
+    std::shared_ptr<data::CrossSections>,
+    std::shared_ptr<quadrature::QuadratureSetI<1>>);
+template std::unique_ptr<SelfAdjointAngularFluxI<2>>
+MakeSelfAdjointAngularFluxKernelPtr<2>(
+    std::shared_ptr<domain::finite_element::FiniteElementI<2>>,
+    std::shared_ptr<data::CrossSections>,
+    std::shared_ptr<quadrature::QuadratureSetI<2>>);
+template std::unique_ptr<SelfAdjointAngularFluxI<3>>
+MakeSelfAdjointAngularFluxKernelPtr<3>(
+    std::shared_ptr<domain::finite_element::FiniteElementI<3>>,
+    std::shared_ptr<data::CrossSections>,
+    std::shared_ptr<quadrature::QuadratureSetI<3>>);
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
@@ -0,0 +1,80 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_SELF_ADJOINT_ANGULAR_FLUX_KERNEL_H_
+#define BART_SRC_FORMULATION_ANGULAR_SELF_ADJOINT_ANGULAR_FLUX_KERNEL_H_
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/assembly_kernel.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Self-adjoint angular flux formulation with cell terms specialized on
+ * the finite element degree.
+ *
+ * On initialization the precalculated shape and
+ * \f$(\vec{\Omega}\cdot\nabla\varphi_i)(\vec{\Omega}\cdot\nabla\varphi_j)\f$
+ * matrices for each angle and refinement level are copied into fixed size
+ * arrays, and the cell streaming and collision terms are integrated using
+ * AssemblyKernel. Boundary and source terms use the generic
+ * SelfAdjointAngularFlux implementation.
+ *
+ * \tparam dim spatial dimension.
+ * \tparam degree polynomial degree of the finite element.
+ */
+template <int dim, int degree>
+class SelfAdjointAngularFluxKernel : public SelfAdjointAngularFlux<dim> {
+ public:
+  using Kernel = AssemblyKernel<dim, degree>;
+
+  SelfAdjointAngularFluxKernel(
+      std::shared_ptr<domain::finite_element::FiniteElementI<dim>>,
+      std::shared_ptr<data::CrossSections>,
+      std::shared_ptr<quadrature::QuadratureSetI<dim>>);
+
+  void Initialize(const domain::CellPtr<dim>&) override;
+
+  void FillCellCollisionTerm(
+      FullMatrix &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      const system::EnergyGroup group_number) override;
+
+  void FillCellStreamingTerm(
+      FullMatrix &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::EnergyGroup group_number) override;
+
+ private:
+  using AngleIndex = typename SelfAdjointAngularFlux<dim>::AngleIndex;
+  using RefinementLevel = typename SelfAdjointAngularFlux<dim>::RefinementLevel;
+  typename Kernel::QuadratureMatrices kernel_shape_squared_;
+  std::map<RefinementLevel,
+           std::unordered_map<AngleIndex, typename Kernel::QuadratureMatrices>>
+      kernel_omega_dot_gradient_squared_;
+};
+
+/*! \brief Makes a self-adjoint angular flux formulation specialized on the
+ * polynomial degree of the finite element.
+ *
+ * If no kernel is compiled for the degree, the generic SelfAdjointAngularFlux
+ * formulation is returned.
+ */
+template <int dim>
+std::unique_ptr<SelfAdjointAngularFluxI<dim>> MakeSelfAdjointAngularFluxKernelPtr(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>>,
+    std::shared_ptr<data::CrossSections>,
+    std::shared_ptr<quadrature::QuadratureSetI<dim>>);
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_SELF_ADJOINT_ANGULAR_FLUX_KERNEL_H_
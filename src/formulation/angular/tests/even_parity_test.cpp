@@ -0,0 +1,210 @@
+#include "formulation/angular/even_parity.h"
+
+#include <cmath>
+
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/tensor.h>
+
+#include "data/cross_sections.h"
+#include "domain/definition.h"
+#include "domain/finite_element/finite_element_gaussian.h"
+#include "domain/mesh/mesh_cartesian.h"
+#include "material/tests/mock_material.h"
+#include "quadrature/tests/quadrature_set_mock.h"
+#include "quadrature/tests/quadrature_point_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return;
+
+/* Tests for the even-parity formulation. The formulation is tested on a real
+ * continuous domain of 2 cells per dimension on the unit cube, using linear
+ * basis functions. As the sum of the basis functions is one, the sums of the
+ * terms of each cell matrix and vector have simple analytic values.
+ */
+template <typename DimensionWrapper>
+class FormulationAngularEvenParityTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using FiniteElementType = domain::finite_element::FiniteElementGaussian<dim>;
+  using QuadraturePointType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+  using QuadratureSetType = NiceMock<quadrature::QuadratureSetMock<dim>>;
+
+  std::shared_ptr<FiniteElementType> finite_element_ptr_;
+  std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr_;
+  std::unique_ptr<domain::Definition<dim>> domain_ptr_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  const int material_id_ = 1;
+  const double sigma_t_ = 2.5;
+  const double q_per_ster_ = 1.5;
+  const double cell_width_ = 0.5;
+  dealii::Tensor<1, dim> omega_;
+
+  void SetUp() override;
+  void SetUpDomain();
+  std::unique_ptr<formulation::angular::EvenParity<dim>> MakeFormulation() {
+    return std::make_unique<formulation::angular::EvenParity<dim>>(
+        finite_element_ptr_, cross_sections_ptr_, quadrature_set_ptr_);
+  }
+  //! Normal of a Cartesian cell face, using the dealii face numbering.
+  double NormalDotOmega(const int face) const {
+    return (face % 2 == 0 ? -1.0 : 1.0) * omega_[face / 2];
+  }
+};
+
+template <typename DimensionWrapper>
+void FormulationAngularEvenParityTest<DimensionWrapper>::SetUp() {
+  for (int i = 0; i < dim; ++i)
+    omega_[i] = 0.3 * (i + 1) * (i % 2 == 0 ? 1.0 : -1.0);
+
+  quadrature_point_ptr_ = std::make_shared<QuadraturePointType>();
+  ON_CALL(*quadrature_point_ptr_, cartesian_position_tensor())
+      .WillByDefault(Return(omega_));
+  quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
+
+  std::unordered_map<int, std::vector<double>> sigma_t{{material_id_, {sigma_t_}}};
+  std::unordered_map<int, std::vector<double>> inverse_sigma_t{
+      {material_id_, {1.0/sigma_t_}}};
+  std::unordered_map<int, std::vector<double>> q_per_ster{{material_id_, {q_per_ster_}}};
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t));
+  ON_CALL(mock_material_, GetInvSigT()).WillByDefault(Return(inverse_sigma_t));
+  ON_CALL(mock_material_, GetQPerSter()).WillByDefault(Return(q_per_ster));
+  cross_sections_ptr_ = std::make_shared<data::CrossSections>(mock_material_);
+}
+
+template <typename DimensionWrapper>
+void FormulationAngularEvenParityTest<DimensionWrapper>::SetUpDomain() {
+  finite_element_ptr_ = std::make_shared<FiniteElementType>(
+      problem::DiscretizationType::kContinuousFEM, 1);
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(
+      std::vector<double>(dim, 1.0), std::vector<int>(dim, 2),
+      std::to_string(material_id_));
+  domain_ptr_ = std::make_unique<domain::Definition<dim>>(
+      std::move(mesh_ptr), finite_element_ptr_,
+      problem::DiscretizationType::kContinuousFEM);
+  domain_ptr_->SetUpMesh().SetUpDOF();
+}
+
+TYPED_TEST_SUITE(FormulationAngularEvenParityTest,
+                 bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationAngularEvenParityTest, Constructor) {
+  this->SetUpDomain();
+  auto test_formulation = this->MakeFormulation();
+  EXPECT_EQ(test_formulation->finite_element_ptr(),
+            this->finite_element_ptr_.get());
+  EXPECT_EQ(test_formulation->cross_sections_ptr(),
+            this->cross_sections_ptr_.get());
+  EXPECT_EQ(test_formulation->quadrature_set_ptr(),
+            this->quadrature_set_ptr_.get());
+}
+
+/* The streaming term is symmetric, and as the gradient of the sum of the basis
+ * functions is zero, the sum of each row is zero. The boundary term of every
+ * face is the absolute value of the outflow through the face. */
+TYPED_TEST(FormulationAngularEvenParityTest, TermsSumLinear) {
+  constexpr int dim = this->dim;
+  this->SetUpDomain();
+  auto test_formulation = this->MakeFormulation();
+  const int dofs_per_cell = this->finite_element_ptr_->dofs_per_cell();
+  const double face_area = std::pow(this->cell_width_, dim - 1);
+  const double cell_volume = std::pow(this->cell_width_, dim);
+  const system::EnergyGroup group(0);
+
+  auto sum_of = [](const formulation::FullMatrix& matrix) {
+    double sum = 0;
+    for (unsigned int i = 0; i < matrix.m(); ++i)
+      for (unsigned int j = 0; j < matrix.n(); ++j)
+        sum += matrix(i, j);
+    return sum;
+  };
+
+  for (const auto& cell : this->domain_ptr_->Cells()) {
+    formulation::FullMatrix streaming(dofs_per_cell, dofs_per_cell),
+        collision(dofs_per_cell, dofs_per_cell);
+    formulation::Vector fixed_source(dofs_per_cell);
+    test_formulation->FillCellStreamingTerm(streaming, cell,
+                                            this->quadrature_point_ptr_, group);
+    test_formulation->FillCellCollisionTerm(collision, cell, group);
+    test_formulation->FillCellFixedSourceTerm(fixed_source, cell, group);
+
+    for (int i = 0; i < dofs_per_cell; ++i) {
+      double row_sum = 0;
+      for (int j = 0; j < dofs_per_cell; ++j) {
+        row_sum += streaming(i, j);
+        EXPECT_NEAR(streaming(i, j), streaming(j, i), 1e-12);
+      }
+      EXPECT_NEAR(row_sum, 0, 1e-12);
+      EXPECT_GE(streaming(i, i), 0);
+    }
+    EXPECT_NEAR(sum_of(collision), this->sigma_t_ * cell_volume, 1e-12);
+    EXPECT_NEAR(fixed_source.l1_norm(), this->q_per_ster_ * cell_volume, 1e-12);
+
+    for (int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+      formulation::FullMatrix boundary(dofs_per_cell, dofs_per_cell);
+      test_formulation->FillBoundaryBilinearTerm(boundary, cell,
+                                                 domain::FaceIndex(face),
+                                                 this->quadrature_point_ptr_);
+      EXPECT_NEAR(sum_of(boundary),
+                  std::abs(this->NormalDotOmega(face)) * face_area, 1e-12);
+    }
+  }
+}
+
+/* In one dimension, the streaming term for linear basis functions on a cell
+ * of width h is mu^2/(sigma_t h) [1, -1; -1, 1]. */
+TYPED_TEST(FormulationAngularEvenParityTest, StreamingTerm1D) {
+  constexpr int dim = this->dim;
+  if constexpr (dim == 1) {
+    this->SetUpDomain();
+    auto test_formulation = this->MakeFormulation();
+    const double mu = this->omega_[0];
+    const double expected = mu * mu / (this->sigma_t_ * this->cell_width_);
+
+    for (const auto& cell : this->domain_ptr_->Cells()) {
+      formulation::FullMatrix streaming(2, 2);
+      test_formulation->FillCellStreamingTerm(streaming, cell,
+                                              this->quadrature_point_ptr_,
+                                              system::EnergyGroup(0));
+      EXPECT_NEAR(streaming(0, 0), expected, 1e-12);
+      EXPECT_NEAR(streaming(1, 1), expected, 1e-12);
+      EXPECT_NEAR(streaming(0, 1), -expected, 1e-12);
+      EXPECT_NEAR(streaming(1, 0), -expected, 1e-12);
+    }
+  }
+}
+
+TYPED_TEST(FormulationAngularEvenParityTest, BadMatrixAndVectorSizes) {
+  this->SetUpDomain();
+  auto test_formulation = this->MakeFormulation();
+  const auto cell = this->domain_ptr_->Cells().at(0);
+  formulation::FullMatrix bad_matrix(1, 2);
+  formulation::Vector bad_vector(1);
+
+  EXPECT_ANY_THROW({
+    test_formulation->FillCellStreamingTerm(bad_matrix, cell,
+                                            this->quadrature_point_ptr_,
+                                            system::EnergyGroup(0));
+  });
+  EXPECT_ANY_THROW({
+    test_formulation->FillCellCollisionTerm(bad_matrix, cell,
+                                            system::EnergyGroup(0));
+  });
+  EXPECT_ANY_THROW({
+    test_formulation->FillBoundaryBilinearTerm(bad_matrix, cell,
+                                               domain::FaceIndex(0),
+                                               this->quadrature_point_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    test_formulation->FillCellFixedSourceTerm(bad_vector, cell,
+                                              system::EnergyGroup(0));
+  });
+}
+
+} // namespace
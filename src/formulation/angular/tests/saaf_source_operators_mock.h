@@ -0,0 +1,38 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_TESTS_SAAF_SOURCE_OPERATORS_MOCK_H_
+#define BART_SRC_FORMULATION_ANGULAR_TESTS_SAAF_SOURCE_OPERATORS_MOCK_H_
+
+#include "formulation/angular/saaf_source_operators_i.h"
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+template <int dim>
+class SAAFSourceOperatorsMock : public SAAFSourceOperatorsI<dim> {
+ public:
+  MOCK_METHOD(void, Initialize, (), (override));
+  MOCK_METHOD(void, AddScatteringSource, (system::MPIVector&,
+      const system::EnergyGroup,
+      const quadrature::QuadraturePointIndex,
+      const system::moments::MomentVector&,
+      const system::moments::MomentsMap&), (const, override));
+  MOCK_METHOD(void, AddFissionSource, (system::MPIVector&,
+      const system::EnergyGroup,
+      const quadrature::QuadraturePointIndex,
+      const double,
+      const system::moments::MomentVector&,
+      const system::moments::MomentsMap&), (const, override));
+  MOCK_METHOD(bool, is_initialized, (), (const, override));
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_TESTS_SAAF_SOURCE_OPERATORS_MOCK_H_
@@ -0,0 +1,224 @@
+#include "formulation/angular/saaf_source_operators.h"
+
+#include <deal.II/base/tensor.h>
+
+#include "data/cross_sections.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "domain/tests/definition_mock.h"
+#include "material/tests/mock_material.h"
+#include "quadrature/tests/quadrature_point_mock.h"
+#include "quadrature/tests/quadrature_set_mock.h"
+#include "system/system_types.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return, ::testing::ReturnRef, ::testing::Invoke,
+    ::testing::_;
+
+/* Tests for the precomputed SAAF source operators. The finite element mock
+ * returns unit shape values, Jacobians, and shape gradient components, and the
+ * only angle is (1, ..., 1), so every cell mass matrix entry is equal to the
+ * number of cell quadrature points, and every streaming matrix entry is dim
+ * times that. All cells have material 0.
+ */
+template <typename DimensionWrapper>
+class FormulationAngularSAAFSourceOperatorsTest :
+    public ::testing::Test,
+    public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using DomainType = NiceMock<domain::DefinitionMock<dim>>;
+  using FiniteElementType = NiceMock<domain::finite_element::FiniteElementMock<dim>>;
+  using QuadratureSetType = NiceMock<quadrature::QuadratureSetMock<dim>>;
+  using QuadraturePointType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+
+  std::unique_ptr<formulation::angular::SAAFSourceOperators<dim>> test_operators_ptr_;
+
+  std::shared_ptr<DomainType> mock_domain_ptr_;
+  std::shared_ptr<FiniteElementType> mock_finite_element_ptr_;
+  std::shared_ptr<QuadratureSetType> mock_quadrature_set_ptr_;
+  std::shared_ptr<QuadraturePointType> mock_quadrature_point_ptr_;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  const int cell_quadrature_points_ = 2;
+  const double sigma_s_per_ster_ = 0.5, inverse_sigma_t_ = 2.0,
+      fission_xfer_per_ster_ = 3.0, k_effective_ = 1.5;
+
+  system::moments::MomentVector in_group_moment_;
+  system::moments::MomentsMap group_moments_;
+
+  void SetUp() override;
+  /*! \brief Expected right hand side for a source of the given scale applied
+   * to the unit in-group moment. */
+  void FillExpected(system::MPIVector& to_fill, const double source_scale);
+};
+
+template <typename DimensionWrapper>
+void FormulationAngularSAAFSourceOperatorsTest<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  mock_domain_ptr_ = std::make_shared<DomainType>();
+  mock_finite_element_ptr_ = std::make_shared<FiniteElementType>();
+  mock_quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
+  mock_quadrature_point_ptr_ = std::make_shared<QuadraturePointType>();
+
+  const int cell_dofs = this->fe_.dofs_per_cell;
+  ON_CALL(*mock_domain_ptr_, Cells()).WillByDefault(Return(this->cells_));
+  ON_CALL(*mock_domain_ptr_, GetCellMatrix())
+      .WillByDefault(Return(dealii::FullMatrix<double>(cell_dofs, cell_dofs)));
+  ON_CALL(*mock_domain_ptr_, MakeMaterialSystemMatrix(_))
+      .WillByDefault(Invoke([this](int) {
+        auto matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+        matrix_ptr->reinit(this->matrix_1);
+        return matrix_ptr; }));
+  ON_CALL(*mock_domain_ptr_, MakeSystemVector())
+      .WillByDefault(Invoke([this]() {
+        auto vector_ptr = std::make_shared<system::MPIVector>();
+        vector_ptr->reinit(this->vector_1);
+        return vector_ptr; }));
+  ON_CALL(*mock_domain_ptr_, constraints())
+      .WillByDefault(ReturnRef(this->constraint_matrix_));
+
+  dealii::Tensor<1, dim> unit_tensor;
+  for (int i = 0; i < dim; ++i)
+    unit_tensor[i] = 1;
+  ON_CALL(*mock_finite_element_ptr_, dofs_per_cell())
+      .WillByDefault(Return(cell_dofs));
+  ON_CALL(*mock_finite_element_ptr_, n_cell_quad_pts())
+      .WillByDefault(Return(cell_quadrature_points_));
+  ON_CALL(*mock_finite_element_ptr_, ShapeValue(_, _)).WillByDefault(Return(1));
+  ON_CALL(*mock_finite_element_ptr_, Jacobian(_)).WillByDefault(Return(1));
+  ON_CALL(*mock_finite_element_ptr_, ShapeGradient(_, _))
+      .WillByDefault(Return(unit_tensor));
+
+  ON_CALL(*mock_quadrature_point_ptr_, cartesian_position_tensor())
+      .WillByDefault(Return(unit_tensor));
+  ON_CALL(*mock_quadrature_set_ptr_, quadrature_point_indices())
+      .WillByDefault(Return(std::set<int>{0}));
+  ON_CALL(*mock_quadrature_set_ptr_,
+          GetQuadraturePoint(quadrature::QuadraturePointIndex(0)))
+      .WillByDefault(Return(mock_quadrature_point_ptr_));
+
+  ON_CALL(mock_material_, GetInvSigT()).WillByDefault(Return(
+      std::unordered_map<int, std::vector<double>>{{0, {inverse_sigma_t_}}}));
+  ON_CALL(mock_material_, GetSigSPerSter()).WillByDefault(Return(
+      std::unordered_map<int, dealii::FullMatrix<double>>{
+          {0, dealii::FullMatrix<double>(1, 1, &sigma_s_per_ster_)}}));
+  ON_CALL(mock_material_, GetChiNuSigFPerSter()).WillByDefault(Return(
+      std::unordered_map<int, dealii::FullMatrix<double>>{
+          {0, dealii::FullMatrix<double>(1, 1, &fission_xfer_per_ster_)}}));
+  ON_CALL(mock_material_, GetFissileIDMap()).WillByDefault(Return(
+      std::unordered_map<int, bool>{{0, true}}));
+  cross_sections_ptr_ = std::make_shared<data::CrossSections>(mock_material_);
+
+  in_group_moment_.reinit(this->dof_handler_.n_dofs());
+  in_group_moment_ = 1;
+  group_moments_[{0, 0, 0}] = in_group_moment_;
+
+  test_operators_ptr_ =
+      std::make_unique<formulation::angular::SAAFSourceOperators<dim>>(
+          mock_domain_ptr_, mock_finite_element_ptr_, cross_sections_ptr_,
+          mock_quadrature_set_ptr_);
+}
+
+template <typename DimensionWrapper>
+void FormulationAngularSAAFSourceOperatorsTest<DimensionWrapper>::FillExpected(
+    system::MPIVector& to_fill, const double source_scale) {
+  const int cell_dofs = this->fe_.dofs_per_cell;
+  // Each row of the cell source operator sums to this value
+  const double row_sum = cell_dofs * cell_quadrature_points_
+      * (1 + inverse_sigma_t_ * dim);
+  std::vector<dealii::types::global_dof_index> local_dof_indices(cell_dofs);
+  std::vector<double> cell_values(cell_dofs, row_sum * source_scale);
+  to_fill = 0;
+  for (const auto& cell : this->cells_) {
+    cell->get_dof_indices(local_dof_indices);
+    to_fill.add(local_dof_indices, cell_values);
+  }
+  to_fill.compress(dealii::VectorOperation::add);
+}
+
+TYPED_TEST_SUITE(FormulationAngularSAAFSourceOperatorsTest,
+                 bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationAngularSAAFSourceOperatorsTest, Constructor) {
+  constexpr int dim = this->dim;
+  using OperatorsType = formulation::angular::SAAFSourceOperators<dim>;
+  EXPECT_FALSE(this->test_operators_ptr_->is_initialized());
+  EXPECT_EQ(this->test_operators_ptr_->domain_ptr(),
+            this->mock_domain_ptr_.get());
+  EXPECT_EQ(this->test_operators_ptr_->finite_element_ptr(),
+            this->mock_finite_element_ptr_.get());
+  EXPECT_EQ(this->test_operators_ptr_->cross_sections_ptr(),
+            this->cross_sections_ptr_.get());
+  EXPECT_EQ(this->test_operators_ptr_->quadrature_set_ptr(),
+            this->mock_quadrature_set_ptr_.get());
+  EXPECT_ANY_THROW({
+    OperatorsType(nullptr, this->mock_finite_element_ptr_,
+                  this->cross_sections_ptr_, this->mock_quadrature_set_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    OperatorsType(this->mock_domain_ptr_, this->mock_finite_element_ptr_,
+                  this->cross_sections_ptr_, nullptr);
+  });
+}
+
+TYPED_TEST(FormulationAngularSAAFSourceOperatorsTest, NotInitialized) {
+  system::MPIVector to_fill;
+  to_fill.reinit(this->vector_1);
+  EXPECT_ANY_THROW({
+    this->test_operators_ptr_->AddScatteringSource(
+        to_fill, system::EnergyGroup(0), quadrature::QuadraturePointIndex(0),
+        this->in_group_moment_, this->group_moments_);
+  });
+}
+
+TYPED_TEST(FormulationAngularSAAFSourceOperatorsTest, AddScatteringSource) {
+  EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(_))
+      .Times(this->cells_.size());
+  // One mass and one streaming matrix for the only material and angle
+  EXPECT_CALL(*this->mock_domain_ptr_, MakeMaterialSystemMatrix(0))
+      .Times(2);
+  EXPECT_CALL(*this->mock_domain_ptr_, MakeSystemMatrix()).Times(0);
+  this->test_operators_ptr_->Initialize();
+  EXPECT_TRUE(this->test_operators_ptr_->is_initialized());
+
+  system::MPIVector to_fill, expected;
+  to_fill.reinit(this->vector_1);
+  expected.reinit(this->vector_1);
+  this->FillExpected(expected, this->sigma_s_per_ster_);
+
+  this->test_operators_ptr_->AddScatteringSource(
+      to_fill, system::EnergyGroup(0), quadrature::QuadraturePointIndex(0),
+      this->in_group_moment_, this->group_moments_);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(expected, to_fill));
+
+  // Repeated calls reuse the zeroed work vector
+  to_fill = 0;
+  this->test_operators_ptr_->AddScatteringSource(
+      to_fill, system::EnergyGroup(0), quadrature::QuadraturePointIndex(0),
+      this->in_group_moment_, this->group_moments_);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(expected, to_fill));
+}
+
+TYPED_TEST(FormulationAngularSAAFSourceOperatorsTest, AddFissionSource) {
+  this->test_operators_ptr_->Initialize();
+
+  system::MPIVector to_fill, expected;
+  to_fill.reinit(this->vector_1);
+  expected.reinit(this->vector_1);
+  this->FillExpected(expected,
+                     this->fission_xfer_per_ster_ / this->k_effective_);
+
+  this->test_operators_ptr_->AddFissionSource(
+      to_fill, system::EnergyGroup(0), quadrature::QuadraturePointIndex(0),
+      this->k_effective_, this->in_group_moment_, this->group_moments_);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(expected, to_fill));
+}
+
+} // namespace
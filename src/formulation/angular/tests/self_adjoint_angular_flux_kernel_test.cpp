@@ -0,0 +1,155 @@
+#include "formulation/angular/self_adjoint_angular_flux_kernel.h"
+
+#include <deal.II/base/tensor.h>
+
+#include "data/cross_sections.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "material/tests/mock_material.h"
+#include "quadrature/tests/quadrature_point_mock.h"
+#include "quadrature/tests/quadrature_set_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return, ::testing::Invoke, ::testing::_;
+
+/* Tests that the degree one assembly kernel gives the same cell matrices as the
+ * generic self-adjoint angular flux formulation. The finite element mock
+ * returns shape values, gradients and Jacobians that vary with degree of
+ * freedom and quadrature point, and there are two angles in different
+ * directions. All cells have material 0.
+ */
+template <typename DimensionWrapper>
+class FormulationAngularSAAFKernelTest :
+    public ::testing::Test,
+    public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using FiniteElementType = NiceMock<domain::finite_element::FiniteElementMock<dim>>;
+  using QuadratureSetType = NiceMock<quadrature::QuadratureSetMock<dim>>;
+  using QuadraturePointType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+  using KernelFormulationType =
+      formulation::angular::SelfAdjointAngularFluxKernel<dim, 1>;
+  using GenericFormulationType = formulation::angular::SelfAdjointAngularFlux<dim>;
+
+  std::shared_ptr<FiniteElementType> mock_finite_element_ptr_;
+  std::shared_ptr<QuadratureSetType> mock_quadrature_set_ptr_;
+  std::vector<std::shared_ptr<QuadraturePointType>> mock_quadrature_points_;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  const int cell_dofs_ = KernelFormulationType::Kernel::n_dofs;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void FormulationAngularSAAFKernelTest<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  mock_finite_element_ptr_ = std::make_shared<FiniteElementType>();
+  mock_quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
+
+  ON_CALL(*mock_finite_element_ptr_, polynomial_degree())
+      .WillByDefault(Return(1));
+  ON_CALL(*mock_finite_element_ptr_, dofs_per_cell())
+      .WillByDefault(Return(cell_dofs_));
+  ON_CALL(*mock_finite_element_ptr_, n_cell_quad_pts())
+      .WillByDefault(Return(cell_dofs_));
+  ON_CALL(*mock_finite_element_ptr_, n_face_quad_pts())
+      .WillByDefault(Return(cell_dofs_));
+  ON_CALL(*mock_finite_element_ptr_, ShapeValue(_, _))
+      .WillByDefault(Invoke([](const int i, const int q) {
+        return 1.0 + i + 0.5 * q; }));
+  ON_CALL(*mock_finite_element_ptr_, Jacobian(_))
+      .WillByDefault(Invoke([](const int q) { return 0.25 * (q + 1); }));
+  ON_CALL(*mock_finite_element_ptr_, ShapeGradient(_, _))
+      .WillByDefault(Invoke([](const int i, const int q) {
+        dealii::Tensor<1, dim> gradient;
+        for (int d = 0; d < dim; ++d)
+          gradient[d] = i - q + 0.5 * d;
+        return gradient; }));
+
+  for (const int angle : {0, 1}) {
+    auto quadrature_point_ptr = std::make_shared<QuadraturePointType>();
+    dealii::Tensor<1, dim> omega;
+    for (int d = 0; d < dim; ++d)
+      omega[d] = (angle == 0 ? 1.0 : -0.5) * (d + 1);
+    ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+        .WillByDefault(Return(omega));
+    ON_CALL(*mock_quadrature_set_ptr_,
+            GetQuadraturePoint(quadrature::QuadraturePointIndex(angle)))
+        .WillByDefault(Return(quadrature_point_ptr));
+    ON_CALL(*mock_quadrature_set_ptr_,
+            GetQuadraturePointIndex(
+                std::shared_ptr<quadrature::QuadraturePointI<dim>>(
+                    quadrature_point_ptr)))
+        .WillByDefault(Return(angle));
+    mock_quadrature_points_.push_back(quadrature_point_ptr);
+  }
+  ON_CALL(*mock_quadrature_set_ptr_, quadrature_point_indices())
+      .WillByDefault(Return(std::set<int>{0, 1}));
+
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(
+      std::unordered_map<int, std::vector<double>>{{0, {1.0, 2.0}}}));
+  ON_CALL(mock_material_, GetInvSigT()).WillByDefault(Return(
+      std::unordered_map<int, std::vector<double>>{{0, {1.0, 0.5}}}));
+  ON_CALL(mock_material_, GetFissileIDMap()).WillByDefault(Return(
+      std::unordered_map<int, bool>{{0, false}}));
+  cross_sections_ptr_ = std::make_shared<data::CrossSections>(mock_material_);
+}
+
+TYPED_TEST_SUITE(FormulationAngularSAAFKernelTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationAngularSAAFKernelTest, Constructor) {
+  EXPECT_NO_THROW({
+    typename TestFixture::KernelFormulationType(
+        this->mock_finite_element_ptr_, this->cross_sections_ptr_,
+        this->mock_quadrature_set_ptr_);
+  });
+  ON_CALL(*this->mock_finite_element_ptr_, n_cell_quad_pts())
+      .WillByDefault(Return(this->cell_dofs_ + 1));
+  EXPECT_ANY_THROW({
+    typename TestFixture::KernelFormulationType(
+        this->mock_finite_element_ptr_, this->cross_sections_ptr_,
+        this->mock_quadrature_set_ptr_);
+  });
+}
+
+TYPED_TEST(FormulationAngularSAAFKernelTest, MatchesGenericFormulation) {
+  const int cell_dofs = this->cell_dofs_;
+  typename TestFixture::KernelFormulationType test_formulation(
+      this->mock_finite_element_ptr_, this->cross_sections_ptr_,
+      this->mock_quadrature_set_ptr_);
+  typename TestFixture::GenericFormulationType generic_formulation(
+      this->mock_finite_element_ptr_, this->cross_sections_ptr_,
+      this->mock_quadrature_set_ptr_);
+  const auto& cell = this->cells_.at(0);
+  test_formulation.Initialize(cell);
+  generic_formulation.Initialize(cell);
+
+  for (const int group : {0, 1}) {
+    dealii::FullMatrix<double> expected(cell_dofs, cell_dofs),
+        result(cell_dofs, cell_dofs);
+    generic_formulation.FillCellCollisionTerm(expected, cell,
+                                              system::EnergyGroup(group));
+    test_formulation.FillCellCollisionTerm(result, cell,
+                                           system::EnergyGroup(group));
+    EXPECT_TRUE(bart::test_helpers::AreEqual(expected, result));
+
+    for (const auto& quadrature_point_ptr : this->mock_quadrature_points_) {
+      // Kernel adds to the matrix passed
+      generic_formulation.FillCellStreamingTerm(expected, cell,
+                                                quadrature_point_ptr,
+                                                system::EnergyGroup(group));
+      test_formulation.FillCellStreamingTerm(result, cell, quadrature_point_ptr,
+                                             system::EnergyGroup(group));
+      EXPECT_TRUE(bart::test_helpers::AreEqual(expected, result));
+    }
+  }
+}
+
+} // namespace
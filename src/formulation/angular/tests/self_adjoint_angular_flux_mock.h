@@ -24,7 +24,11 @@ class SelfAdjointAngularFluxMock :
       const domain::CellPtr<dim>&,
       const domain::FaceIndex,
       const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
-      const dealii::Vector<double>&), (override));
+      const std::vector<double>&), (override));
+  MOCK_METHOD(void, FillReflectiveBoundaryBilinearTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const domain::FaceIndex,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>), (override));
   MOCK_METHOD(void, FillCellCollisionTerm, (FullMatrix&,
       const domain::CellPtr<dim>&,
       const system::EnergyGroup), (override));
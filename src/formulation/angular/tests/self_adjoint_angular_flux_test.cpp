@@ -298,7 +298,8 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, InitializeOmegaDotGradi
     for (int angle_index : this->quadrature_point_indices_) {
       std::vector<double> result;
       EXPECT_NO_THROW(result = test_saaf.OmegaDotGradient(cell_quad_point,
-                                                           quadrature::QuadraturePointIndex(angle_index)));
+                                                           quadrature::QuadraturePointIndex(angle_index),
+                                                           this->cell_ptr_->level()));
       EXPECT_THAT(result, ::testing::ContainerEq(omega_dot_gradient.at(cell_quad_point).at(angle_index)));
     }
   }
@@ -335,7 +336,8 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,InitializeOmegaDotGradie
     for (int angle_index : this->quadrature_point_indices_) {
       formulation::FullMatrix result;
       ASSERT_NO_THROW(result = test_saaf.OmegaDotGradientSquared(cell_quad_point,
-                                                                 quadrature::QuadraturePointIndex(angle_index)));
+                                                                 quadrature::QuadraturePointIndex(angle_index),
+                                                                 this->cell_ptr_->level()));
       EXPECT_TRUE(AreEqual(omega_dot_gradient_squared.at(cell_quad_point).at(angle_index), result));
     }
   }
@@ -501,7 +503,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryL
 
   EXPECT_ANY_THROW({
     test_saaf.FillReflectiveBoundaryLinearTerm(cell_vector, invalid_cell_ptr, domain::FaceIndex(0), angle_ptr,
-                                               dealii::Vector<double>{});
+                                               std::vector<double>(2));
                    });
 }
 
@@ -521,7 +523,16 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryL
                                                       this->cell_ptr_,
                                                       domain::FaceIndex(0),
                                                       angle_ptr,
-                                                      dealii::Vector<double>{});
+                                                      std::vector<double>(2));
+                   });
+  // Incoming flux must have a value for each cell degree of freedom
+  formulation::Vector good_cell_vector(2);
+  EXPECT_ANY_THROW({
+                     test_saaf.FillReflectiveBoundaryLinearTerm(good_cell_vector,
+                                                      this->cell_ptr_,
+                                                      domain::FaceIndex(0),
+                                                      angle_ptr,
+                                                      std::vector<double>(3));
                    });
 }
 
@@ -554,7 +565,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryL
                                                      this->cell_ptr_,
                                                      domain::FaceIndex(0),
                                                      angle_ptr,
-                                                     dealii::Vector<double>{});
+                                                     std::vector<double>(2));
                   });
 
   EXPECT_EQ(expected_results, cell_vector);
@@ -567,9 +578,12 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryL
                                                               this->cross_section_ptr_,
                                                               this->mock_quadrature_set_ptr_);
 
+  // Incoming flux at the face quadrature points is the first face shape
+  // function, (11, 12)
+  const std::vector<double> incoming_flux{1.0, 0.0};
   formulation::Vector expected_results(2);
-  expected_results[0] = 78.75 * dim;
-  expected_results[1] = 146.25 * dim;
+  expected_results[0] = 1227.0 * dim;
+  expected_results[1] = 2277.0 * dim;
   formulation::Vector cell_vector(2);
 
   test_saaf.Initialize(this->cell_ptr_);
@@ -585,21 +599,95 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryL
   for (const auto f_q : {0, 1}) {
     EXPECT_CALL(*this->mock_finite_element_ptr_, FaceJacobian(f_q)).WillOnce(DoDefault());
     for (const auto dof : {0, 1}) {
-      EXPECT_CALL(*this->mock_finite_element_ptr_, FaceShapeValue(dof, f_q)).WillOnce(DoDefault());
+      EXPECT_CALL(*this->mock_finite_element_ptr_, FaceShapeValue(dof, f_q))
+          .Times(2).WillRepeatedly(DoDefault());
     }
   }
 
-
-  EXPECT_CALL(*this->mock_finite_element_ptr_, ValueAtFaceQuadrature(_)).WillOnce(DoDefault());
-
   EXPECT_NO_THROW({
                     test_saaf.FillReflectiveBoundaryLinearTerm(cell_vector, this->cell_ptr_, domain::FaceIndex(0),
-                                                               angle_ptr, dealii::Vector<double>{});
+                                                               angle_ptr, incoming_flux);
                   });
 
   EXPECT_EQ(expected_results, cell_vector);
 }
 
+// FillReflectiveBoundaryBilinearTerm ==========================================
+
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryBilinearTermTestBadCellPtr) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+
+  formulation::FullMatrix cell_matrix(2,2);
+  domain::CellPtr<dim> invalid_cell_ptr;
+  auto angle_ptr = *this->quadrature_set_.begin();
+  test_saaf.Initialize(this->cell_ptr_);
+
+  EXPECT_ANY_THROW({
+    test_saaf.FillReflectiveBoundaryBilinearTerm(cell_matrix, invalid_cell_ptr,
+                                                 domain::FaceIndex(0), angle_ptr);
+                   });
+}
+
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryBilinearTermTestGreaterThanZero) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+
+  formulation::FullMatrix cell_matrix(2, 2, std::array<double, 4>{2454, 4554, 4554, 8454}.begin());
+  formulation::FullMatrix expected_results(cell_matrix);
+
+  test_saaf.Initialize(this->cell_ptr_);
+  auto angle_ptr = *this->quadrature_set_.begin();
+
+  dealii::Tensor<1, dim> normal;
+  for (int i = 0; i < dim; ++i)
+    normal[i] = 1;
+  EXPECT_CALL(*this->mock_finite_element_ptr_, SetFace(this->cell_ptr_, domain::FaceIndex(0)));
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceNormal()).WillOnce(Return(normal));
+
+  EXPECT_NO_THROW({
+    test_saaf.FillReflectiveBoundaryBilinearTerm(cell_matrix, this->cell_ptr_,
+                                                 domain::FaceIndex(0), angle_ptr);
+                  });
+  EXPECT_TRUE(AreEqual(expected_results, cell_matrix));
+}
+
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillReflectiveBoundaryBilinearTermTest) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+
+  formulation::FullMatrix expected_results(2, 2, std::array<double, 4>{1227, 2277, 2277, 4227}.begin());
+  expected_results *= -3*dim;
+  formulation::FullMatrix cell_matrix(2,2);
+  cell_matrix = 0;
+
+  test_saaf.Initialize(this->cell_ptr_);
+  auto angle_ptr = *this->quadrature_set_.begin();
+
+  dealii::Tensor<1, dim> normal;
+  for (int i = 0; i < dim; ++i)
+    normal[i] = -3;
+
+  EXPECT_CALL(*this->mock_finite_element_ptr_, SetFace(this->cell_ptr_, domain::FaceIndex(0)));
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceNormal()).WillOnce(Return(normal));
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceJacobian(_)).Times(2).WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceShapeValue(_, _)).Times(16).WillRepeatedly(DoDefault());
+
+  test_saaf.FillReflectiveBoundaryBilinearTerm(cell_matrix, this->cell_ptr_,
+                                               domain::FaceIndex(0), angle_ptr);
+
+  EXPECT_TRUE(AreEqual(expected_results, cell_matrix));
+}
+
 // FillStreamingTerm ===========================================================
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellStreamingTermTestBadCellPtr) {
   constexpr int dim = this->dim;
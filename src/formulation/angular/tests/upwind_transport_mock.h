@@ -0,0 +1,54 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_TESTS_UPWIND_TRANSPORT_MOCK_H_
+#define BART_SRC_FORMULATION_ANGULAR_TESTS_UPWIND_TRANSPORT_MOCK_H_
+
+#include "formulation/angular/upwind_transport_i.h"
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+template <int dim>
+class UpwindTransportMock : public UpwindTransportI<dim> {
+ public:
+  MOCK_METHOD(void, FillCellStreamingTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>), (override));
+  MOCK_METHOD(void, FillCellCollisionTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const system::EnergyGroup), (override));
+  MOCK_METHOD(void, FillFaceOutflowTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const domain::FaceIndex,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>), (override));
+  MOCK_METHOD(void, FillFaceInflowTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&,
+      const domain::FaceIndex,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>), (override));
+  MOCK_METHOD(double, NormalDotOmega, (const domain::CellPtr<dim>&,
+      const domain::FaceIndex,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>), (override));
+  MOCK_METHOD(void, FillCellFixedSourceTerm, (Vector&,
+      const domain::CellPtr<dim>&,
+      const system::EnergyGroup), (override));
+  MOCK_METHOD(void, FillCellScatteringSourceTerm, (Vector&,
+      const domain::CellPtr<dim>&,
+      const system::EnergyGroup, const system::moments::MomentVector&,
+      const system::moments::MomentsMap&), (override));
+  MOCK_METHOD(void, FillCellFissionSourceTerm, (Vector&,
+      const domain::CellPtr<dim>&,
+      const system::EnergyGroup, const double,
+      const system::moments::MomentVector&,
+      const system::moments::MomentsMap&), (override));
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_TESTS_UPWIND_TRANSPORT_MOCK_H_
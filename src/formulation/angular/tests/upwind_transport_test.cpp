@@ -0,0 +1,238 @@
+#include "formulation/angular/upwind_transport.h"
+
+#include <cmath>
+
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/tensor.h>
+
+#include "data/cross_sections.h"
+#include "domain/definition.h"
+#include "domain/finite_element/finite_element_gaussian.h"
+#include "domain/mesh/mesh_cartesian.h"
+#include "material/tests/mock_material.h"
+#include "quadrature/tests/quadrature_set_mock.h"
+#include "quadrature/tests/quadrature_point_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return;
+
+/* Tests for the DFEM upwind discrete ordinates formulation. The formulation
+ * is tested on a real discontinuous domain of 2 cells per dimension on the
+ * unit cube, so that face terms can be integrated using neighbor cells. For
+ * piecewise constant (degree 0) basis functions the cell and face terms have
+ * simple analytic values.
+ */
+template <typename DimensionWrapper>
+class FormulationAngularUpwindTransportTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using FiniteElementType = domain::finite_element::FiniteElementGaussian<dim>;
+  using QuadraturePointType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+  using QuadratureSetType = NiceMock<quadrature::QuadratureSetMock<dim>>;
+
+  std::shared_ptr<FiniteElementType> finite_element_ptr_;
+  std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr_;
+  std::unique_ptr<domain::Definition<dim>> domain_ptr_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  const int material_id_ = 1;
+  const double sigma_t_ = 2.5;
+  const double q_per_ster_ = 1.5;
+  const double cell_width_ = 0.5;
+  dealii::Tensor<1, dim> omega_;
+
+  void SetUp() override;
+  void SetUpDomain(const int polynomial_degree);
+  std::unique_ptr<formulation::angular::UpwindTransport<dim>> MakeFormulation() {
+    return std::make_unique<formulation::angular::UpwindTransport<dim>>(
+        finite_element_ptr_, cross_sections_ptr_, quadrature_set_ptr_);
+  }
+  //! Normal of a Cartesian cell face, using the dealii face numbering.
+  double NormalDotOmega(const int face) const {
+    return (face % 2 == 0 ? -1.0 : 1.0) * omega_[face / 2];
+  }
+};
+
+template <typename DimensionWrapper>
+void FormulationAngularUpwindTransportTest<DimensionWrapper>::SetUp() {
+  for (int i = 0; i < dim; ++i)
+    omega_[i] = 0.3 * (i + 1) * (i % 2 == 0 ? 1.0 : -1.0);
+
+  quadrature_point_ptr_ = std::make_shared<QuadraturePointType>();
+  ON_CALL(*quadrature_point_ptr_, cartesian_position_tensor())
+      .WillByDefault(Return(omega_));
+  quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
+
+  std::unordered_map<int, std::vector<double>> sigma_t{{material_id_, {sigma_t_}}};
+  std::unordered_map<int, std::vector<double>> q_per_ster{{material_id_, {q_per_ster_}}};
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t));
+  ON_CALL(mock_material_, GetQPerSter()).WillByDefault(Return(q_per_ster));
+  cross_sections_ptr_ = std::make_shared<data::CrossSections>(mock_material_);
+}
+
+template <typename DimensionWrapper>
+void FormulationAngularUpwindTransportTest<DimensionWrapper>::SetUpDomain(
+    const int polynomial_degree) {
+  finite_element_ptr_ = std::make_shared<FiniteElementType>(
+      problem::DiscretizationType::kDiscontinuousFEM, polynomial_degree);
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(
+      std::vector<double>(dim, 1.0), std::vector<int>(dim, 2),
+      std::to_string(material_id_));
+  domain_ptr_ = std::make_unique<domain::Definition<dim>>(
+      std::move(mesh_ptr), finite_element_ptr_,
+      problem::DiscretizationType::kDiscontinuousFEM);
+  domain_ptr_->SetUpMesh().SetUpDOF();
+}
+
+TYPED_TEST_SUITE(FormulationAngularUpwindTransportTest,
+                 bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationAngularUpwindTransportTest, Constructor) {
+  this->SetUpDomain(1);
+  auto test_formulation = this->MakeFormulation();
+  EXPECT_EQ(test_formulation->finite_element_ptr(),
+            this->finite_element_ptr_.get());
+  EXPECT_EQ(test_formulation->cross_sections_ptr(),
+            this->cross_sections_ptr_.get());
+  EXPECT_EQ(test_formulation->quadrature_set_ptr(),
+            this->quadrature_set_ptr_.get());
+}
+
+TYPED_TEST(FormulationAngularUpwindTransportTest, CellTermsPiecewiseConstant) {
+  constexpr int dim = this->dim;
+  this->SetUpDomain(0);
+  auto test_formulation = this->MakeFormulation();
+  const double cell_volume = std::pow(this->cell_width_, dim);
+
+  for (const auto& cell : this->domain_ptr_->Cells()) {
+    formulation::FullMatrix streaming(1, 1), collision(1, 1);
+    formulation::Vector fixed_source(1);
+    test_formulation->FillCellStreamingTerm(streaming, cell,
+                                            this->quadrature_point_ptr_);
+    test_formulation->FillCellCollisionTerm(collision, cell,
+                                            system::EnergyGroup(0));
+    test_formulation->FillCellFixedSourceTerm(fixed_source, cell,
+                                              system::EnergyGroup(0));
+    EXPECT_NEAR(streaming(0, 0), 0, 1e-12);
+    EXPECT_NEAR(collision(0, 0), this->sigma_t_ * cell_volume, 1e-12);
+    EXPECT_NEAR(fixed_source(0), this->q_per_ster_ * cell_volume, 1e-12);
+  }
+}
+
+TYPED_TEST(FormulationAngularUpwindTransportTest, FaceTermsPiecewiseConstant) {
+  constexpr int dim = this->dim;
+  this->SetUpDomain(0);
+  auto test_formulation = this->MakeFormulation();
+  const double face_area = std::pow(this->cell_width_, dim - 1);
+
+  for (const auto& cell : this->domain_ptr_->Cells()) {
+    for (int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+      const double expected_normal_dot_omega = this->NormalDotOmega(face);
+      const domain::FaceIndex face_index(face);
+      EXPECT_NEAR(test_formulation->NormalDotOmega(cell, face_index,
+                                                   this->quadrature_point_ptr_),
+                  expected_normal_dot_omega, 1e-12);
+
+      formulation::FullMatrix outflow(1, 1);
+      test_formulation->FillFaceOutflowTerm(outflow, cell, face_index,
+                                            this->quadrature_point_ptr_);
+      EXPECT_NEAR(outflow(0, 0),
+                  std::max(expected_normal_dot_omega, 0.0) * face_area, 1e-12);
+
+      formulation::FullMatrix inflow(1, 1);
+      if (cell->at_boundary(face)) {
+        EXPECT_ANY_THROW({
+          test_formulation->FillFaceInflowTerm(inflow, cell, face_index,
+                                               this->quadrature_point_ptr_);
+        });
+      } else {
+        test_formulation->FillFaceInflowTerm(inflow, cell, face_index,
+                                             this->quadrature_point_ptr_);
+        EXPECT_NEAR(inflow(0, 0),
+                    std::min(expected_normal_dot_omega, 0.0) * face_area,
+                    1e-12);
+      }
+    }
+  }
+}
+
+/* For linear basis functions, the sum of the shape functions is one, so the
+ * sum of all streaming terms is zero, and the sum of all face terms is the
+ * outflow (or inflow) through the face. */
+TYPED_TEST(FormulationAngularUpwindTransportTest, TermsSumLinear) {
+  constexpr int dim = this->dim;
+  this->SetUpDomain(1);
+  auto test_formulation = this->MakeFormulation();
+  const int dofs_per_cell = this->finite_element_ptr_->dofs_per_cell();
+  const double face_area = std::pow(this->cell_width_, dim - 1);
+  const double cell_volume = std::pow(this->cell_width_, dim);
+
+  auto sum_of = [](const formulation::FullMatrix& matrix) {
+    double sum = 0;
+    for (unsigned int i = 0; i < matrix.m(); ++i)
+      for (unsigned int j = 0; j < matrix.n(); ++j)
+        sum += matrix(i, j);
+    return sum;
+  };
+
+  for (const auto& cell : this->domain_ptr_->Cells()) {
+    formulation::FullMatrix streaming(dofs_per_cell, dofs_per_cell),
+        collision(dofs_per_cell, dofs_per_cell);
+    test_formulation->FillCellStreamingTerm(streaming, cell,
+                                            this->quadrature_point_ptr_);
+    test_formulation->FillCellCollisionTerm(collision, cell,
+                                            system::EnergyGroup(0));
+    EXPECT_NEAR(sum_of(streaming), 0, 1e-12);
+    EXPECT_NEAR(sum_of(collision), this->sigma_t_ * cell_volume, 1e-12);
+
+    for (int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+      const double normal_dot_omega = this->NormalDotOmega(face);
+      const domain::FaceIndex face_index(face);
+      formulation::FullMatrix outflow(dofs_per_cell, dofs_per_cell);
+      test_formulation->FillFaceOutflowTerm(outflow, cell, face_index,
+                                            this->quadrature_point_ptr_);
+      EXPECT_NEAR(sum_of(outflow), std::max(normal_dot_omega, 0.0) * face_area,
+                  1e-12);
+      if (!cell->at_boundary(face)) {
+        formulation::FullMatrix inflow(dofs_per_cell, dofs_per_cell);
+        test_formulation->FillFaceInflowTerm(inflow, cell, face_index,
+                                             this->quadrature_point_ptr_);
+        EXPECT_NEAR(sum_of(inflow), std::min(normal_dot_omega, 0.0) * face_area,
+                    1e-12);
+      }
+    }
+  }
+}
+
+TYPED_TEST(FormulationAngularUpwindTransportTest, BadMatrixAndVectorSizes) {
+  this->SetUpDomain(1);
+  auto test_formulation = this->MakeFormulation();
+  const auto cell = this->domain_ptr_->Cells().at(0);
+  formulation::FullMatrix bad_matrix(1, 2);
+  formulation::Vector bad_vector(1);
+
+  EXPECT_ANY_THROW({
+    test_formulation->FillCellStreamingTerm(bad_matrix, cell,
+                                            this->quadrature_point_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    test_formulation->FillCellCollisionTerm(bad_matrix, cell,
+                                            system::EnergyGroup(0));
+  });
+  EXPECT_ANY_THROW({
+    test_formulation->FillFaceOutflowTerm(bad_matrix, cell, domain::FaceIndex(0),
+                                          this->quadrature_point_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    test_formulation->FillCellFixedSourceTerm(bad_vector, cell,
+                                              system::EnergyGroup(0));
+  });
+}
+
+} // namespace
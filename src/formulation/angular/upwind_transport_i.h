@@ -0,0 +1,164 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_UPWIND_TRANSPORT_I_H_
+#define BART_SRC_FORMULATION_ANGULAR_UPWIND_TRANSPORT_I_H_
+
+#include <memory>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/dofs/dof_accessor.h>
+
+#include "domain/domain_types.h"
+#include "formulation/formulation_types.h"
+#include "quadrature/quadrature_point_i.h"
+#include "system/system_types.h"
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace angular {
+
+/*! \brief Interface for discontinuous upwind discrete ordinates formulations.
+ *
+ * The first-order transport equation for a single angle and group,
+ * \f[
+ * \vec{\Omega}\cdot\nabla\psi(\vec{r}) + \sigma_t(\vec{r})\psi(\vec{r}) =
+ * q(\vec{r})
+ * \f]
+ * is discretized with discontinuous basis functions, integrating the streaming
+ * term by parts on each cell \f$K\f$ and using the upwind value of the angular
+ * flux on each face:
+ * \f[
+ * -\int_K\psi(\vec{\Omega}\cdot\nabla\varphi_i)dV
+ * + \int_{\partial K}(\hat{n}\cdot\vec{\Omega})\hat{\psi}\varphi_i dS
+ * + \int_K\sigma_t\psi\varphi_i dV = \int_K q\varphi_i dV
+ * \f]
+ * where \f$\hat{\psi}\f$ is the angular flux in the cell for outflow faces
+ * \f$(\hat{n}\cdot\vec{\Omega}) > 0\f$, and the angular flux in the neighboring
+ * cell for inflow faces. Each cell is only coupled to its upwind neighbors, so
+ * the system can be solved cell-by-cell in downwind order (a sweep).
+ *
+ * Sources are isotropic, so the source terms do not depend on angle.
+ */
+template <int dim>
+class UpwindTransportI {
+ public:
+  virtual ~UpwindTransportI() = default;
+
+  /*! \brief Integrates the cell streaming term and fills a given matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K}' = \mathbf{A}(i,j)_{K} -
+   * \int_{K}(\vec{\Omega}\cdot\nabla\varphi_i(\vec{r}))\varphi_j(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellStreamingTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Integrates the cell collision term and fills a given matrix.
+   *
+   * \f[
+   * \mathbf{A}(i,j)_{K,g}' = \mathbf{A}(i,j)_{K,g} +
+   * \int_{K}\sigma_{t,g}(\vec{r})\varphi_i(\vec{r})\varphi_j(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellCollisionTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the face term for an outflow face and fills a given
+   * matrix.
+   *
+   * If \f$(\hat{n}\cdot\vec{\Omega}) > 0\f$ on the face,
+   * \f[
+   * \mathbf{A}(i,j)_{K}' = \mathbf{A}(i,j)_{K} +
+   * \int_{\partial K}(\hat{n}\cdot\vec{\Omega})\varphi_i(\vec{r})
+   * \varphi_j(\vec{r})dS
+   * \f]
+   * otherwise the matrix is not modified.
+   */
+  virtual void FillFaceOutflowTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Integrates the term coupling a cell to its upwind neighbor across
+   * an inflow face and fills a given matrix.
+   *
+   * If \f$(\hat{n}\cdot\vec{\Omega}) < 0\f$ on the face, with neighbor basis
+   * functions \f$\varphi^{n}\f$,
+   * \f[
+   * \mathbf{A}(i,j)_{K}' = \mathbf{A}(i,j)_{K} +
+   * \int_{\partial K}(\hat{n}\cdot\vec{\Omega})\varphi_i(\vec{r})
+   * \varphi^{n}_j(\vec{r})dS
+   * \f]
+   * otherwise the matrix is not modified. The face must be an interior face.
+   */
+  virtual void FillFaceInflowTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Returns \f$(\hat{n}\cdot\vec{\Omega})\f$ for a cell face. */
+  virtual double NormalDotOmega(
+      const domain::CellPtr<dim>& cell_ptr,
+      const domain::FaceIndex face_number,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point) = 0;
+
+  /*! \brief Integrates the isotropic fixed source and fills a given vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\frac{Q_g(\vec{r})}{4\pi}\varphi_i(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellFixedSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the isotropic scattering source and fills a given
+   * vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\sum_{g'}\frac{\sigma_{s,g'\to g}(\vec{r})}{4\pi}\phi_{g'}(\vec{r})
+   * \varphi_i(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellScatteringSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) = 0;
+
+  /*! \brief Integrates the isotropic fission source and fills a given vector.
+   *
+   * \f[
+   * \vec{b}(i)_{K,g}' = \vec{b}(i)_{K,g} +
+   * \int_{K}\sum_{g'}\frac{\chi_g\nu\sigma_{f,g'}(\vec{r})}{4\pi k_{\mathrm{eff}}}
+   * \phi_{g'}(\vec{r})\varphi_i(\vec{r})dV
+   * \f]
+   */
+  virtual void FillCellFissionSourceTerm(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) = 0;
+};
+
+} // namespace angular
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ANGULAR_UPWIND_TRANSPORT_I_H_
@@ -0,0 +1,132 @@
+#ifndef BART_SRC_FORMULATION_ASSEMBLY_KERNEL_H_
+#define BART_SRC_FORMULATION_ASSEMBLY_KERNEL_H_
+
+#include <array>
+#include <vector>
+
+#include <deal.II/base/exceptions.h>
+
+#include "domain/finite_element/finite_element_i.h"
+#include "formulation/formulation_types.h"
+
+namespace bart {
+
+namespace formulation {
+
+/*! \brief Cell matrix assembly with sizes fixed at compile time.
+ *
+ * For the Lagrange finite elements of degree \f$p\f$ used in BART, integrated
+ * using the \f$(p + 1)^d\f$ point Gaussian quadrature of FiniteElementGaussian,
+ * both the number of cell degrees of freedom and the number of cell
+ * quadrature points are \f$(p + 1)^d\f$. Local matrices are held in
+ * std::array so that all loops have constant bounds and can be unrolled and
+ * vectorized by the compiler.
+ *
+ * Formulations precalculate one local matrix per cell quadrature point, and
+ * cell terms are integrated as
+ * \f[
+ * \mathbf{A}' = \mathbf{A} + c\sum_q |J_q|\mathbf{M}_q
+ * \f]
+ * using AddIntegral.
+ *
+ * \tparam dim spatial dimension.
+ * \tparam degree polynomial degree of the finite element.
+ */
+template <int dim, int degree>
+class AssemblyKernel {
+ public:
+  static_assert(dim > 0 && dim <= 3, "AssemblyKernel dimension must be 1-3");
+  static_assert(degree > 0, "AssemblyKernel degree must be positive");
+
+  static constexpr int n_dofs = (dim == 1) ? (degree + 1) :
+                                (dim == 2) ? (degree + 1)*(degree + 1) :
+                                (degree + 1)*(degree + 1)*(degree + 1);
+  static constexpr int n_quadrature_points = n_dofs;
+  static constexpr int n_entries = n_dofs * n_dofs;
+
+  //! Row-major local matrix
+  using LocalMatrix = std::array<double, n_entries>;
+  using QuadratureValues = std::array<double, n_quadrature_points>;
+  //! One local matrix per cell quadrature point
+  using QuadratureMatrices = std::array<LocalMatrix, n_quadrature_points>;
+
+  /*! \brief Returns true if the finite element has the degree and sizes of
+   * this kernel. */
+  static bool IsSupported(
+      const domain::finite_element::FiniteElementI<dim>& finite_element) {
+    return finite_element.polynomial_degree() == degree &&
+        finite_element.dofs_per_cell() == n_dofs &&
+        finite_element.n_cell_quad_pts() == n_quadrature_points;
+  }
+
+  /*! \brief Copies precalculated matrices indexed by cell quadrature point.
+   *
+   * Quadrature matrices are large for higher degrees and dimensions, so they
+   * are filled in place rather than returned.
+   */
+  static void ToQuadratureMatrices(const std::vector<FullMatrix>& matrices,
+                                   QuadratureMatrices& to_fill) {
+    AssertThrow(static_cast<int>(matrices.size()) == n_quadrature_points,
+                dealii::ExcMessage("Error in AssemblyKernel, number of "
+                                   "matrices does not match the number of "
+                                   "quadrature points"))
+    for (int q = 0; q < n_quadrature_points; ++q)
+      ToLocalMatrix(matrices[q], to_fill[q]);
+  }
+
+  /*! \brief Copies a cell matrix into a row-major local matrix. */
+  static void ToLocalMatrix(const FullMatrix& matrix, LocalMatrix& to_fill) {
+    AssertThrow(static_cast<int>(matrix.m()) == n_dofs &&
+                static_cast<int>(matrix.n()) == n_dofs,
+                dealii::ExcMessage("Error in AssemblyKernel, matrix size does "
+                                   "not match the number of degrees of "
+                                   "freedom"))
+    for (int i = 0; i < n_dofs; ++i) {
+      for (int j = 0; j < n_dofs; ++j)
+        to_fill[i * n_dofs + j] = matrix(i, j);
+    }
+  }
+
+  /*! \brief Jacobian at each cell quadrature point of the current cell. */
+  static QuadratureValues Jacobians(
+      const domain::finite_element::FiniteElementI<dim>& finite_element) {
+    QuadratureValues jacobians;
+    for (int q = 0; q < n_quadrature_points; ++q)
+      jacobians[q] = finite_element.Jacobian(q);
+    return jacobians;
+  }
+
+  /*! \brief Adds \f$c\sum_q |J_q|\mathbf{M}_q\f$ to a cell matrix. */
+  static void AddIntegral(FullMatrix& to_fill,
+                          const double factor,
+                          const QuadratureValues& jacobians,
+                          const QuadratureMatrices& matrices) {
+    LocalMatrix integral{};
+    for (int q = 0; q < n_quadrature_points; ++q) {
+      const double weight = factor * jacobians[q];
+      const LocalMatrix& matrix = matrices[q];
+      for (int k = 0; k < n_entries; ++k)
+        integral[k] += weight * matrix[k];
+    }
+    AddToMatrix(to_fill, integral);
+  }
+
+  /*! \brief Adds a local matrix to a cell matrix, bypassing element access. */
+  static void AddToMatrix(FullMatrix& to_fill, const LocalMatrix& local_matrix) {
+    AssertThrow(static_cast<int>(to_fill.m()) == n_dofs &&
+                static_cast<int>(to_fill.n()) == n_dofs,
+                dealii::ExcMessage("Error in AssemblyKernel, cell matrix size "
+                                   "does not match the number of degrees of "
+                                   "freedom"))
+    // FullMatrix entries are stored contiguously in row-major order
+    double* const entries = &to_fill(0, 0);
+    for (int k = 0; k < n_entries; ++k)
+      entries[k] += local_matrix[k];
+  }
+};
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_ASSEMBLY_KERNEL_H_
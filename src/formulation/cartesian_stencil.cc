@@ -0,0 +1,111 @@
+#include "formulation/cartesian_stencil.h"
+
+#include <algorithm>
+
+namespace bart {
+
+namespace formulation {
+
+template <int dim>
+CartesianStencil<dim>::CartesianStencil(
+    std::shared_ptr<const domain::CartesianLattice<dim>> lattice_ptr)
+    : lattice_ptr_(lattice_ptr) {
+  AssertThrow(lattice_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of CartesianStencil, "
+                                 "lattice pointer is null"))
+  local_matrices_.assign(lattice_ptr_->cell_classes().size(), LocalMatrix{});
+}
+
+template <int dim>
+CartesianStencil<dim>& CartesianStencil<dim>::StampCellTerm(
+    const CellTermFunction& cell_function) {
+  const auto& cell_classes = lattice_ptr_->cell_classes();
+  formulation::FullMatrix cell_matrix(Kernel::n_dofs, Kernel::n_dofs);
+  LocalMatrix local_matrix;
+  for (std::size_t i = 0; i < cell_classes.size(); ++i) {
+    cell_matrix = 0;
+    cell_function(cell_matrix, cell_classes[i].cell);
+    Kernel::ToLocalMatrix(cell_matrix, local_matrix);
+    for (int k = 0; k < Kernel::n_entries; ++k)
+      local_matrices_[i][k] += local_matrix[k];
+  }
+  return *this;
+}
+
+template <int dim>
+CartesianStencil<dim>& CartesianStencil<dim>::StampBoundaryTerm(
+    const BoundaryTermFunction& boundary_function) {
+  const auto& cell_classes = lattice_ptr_->cell_classes();
+  formulation::FullMatrix cell_matrix(Kernel::n_dofs, Kernel::n_dofs);
+  LocalMatrix local_matrix;
+  for (std::size_t i = 0; i < cell_classes.size(); ++i) {
+    for (const int face : cell_classes[i].boundary_faces) {
+      cell_matrix = 0;
+      boundary_function(cell_matrix, domain::FaceIndex(face),
+                        cell_classes[i].cell);
+      Kernel::ToLocalMatrix(cell_matrix, local_matrix);
+      for (int k = 0; k < Kernel::n_entries; ++k)
+        local_matrices_[i][k] += local_matrix[k];
+    }
+  }
+  return *this;
+}
+
+template <int dim>
+void CartesianStencil<dim>::Clear() {
+  std::fill(local_matrices_.begin(), local_matrices_.end(), LocalMatrix{});
+}
+
+template <int dim>
+void CartesianStencil<dim>::Diagonal(dealii::Vector<double>& to_fill) const {
+  const auto& node_offsets = lattice_ptr_->node_offsets();
+  to_fill.reinit(lattice_ptr_->n_nodes());
+  for (const auto& run : lattice_ptr_->runs()) {
+    const LocalMatrix& local_matrix = local_matrices_[run.cell_class];
+    for (int i = 0; i < Kernel::n_dofs; ++i) {
+      const double entry = local_matrix[i * Kernel::n_dofs + i];
+      double* const diagonal = to_fill.begin() + run.first_node + node_offsets[i];
+      for (int cell = 0; cell < run.n_cells; ++cell)
+        diagonal[cell] += entry;
+    }
+  }
+}
+
+template <int dim>
+void CartesianStencil<dim>::vmult(dealii::Vector<double>& dst,
+                                  const dealii::Vector<double>& src) const {
+  AssertThrow(src.size() == lattice_ptr_->n_nodes(),
+              dealii::ExcMessage("Error in CartesianStencil vmult, vector size "
+                                 "does not match the number of lattice nodes"))
+  const auto& node_offsets = lattice_ptr_->node_offsets();
+  dst.reinit(src.size());
+
+  for (const auto& run : lattice_ptr_->runs()) {
+    const LocalMatrix& local_matrix = local_matrices_[run.cell_class];
+    for (int block_start = 0; block_start < run.n_cells;
+         block_start += kBlockSize) {
+      const int block_size = std::min(kBlockSize, run.n_cells - block_start);
+      const std::size_t block_node = run.first_node + block_start;
+      for (int i = 0; i < Kernel::n_dofs; ++i) {
+        double* const dst_row = dst.begin() + block_node + node_offsets[i];
+        for (int j = 0; j < Kernel::n_dofs; ++j) {
+          const double entry = local_matrix[i * Kernel::n_dofs + j];
+          if (entry == 0)
+            continue;
+          const double* const src_row =
+              src.begin() + block_node + node_offsets[j];
+          for (int cell = 0; cell < block_size; ++cell)
+            dst_row[cell] += entry * src_row[cell];
+        }
+      }
+    }
+  }
+}
+
+template class CartesianStencil<1>;
+template class CartesianStencil<2>;
+template class CartesianStencil<3>;
+
+} // namespace formulation
+
+} // namespace bart
@@ -0,0 +1,97 @@
+#ifndef BART_SRC_FORMULATION_CARTESIAN_STENCIL_H_
+#define BART_SRC_FORMULATION_CARTESIAN_STENCIL_H_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <deal.II/lac/vector.h>
+
+#include "domain/cartesian_lattice.h"
+#include "domain/domain_types.h"
+#include "formulation/assembly_kernel.h"
+#include "formulation/formulation_types.h"
+
+namespace bart {
+
+namespace formulation {
+
+/*! \brief Matrix-free operator for linear finite elements on a Cartesian mesh.
+ *
+ * On a uniform Cartesian mesh, all cells of the same domain::CartesianLattice
+ * cell class have the same local matrix. The operator is stored as one local
+ * matrix per cell class, calculated by evaluating the same cell and boundary
+ * functions used with a Stamper on the representative cell of each class,
+ * instead of a global sparse matrix.
+ *
+ * The operator is applied to vectors in lattice ordering. For each run of
+ * cells, each local matrix entry \f$a_{ij}\f$ is applied to all cells of the
+ * run as
+ * \f[
+ * y_{n + o_i} \mathrel{+}= a_{ij}x_{n + o_j}
+ * \f]
+ * where \f$n\f$ is the lowest node of each cell and \f$o_i\f$ are the constant
+ * node offsets. These loops are stride one with no index arrays, so they are
+ * vectorized by the compiler. Runs are split into blocks of kBlockSize cells so
+ * that the rows of the source and destination vectors used by a block stay in
+ * cache for all local matrix entries.
+ *
+ * Example use:
+ * \code{.cpp}
+ * CartesianStencil<2> stencil(lattice_ptr);
+ * stencil.StampCellTerm(cell_function).StampBoundaryTerm(boundary_function);
+ * stencil.vmult(y, x);
+ * \endcode
+ *
+ * @tparam dim spatial dimension.
+ */
+template <int dim>
+class CartesianStencil {
+ public:
+  using Kernel = AssemblyKernel<dim, 1>;
+  using LocalMatrix = typename Kernel::LocalMatrix;
+  using CellTermFunction = std::function<void(formulation::FullMatrix&,
+                                              const domain::CellPtr<dim>&)>;
+  using BoundaryTermFunction = std::function<void(formulation::FullMatrix&,
+                                                  const domain::FaceIndex,
+                                                  const domain::CellPtr<dim>&)>;
+
+  //! Number of cells in each block of a run
+  static constexpr int kBlockSize = 256;
+
+  explicit CartesianStencil(
+      std::shared_ptr<const domain::CartesianLattice<dim>> lattice_ptr);
+
+  /*! \brief Adds a cell term to the local matrix of each cell class. */
+  CartesianStencil& StampCellTerm(const CellTermFunction& cell_function);
+
+  /*! \brief Adds a boundary term for each boundary face of each cell class. */
+  CartesianStencil& StampBoundaryTerm(
+      const BoundaryTermFunction& boundary_function);
+
+  /*! \brief Sets all local matrices to zero. */
+  void Clear();
+
+  /*! \brief Fills a lattice ordered vector with the operator diagonal. */
+  void Diagonal(dealii::Vector<double>& to_fill) const;
+
+  /*! \brief Applies the operator, \f$y = \mathbf{A}x\f$, in lattice ordering. */
+  void vmult(dealii::Vector<double>& dst,
+             const dealii::Vector<double>& src) const;
+
+  const domain::CartesianLattice<dim>* lattice_ptr() const {
+    return lattice_ptr_.get(); }
+  const std::vector<LocalMatrix>& local_matrices() const {
+    return local_matrices_; }
+
+ private:
+  std::shared_ptr<const domain::CartesianLattice<dim>> lattice_ptr_;
+  //! Local matrix of each cell class
+  std::vector<LocalMatrix> local_matrices_;
+};
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_CARTESIAN_STENCIL_H_
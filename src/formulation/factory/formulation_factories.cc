@@ -2,7 +2,9 @@
 
 #include "formulation/stamper.h"
 #include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/angular/self_adjoint_angular_flux_kernel.h"
 #include "formulation/scalar/diffusion.h"
+#include "formulation/scalar/diffusion_kernel.h"
 
 namespace bart {
 
@@ -21,6 +23,10 @@ std::unique_ptr<formulation::scalar::DiffusionI<dim>> MakeDiffusionPtr(
     return_ptr = std::move(
         std::make_unique<scalar::Diffusion<dim>>(
             finite_element_ptr, cross_sections_ptr));
+  } else if (implementation ==
+      formulation::DiffusionFormulationImpl::kAssemblyKernel) {
+    return_ptr = scalar::MakeDiffusionKernelPtr<dim>(finite_element_ptr,
+                                                     cross_sections_ptr);
   }
 
   return return_ptr;
@@ -52,6 +58,10 @@ std::unique_ptr<angular::SelfAdjointAngularFluxI<dim>> MakeSAAFFormulationPtr(
     return_ptr = std::move(
         std::make_unique<angular::SelfAdjointAngularFlux<dim>>(
             finite_element_ptr, cross_sections_ptr, quadrature_set_ptr));
+  } else if (implementation ==
+      formulation::SAAFFormulationImpl::kAssemblyKernel) {
+    return_ptr = angular::MakeSelfAdjointAngularFluxKernelPtr<dim>(
+        finite_element_ptr, cross_sections_ptr, quadrature_set_ptr);
   }
 
   return return_ptr;
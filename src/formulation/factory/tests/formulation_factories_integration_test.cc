@@ -5,7 +5,9 @@
 // Built by factory
 #include "formulation/stamper.h"
 #include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/angular/self_adjoint_angular_flux_kernel.h"
 #include "formulation/scalar/diffusion.h"
+#include "formulation/scalar/diffusion_kernel.h"
 #include "formulation/updater/saaf_updater.h"
 
 // Dependencies and mocks
@@ -95,6 +97,57 @@ TYPED_TEST(FormulationFactoryTests, MakeDiffusionPtr) {
   ASSERT_NE(nullptr, dynamic_cast<ExpectedType*>(returned_ptr.get()));
 }
 
+TYPED_TEST(FormulationFactoryTests, MakeDiffusionPtrAssemblyKernel) {
+  constexpr int dim = this->dim;
+  using BaseType = formulation::scalar::DiffusionI<dim>;
+  using ExpectedType = formulation::scalar::DiffusionKernel<dim, 1>;
+  // Linear elements have 2^dim degrees of freedom and quadrature points
+  const int cell_dofs = 1 << dim;
+  ON_CALL(*this->finite_element_ptr_, polynomial_degree())
+      .WillByDefault(Return(1));
+  ON_CALL(*this->finite_element_ptr_, dofs_per_cell())
+      .WillByDefault(Return(cell_dofs));
+  ON_CALL(*this->finite_element_ptr_, n_cell_quad_pts())
+      .WillByDefault(Return(cell_dofs));
+
+  std::unique_ptr<BaseType> returned_ptr = nullptr;
+  EXPECT_NO_THROW({
+    returned_ptr = std::move(formulation::factory::MakeDiffusionPtr<dim>(
+        this->finite_element_ptr_,
+        this->cross_section_ptr_,
+        formulation::DiffusionFormulationImpl::kAssemblyKernel));
+  });
+  ASSERT_NE(returned_ptr, nullptr);
+  ASSERT_NE(nullptr, dynamic_cast<ExpectedType*>(returned_ptr.get()));
+}
+
+TYPED_TEST(FormulationFactoryTests, MakeSAAFFormulationPtrAssemblyKernel) {
+  constexpr int dim = this->dim;
+  using BaseType = formulation::angular::SelfAdjointAngularFluxI<dim>;
+  using ExpectedType = formulation::angular::SelfAdjointAngularFluxKernel<dim, 2>;
+  // Quadratic elements have 3^dim degrees of freedom and quadrature points
+  int cell_dofs = 1;
+  for (int i = 0; i < dim; ++i)
+    cell_dofs *= 3;
+  ON_CALL(*this->finite_element_ptr_, polynomial_degree())
+      .WillByDefault(Return(2));
+  ON_CALL(*this->finite_element_ptr_, dofs_per_cell())
+      .WillByDefault(Return(cell_dofs));
+  ON_CALL(*this->finite_element_ptr_, n_cell_quad_pts())
+      .WillByDefault(Return(cell_dofs));
+
+  std::unique_ptr<BaseType> returned_ptr = nullptr;
+  EXPECT_NO_THROW({
+    returned_ptr = std::move(formulation::factory::MakeSAAFFormulationPtr<dim>(
+        this->finite_element_ptr_,
+        this->cross_section_ptr_,
+        this->quadrature_ptr_,
+        formulation::SAAFFormulationImpl::kAssemblyKernel));
+  });
+  ASSERT_NE(returned_ptr, nullptr);
+  ASSERT_NE(nullptr, dynamic_cast<ExpectedType*>(returned_ptr.get()));
+}
+
 TYPED_TEST(FormulationFactoryTests, MakeDiffusionUpdaterPtr) {
   constexpr int dim = this->dim;
   using ExpectedType = formulation::updater::DiffusionUpdater<dim>;
@@ -20,10 +20,12 @@ enum class BoundaryType {
 
 enum class DiffusionFormulationImpl {
   kDefault = 0,
+  kAssemblyKernel = 1, //!< Cell terms specialized on finite element degree
 };
 
 enum class SAAFFormulationImpl {
   kDefault = 0,
+  kAssemblyKernel = 1, //!< Cell terms specialized on finite element degree
 };
 
 enum class StamperImpl {
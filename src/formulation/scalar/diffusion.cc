@@ -1,5 +1,7 @@
 #include "formulation/scalar/diffusion.h"
 
+#include <string>
+
 namespace bart {
 
 namespace formulation {
@@ -23,24 +25,22 @@ void Diffusion<dim>::Precalculate(const CellPtr& cell_ptr) {
 
   finite_element_->SetCell(cell_ptr);
 
-  for (int q = 0; q < cell_quadrature_points_; ++q) {
-    Matrix gradient_squared(cell_degrees_of_freedom_,
-                            cell_degrees_of_freedom_);
-    Matrix shape_squared(cell_degrees_of_freedom_,
-                         cell_degrees_of_freedom_);
+  const Matrix empty_matrix(cell_degrees_of_freedom_, cell_degrees_of_freedom_);
+  shape_squared_.assign(cell_quadrature_points_, empty_matrix);
+  auto& gradient_squared = gradient_squared_[cell_ptr->level()];
+  gradient_squared.assign(cell_quadrature_points_, empty_matrix);
 
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        shape_squared(i, j) =
+        shape_squared_[q](i, j) =
             finite_element_->ShapeValue(i, q) *
             finite_element_->ShapeValue(j, q);
-        gradient_squared(i, j) =
+        gradient_squared[q](i, j) =
             finite_element_->ShapeGradient(i, q) *
             finite_element_->ShapeGradient(j, q);
       }
     }
-    shape_squared_.push_back(shape_squared);
-    gradient_squared_.push_back(gradient_squared);
   }
   is_initialized_ = true;
 }
@@ -55,12 +55,13 @@ void Diffusion<dim>::FillCellStreamingTerm(Matrix& to_fill,
 
   const double diffusion_coef =
       cross_sections_->diffusion_coef.at(material_id)[group];
+  const auto& gradient_squared = GradientSquared(cell_ptr->level());
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     double jacobian = finite_element_->Jacobian(q);
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) += diffusion_coef * gradient_squared_[q](i, j) *jacobian;
+        to_fill(i, j) += diffusion_coef * gradient_squared[q](i, j) *jacobian;
       }
     }
   }
@@ -89,6 +90,33 @@ void Diffusion<dim>::FillCellCollisionTerm(Matrix& to_fill,
   }
 }
 
+template <int dim>
+void Diffusion<dim>::FillCellScatteringCouplingTerm(
+    Matrix& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group,
+    const GroupNumber source_group) const {
+  VerifyInitialized(__FUNCTION__);
+  AssertThrow(group != source_group,
+              dealii::ExcMessage("Error in Diffusion::FillCellScatteringCoupling"
+                                 "Term, in-group scattering is part of the "
+                                 "collision term"))
+  finite_element_->SetCell(cell_ptr);
+  int material_id = cell_ptr->material_id();
+
+  const double sigma_s =
+      cross_sections_->sigma_s.at(material_id)(group, source_group);
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) -= sigma_s * shape_squared_[q](i, j) * jacobian;
+      }
+    }
+  }
+}
+
 template <int dim>
 void Diffusion<dim>::FillBoundaryTerm(Matrix& to_fill,
                                       const CellPtr& cell_ptr,
@@ -124,8 +152,6 @@ void Diffusion<dim>::FillCellFixedSource(Vector& to_fill,
   } catch (std::exception&) {
     return;
   }
-  std::vector<double> cell_fixed_source(cell_quadrature_points_, q);
-
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_->Jacobian(q);
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
@@ -148,22 +174,18 @@ void Diffusion<dim>::FillCellFissionSource(
     finite_element_->SetCell(cell_ptr);
 
 
-    std::vector<double> fission_source_at_quad_points(cell_quadrature_points_);
+    std::vector<double> owned_source, owned_scalar_flux;
+    auto& fission_source_at_quad_points = SourceAtQuadrature(owned_source);
+    auto& scalar_flux_at_quad_points = MomentAtQuadrature(owned_scalar_flux);
 
     // Get fission source contribution from each group at each quadrature point
     for (const auto& moment_pair : group_moments) {
       auto &[index, moment] = moment_pair;
       int group_in = index[0];
       if (index[1] == 0 && index[2] == 0) {
-        std::vector<double> scalar_flux_at_quad_points(cell_quadrature_points_);
-
-        if (group_in == group) {
-          scalar_flux_at_quad_points =
-              finite_element_->ValueAtQuadrature(in_group_moment);
-        } else {
-          scalar_flux_at_quad_points =
-              finite_element_->ValueAtQuadrature(moment);
-        }
+        finite_element_->ValueAtQuadrature(
+            group_in == group ? in_group_moment : moment,
+            scalar_flux_at_quad_points);
 
         auto fission_transfer =
             cross_sections_->fiss_transfer.at(material_id)(group_in, group);
@@ -197,7 +219,9 @@ void Diffusion<dim>::FillCellScatteringSource(
   finite_element_->SetCell(cell_ptr);
   int material_id = cell_ptr->material_id();
 
-  std::vector<double> scattering_source_at_quad_points(cell_quadrature_points_);
+  std::vector<double> owned_source, owned_scalar_flux;
+  auto& scattering_source_at_quad_points = SourceAtQuadrature(owned_source);
+  auto& scalar_flux_at_quad_points = MomentAtQuadrature(owned_scalar_flux);
 
   // Get fission source contribution from each group at each quadrature point
   for (const auto& moment_pair : group_moments) {
@@ -206,10 +230,7 @@ void Diffusion<dim>::FillCellScatteringSource(
 
     // Check if scalar flux for an out-group
     if ((group_in != group) && (harmonic_l == 0) && (harmonic_m == 0)) {
-      std::vector<double> scalar_flux_at_quad_points(cell_quadrature_points_);
-
-      scalar_flux_at_quad_points =
-            finite_element_->ValueAtQuadrature(moment);
+      finite_element_->ValueAtQuadrature(moment, scalar_flux_at_quad_points);
 
       const auto sigma_s =
           cross_sections_->sigma_s.at(material_id)(group, group_in);
@@ -231,6 +252,33 @@ void Diffusion<dim>::FillCellScatteringSource(
   }
 }
 
+template <int dim>
+std::vector<double>& Diffusion<dim>::SourceAtQuadrature(
+    std::vector<double>& owned_storage) const {
+  auto& source = workspace_ptr_ == nullptr ?
+      owned_storage : workspace_ptr_->source_at_quadrature();
+  source.assign(cell_quadrature_points_, 0);
+  return source;
+}
+
+template <int dim>
+std::vector<double>& Diffusion<dim>::MomentAtQuadrature(
+    std::vector<double>& owned_storage) const {
+  return workspace_ptr_ == nullptr ?
+      owned_storage : workspace_ptr_->moment_at_quadrature();
+}
+
+template <int dim>
+auto Diffusion<dim>::GradientSquared(const int level) const
+-> const std::vector<Matrix>& {
+  const auto gradient_squared_it = gradient_squared_.find(level);
+  AssertThrow(gradient_squared_it != gradient_squared_.end(),
+              dealii::ExcMessage("Error in Diffusion, gradient matrices have "
+                                 "not been precalculated for refinement level "
+                                 + std::to_string(level)))
+  return gradient_squared_it->second;
+}
+
 template<int dim>
 void Diffusion<dim>::VerifyInitialized(std::string called_function_name) const {
   if (!is_initialized_) {
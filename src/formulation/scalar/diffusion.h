@@ -1,6 +1,7 @@
 #ifndef BART_SRC_FORMULATION_SCALAR_DIFFUSION_H_
 #define BART_SRC_FORMULATION_SCALAR_DIFFUSION_H_
 
+#include <map>
 #include <memory>
 
 #include <deal.II/lac/full_matrix.h>
@@ -9,6 +10,7 @@
 #include "data/cross_sections.h"
 #include "domain/finite_element/finite_element_i.h"
 #include "formulation/scalar/diffusion_i.h"
+#include "system/workspace.h"
 
 namespace bart {
 
@@ -31,9 +33,14 @@ class Diffusion : public DiffusionI<dim> {
   Diffusion(std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
             std::shared_ptr<data::CrossSections> cross_sections);
 
-  /*! \brief Precalculate matrices.
+  /*! \brief Precalculate matrices for cells on the refinement level of a cell.
    *
-   * \param cell_ptr any cell, no Jacobian is used so this is arbitrary.
+   * Shape function products do not depend on the cell, but gradient products
+   * scale with the cell size, so they are stored for each refinement level.
+   * This must be called with a cell of each refinement level of the mesh, all
+   * cells on a level of the Cartesian meshes share the same geometry.
+   *
+   * \param cell_ptr any cell on the refinement level to precalculate.
    */
   void Precalculate(const CellPtr& cell_ptr) override;
 
@@ -45,6 +52,11 @@ class Diffusion : public DiffusionI<dim> {
                              const CellPtr& cell_ptr,
                              const GroupNumber group) const override;
 
+  void FillCellScatteringCouplingTerm(Matrix& to_fill,
+                                      const CellPtr& cell_ptr,
+                                      const GroupNumber group,
+                                      const GroupNumber source_group) const override;
+
   void FillBoundaryTerm(Matrix& to_fill,
                         const CellPtr& cell_ptr,
                         const FaceNumber face_number,
@@ -76,30 +88,52 @@ class Diffusion : public DiffusionI<dim> {
   }
 
   /*! \brief Get precalculated matrices for the square of the gradient
-   * of the shape function.
+   * of the shape function on a refinement level.
    *
+   * \param level refinement level, must have been precalculated.
    * \return Vector containing matrices corresponding to each quadrature point.
    */
-  std::vector<Matrix> GetGradientSquared() const {
-    return gradient_squared_;
+  std::vector<Matrix> GetGradientSquared(const int level) const {
+    return GradientSquared(level);
   }
 
   bool is_initialized() const override { return is_initialized_; }
 
+  /*! \brief Use preallocated source buffers from a workspace instead of
+   * making them for each cell. */
+  Diffusion& SetWorkspace(std::shared_ptr<system::Workspace> workspace_ptr) {
+    workspace_ptr_ = workspace_ptr;
+    return *this;
+  }
+  system::Workspace* workspace_ptr() const { return workspace_ptr_.get(); }
+
  protected:
   //! Finite element object to provide shape function values
   std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_;
   //! Cross-sections object for cross-section data
   std::shared_ptr<data::CrossSections> cross_sections_;
+  //! Optional scratch storage for source terms
+  std::shared_ptr<system::Workspace> workspace_ptr_ = nullptr;
 
-  //Precalculated matrices
+  //Precalculated matrices, gradient products are stored by refinement level
   std::vector<Matrix> shape_squared_;
-  std::vector<Matrix> gradient_squared_;
+  std::map<int, std::vector<Matrix>> gradient_squared_;
 
   int cell_degrees_of_freedom_ = 0; //!< Number of degrees of freedom per cell
   int cell_quadrature_points_ = 0; //!< Number of quadrature points per cell
   int face_quadrature_points_ = 0; //!< Number of quadrature points per face
 
+  /*! \brief Returns a zeroed source buffer with one entry per cell quadrature
+   * point, from the workspace if one is set, otherwise the owned storage. */
+  std::vector<double>& SourceAtQuadrature(
+      std::vector<double>& owned_storage) const;
+  /*! \brief Returns a buffer for moment values at the cell quadrature points,
+   * from the workspace if one is set, otherwise the owned storage. */
+  std::vector<double>& MomentAtQuadrature(
+      std::vector<double>& owned_storage) const;
+  /*! \brief Returns the precalculated gradient products of a refinement
+   * level, throws if the level has not been precalculated. */
+  const std::vector<Matrix>& GradientSquared(const int level) const;
   void VerifyInitialized(std::string called_function_name) const;
   bool is_initialized_ = false;
 };
@@ -41,6 +41,17 @@ class DiffusionI : public utility::HasDescription {
                              const CellPtr& cell_ptr,
                              const GroupNumber group) const = 0;
 
+  /*! \brief Fills the scattering transfer from a source group, as an
+   * off-diagonal block of a multigroup left hand side.
+   *
+   * The term is the negative of the scattering source from the source group,
+   * so it can be added directly to the left hand side.
+   */
+  virtual void FillCellScatteringCouplingTerm(Matrix& to_fill,
+                                              const CellPtr& cell_ptr,
+                                              const GroupNumber group,
+                                              const GroupNumber source_group) const = 0;
+
   virtual void FillBoundaryTerm(Matrix& to_fill,
                         const CellPtr& cell_ptr,
                         const FaceNumber face_number,
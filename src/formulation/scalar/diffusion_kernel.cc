@@ -0,0 +1,137 @@
+#include "formulation/scalar/diffusion_kernel.h"
+
+#include <string>
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+template <int dim, int degree>
+DiffusionKernel<dim, degree>::DiffusionKernel(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
+    std::shared_ptr<data::CrossSections> cross_sections)
+    : Diffusion<dim>(finite_element, cross_sections) {
+  AssertThrow(Kernel::IsSupported(*finite_element),
+              dealii::ExcMessage("Error in constructor of DiffusionKernel, "
+                                 "finite element does not match the kernel "
+                                 "degree"))
+  this->set_description("Diffusion Formulation, degree "
+                            + std::to_string(degree) + " assembly kernel",
+                        utility::DefaultImplementation(false));
+}
+
+template <int dim, int degree>
+void DiffusionKernel<dim, degree>::Precalculate(const CellPtr& cell_ptr) {
+  Diffusion<dim>::Precalculate(cell_ptr);
+  const int level = cell_ptr->level();
+  Kernel::ToQuadratureMatrices(this->shape_squared_, kernel_shape_squared_);
+  Kernel::ToQuadratureMatrices(this->GradientSquared(level),
+                               kernel_gradient_squared_[level]);
+}
+
+template <int dim, int degree>
+void DiffusionKernel<dim, degree>::FillCellStreamingTerm(
+    Matrix& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group) const {
+  this->VerifyInitialized(__FUNCTION__);
+  this->finite_element_->SetCell(cell_ptr);
+  const int material_id = cell_ptr->material_id();
+
+  const double diffusion_coef =
+      this->cross_sections_->diffusion_coef.at(material_id)[group];
+
+  const int level = cell_ptr->level();
+  const auto gradient_squared_it = kernel_gradient_squared_.find(level);
+  AssertThrow(gradient_squared_it != kernel_gradient_squared_.end(),
+              dealii::ExcMessage("Error in DiffusionKernel::FillCellStreaming"
+                                 "Term, gradient matrices have not been "
+                                 "precalculated for refinement level "
+                                 + std::to_string(level)))
+
+  Kernel::AddIntegral(to_fill, diffusion_coef,
+                      Kernel::Jacobians(*this->finite_element_),
+                      gradient_squared_it->second);
+}
+
+template <int dim, int degree>
+void DiffusionKernel<dim, degree>::FillCellCollisionTerm(
+    Matrix& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group) const {
+  this->VerifyInitialized(__FUNCTION__);
+  this->finite_element_->SetCell(cell_ptr);
+  const int material_id = cell_ptr->material_id();
+
+  const double sigma_t = this->cross_sections_->sigma_t.at(material_id)[group];
+  const double sigma_s =
+      this->cross_sections_->sigma_s.at(material_id)(group, group);
+
+  Kernel::AddIntegral(to_fill, sigma_t - sigma_s,
+                      Kernel::Jacobians(*this->finite_element_),
+                      kernel_shape_squared_);
+}
+
+template <int dim, int degree>
+void DiffusionKernel<dim, degree>::FillCellScatteringCouplingTerm(
+    Matrix& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group,
+    const GroupNumber source_group) const {
+  this->VerifyInitialized(__FUNCTION__);
+  AssertThrow(group != source_group,
+              dealii::ExcMessage("Error in DiffusionKernel::FillCellScattering"
+                                 "CouplingTerm, in-group scattering is part of "
+                                 "the collision term"))
+  this->finite_element_->SetCell(cell_ptr);
+  const int material_id = cell_ptr->material_id();
+
+  const double sigma_s =
+      this->cross_sections_->sigma_s.at(material_id)(group, source_group);
+
+  Kernel::AddIntegral(to_fill, -sigma_s,
+                      Kernel::Jacobians(*this->finite_element_),
+                      kernel_shape_squared_);
+}
+
+template <int dim>
+std::unique_ptr<DiffusionI<dim>> MakeDiffusionKernelPtr(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
+    std::shared_ptr<data::CrossSections> cross_sections) {
+  switch (finite_element->polynomial_degree()) {
+    case 1:
+      return std::make_unique<DiffusionKernel<dim, 1>>(finite_element,
+                                                       cross_sections);
+    case 2:
+      return std::make_unique<DiffusionKernel<dim, 2>>(finite_element,
+                                                       cross_sections);
+    default:
+      break;
+  }
+  return std::make_unique<Diffusion<dim>>(finite_element, cross_sections);
+}
+
+template class DiffusionKernel<1, 1>;
+template class DiffusionKernel<2, 1>;
+template class DiffusionKernel<3, 1>;
+template class DiffusionKernel<1, 2>;
+template class DiffusionKernel<2, 2>;
+template class DiffusionKernel<3, 2>;
+
+template std::unique_ptr<DiffusionI<1>> MakeDiffusionKernelPtr<1>(
+    std::shared_ptr<domain::finite_element::FiniteElementI<1>>,
+    std::shared_ptr<data::CrossSections>);
+template std::unique_ptr<DiffusionI<2>> MakeDiffusionKernelPtr<2>(
+    std::shared_ptr<domain::finite_element::FiniteElementI<2>>,
+    std::shared_ptr<data::CrossSections>);
+template std::unique_ptr<DiffusionI<3>> MakeDiffusionKernelPtr<3>(
+    std::shared_ptr<domain::finite_element::FiniteElementI<3>>,
+    std::shared_ptr<data::CrossSections>);
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
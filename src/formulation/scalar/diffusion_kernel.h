@@ -0,0 +1,77 @@
+#ifndef BART_SRC_FORMULATION_SCALAR_DIFFUSION_KERNEL_H_
+#define BART_SRC_FORMULATION_SCALAR_DIFFUSION_KERNEL_H_
+
+#include <map>
+#include <memory>
+
+#include "formulation/assembly_kernel.h"
+#include "formulation/scalar/diffusion.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+/*! \brief Diffusion formulation with cell terms specialized on the finite
+ * element degree.
+ *
+ * The precalculated shape and gradient matrices are copied into fixed size
+ * arrays and the cell streaming, collision, and scattering coupling terms are
+ * integrated using AssemblyKernel. Boundary and source terms use the generic
+ * Diffusion implementation.
+ *
+ * \tparam dim spatial dimension.
+ * \tparam degree polynomial degree of the finite element.
+ */
+template <int dim, int degree>
+class DiffusionKernel : public Diffusion<dim> {
+ public:
+  using Kernel = AssemblyKernel<dim, degree>;
+  using typename Diffusion<dim>::CellPtr;
+  using typename Diffusion<dim>::Matrix;
+  using typename Diffusion<dim>::GroupNumber;
+
+  DiffusionKernel(
+      std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
+      std::shared_ptr<data::CrossSections> cross_sections);
+
+  void Precalculate(const CellPtr& cell_ptr) override;
+
+  void FillCellStreamingTerm(Matrix& to_fill,
+                             const CellPtr& cell_ptr,
+                             const GroupNumber group) const override;
+
+  void FillCellCollisionTerm(Matrix& to_fill,
+                             const CellPtr& cell_ptr,
+                             const GroupNumber group) const override;
+
+  void FillCellScatteringCouplingTerm(Matrix& to_fill,
+                                      const CellPtr& cell_ptr,
+                                      const GroupNumber group,
+                                      const GroupNumber source_group) const override;
+
+ private:
+  typename Kernel::QuadratureMatrices kernel_shape_squared_;
+  //! Gradient products for each precalculated refinement level
+  std::map<int, typename Kernel::QuadratureMatrices> kernel_gradient_squared_;
+};
+
+/*! \brief Makes a diffusion formulation specialized on the polynomial degree
+ * of the finite element.
+ *
+ * If no kernel is compiled for the degree, the generic Diffusion formulation
+ * is returned.
+ */
+template <int dim>
+std::unique_ptr<DiffusionI<dim>> MakeDiffusionKernelPtr(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
+    std::shared_ptr<data::CrossSections> cross_sections);
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_SCALAR_DIFFUSION_KERNEL_H_
@@ -0,0 +1,371 @@
+#include "formulation/scalar/simplified_pn.h"
+
+#include <sstream>
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+template<int dim>
+SimplifiedPN<dim>::SimplifiedPN(
+    std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
+    std::shared_ptr<data::CrossSections> cross_sections,
+    const int order)
+    : finite_element_(finite_element),
+      cross_sections_(cross_sections),
+      coefficients_(order),
+      cell_degrees_of_freedom_(finite_element->dofs_per_cell()),
+      cell_quadrature_points_(finite_element->n_cell_quad_pts()),
+      face_quadrature_points_(finite_element->n_face_quad_pts()) {
+  this->set_description("Simplified P" + std::to_string(order)
+                            + " Formulation",
+                        utility::DefaultImplementation(true));
+}
+
+template <int dim>
+void SimplifiedPN<dim>::Precalculate(const CellPtr& cell_ptr) {
+
+  finite_element_->SetCell(cell_ptr);
+
+  const Matrix empty_matrix(cell_degrees_of_freedom_, cell_degrees_of_freedom_);
+  shape_squared_.assign(cell_quadrature_points_, empty_matrix);
+  auto& gradient_squared = gradient_squared_[cell_ptr->level()];
+  gradient_squared.assign(cell_quadrature_points_, empty_matrix);
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        shape_squared_[q](i, j) =
+            finite_element_->ShapeValue(i, q) *
+            finite_element_->ShapeValue(j, q);
+        gradient_squared[q](i, j) =
+            finite_element_->ShapeGradient(i, q) *
+            finite_element_->ShapeGradient(j, q);
+      }
+    }
+  }
+  is_initialized_ = true;
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillCellStreamingTerm(
+    Matrix& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group,
+    const EquationNumber equation) const {
+  VerifyInitialized(__FUNCTION__);
+  VerifyEquation(equation, __FUNCTION__);
+  finite_element_->SetCell(cell_ptr);
+  int material_id = cell_ptr->material_id();
+
+  const double streaming_coef =
+      coefficients_.diffusion_factor(equation) *
+      cross_sections_->inverse_sigma_t.at(material_id)[group];
+  const auto& gradient_squared = GradientSquared(cell_ptr->level());
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) += streaming_coef * gradient_squared[q](i, j) * jacobian;
+      }
+    }
+  }
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillCellCollisionTerm(
+    Matrix& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group,
+    const EquationNumber equation) const {
+  VerifyInitialized(__FUNCTION__);
+  VerifyEquation(equation, __FUNCTION__);
+  finite_element_->SetCell(cell_ptr);
+  int material_id = cell_ptr->material_id();
+
+  const double sigma_t = cross_sections_->sigma_t.at(material_id)[group];
+  const double sigma_s = cross_sections_->sigma_s.at(material_id)(group, group);
+  const double sigma_r =
+      sigma_t * coefficients_.total_removal()(equation, equation)
+          - sigma_s * coefficients_.scattering_removal()(equation, equation);
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+        to_fill(i, j) += sigma_r * shape_squared_[q](i, j) * jacobian;
+      }
+    }
+  }
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillBoundaryTerm(
+    Matrix& to_fill,
+    const CellPtr& cell_ptr,
+    const FaceNumber face_number,
+    const BoundaryType boundary_type,
+    const EquationNumber equation) const {
+  VerifyInitialized(__FUNCTION__);
+  VerifyEquation(equation, __FUNCTION__);
+  if (boundary_type == BoundaryType::kVacuum) {
+    finite_element_->SetFace(cell_ptr, domain::FaceIndex(face_number));
+    const double boundary_coef = coefficients_.boundary()(equation, equation);
+
+    for (int q = 0; q < face_quadrature_points_; ++q) {
+      const double jacobian = finite_element_->FaceJacobian(q);
+      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+        for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
+          to_fill(i, j) +=
+              boundary_coef * jacobian * finite_element_->FaceShapeValue(i, q)
+                  * finite_element_->FaceShapeValue(j, q);
+        }
+      }
+    }
+  }
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillCellFixedSource(
+    Vector& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group,
+    const EquationNumber equation) const {
+  VerifyEquation(equation, __FUNCTION__);
+  finite_element_->SetCell(cell_ptr);
+  int material_id = cell_ptr->material_id();
+  double q = 0;
+  try {
+    q = cross_sections_->q.at(material_id).at(group);
+  } catch (std::exception&) {
+    return;
+  }
+  std::vector<double> cell_fixed_source(
+      cell_quadrature_points_, coefficients_.source_factor(equation) * q);
+  FillCellSourceTerm(to_fill, cell_fixed_source);
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillCellFissionSource(
+    Vector& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group,
+    const EquationNumber equation,
+    const double k_effective,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentsMap& group_moments) const {
+  VerifyEquation(equation, __FUNCTION__);
+  int material_id = cell_ptr->material_id();
+  if (cross_sections_->is_material_fissile.at(material_id)) {
+    finite_element_->SetCell(cell_ptr);
+
+    std::vector<double> fission_source_at_quad_points(cell_quadrature_points_);
+
+    // Get fission source contribution from each group at each quadrature point
+    for (const auto& [index, moment] : group_moments) {
+      const auto &[group_in, harmonic_l, harmonic_m] = index;
+      if (harmonic_l == 0 && harmonic_m == 0) {
+        const auto scalar_flux_at_quad_points =
+            finite_element_->ValueAtQuadrature(
+                group_in == group ? in_group_moment : moment);
+
+        const double fission_transfer =
+            cross_sections_->fiss_transfer.at(material_id)(group_in, group);
+
+        for (int q = 0; q < cell_quadrature_points_; ++q)
+          fission_source_at_quad_points[q] +=
+              fission_transfer * scalar_flux_at_quad_points[q];
+      }
+    }
+
+    const double source_factor =
+        coefficients_.source_factor(equation) / k_effective;
+    for (auto& fission_source : fission_source_at_quad_points)
+      fission_source *= source_factor;
+
+    FillCellSourceTerm(to_fill, fission_source_at_quad_points);
+  }
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillCellScatteringSource(
+    Vector& to_fill,
+    const CellPtr& cell_ptr,
+    const GroupNumber group,
+    const EquationNumber equation,
+    const system::moments::MomentsMap& group_moments) const {
+  VerifyEquation(equation, __FUNCTION__);
+  finite_element_->SetCell(cell_ptr);
+  int material_id = cell_ptr->material_id();
+
+  std::vector<double> scattering_source_at_quad_points(cell_quadrature_points_);
+
+  // Out-group scattering source, only the scalar flux is scattered
+  for (const auto& [index, moment] : group_moments) {
+    const auto &[group_in, harmonic_l, harmonic_m] = index;
+
+    if ((group_in != group) && (harmonic_l == 0) && (harmonic_m == 0)) {
+      const auto scalar_flux_at_quad_points =
+          finite_element_->ValueAtQuadrature(moment);
+
+      const double sigma_s =
+          cross_sections_->sigma_s.at(material_id)(group, group_in);
+
+      for (int q = 0; q < cell_quadrature_points_; ++q)
+        scattering_source_at_quad_points[q] +=
+            sigma_s * scalar_flux_at_quad_points[q];
+    }
+  }
+
+  for (auto& scattering_source : scattering_source_at_quad_points)
+    scattering_source *= coefficients_.source_factor(equation);
+
+  // Lagged removal coupling to the other unknowns of the group
+  const int n_equations = coefficients_.n_equations();
+  if (n_equations > 1) {
+    std::vector<std::vector<double>> even_moments;
+    for (int i = 0; i < n_equations; ++i)
+      even_moments.push_back(finite_element_->ValueAtQuadrature(
+          group_moments.at({group, 2 * i, 0})));
+    const auto unknowns = CalculateUnknowns(even_moments);
+
+    const double sigma_t = cross_sections_->sigma_t.at(material_id)[group];
+    const double sigma_s = cross_sections_->sigma_s.at(material_id)(group, group);
+
+    for (int k = 0; k < n_equations; ++k) {
+      if (k == equation)
+        continue;
+      const double sigma_r =
+          sigma_t * coefficients_.total_removal()(equation, k)
+              - sigma_s * coefficients_.scattering_removal()(equation, k);
+      for (int q = 0; q < cell_quadrature_points_; ++q)
+        scattering_source_at_quad_points[q] -= sigma_r * unknowns[k][q];
+    }
+  }
+
+  FillCellSourceTerm(to_fill, scattering_source_at_quad_points);
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillBoundaryCouplingSource(
+    Vector& to_fill,
+    const CellPtr& cell_ptr,
+    const FaceNumber face_number,
+    const BoundaryType boundary_type,
+    const GroupNumber group,
+    const EquationNumber equation,
+    const system::moments::MomentsMap& group_moments) const {
+  VerifyEquation(equation, __FUNCTION__);
+  const int n_equations = coefficients_.n_equations();
+  if (boundary_type != BoundaryType::kVacuum || n_equations == 1)
+    return;
+
+  finite_element_->SetFace(cell_ptr, domain::FaceIndex(face_number));
+
+  std::vector<std::vector<double>> even_moments;
+  for (int i = 0; i < n_equations; ++i)
+    even_moments.push_back(finite_element_->ValueAtFaceQuadrature(
+        group_moments.at({group, 2 * i, 0})));
+  const auto unknowns = CalculateUnknowns(even_moments);
+
+  std::vector<double> boundary_source(face_quadrature_points_);
+  for (int k = 0; k < n_equations; ++k) {
+    if (k == equation)
+      continue;
+    for (int q = 0; q < face_quadrature_points_; ++q)
+      boundary_source[q] -=
+          coefficients_.boundary()(equation, k) * unknowns[k][q];
+  }
+
+  for (int q = 0; q < face_quadrature_points_; ++q) {
+    const double jacobian = finite_element_->FaceJacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i)
+      to_fill(i) += finite_element_->FaceShapeValue(i, q) * jacobian
+          * boundary_source[q];
+  }
+}
+
+template <int dim>
+std::vector<std::vector<double>> SimplifiedPN<dim>::CalculateUnknowns(
+    const std::vector<std::vector<double>>& even_moments) const {
+  const int n_equations = coefficients_.n_equations();
+  const auto& moments_to_unknowns = coefficients_.moments_to_unknowns();
+  const std::size_t n_points = even_moments.at(0).size();
+
+  std::vector<std::vector<double>> unknowns(n_equations,
+                                            std::vector<double>(n_points));
+  for (int k = 0; k < n_equations; ++k) {
+    for (int i = 0; i < n_equations; ++i) {
+      const double factor = moments_to_unknowns(k, i);
+      if (factor == 0)
+        continue;
+      for (std::size_t q = 0; q < n_points; ++q)
+        unknowns[k][q] += factor * even_moments[i][q];
+    }
+  }
+  return unknowns;
+}
+
+template <int dim>
+void SimplifiedPN<dim>::FillCellSourceTerm(
+    Vector& to_fill,
+    const std::vector<double>& source) const {
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i)
+      to_fill(i) += finite_element_->ShapeValue(i, q) * source[q] * jacobian;
+  }
+}
+
+template <int dim>
+auto SimplifiedPN<dim>::GradientSquared(const int level) const
+-> const std::vector<Matrix>& {
+  const auto gradient_squared_it = gradient_squared_.find(level);
+  AssertThrow(gradient_squared_it != gradient_squared_.end(),
+              dealii::ExcMessage("Error in SimplifiedPN, gradient matrices "
+                                 "have not been precalculated for refinement "
+                                 "level " + std::to_string(level)))
+  return gradient_squared_it->second;
+}
+
+template<int dim>
+void SimplifiedPN<dim>::VerifyInitialized(
+    std::string called_function_name) const {
+  if (!is_initialized_) {
+
+    std::ostringstream error_string;
+    error_string << "Error in SimplifiedPN function "
+                 << called_function_name
+                 << ": formulation has not been initialized, call Precalculate "
+                 << "prior to filing any cell matrices or vectors.";
+
+    AssertThrow(false,
+                dealii::ExcMessage(error_string.str()))
+  }
+}
+
+template<int dim>
+void SimplifiedPN<dim>::VerifyEquation(const EquationNumber equation,
+                                       std::string called_function_name) const {
+  if (equation < 0 || equation >= coefficients_.n_equations()) {
+    std::ostringstream error_string;
+    error_string << "Error in SimplifiedPN function " << called_function_name
+                 << ": equation number " << equation << " is out of range";
+
+    AssertThrow(false,
+                dealii::ExcMessage(error_string.str()))
+  }
+}
+
+template class SimplifiedPN<1>;
+template class SimplifiedPN<2>;
+template class SimplifiedPN<3>;
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
@@ -0,0 +1,146 @@
+#ifndef BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_H_
+#define BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <deal.II/lac/full_matrix.h>
+
+#include "system/moments/spherical_harmonic_types.h"
+#include "data/cross_sections.h"
+#include "domain/finite_element/finite_element_i.h"
+#include "formulation/scalar/simplified_pn_coefficients.h"
+#include "formulation/scalar/simplified_pn_i.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+/*! \brief Default implementation of the simplified \f$P_N\f$ formulation.
+ *
+ * Cell matrices are integrated in the same way as for the Diffusion
+ * formulation, using precalculated shape function and gradient products, and
+ * scaled by the coefficients of each equation.
+ */
+template <int dim>
+class SimplifiedPN : public SimplifiedPNI<dim> {
+ public:
+  using typename SimplifiedPNI<dim>::BoundaryType;
+
+  using typename SimplifiedPNI<dim>::CellPtr;
+  using typename SimplifiedPNI<dim>::Matrix;
+  using typename SimplifiedPNI<dim>::Vector;
+  using typename SimplifiedPNI<dim>::GroupNumber;
+  using typename SimplifiedPNI<dim>::FaceNumber;
+  using typename SimplifiedPNI<dim>::EquationNumber;
+
+  /*! \brief Constructor.
+   *
+   * \param order odd order of the equations, i.e. 3 for \f$SP_3\f$.
+   */
+  SimplifiedPN(std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
+               std::shared_ptr<data::CrossSections> cross_sections,
+               const int order);
+
+  /*! \brief Precalculate matrices for the refinement level of a cell.
+   *
+   * Gradient products depend on the cell size and are stored by refinement
+   * level, so a cell of each level of the mesh must be precalculated.
+   *
+   * \param cell_ptr any cell on the refinement level to precalculate.
+   */
+  void Precalculate(const CellPtr& cell_ptr) override;
+
+  void FillCellStreamingTerm(Matrix& to_fill,
+                             const CellPtr& cell_ptr,
+                             const GroupNumber group,
+                             const EquationNumber equation) const override;
+
+  void FillCellCollisionTerm(Matrix& to_fill,
+                             const CellPtr& cell_ptr,
+                             const GroupNumber group,
+                             const EquationNumber equation) const override;
+
+  void FillBoundaryTerm(Matrix& to_fill,
+                        const CellPtr& cell_ptr,
+                        const FaceNumber face_number,
+                        const BoundaryType boundary_type,
+                        const EquationNumber equation) const override;
+
+  void FillCellFixedSource(Vector& to_fill,
+                           const CellPtr& cell_ptr,
+                           const GroupNumber group,
+                           const EquationNumber equation) const override;
+
+  void FillCellFissionSource(Vector& to_fill,
+                             const CellPtr& cell_ptr,
+                             const GroupNumber group,
+                             const EquationNumber equation,
+                             const double k_effective,
+                             const system::moments::MomentVector& in_group_moment,
+                             const system::moments::MomentsMap& group_moments) const override;
+
+  void FillCellScatteringSource(Vector& to_fill,
+                                const CellPtr& cell_ptr,
+                                const GroupNumber group,
+                                const EquationNumber equation,
+                                const system::moments::MomentsMap& group_moments) const override;
+
+  void FillBoundaryCouplingSource(Vector& to_fill,
+                                  const CellPtr& cell_ptr,
+                                  const FaceNumber face_number,
+                                  const BoundaryType boundary_type,
+                                  const GroupNumber group,
+                                  const EquationNumber equation,
+                                  const system::moments::MomentsMap& group_moments) const override;
+
+  int n_equations() const override { return coefficients_.n_equations(); }
+  bool is_initialized() const override { return is_initialized_; }
+
+  const SimplifiedPNCoefficients& coefficients() const { return coefficients_; }
+
+ protected:
+  /*! \brief Calculates the unknowns of a group from its even moments.
+   *
+   * \param even_moments values of each even moment \f$\phi_{2i}\f$ at a set
+   *        of points.
+   * \return values of each unknown \f$\Psi_k\f$ at the same points.
+   */
+  std::vector<std::vector<double>> CalculateUnknowns(
+      const std::vector<std::vector<double>>& even_moments) const;
+  void FillCellSourceTerm(Vector& to_fill,
+                          const std::vector<double>& source) const;
+  //! Precalculated gradient products of a refinement level
+  const std::vector<Matrix>& GradientSquared(const int level) const;
+  void VerifyInitialized(std::string called_function_name) const;
+  void VerifyEquation(const EquationNumber equation,
+                      std::string called_function_name) const;
+
+  //! Finite element object to provide shape function values
+  std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_;
+  //! Cross-sections object for cross-section data
+  std::shared_ptr<data::CrossSections> cross_sections_;
+  const SimplifiedPNCoefficients coefficients_;
+
+  //Precalculated matrices, gradient products are stored by refinement level
+  std::vector<Matrix> shape_squared_;
+  std::map<int, std::vector<Matrix>> gradient_squared_;
+
+  int cell_degrees_of_freedom_ = 0; //!< Number of degrees of freedom per cell
+  int cell_quadrature_points_ = 0; //!< Number of quadrature points per cell
+  int face_quadrature_points_ = 0; //!< Number of quadrature points per face
+
+  bool is_initialized_ = false;
+};
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_H_
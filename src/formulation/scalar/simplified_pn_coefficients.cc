@@ -0,0 +1,101 @@
+#include "formulation/scalar/simplified_pn_coefficients.h"
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature_lib.h>
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+namespace {
+
+/*! Value of the Legendre polynomial of degree n, using the Bonnet recursion */
+double Legendre(const int n, const double x) {
+  double previous = 1.0, current = x;
+  if (n == 0)
+    return previous;
+  for (int k = 1; k < n; ++k) {
+    const double next = ((2*k + 1) * x * current - k * previous)/(k + 1);
+    previous = current;
+    current = next;
+  }
+  return current;
+}
+
+} // namespace
+
+SimplifiedPNCoefficients::SimplifiedPNCoefficients(const int order)
+    : order_(order),
+      n_equations_((order + 1)/2) {
+  AssertThrow(order > 0 && order % 2 == 1,
+              dealii::ExcMessage("Error in constructor of "
+                                 "SimplifiedPNCoefficients, order must be a "
+                                 "positive odd number"))
+  const int n = n_equations_;
+
+  // Unknowns are Psi_j = (2j + 1)phi_2j + (2j + 2)phi_2j+2
+  moments_to_unknowns_.reinit(n, n);
+  for (int j = 0; j < n; ++j) {
+    moments_to_unknowns_(j, j) = 2*j + 1;
+    if (j + 1 < n)
+      moments_to_unknowns_(j, j + 1) = 2*j + 2;
+  }
+  unknowns_to_moments_.reinit(n, n);
+  unknowns_to_moments_.invert(moments_to_unknowns_);
+
+  // Even moment equation i has the streaming terms a_i Psi_i and b_i Psi_i-1,
+  // the latter is eliminated using the combination of the previous equations
+  Matrix combination(n, n);
+  for (int j = 0; j < n; ++j) {
+    diffusion_factors_.push_back((2.0*j + 1)/((4*j + 1)*(4*j + 3)));
+    combination(j, j) = 1.0;
+    if (j > 0) {
+      const double b = (2.0*j)/((4*j + 1)*(4*j - 1));
+      for (int i = 0; i < j; ++i)
+        combination(j, i) = -b/diffusion_factors_.at(j - 1)
+            * combination(j - 1, i);
+    }
+    source_factors_.push_back(combination(j, 0));
+  }
+
+  total_removal_.reinit(n, n);
+  scattering_removal_.reinit(n, n);
+  combination.mmult(total_removal_, unknowns_to_moments_);
+  for (int j = 0; j < n; ++j) {
+    for (int k = 0; k < n; ++k)
+      scattering_removal_(j, k) = combination(j, 0) * unknowns_to_moments_(0, k);
+  }
+
+  // Marshak vacuum conditions give the outgoing odd moments in terms of the
+  // even moments, phi_2j+1 = sum_i (4i + 1) I(2i, 2j + 1) phi_2i
+  boundary_.reinit(n, n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      const double odd_moment_factor =
+          (2.0*j + 1)/(4*j + 1) * (4*i + 1)
+              * HalfRangeLegendreIntegral(2*i, 2*j + 1);
+      for (int k = 0; k < n; ++k)
+        boundary_(j, k) += odd_moment_factor * unknowns_to_moments_(i, k);
+    }
+  }
+}
+
+double SimplifiedPNCoefficients::HalfRangeLegendreIntegral(const int n,
+                                                           const int m) const {
+  // Exact for the polynomial of degree n + m <= 2 * order_ + 1
+  const dealii::QGauss<1> quadrature(order_ + 2);
+  double integral = 0;
+  for (unsigned int q = 0; q < quadrature.size(); ++q) {
+    const double mu = quadrature.point(q)[0];
+    integral += quadrature.weight(q) * Legendre(n, mu) * Legendre(m, mu);
+  }
+  return integral;
+}
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
@@ -0,0 +1,84 @@
+#ifndef BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_COEFFICIENTS_H_
+#define BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_COEFFICIENTS_H_
+
+#include <vector>
+
+#include <deal.II/lac/full_matrix.h>
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+/*! \brief Coefficients of the simplified \f$P_N\f$ equations.
+ *
+ * The \f$SP_N\f$ equations, for odd \f$N\f$, are \f$(N + 1)/2\f$ coupled
+ * diffusion-like equations for the unknowns
+ * \f[
+ * \Psi_j = (2j + 1)\phi_{2j} + (2j + 2)\phi_{2j + 2}, \quad
+ * j = 0, \ldots, \frac{N - 1}{2}
+ * \f]
+ * where \f$\phi_n\f$ is the \f$n\f$th Legendre moment of the angular flux and
+ * \f$\phi_{N + 1} = 0\f$. The equations are combined so that each has only
+ * one streaming term. With isotropic scattering, equation \f$j\f$ is
+ * \f[
+ * -a_j\nabla\cdot\frac{1}{\sigma_t}\nabla\Psi_j + \sum_{k}\left(
+ * \sigma_tR^t_{jk} - \sigma_{s}R^s_{jk}\right)\Psi_k = c_jQ
+ * \f]
+ * and the vacuum (Marshak) boundary term is \f$\sum_k G_{jk}\Psi_k\f$. For
+ * \f$N = 1\f$ this is the diffusion equation with
+ * \f$D = 1/3\sigma_t\f$.
+ *
+ * Coefficients are indexed by equation \f$j\f$ and unknown \f$k\f$.
+ */
+class SimplifiedPNCoefficients {
+ public:
+  using Matrix = dealii::FullMatrix<double>;
+  /*! \brief Constructor.
+   *
+   * \param order odd order \f$N\f$ of the equations.
+   */
+  explicit SimplifiedPNCoefficients(const int order);
+
+  int order() const { return order_; }
+  int n_equations() const { return n_equations_; }
+  //! Streaming coefficient \f$a_j\f$ of each equation
+  double diffusion_factor(const int equation) const {
+    return diffusion_factors_.at(equation); }
+  //! Factor \f$c_j\f$ multiplying isotropic sources in each equation
+  double source_factor(const int equation) const {
+    return source_factors_.at(equation); }
+  //! Total cross-section removal coefficients \f$R^t\f$
+  const Matrix& total_removal() const { return total_removal_; }
+  //! Scattering cross-section removal coefficients \f$R^s\f$
+  const Matrix& scattering_removal() const { return scattering_removal_; }
+  //! Vacuum boundary coefficients \f$G\f$
+  const Matrix& boundary() const { return boundary_; }
+  //! Maps even moments \f$\phi_{2i}\f$ to unknowns \f$\Psi_j\f$
+  const Matrix& moments_to_unknowns() const { return moments_to_unknowns_; }
+  //! Maps unknowns \f$\Psi_j\f$ to even moments \f$\phi_{2i}\f$
+  const Matrix& unknowns_to_moments() const { return unknowns_to_moments_; }
+
+ private:
+  //! Integral of the product of two Legendre polynomials over [0, 1]
+  double HalfRangeLegendreIntegral(const int n, const int m) const;
+
+  const int order_;
+  const int n_equations_;
+  std::vector<double> diffusion_factors_;
+  std::vector<double> source_factors_;
+  Matrix total_removal_;
+  Matrix scattering_removal_;
+  Matrix boundary_;
+  Matrix moments_to_unknowns_;
+  Matrix unknowns_to_moments_;
+};
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_COEFFICIENTS_H_
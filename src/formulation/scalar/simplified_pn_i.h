@@ -0,0 +1,112 @@
+#ifndef BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_I_H_
+#define BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_I_H_
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/dofs/dof_accessor.h>
+
+#include "formulation/scalar/diffusion_i.h"
+#include "system/moments/spherical_harmonic_types.h"
+#include "utility/has_description.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+/*! \brief Interface for simplified \f$P_N\f$ formulations.
+ *
+ * Each group is solved as a set of diffusion-like equations, indexed by
+ * equation number (see SimplifiedPNCoefficients). The left hand side of each
+ * equation only includes the terms of its own unknown, so it is symmetric and
+ * can be solved with the same solvers as the diffusion equation. The coupling
+ * to the other unknowns of the group is lagged, and is included in the
+ * scattering source and boundary coupling source, using the unknowns
+ * calculated from the current even Legendre moments \f$\phi_{g}^{2i, 0}\f$.
+ */
+template <int dim>
+class SimplifiedPNI : public utility::HasDescription {
+ public:
+  using BoundaryType = typename DiffusionI<dim>::BoundaryType;
+
+  using CellPtr = typename DiffusionI<dim>::CellPtr;
+  using Matrix = typename DiffusionI<dim>::Matrix;
+  using Vector = typename DiffusionI<dim>::Vector;
+  using GroupNumber = typename DiffusionI<dim>::GroupNumber;
+  using FaceNumber = typename DiffusionI<dim>::FaceNumber;
+  using EquationNumber = int;
+
+  virtual ~SimplifiedPNI() = default;
+
+  virtual void Precalculate(const CellPtr& cell_ptr) = 0;
+
+  /*! \brief Fills the streaming term of an equation,
+   * \f$a_j\int_K\frac{1}{\sigma_t}\nabla\varphi_i\cdot\nabla\varphi_j dV\f$.
+   */
+  virtual void FillCellStreamingTerm(Matrix& to_fill,
+                                     const CellPtr& cell_ptr,
+                                     const GroupNumber group,
+                                     const EquationNumber equation) const = 0;
+
+  /*! \brief Fills the removal term of an equation for its own unknown. */
+  virtual void FillCellCollisionTerm(Matrix& to_fill,
+                                     const CellPtr& cell_ptr,
+                                     const GroupNumber group,
+                                     const EquationNumber equation) const = 0;
+
+  /*! \brief Fills the vacuum boundary term of an equation for its own
+   * unknown, reflective boundaries have no boundary term.
+   */
+  virtual void FillBoundaryTerm(Matrix& to_fill,
+                                const CellPtr& cell_ptr,
+                                const FaceNumber face_number,
+                                const BoundaryType boundary_type,
+                                const EquationNumber equation) const = 0;
+
+  virtual void FillCellFixedSource(Vector& to_fill,
+                                   const CellPtr& cell_ptr,
+                                   const GroupNumber group,
+                                   const EquationNumber equation) const = 0;
+
+  virtual void FillCellFissionSource(
+      Vector& to_fill,
+      const CellPtr& cell_ptr,
+      const GroupNumber group,
+      const EquationNumber equation,
+      const double k_effective,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) const = 0;
+
+  /*! \brief Fills the out-group scattering source, and the removal coupling
+   * to the other unknowns of the group.
+   */
+  virtual void FillCellScatteringSource(
+      Vector& to_fill,
+      const CellPtr& cell_ptr,
+      const GroupNumber group,
+      const EquationNumber equation,
+      const system::moments::MomentsMap& group_moments) const = 0;
+
+  /*! \brief Fills the vacuum boundary coupling to the other unknowns of the
+   * group.
+   */
+  virtual void FillBoundaryCouplingSource(
+      Vector& to_fill,
+      const CellPtr& cell_ptr,
+      const FaceNumber face_number,
+      const BoundaryType boundary_type,
+      const GroupNumber group,
+      const EquationNumber equation,
+      const system::moments::MomentsMap& group_moments) const = 0;
+
+  virtual int n_equations() const = 0;
+  virtual bool is_initialized() const = 0;
+};
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_SCALAR_SIMPLIFIED_PN_I_H_
@@ -0,0 +1,164 @@
+#include "formulation/scalar/diffusion_kernel.h"
+
+#include <deal.II/base/tensor.h>
+
+#include "data/cross_sections.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "material/tests/mock_material.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return, ::testing::Invoke, ::testing::_;
+
+/* Tests that the degree one assembly kernel gives the same cell matrices as the
+ * generic diffusion formulation. The finite element mock returns shape values,
+ * gradients and Jacobians that vary with degree of freedom and quadrature
+ * point so that every term of the sums contributes differently. All cells
+ * have material 0.
+ */
+template <typename DimensionWrapper>
+class FormulationScalarDiffusionKernelTest :
+    public ::testing::Test,
+    public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using FiniteElementType = NiceMock<domain::finite_element::FiniteElementMock<dim>>;
+  using KernelFormulationType = formulation::scalar::DiffusionKernel<dim, 1>;
+  using GenericFormulationType = formulation::scalar::Diffusion<dim>;
+
+  std::shared_ptr<FiniteElementType> mock_finite_element_ptr_;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  const int cell_dofs_ = KernelFormulationType::Kernel::n_dofs;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void FormulationScalarDiffusionKernelTest<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  mock_finite_element_ptr_ = std::make_shared<FiniteElementType>();
+
+  ON_CALL(*mock_finite_element_ptr_, polynomial_degree())
+      .WillByDefault(Return(1));
+  ON_CALL(*mock_finite_element_ptr_, dofs_per_cell())
+      .WillByDefault(Return(cell_dofs_));
+  ON_CALL(*mock_finite_element_ptr_, n_cell_quad_pts())
+      .WillByDefault(Return(cell_dofs_));
+  ON_CALL(*mock_finite_element_ptr_, n_face_quad_pts())
+      .WillByDefault(Return(cell_dofs_));
+  ON_CALL(*mock_finite_element_ptr_, ShapeValue(_, _))
+      .WillByDefault(Invoke([](const int i, const int q) {
+        return 1.0 + i + 0.5 * q; }));
+  ON_CALL(*mock_finite_element_ptr_, Jacobian(_))
+      .WillByDefault(Invoke([](const int q) { return 0.25 * (q + 1); }));
+  ON_CALL(*mock_finite_element_ptr_, ShapeGradient(_, _))
+      .WillByDefault(Invoke([](const int i, const int q) {
+        dealii::Tensor<1, dim> gradient;
+        for (int d = 0; d < dim; ++d)
+          gradient[d] = i - q + 0.5 * d;
+        return gradient; }));
+
+  std::unordered_map<int, std::vector<double>> sigma_t{{0, {1.0, 2.0}}};
+  std::unordered_map<int, std::vector<double>> diffusion_coef{{0, {0.5, 0.25}}};
+  std::array<double, 4> sigma_s_values{0.25, 0.5, 0.75, 1.0};
+  std::unordered_map<int, dealii::FullMatrix<double>> sigma_s{
+      {0, dealii::FullMatrix<double>(2, 2, sigma_s_values.begin())}};
+
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t));
+  ON_CALL(mock_material_, GetDiffusionCoef())
+      .WillByDefault(Return(diffusion_coef));
+  ON_CALL(mock_material_, GetSigS()).WillByDefault(Return(sigma_s));
+  ON_CALL(mock_material_, GetFissileIDMap()).WillByDefault(Return(
+      std::unordered_map<int, bool>{{0, false}}));
+  cross_sections_ptr_ = std::make_shared<data::CrossSections>(mock_material_);
+}
+
+TYPED_TEST_SUITE(FormulationScalarDiffusionKernelTest,
+                 bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationScalarDiffusionKernelTest, Constructor) {
+  constexpr int dim = this->dim;
+  EXPECT_NO_THROW({
+    typename TestFixture::KernelFormulationType(this->mock_finite_element_ptr_,
+                                                this->cross_sections_ptr_);
+  });
+  // Quadratic finite element does not match the degree one kernel
+  int quadratic_dofs = 1;
+  for (int i = 0; i < dim; ++i)
+    quadratic_dofs *= 3;
+  ON_CALL(*this->mock_finite_element_ptr_, dofs_per_cell())
+      .WillByDefault(Return(quadratic_dofs));
+  EXPECT_ANY_THROW({
+    typename TestFixture::KernelFormulationType(this->mock_finite_element_ptr_,
+                                                this->cross_sections_ptr_);
+  });
+  // Same sizes but a different polynomial degree
+  ON_CALL(*this->mock_finite_element_ptr_, dofs_per_cell())
+      .WillByDefault(Return(this->cell_dofs_));
+  ON_CALL(*this->mock_finite_element_ptr_, polynomial_degree())
+      .WillByDefault(Return(2));
+  EXPECT_ANY_THROW({
+    typename TestFixture::KernelFormulationType(this->mock_finite_element_ptr_,
+                                                this->cross_sections_ptr_);
+  });
+}
+
+TYPED_TEST(FormulationScalarDiffusionKernelTest, NotInitialized) {
+  typename TestFixture::KernelFormulationType test_formulation(
+      this->mock_finite_element_ptr_, this->cross_sections_ptr_);
+  dealii::FullMatrix<double> to_fill(this->cell_dofs_, this->cell_dofs_);
+  EXPECT_ANY_THROW({
+    test_formulation.FillCellStreamingTerm(to_fill, this->cells_.at(0), 0);
+  });
+}
+
+TYPED_TEST(FormulationScalarDiffusionKernelTest, MatchesGenericFormulation) {
+  const int cell_dofs = this->cell_dofs_;
+  typename TestFixture::KernelFormulationType test_formulation(
+      this->mock_finite_element_ptr_, this->cross_sections_ptr_);
+  typename TestFixture::GenericFormulationType generic_formulation(
+      this->mock_finite_element_ptr_, this->cross_sections_ptr_);
+  const auto& cell = this->cells_.at(0);
+  test_formulation.Precalculate(cell);
+  generic_formulation.Precalculate(cell);
+
+  for (const int group : {0, 1}) {
+    dealii::FullMatrix<double> expected(cell_dofs, cell_dofs),
+        result(cell_dofs, cell_dofs);
+
+    generic_formulation.FillCellStreamingTerm(expected, cell, group);
+    test_formulation.FillCellStreamingTerm(result, cell, group);
+    EXPECT_TRUE(bart::test_helpers::AreEqual(expected, result));
+
+    // Kernel adds to the matrix passed
+    generic_formulation.FillCellCollisionTerm(expected, cell, group);
+    test_formulation.FillCellCollisionTerm(result, cell, group);
+    EXPECT_TRUE(bart::test_helpers::AreEqual(expected, result));
+
+    const int source_group = 1 - group;
+    generic_formulation.FillCellScatteringCouplingTerm(expected, cell, group,
+                                                       source_group);
+    test_formulation.FillCellScatteringCouplingTerm(result, cell, group,
+                                                    source_group);
+    EXPECT_TRUE(bart::test_helpers::AreEqual(expected, result));
+  }
+}
+
+TYPED_TEST(FormulationScalarDiffusionKernelTest, BadMatrixSize) {
+  typename TestFixture::KernelFormulationType test_formulation(
+      this->mock_finite_element_ptr_, this->cross_sections_ptr_);
+  test_formulation.Precalculate(this->cells_.at(0));
+  dealii::FullMatrix<double> to_fill(this->cell_dofs_ + 1, this->cell_dofs_);
+  EXPECT_ANY_THROW({
+    test_formulation.FillCellCollisionTerm(to_fill, this->cells_.at(0), 0);
+  });
+}
+
+} // namespace
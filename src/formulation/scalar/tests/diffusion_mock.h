@@ -33,6 +33,10 @@ class DiffusionMock : public DiffusionI<dim> {
   MOCK_METHOD(void, FillCellCollisionTerm,
               (Matrix&, const CellPtr&, const GroupNumber), (const, override));
 
+  MOCK_METHOD(void, FillCellScatteringCouplingTerm,
+              (Matrix&, const CellPtr&, const GroupNumber, const GroupNumber),
+              (const, override));
+
   MOCK_METHOD(void, FillBoundaryTerm,
               (Matrix&, const CellPtr&, const FaceNumber, const BoundaryType),
               (const, override));
@@ -150,7 +150,7 @@ TEST_F(FormulationCFEMDiffusionTest, PrecalculateTest) {
 
   test_diffusion.Precalculate(cell_ptr_);
   auto shape_squared = test_diffusion.GetShapeSquared();
-  auto gradient_squared = test_diffusion.GetGradientSquared();
+  auto gradient_squared = test_diffusion.GetGradientSquared(cell_ptr_->level());
 
   EXPECT_TRUE(AreEqual(shape_matrix_q_0, shape_squared.at(0)));
   EXPECT_TRUE(AreEqual(shape_matrix_q_1, shape_squared.at(1)));
@@ -159,6 +159,37 @@ TEST_F(FormulationCFEMDiffusionTest, PrecalculateTest) {
   EXPECT_TRUE(test_diffusion.is_initialized());
 }
 
+// Gradient matrices are precalculated for each refinement level
+TEST_F(FormulationCFEMDiffusionTest, PrecalculateRefinementLevelsTest) {
+  dealii::Triangulation<2> refined_triangulation;
+  dealii::GridGenerator::hyper_cube(refined_triangulation, 0, 1);
+  refined_triangulation.refine_global(1);
+  dealii::DoFHandler<2> refined_dof_handler(refined_triangulation);
+  refined_dof_handler.distribute_dofs(fe_);
+  auto refined_cell_ptr = refined_dof_handler.begin_active();
+  refined_cell_ptr->set_material_id(this->fissile_material_id_);
+  const int level = cell_ptr_->level(), refined_level = refined_cell_ptr->level();
+  ASSERT_NE(level, refined_level);
+
+  formulation::scalar::Diffusion<2> test_diffusion(fe_mock_ptr, cross_sections_ptr);
+  dealii::FullMatrix<double> test_matrix(2, 2);
+
+  test_diffusion.Precalculate(cell_ptr_);
+  EXPECT_NO_THROW(test_diffusion.GetGradientSquared(level));
+  EXPECT_ANY_THROW(test_diffusion.GetGradientSquared(refined_level));
+  EXPECT_ANY_THROW({
+    test_diffusion.FillCellStreamingTerm(test_matrix, refined_cell_ptr, 0);
+  });
+
+  test_diffusion.Precalculate(refined_cell_ptr);
+  EXPECT_EQ(test_diffusion.GetShapeSquared().size(), 2);
+  EXPECT_EQ(test_diffusion.GetGradientSquared(level).size(), 2);
+  EXPECT_EQ(test_diffusion.GetGradientSquared(refined_level).size(), 2);
+  EXPECT_NO_THROW({
+    test_diffusion.FillCellStreamingTerm(test_matrix, refined_cell_ptr, 0);
+  });
+}
+
 TEST_F(FormulationCFEMDiffusionTest, FillCellStreamingTermTest) {
   dealii::FullMatrix<double> test_matrix(2,2);
 
@@ -205,6 +236,36 @@ TEST_F(FormulationCFEMDiffusionTest, FillCellCollisionTermTest) {
   EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
 }
 
+TEST_F(FormulationCFEMDiffusionTest, FillCellScatteringCouplingTermTest) {
+  dealii::FullMatrix<double> test_matrix(2,2);
+
+  // Negative of sigma_s(group, source_group) times the mass matrix
+  std::array<double, 4> expected_group_0_values{-3.0, -6.0,
+                                                -6.0, -13.5};
+  std::array<double, 4> expected_group_1_values{-4.5, -9.0,
+                                                -9.0, -20.25};
+  std::array<dealii::FullMatrix<double>, 2> expected_matrices{
+      dealii::FullMatrix<double>(2, 2, expected_group_0_values.begin()),
+      dealii::FullMatrix<double>(2, 2, expected_group_1_values.begin())};
+
+  formulation::scalar::Diffusion<2> test_diffusion(fe_mock_ptr, cross_sections_ptr);
+
+  EXPECT_ANY_THROW({
+    test_diffusion.FillCellScatteringCouplingTerm(test_matrix, cell_ptr_, 0, 1);
+                   });
+  test_diffusion.Precalculate(cell_ptr_);
+  EXPECT_ANY_THROW({
+    test_diffusion.FillCellScatteringCouplingTerm(test_matrix, cell_ptr_, 0, 0);
+                   });
+
+  for (int group = 0; group < 2; ++group) {
+    test_matrix = 0;
+    test_diffusion.FillCellScatteringCouplingTerm(test_matrix, cell_ptr_,
+                                                  group, 1 - group);
+    EXPECT_TRUE(AreEqual(expected_matrices.at(group), test_matrix));
+  }
+}
+
 TEST_F(FormulationCFEMDiffusionTest, FillBoundaryTermTestReflective) {
   dealii::FullMatrix<double> test_matrix(2,2);
   dealii::FullMatrix<double> expected_matrix(2,2);
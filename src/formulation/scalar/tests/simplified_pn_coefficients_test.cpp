@@ -0,0 +1,116 @@
+#include "formulation/scalar/simplified_pn_coefficients.h"
+
+#include <array>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+using formulation::scalar::SimplifiedPNCoefficients;
+
+class FormulationSimplifiedPNCoefficientsTest : public ::testing::Test {
+ protected:
+  using Matrix = dealii::FullMatrix<double>;
+  void ExpectMatrixNear(const Matrix& expected, const Matrix& result) {
+    ASSERT_EQ(expected.m(), result.m());
+    ASSERT_EQ(expected.n(), result.n());
+    for (unsigned int i = 0; i < expected.m(); ++i) {
+      for (unsigned int j = 0; j < expected.n(); ++j)
+        EXPECT_NEAR(expected(i, j), result(i, j), 1e-12)
+            << "Entry (" << i << ", " << j << ")";
+    }
+  }
+};
+
+TEST_F(FormulationSimplifiedPNCoefficientsTest, BadOrderThrows) {
+  for (const int order : {-1, 0, 2, 4}) {
+    EXPECT_ANY_THROW({ SimplifiedPNCoefficients test_coefficients(order); });
+  }
+}
+
+// SP1 is the diffusion equation, with D = 1/3 sigma_t and the Marshak vacuum
+// boundary condition
+TEST_F(FormulationSimplifiedPNCoefficientsTest, SP1IsDiffusion) {
+  SimplifiedPNCoefficients test_coefficients(1);
+
+  EXPECT_EQ(test_coefficients.order(), 1);
+  ASSERT_EQ(test_coefficients.n_equations(), 1);
+  EXPECT_NEAR(test_coefficients.diffusion_factor(0), 1.0/3.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.source_factor(0), 1.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.total_removal()(0, 0), 1.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.scattering_removal()(0, 0), 1.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.boundary()(0, 0), 0.5, 1e-12);
+}
+
+TEST_F(FormulationSimplifiedPNCoefficientsTest, SP3) {
+  SimplifiedPNCoefficients test_coefficients(3);
+
+  ASSERT_EQ(test_coefficients.n_equations(), 2);
+  EXPECT_NEAR(test_coefficients.diffusion_factor(0), 1.0/3.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.diffusion_factor(1), 3.0/35.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.source_factor(0), 1.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.source_factor(1), -2.0/5.0, 1e-12);
+
+  Matrix expected_moments_to_unknowns(2, 2), expected_unknowns_to_moments(2, 2),
+      expected_total_removal(2, 2), expected_scattering_removal(2, 2),
+      expected_boundary(2, 2);
+  expected_moments_to_unknowns(0, 0) = 1;
+  expected_moments_to_unknowns(0, 1) = 2;
+  expected_moments_to_unknowns(1, 1) = 3;
+  expected_unknowns_to_moments(0, 0) = 1;
+  expected_unknowns_to_moments(0, 1) = -2.0/3.0;
+  expected_unknowns_to_moments(1, 1) = 1.0/3.0;
+  expected_total_removal(0, 0) = 1;
+  expected_total_removal(0, 1) = -2.0/3.0;
+  expected_total_removal(1, 0) = -2.0/5.0;
+  expected_total_removal(1, 1) = 3.0/5.0;
+  expected_scattering_removal(0, 0) = 1;
+  expected_scattering_removal(0, 1) = -2.0/3.0;
+  expected_scattering_removal(1, 0) = -2.0/5.0;
+  expected_scattering_removal(1, 1) = 4.0/15.0;
+  expected_boundary(0, 0) = 1.0/2.0;
+  expected_boundary(0, 1) = -1.0/8.0;
+  expected_boundary(1, 0) = -3.0/40.0;
+  expected_boundary(1, 1) = 7.0/40.0;
+
+  ExpectMatrixNear(expected_moments_to_unknowns,
+                   test_coefficients.moments_to_unknowns());
+  ExpectMatrixNear(expected_unknowns_to_moments,
+                   test_coefficients.unknowns_to_moments());
+  ExpectMatrixNear(expected_total_removal, test_coefficients.total_removal());
+  ExpectMatrixNear(expected_scattering_removal,
+                   test_coefficients.scattering_removal());
+  ExpectMatrixNear(expected_boundary, test_coefficients.boundary());
+}
+
+TEST_F(FormulationSimplifiedPNCoefficientsTest, SP5) {
+  SimplifiedPNCoefficients test_coefficients(5);
+
+  ASSERT_EQ(test_coefficients.n_equations(), 3);
+  EXPECT_NEAR(test_coefficients.diffusion_factor(2), 5.0/99.0, 1e-12);
+  EXPECT_NEAR(test_coefficients.source_factor(2), 8.0/27.0, 1e-12);
+
+  std::array<double, 9> total_removal_values{
+       1.0,      -2.0/3.0,  8.0/15.0,
+      -2.0/5.0,   3.0/5.0, -12.0/25.0,
+       8.0/27.0, -4.0/9.0,  5.0/9.0};
+  std::array<double, 9> scattering_removal_values{
+       1.0,      -2.0/3.0,   8.0/15.0,
+      -2.0/5.0,   4.0/15.0, -16.0/75.0,
+       8.0/27.0, -16.0/81.0, 64.0/405.0};
+  std::array<double, 9> boundary_values{
+       1.0/2.0,   -1.0/8.0,      1.0/16.0,
+      -3.0/40.0,   7.0/40.0,   -41.0/640.0,
+       5.0/144.0, -205.0/3456.0, 407.0/3456.0};
+
+  ExpectMatrixNear(Matrix(3, 3, total_removal_values.begin()),
+                   test_coefficients.total_removal());
+  ExpectMatrixNear(Matrix(3, 3, scattering_removal_values.begin()),
+                   test_coefficients.scattering_removal());
+  ExpectMatrixNear(Matrix(3, 3, boundary_values.begin()),
+                   test_coefficients.boundary());
+}
+
+} // namespace
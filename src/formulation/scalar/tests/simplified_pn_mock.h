@@ -0,0 +1,68 @@
+#ifndef BART_SRC_FORMULATION_SCALAR_TESTS_SIMPLIFIED_PN_MOCK_H_
+#define BART_SRC_FORMULATION_SCALAR_TESTS_SIMPLIFIED_PN_MOCK_H_
+
+#include "system/moments/spherical_harmonic_types.h"
+#include "formulation/scalar/simplified_pn_i.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace scalar {
+
+template <int dim>
+class SimplifiedPNMock : public SimplifiedPNI<dim> {
+ public:
+  using typename SimplifiedPNI<dim>::BoundaryType;
+
+  using typename SimplifiedPNI<dim>::CellPtr;
+  using typename SimplifiedPNI<dim>::Matrix;
+  using typename SimplifiedPNI<dim>::Vector;
+  using typename SimplifiedPNI<dim>::GroupNumber;
+  using typename SimplifiedPNI<dim>::FaceNumber;
+  using typename SimplifiedPNI<dim>::EquationNumber;
+
+  MOCK_METHOD(void, Precalculate, (const CellPtr& cell_ptr), (override));
+
+  MOCK_METHOD(void, FillCellStreamingTerm,
+              (Matrix&, const CellPtr&, const GroupNumber,
+                  const EquationNumber), (const, override));
+
+  MOCK_METHOD(void, FillCellCollisionTerm,
+              (Matrix&, const CellPtr&, const GroupNumber,
+                  const EquationNumber), (const, override));
+
+  MOCK_METHOD(void, FillBoundaryTerm,
+              (Matrix&, const CellPtr&, const FaceNumber, const BoundaryType,
+                  const EquationNumber), (const, override));
+
+  MOCK_METHOD(void, FillCellFixedSource,
+              (Vector&, const CellPtr&, const GroupNumber,
+                  const EquationNumber), (const, override));
+
+  MOCK_METHOD(void, FillCellFissionSource,
+              (Vector&, const CellPtr&, const GroupNumber, const EquationNumber,
+                  const double, const system::moments::MomentVector&,
+                  const system::moments::MomentsMap&), (const, override));
+
+  MOCK_METHOD(void, FillCellScatteringSource,
+              (Vector&, const CellPtr&, const GroupNumber, const EquationNumber,
+                  const system::moments::MomentsMap&), (const, override));
+
+  MOCK_METHOD(void, FillBoundaryCouplingSource,
+              (Vector&, const CellPtr&, const FaceNumber, const BoundaryType,
+                  const GroupNumber, const EquationNumber,
+                  const system::moments::MomentsMap&), (const, override));
+
+  MOCK_METHOD(int, n_equations, (), (const, override));
+  MOCK_METHOD(bool, is_initialized, (), (const, override));
+};
+
+} // namespace scalar
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_SCALAR_TESTS_SIMPLIFIED_PN_MOCK_H_
@@ -0,0 +1,311 @@
+#include "formulation/scalar/simplified_pn.h"
+
+#include <array>
+#include <memory>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "data/cross_sections.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "material/tests/mock_material.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace {
+
+using ::testing::DoDefault;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::_;
+using namespace bart;
+
+using test_helpers::AreEqual;
+
+/* Tests use the same finite element mock and cross-sections as the diffusion
+ * formulation tests, so that results for the first equation can be compared
+ * to the diffusion results, with an SP3 formulation. */
+class FormulationCFEMSimplifiedPNTest : public ::testing::Test {
+ protected:
+  FormulationCFEMSimplifiedPNTest()
+      : dof_handler_(triangulation_),
+        fe_(1) {};
+  using Matrix = dealii::FullMatrix<double>;
+  using TestFormulation = formulation::scalar::SimplifiedPN<2>;
+  using BoundaryType = TestFormulation::BoundaryType;
+  std::shared_ptr<domain::finite_element::FiniteElementMock<2>> fe_mock_ptr;
+  std::shared_ptr<data::CrossSections> cross_sections_ptr;
+
+  dealii::DoFHandler<2>::active_cell_iterator cell_ptr_;
+  dealii::Triangulation<2> triangulation_;
+  dealii::DoFHandler<2> dof_handler_;
+  dealii::FE_Q<2> fe_;
+
+  const int fissile_material_id_ = 0, non_fissile_material_id_ = 1;
+  // Integral of the shape function, mass and stiffness matrices for the mock
+  const dealii::Vector<double> shape_integral_{6, 15};
+  const std::array<double, 4> mass_values_{6, 12,
+                                           12, 27};
+  const std::array<double, 4> stiffness_values_{6, 6,
+                                                6, 15};
+
+  void SetUp() override;
+  void SetUpDealii();
+};
+
+void FormulationCFEMSimplifiedPNTest::SetUp() {
+  SetUpDealii();
+  NiceMock<btest::MockMaterial> mock_material;
+  fe_mock_ptr = std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<2>>>();
+
+  ON_CALL(*fe_mock_ptr, dofs_per_cell()).WillByDefault(Return(2));
+  ON_CALL(*fe_mock_ptr, n_cell_quad_pts()).WillByDefault(Return(2));
+  ON_CALL(*fe_mock_ptr, n_face_quad_pts()).WillByDefault(Return(2));
+
+  for (int q = 0; q < 2; ++q) {
+    ON_CALL(*fe_mock_ptr, Jacobian(q)).WillByDefault(Return((1 + q)*3));
+    ON_CALL(*fe_mock_ptr, FaceJacobian(q)).WillByDefault(Return((1 + q)*3));
+    for (int i = 0; i < 2; ++i) {
+      ON_CALL(*fe_mock_ptr, ShapeValue(i, q)).WillByDefault(Return(i + q));
+      ON_CALL(*fe_mock_ptr, FaceShapeValue(i,q)).WillByDefault(Return(i + q));
+
+      dealii::Tensor<1, 2> gradient_tensor;
+      gradient_tensor[0] = i;
+      gradient_tensor[1] = q;
+
+      ON_CALL(*fe_mock_ptr, ShapeGradient(i, q)).WillByDefault(Return(gradient_tensor));
+    }
+  }
+
+  std::array<double, 4> sigma_s_values{0.25, 0.5, 0.75, 1.0};
+  dealii::FullMatrix<double> sigma_s_matrix{2,2, sigma_s_values.begin()};
+  std::unordered_map<int, dealii::FullMatrix<double>> sigma_s{{this->fissile_material_id_, sigma_s_matrix}};
+  std::unordered_map<int, std::vector<double>> sigma_t{{this->fissile_material_id_, {1.0, 2.0}}};
+  std::unordered_map<int, std::vector<double>> inverse_sigma_t{{this->fissile_material_id_, {1.0, 0.5}}};
+  std::unordered_map<int, std::vector<double>> q{{this->non_fissile_material_id_, {1.0, 2.0}}};
+  std::unordered_map<int, bool> fissile_id{{this->fissile_material_id_, true},
+                                           {this->non_fissile_material_id_, false}};
+
+  ON_CALL(mock_material, GetSigT()).WillByDefault(Return(sigma_t));
+  ON_CALL(mock_material, GetInvSigT()).WillByDefault(Return(inverse_sigma_t));
+  ON_CALL(mock_material, GetSigS()).WillByDefault(Return(sigma_s));
+  ON_CALL(mock_material, GetQ()).WillByDefault(Return(q));
+  ON_CALL(mock_material, GetFissileIDMap()).WillByDefault(Return(fissile_id));
+  ON_CALL(mock_material, GetChiNuSigF()).WillByDefault(Return(sigma_s));
+
+  cross_sections_ptr = std::make_shared<data::CrossSections>(mock_material);
+}
+
+void FormulationCFEMSimplifiedPNTest::SetUpDealii() {
+  dealii::GridGenerator::hyper_cube(triangulation_, 0, 1);
+  dof_handler_.distribute_dofs(fe_);
+  for (auto cell = dof_handler_.begin_active(); cell != dof_handler_.end(); ++cell) {
+    if (cell->is_locally_owned()) {
+      cell_ptr_ = cell;
+      cell_ptr_->set_material_id(this->fissile_material_id_);
+    }
+  }
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, Constructor) {
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+
+  EXPECT_EQ(fe_mock_ptr.use_count(), 2);
+  EXPECT_EQ(cross_sections_ptr.use_count(), 2);
+  EXPECT_EQ(test_formulation.n_equations(), 2);
+  EXPECT_EQ(test_formulation.coefficients().order(), 3);
+  EXPECT_FALSE(test_formulation.is_initialized());
+  EXPECT_ANY_THROW({ TestFormulation bad_formulation(fe_mock_ptr, cross_sections_ptr, 2); });
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillCellStreamingTerm) {
+  Matrix test_matrix(2, 2);
+  // Group 1 has 1/sigma_t = 0.5, and the second equation a_1 = 3/35
+  Matrix expected_matrix(2, 2, stiffness_values_.begin());
+  expected_matrix *= 0.5 * 3.0/35.0;
+
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+
+  EXPECT_ANY_THROW({
+    test_formulation.FillCellStreamingTerm(test_matrix, cell_ptr_, 1, 1);
+  });
+  test_formulation.Precalculate(cell_ptr_);
+  EXPECT_ANY_THROW({
+    test_formulation.FillCellStreamingTerm(test_matrix, cell_ptr_, 1, 2);
+  });
+  EXPECT_CALL(*fe_mock_ptr, SetCell(cell_ptr_)).Times(1);
+  EXPECT_CALL(*fe_mock_ptr, Jacobian(_)).Times(2).WillRepeatedly(DoDefault());
+
+  EXPECT_NO_THROW({
+    test_formulation.FillCellStreamingTerm(test_matrix, cell_ptr_, 1, 1);
+  });
+  EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillCellCollisionTerm) {
+  // Equation 0 is the diffusion removal term, sigma_t - sigma_s = 0.75,
+  // equation 1 has 3/5 sigma_t - 4/15 sigma_s = 8/15.
+  std::array<double, 2> removal{0.75, 8.0/15.0};
+
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+
+  Matrix test_matrix(2, 2);
+  EXPECT_ANY_THROW({
+    test_formulation.FillCellCollisionTerm(test_matrix, cell_ptr_, 0, 0);
+  });
+  test_formulation.Precalculate(cell_ptr_);
+
+  for (int equation = 0; equation < 2; ++equation) {
+    test_matrix = 0;
+    Matrix expected_matrix(2, 2, mass_values_.begin());
+    expected_matrix *= removal.at(equation);
+    test_formulation.FillCellCollisionTerm(test_matrix, cell_ptr_, 0, equation);
+    EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
+  }
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillBoundaryTermVacuum) {
+  Matrix test_matrix(2, 2);
+  std::array<double, 4> expected_values{1.05, 2.1,
+                                        2.1, 4.725};
+  Matrix expected_matrix(2, 2, expected_values.begin());
+
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+  test_formulation.Precalculate(cell_ptr_);
+
+  EXPECT_CALL(*fe_mock_ptr, SetFace(cell_ptr_, domain::FaceIndex(0))).Times(1);
+  EXPECT_CALL(*fe_mock_ptr, FaceJacobian(_)).Times(2).WillRepeatedly(DoDefault());
+
+  test_formulation.FillBoundaryTerm(test_matrix, cell_ptr_, 0,
+                                    BoundaryType::kVacuum, 1);
+  EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillBoundaryTermReflective) {
+  Matrix test_matrix(2, 2), expected_matrix(2, 2);
+
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+  test_formulation.Precalculate(cell_ptr_);
+
+  EXPECT_CALL(*fe_mock_ptr, SetFace(_, _)).Times(0);
+
+  test_formulation.FillBoundaryTerm(test_matrix, cell_ptr_, 0,
+                                    BoundaryType::kReflective, 1);
+  EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillCellFixedSource) {
+  // Group 1 source is 2.0, the second equation has a source factor of -2/5
+  dealii::Vector<double> expected_vector(shape_integral_);
+  expected_vector *= -0.8;
+  dealii::Vector<double> test_vector(2);
+
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+
+  cell_ptr_->set_material_id(this->non_fissile_material_id_);
+  test_formulation.FillCellFixedSource(test_vector, cell_ptr_, 1, 1);
+
+  EXPECT_TRUE(AreEqual(expected_vector, test_vector));
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillCellFissionSource) {
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+
+  dealii::Vector<double> test_vector(2);
+  const double k_effective = 1.05;
+  std::vector<double> in_group_moment_values{0.5, 0.5};
+  std::vector<double> group_1_moment_values{1.0, 1.0};
+  system::moments::MomentVector in_group_moment{0.5, 0.5};
+  system::moments::MomentVector group_0_moment{0.75, 0.75};
+  system::moments::MomentVector group_1_moment{1.0, 1.0};
+  system::moments::MomentsMap group_moments;
+  group_moments[{0, 0, 0}] = group_0_moment;
+  group_moments[{1, 0, 0}] = group_1_moment;
+
+  // Diffusion fission source, multiplied by the source factor -2/5
+  dealii::Vector<double> expected_vector{-2.0, -5.0};
+
+  EXPECT_CALL(*fe_mock_ptr, ValueAtQuadrature(group_1_moment))
+      .WillOnce(Return(group_1_moment_values));
+  EXPECT_CALL(*fe_mock_ptr, ValueAtQuadrature(in_group_moment))
+      .WillOnce(Return(in_group_moment_values));
+
+  test_formulation.FillCellFissionSource(test_vector, cell_ptr_, 0, 1,
+                                         k_effective, in_group_moment,
+                                         group_moments);
+
+  EXPECT_TRUE(AreEqual(expected_vector, test_vector));
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillCellScatteringSource) {
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+
+  // Moments are identified by their values
+  system::moments::MomentVector group_0_scalar_flux{1.0, 1.0},
+      group_0_second_moment{2.0, 2.0}, group_1_scalar_flux{3.0, 3.0},
+      group_1_second_moment{4.0, 4.0}, first_moment{5.0, 5.0};
+  system::moments::MomentsMap group_moments;
+  group_moments[{0, 0, 0}] = group_0_scalar_flux;
+  group_moments[{0, 2, 0}] = group_0_second_moment;
+  group_moments[{1, 0, 0}] = group_1_scalar_flux;
+  group_moments[{1, 2, 0}] = group_1_second_moment;
+  for (int group = 0; group < 2; ++group) {
+    for (int m = -1; m <= 1; ++m)
+      group_moments[{group, 1, m}] = first_moment;
+  }
+
+  for (const auto& moment : {group_0_scalar_flux, group_0_second_moment,
+                             group_1_scalar_flux, group_1_second_moment}) {
+    ON_CALL(*fe_mock_ptr, ValueAtQuadrature(moment))
+        .WillByDefault(Return(std::vector<double>(2, moment[0])));
+  }
+  EXPECT_CALL(*fe_mock_ptr, ValueAtQuadrature(first_moment)).Times(0);
+
+  /* Group 0 has Psi_0 = 5 and Psi_1 = 6. The first equation has the
+   * out-group source 0.5 * 3 = 1.5, and the coupling -R_01 Psi_1 = 3. The
+   * second has the source -2/5 * 1.5 = -0.6, and coupling -R_10 Psi_0 = 1.5 */
+  std::array<double, 2> expected_source{4.5, 0.9};
+
+  for (int equation = 0; equation < 2; ++equation) {
+    dealii::Vector<double> test_vector(2);
+    dealii::Vector<double> expected_vector(shape_integral_);
+    expected_vector *= expected_source.at(equation);
+
+    test_formulation.FillCellScatteringSource(test_vector, cell_ptr_, 0,
+                                              equation, group_moments);
+    EXPECT_TRUE(AreEqual(expected_vector, test_vector));
+  }
+}
+
+TEST_F(FormulationCFEMSimplifiedPNTest, FillBoundaryCouplingSource) {
+  TestFormulation test_formulation(fe_mock_ptr, cross_sections_ptr, 3);
+
+  system::moments::MomentVector scalar_flux{1.0, 1.0}, second_moment{2.0, 2.0};
+  system::moments::MomentsMap group_moments;
+  group_moments[{0, 0, 0}] = scalar_flux;
+  group_moments[{0, 2, 0}] = second_moment;
+
+  ON_CALL(*fe_mock_ptr, ValueAtFaceQuadrature(scalar_flux))
+      .WillByDefault(Return(std::vector<double>{1.0, 1.0}));
+  ON_CALL(*fe_mock_ptr, ValueAtFaceQuadrature(second_moment))
+      .WillByDefault(Return(std::vector<double>{2.0, 2.0}));
+
+  // Reflective boundaries have no coupling
+  dealii::Vector<double> test_vector(2), expected_vector(2);
+  EXPECT_CALL(*fe_mock_ptr, SetFace(_, _)).Times(1);
+  test_formulation.FillBoundaryCouplingSource(test_vector, cell_ptr_, 0,
+                                              BoundaryType::kReflective, 0, 0,
+                                              group_moments);
+  EXPECT_TRUE(AreEqual(expected_vector, test_vector));
+
+  // Vacuum boundary source for equation 0 is -G_01 Psi_1 = 1/8 * 6
+  expected_vector = dealii::Vector<double>{4.5, 11.25};
+  test_formulation.FillBoundaryCouplingSource(test_vector, cell_ptr_, 0,
+                                              BoundaryType::kVacuum, 0, 0,
+                                              group_moments);
+  EXPECT_TRUE(AreEqual(expected_vector, test_vector));
+}
+
+} // namespace
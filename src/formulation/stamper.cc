@@ -19,16 +19,25 @@ void Stamper<dim>::StampMatrix(
     system::MPISparseMatrix& to_stamp,
     std::function<void(formulation::FullMatrix&,
                        const domain::CellPtr<dim> &)> stamp_function) {
-  auto cell_matrix = domain_ptr_->GetCellMatrix();
+  formulation::FullMatrix owned_cell_matrix;
+  std::vector<dealii::types::global_dof_index> owned_local_dof_indices;
+  if (workspace_ptr_ == nullptr) {
+    owned_cell_matrix = domain_ptr_->GetCellMatrix();
+    owned_local_dof_indices.resize(owned_cell_matrix.n_cols());
+  }
+  auto& cell_matrix = workspace_ptr_ == nullptr ?
+      owned_cell_matrix : workspace_ptr_->cell_matrix();
+  auto& local_dof_indices = workspace_ptr_ == nullptr ?
+      owned_local_dof_indices : workspace_ptr_->local_dof_indices();
   auto cells = domain_ptr_->Cells();
-  std::vector<dealii::types::global_dof_index> local_dof_indices(
-      cell_matrix.n_cols());
+  const auto& constraints = domain_ptr_->constraints();
 
   for (const auto& cell : cells) {
     cell_matrix = 0;
     cell->get_dof_indices(local_dof_indices);
     stamp_function(cell_matrix, cell);
-    to_stamp.add(local_dof_indices, local_dof_indices, cell_matrix);
+    constraints.distribute_local_to_global(cell_matrix, local_dof_indices,
+                                           to_stamp);
   }
   to_stamp.compress(dealii::VectorOperation::add);
 }
@@ -37,16 +46,25 @@ void Stamper<dim>::StampVector(
     system::MPIVector& to_stamp,
     std::function<void(formulation::Vector&,
                        const domain::CellPtr<dim>&)> stamp_function) {
-  auto cell_vector = domain_ptr_->GetCellVector();
+  formulation::Vector owned_cell_vector;
+  std::vector<dealii::types::global_dof_index> owned_local_dof_indices;
+  if (workspace_ptr_ == nullptr) {
+    owned_cell_vector = domain_ptr_->GetCellVector();
+    owned_local_dof_indices.resize(owned_cell_vector.size());
+  }
+  auto& cell_vector = workspace_ptr_ == nullptr ?
+      owned_cell_vector : workspace_ptr_->cell_vector();
+  auto& local_dof_indices = workspace_ptr_ == nullptr ?
+      owned_local_dof_indices : workspace_ptr_->local_dof_indices();
   auto cells = domain_ptr_->Cells();
-  std::vector<dealii::types::global_dof_index> local_dof_indices(
-      cell_vector.size());
+  const auto& constraints = domain_ptr_->constraints();
 
   for (const auto& cell : cells) {
     cell_vector = 0;
     cell->get_dof_indices(local_dof_indices);
     stamp_function(cell_vector, cell);
-    to_stamp.add(local_dof_indices, cell_vector);
+    constraints.distribute_local_to_global(cell_vector, local_dof_indices,
+                                           to_stamp);
   }
   to_stamp.compress(dealii::VectorOperation::add);
 }
@@ -57,10 +75,18 @@ void Stamper<dim>::StampBoundaryMatrix(
     std::function<void(formulation::FullMatrix&,
                        const domain::FaceIndex,
                        const domain::CellPtr<dim> &)> stamp_function) {
-  auto cell_matrix = domain_ptr_->GetCellMatrix();
+  formulation::FullMatrix owned_cell_matrix;
+  std::vector<dealii::types::global_dof_index> owned_local_dof_indices;
+  if (workspace_ptr_ == nullptr) {
+    owned_cell_matrix = domain_ptr_->GetCellMatrix();
+    owned_local_dof_indices.resize(owned_cell_matrix.n_cols());
+  }
+  auto& cell_matrix = workspace_ptr_ == nullptr ?
+      owned_cell_matrix : workspace_ptr_->cell_matrix();
+  auto& local_dof_indices = workspace_ptr_ == nullptr ?
+      owned_local_dof_indices : workspace_ptr_->local_dof_indices();
   auto cells = domain_ptr_->Cells();
-  std::vector<dealii::types::global_dof_index> local_dof_indices(
-      cell_matrix.n_cols());
+  const auto& constraints = domain_ptr_->constraints();
 
   for (const auto& cell : cells) {
     if (cell->at_boundary()) {
@@ -70,7 +96,8 @@ void Stamper<dim>::StampBoundaryMatrix(
           cell_matrix = 0;
           cell->get_dof_indices(local_dof_indices);
           stamp_function(cell_matrix, domain::FaceIndex(face), cell);
-          to_stamp.add(local_dof_indices, local_dof_indices, cell_matrix);
+          constraints.distribute_local_to_global(
+              cell_matrix, local_dof_indices, to_stamp);
         }
       }
     }
@@ -84,8 +111,18 @@ void Stamper<dim>::StampBoundaryVector(
     std::function<void(Vector &,
                        const domain::FaceIndex,
                        const domain::CellPtr<dim> &)> stamp_function) {
-  auto cell_vector = domain_ptr_->GetCellVector();
+  formulation::Vector owned_cell_vector;
+  std::vector<dealii::types::global_dof_index> owned_local_dof_indices;
+  if (workspace_ptr_ == nullptr) {
+    owned_cell_vector = domain_ptr_->GetCellVector();
+    owned_local_dof_indices.resize(owned_cell_vector.size());
+  }
+  auto& cell_vector = workspace_ptr_ == nullptr ?
+      owned_cell_vector : workspace_ptr_->cell_vector();
+  auto& local_dof_indices = workspace_ptr_ == nullptr ?
+      owned_local_dof_indices : workspace_ptr_->local_dof_indices();
   auto cells = domain_ptr_->Cells();
+  const auto& constraints = domain_ptr_->constraints();
 
   for (const auto& cell : cells) {
     if (cell->at_boundary()) {
@@ -93,11 +130,10 @@ void Stamper<dim>::StampBoundaryVector(
       for (int face = 0; face < faces_per_cell; ++face) {
         if (cell->face(face)->at_boundary()) {
           cell_vector = 0;
-          std::vector<dealii::types::global_dof_index> local_dof_indices(
-              cell_vector.size());
           cell->get_dof_indices(local_dof_indices);
           stamp_function(cell_vector, domain::FaceIndex(face), cell);
-          to_stamp.add(local_dof_indices, cell_vector);
+          constraints.distribute_local_to_global(
+              cell_vector, local_dof_indices, to_stamp);
         }
       }
     }
@@ -5,6 +5,7 @@
 
 #include "domain/definition_i.h"
 #include "formulation/stamper_i.h"
+#include "system/workspace.h"
 
 namespace bart {
 
@@ -16,7 +17,9 @@ namespace formulation {
  *  and fills the system matrix with the results of the function over all the
  *  cells in the triangulation. Another class provides a functional that will
  *  fill a matrix or vector for a given cell, this class then iterates over all
- *  cells and stamps the results onto the system matrix.
+ *  cells and stamps the results onto the system matrix. Cell results are
+ *  added using the constraints of the domain, so that stamped systems are
+ *  condensed for hanging nodes on adaptively refined meshes.
  *
  *  \author J.S. Rehak
  *  \tparam dim spatial dimension of the cells in the mesh
@@ -58,10 +61,20 @@ class Stamper : public StamperI<dim> {
                          const domain::CellPtr<dim> &)> stamp_function)
   override;
 
+  /*! \brief Use preallocated cell matrices, vectors, and degree of freedom
+   * indices from a workspace instead of making them for each stamp.
+   */
+  Stamper& SetWorkspace(std::shared_ptr<system::Workspace> workspace_ptr) {
+    workspace_ptr_ = workspace_ptr;
+    return *this;
+  }
+
   /*! \brief Access domain definition dependency */
   domain::DefinitionI<dim>* domain_ptr() const { return domain_ptr_.get(); }
+  system::Workspace* workspace_ptr() const { return workspace_ptr_.get(); }
  private:
   std::shared_ptr<domain::DefinitionI<dim>> domain_ptr_;
+  std::shared_ptr<system::Workspace> workspace_ptr_ = nullptr;
 };
 
 } // namespace formulation
@@ -0,0 +1,184 @@
+#include "formulation/cartesian_stencil.h"
+
+#include <cmath>
+#include <memory>
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include "domain/definition.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "domain/mesh/tests/mesh_mock.h"
+#include "formulation/stamper.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::_, ::testing::NiceMock, ::testing::Return;
+
+/* Verifies that stencils give the same operator as the stamped system matrix
+ * on a Cartesian mesh with two materials. */
+template <typename DimensionWrapper>
+class FormulationCartesianStencilTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+  using Domain = domain::Definition<dim>;
+  using Lattice = domain::CartesianLattice<dim>;
+  using Stencil = formulation::CartesianStencil<dim>;
+
+  FormulationCartesianStencilTest()
+      : fe_(1),
+        fe_values_(fe_, dealii::QGauss<dim>(2),
+                   dealii::update_values | dealii::update_gradients |
+                   dealii::update_JxW_values),
+        fe_face_values_(fe_, dealii::QGauss<dim - 1>(2),
+                        dealii::update_values | dealii::update_JxW_values) {}
+
+  dealii::FE_Q<dim> fe_;
+  dealii::FEValues<dim> fe_values_;
+  dealii::FEFaceValues<dim> fe_face_values_;
+  std::shared_ptr<domain::finite_element::FiniteElementMock<dim>> fe_ptr_;
+  std::shared_ptr<Domain> domain_ptr_;
+  std::shared_ptr<const Lattice> lattice_ptr_;
+
+  typename Stencil::CellTermFunction cell_function_;
+  typename Stencil::BoundaryTermFunction boundary_function_;
+
+  void SetUp() override;
+  //! Diffusion and absorption, scaled by material
+  void FillCellTerm(formulation::FullMatrix& to_fill,
+                    const domain::CellPtr<dim>& cell_ptr);
+  //! Face mass matrix, scaled by face index
+  void FillBoundaryTerm(formulation::FullMatrix& to_fill,
+                        const domain::FaceIndex face_index,
+                        const domain::CellPtr<dim>& cell_ptr);
+  static void SetTriangulation(dealii::Triangulation<dim>& to_fill) {
+    dealii::GridGenerator::hyper_cube(to_fill, 0, 1);
+  }
+  static void SetMaterialID(dealii::Triangulation<dim>& to_fill) {
+    for (auto& cell : to_fill.active_cell_iterators())
+      cell->set_material_id(cell->center()[0] < 0.5 ? 1 : 0);
+  }
+};
+
+TYPED_TEST_CASE(FormulationCartesianStencilTest, bart::testing::AllDimensions);
+
+template <typename DimensionWrapper>
+void FormulationCartesianStencilTest<DimensionWrapper>::SetUp() {
+  fe_ptr_ = std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  ON_CALL(*fe_ptr_, finite_element()).WillByDefault(Return(&fe_));
+
+  auto mesh_ptr = std::make_unique<NiceMock<domain::mesh::MeshMock<dim>>>();
+  ON_CALL(*mesh_ptr, has_material_mapping()).WillByDefault(Return(true));
+  ON_CALL(*mesh_ptr, FillTriangulation(_))
+      .WillByDefault(::testing::Invoke(SetTriangulation));
+  ON_CALL(*mesh_ptr, FillMaterialID(_))
+      .WillByDefault(::testing::Invoke(SetMaterialID));
+  domain_ptr_ = std::make_shared<Domain>(std::move(mesh_ptr), fe_ptr_);
+  // Runs in 1D are longer than one block
+  domain_ptr_->SetUpMesh(dim == 1 ? 10 : 3);
+  domain_ptr_->SetUpDOF();
+  lattice_ptr_ = std::make_shared<const Lattice>(*domain_ptr_);
+
+  cell_function_ = [this](formulation::FullMatrix& to_fill,
+                          const domain::CellPtr<dim>& cell_ptr) {
+    FillCellTerm(to_fill, cell_ptr); };
+  boundary_function_ = [this](formulation::FullMatrix& to_fill,
+                              const domain::FaceIndex face_index,
+                              const domain::CellPtr<dim>& cell_ptr) {
+    FillBoundaryTerm(to_fill, face_index, cell_ptr); };
+}
+
+template <typename DimensionWrapper>
+void FormulationCartesianStencilTest<DimensionWrapper>::FillCellTerm(
+    formulation::FullMatrix& to_fill, const domain::CellPtr<dim>& cell_ptr) {
+  const double coefficient = 1.0 + cell_ptr->material_id();
+  fe_values_.reinit(cell_ptr);
+  for (unsigned int q = 0; q < fe_values_.n_quadrature_points; ++q) {
+    for (unsigned int i = 0; i < fe_.dofs_per_cell; ++i) {
+      for (unsigned int j = 0; j < fe_.dofs_per_cell; ++j) {
+        to_fill(i, j) += coefficient * (
+            fe_values_.shape_grad(i, q) * fe_values_.shape_grad(j, q) +
+            0.1 * fe_values_.shape_value(i, q) * fe_values_.shape_value(j, q))
+            * fe_values_.JxW(q);
+      }
+    }
+  }
+}
+
+template <typename DimensionWrapper>
+void FormulationCartesianStencilTest<DimensionWrapper>::FillBoundaryTerm(
+    formulation::FullMatrix& to_fill, const domain::FaceIndex face_index,
+    const domain::CellPtr<dim>& cell_ptr) {
+  const double coefficient = 1.0 + face_index.get();
+  fe_face_values_.reinit(cell_ptr, face_index.get());
+  for (unsigned int q = 0; q < fe_face_values_.n_quadrature_points; ++q) {
+    for (unsigned int i = 0; i < fe_.dofs_per_cell; ++i) {
+      for (unsigned int j = 0; j < fe_.dofs_per_cell; ++j) {
+        to_fill(i, j) += coefficient * fe_face_values_.shape_value(i, q) *
+            fe_face_values_.shape_value(j, q) * fe_face_values_.JxW(q);
+      }
+    }
+  }
+}
+
+TYPED_TEST(FormulationCartesianStencilTest, Constructor) {
+  typename TestFixture::Stencil test_stencil(this->lattice_ptr_);
+  EXPECT_EQ(test_stencil.lattice_ptr(), this->lattice_ptr_.get());
+  EXPECT_EQ(test_stencil.local_matrices().size(),
+            this->lattice_ptr_->cell_classes().size());
+  EXPECT_ANY_THROW({
+    typename TestFixture::Stencil bad_stencil(nullptr);
+  });
+}
+
+TYPED_TEST(FormulationCartesianStencilTest, MatchesStampedMatrix) {
+  constexpr int dim = this->dim;
+  typename TestFixture::Stencil test_stencil(this->lattice_ptr_);
+  test_stencil.StampCellTerm(this->cell_function_)
+      .StampBoundaryTerm(this->boundary_function_);
+
+  auto matrix_ptr = this->domain_ptr_->MakeSystemMatrix();
+  formulation::Stamper<dim> stamper(this->domain_ptr_);
+  stamper.StampMatrix(*matrix_ptr, this->cell_function_);
+  stamper.StampBoundaryMatrix(*matrix_ptr, this->boundary_function_);
+
+  auto source_ptr = this->domain_ptr_->MakeSystemVector();
+  auto expected_ptr = this->domain_ptr_->MakeSystemVector();
+  for (unsigned int dof = 0; dof < source_ptr->size(); ++dof)
+    (*source_ptr)[dof] = std::sin(1.0 + dof);
+  source_ptr->compress(dealii::VectorOperation::insert);
+  matrix_ptr->vmult(*expected_ptr, *source_ptr);
+
+  dealii::Vector<double> lattice_source, lattice_result, lattice_diagonal;
+  auto result_ptr = this->domain_ptr_->MakeSystemVector();
+  auto diagonal_ptr = this->domain_ptr_->MakeSystemVector();
+  this->lattice_ptr_->ToLattice(*source_ptr, lattice_source);
+  test_stencil.vmult(lattice_result, lattice_source);
+  this->lattice_ptr_->FromLattice(lattice_result, *result_ptr);
+  test_stencil.Diagonal(lattice_diagonal);
+  this->lattice_ptr_->FromLattice(lattice_diagonal, *diagonal_ptr);
+
+  for (unsigned int dof = 0; dof < result_ptr->size(); ++dof) {
+    EXPECT_NEAR((*result_ptr)[dof], (*expected_ptr)[dof], 1e-12);
+    EXPECT_NEAR((*diagonal_ptr)[dof], matrix_ptr->diag_element(dof), 1e-12);
+  }
+}
+
+TYPED_TEST(FormulationCartesianStencilTest, Clear) {
+  typename TestFixture::Stencil test_stencil(this->lattice_ptr_);
+  test_stencil.StampCellTerm(this->cell_function_);
+  test_stencil.Clear();
+
+  dealii::Vector<double> source(this->lattice_ptr_->n_nodes()), result;
+  source = 1.0;
+  test_stencil.vmult(result, source);
+  EXPECT_EQ(result.size(), source.size());
+  EXPECT_EQ(result.linfty_norm(), 0);
+}
+
+} // namespace
@@ -1,6 +1,19 @@
 #include "formulation/stamper.h"
 
+#include <cmath>
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/petsc_solver.h>
+
+#include "domain/definition.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "domain/mesh/tests/mesh_mock.h"
 #include "domain/tests/definition_mock.h"
+#include "system/workspace.h"
 #include "test_helpers/dealii_test_domain.h"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_assertions.hpp"
@@ -9,7 +22,8 @@ namespace {
 
 using namespace bart;
 
-using ::testing::ReturnRef, ::testing::Return, ::testing::DoDefault;
+using ::testing::ReturnRef, ::testing::Return, ::testing::DoDefault,
+    ::testing::NiceMock, ::testing::_;
 
 /* ===== BASIC TESTS ===========================================================
  * These tests verify basic functionality of formulation::Stamper. */
@@ -165,6 +179,8 @@ void FormulationStamperTestDealiiDomain<DimensionWrapper>::SetUp() {
       .WillByDefault(Return(dealii::FullMatrix<double>(cell_dofs, cell_dofs)));
   ON_CALL(*domain_ptr_, GetCellVector())
       .WillByDefault(Return(dealii::Vector<double>(cell_dofs)));
+  ON_CALL(*domain_ptr_, constraints())
+      .WillByDefault(ReturnRef(this->constraint_matrix_));
 }
 
 TYPED_TEST_SUITE(FormulationStamperTestDealiiDomain,
@@ -214,4 +230,269 @@ TYPED_TEST(FormulationStamperTestDealiiDomain, StampVectorBoundaryMPI) {
                                      this->boundary_expected_vector));
 }
 
+// Stamping with a workspace should use its buffers instead of the domain's
+TYPED_TEST(FormulationStamperTestDealiiDomain, StampMatrixWorkspaceMPI) {
+  const int cell_dofs = this->fe_.dofs_per_cell;
+  auto workspace_ptr = std::make_shared<system::Workspace>(
+      cell_dofs, cell_dofs, this->dof_handler_.n_dofs());
+  this->test_stamper_ptr_->SetWorkspace(workspace_ptr);
+  EXPECT_EQ(this->test_stamper_ptr_->workspace_ptr(), workspace_ptr.get());
+
+  EXPECT_CALL(*this->domain_ptr_, GetCellMatrix()).Times(0);
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampMatrix(this->system_matrix,
+                                         this->matrix_stamp_function);
+  });
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_matrix,
+                                     this->expected_matrix));
+}
+
+TYPED_TEST(FormulationStamperTestDealiiDomain, StampVectorBoundaryWorkspaceMPI) {
+  const int cell_dofs = this->fe_.dofs_per_cell;
+  auto workspace_ptr = std::make_shared<system::Workspace>(
+      cell_dofs, cell_dofs, this->dof_handler_.n_dofs());
+  this->test_stamper_ptr_->SetWorkspace(workspace_ptr);
+
+  EXPECT_CALL(*this->domain_ptr_, GetCellVector()).Times(0);
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampBoundaryVector(this->system_vector,
+                                                 this->vector_boundary_stamp_function);
+                  });
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_vector,
+                                     this->boundary_expected_vector));
+}
+
+/* ===== HANGING NODE TESTS ====================================================
+ * These tests verify that stamped terms are condensed using the constraints of
+ * a locally refined domain. */
+template <typename DimensionWrapper>
+class FormulationStamperTestHangingNodes : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using Domain = domain::Definition<dim>;
+  using StamperType = formulation::Stamper<dim>;
+
+  FormulationStamperTestHangingNodes() : fe_(1) {}
+
+  //! Sharpness \f$a\f$ of the peaked solution \f$u = e^{-a r^2}\f$
+  static constexpr double peak_sharpness_{200.0};
+
+  dealii::FE_Q<dim> fe_;
+  std::shared_ptr<domain::finite_element::FiniteElementMock<dim>> fe_ptr_;
+  std::shared_ptr<Domain> domain_ptr_;
+  std::unique_ptr<StamperType> test_stamper_ptr_;
+
+  void SetUp() override;
+  //! Makes a domain on the unit hypercube with the given global refinements
+  std::shared_ptr<Domain> MakeDomain(const int global_refinements) const;
+  /*! \brief Solves \f$-\nabla^2 u + u = f\f$ on a domain, where the exact
+   * solution is peaked at the center of the unit hypercube.
+   *
+   * @param domain_ptr domain to solve on.
+   * @param moments replaced by the solution, as the scalar flux of group 0.
+   * @return \f$L_2\f$ norm of the error in the solution.
+   */
+  double SolvePeakedProblem(const std::shared_ptr<Domain>& domain_ptr,
+                            system::moments::MomentsMap& moments) const;
+  static double SquaredRadius(const dealii::Point<dim>& point) {
+    double squared_radius = 0;
+    for (int d = 0; d < dim; ++d)
+      squared_radius += std::pow(point[d] - 0.5, 2);
+    return squared_radius;
+  }
+  static double PeakedSolution(const dealii::Point<dim>& point) {
+    return std::exp(-peak_sharpness_ * SquaredRadius(point));
+  }
+  static double PeakedSource(const dealii::Point<dim>& point) {
+    const double a = peak_sharpness_;
+    return (1.0 + 2.0 * a * dim - 4.0 * a * a * SquaredRadius(point)) *
+        PeakedSolution(point);
+  }
+  static void SetTriangulation(dealii::Triangulation<dim>& to_fill) {
+    dealii::GridGenerator::hyper_cube(to_fill, 0, 1);
+  }
+};
+
+template <typename DimensionWrapper>
+void FormulationStamperTestHangingNodes<DimensionWrapper>::SetUp() {
+  fe_ptr_ = std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  ON_CALL(*fe_ptr_, finite_element()).WillByDefault(Return(&fe_));
+  ON_CALL(*fe_ptr_, dofs_per_cell()).WillByDefault(Return(fe_.dofs_per_cell));
+  domain_ptr_ = MakeDomain(2);
+
+  // Refine the cells with the largest index, leaving hanging nodes
+  const int n_cells =
+      domain_ptr_->dof_handler().get_triangulation().n_active_cells();
+  dealii::Vector<float> cell_error(n_cells);
+  for (int cell = 0; cell < n_cells; ++cell)
+    cell_error[cell] = cell;
+  system::moments::MomentsMap moments;
+  domain_ptr_->RefineAndCoarsen(cell_error, 0.3, 0.0, moments);
+
+  test_stamper_ptr_ = std::make_unique<StamperType>(domain_ptr_);
+}
+
+template <typename DimensionWrapper>
+auto FormulationStamperTestHangingNodes<DimensionWrapper>::MakeDomain(
+    const int global_refinements) const -> std::shared_ptr<Domain> {
+  auto mesh_ptr = std::make_unique<NiceMock<domain::mesh::MeshMock<dim>>>();
+  ON_CALL(*mesh_ptr, has_material_mapping()).WillByDefault(Return(true));
+  ON_CALL(*mesh_ptr, FillTriangulation(_))
+      .WillByDefault(::testing::Invoke(SetTriangulation));
+  auto domain_ptr = std::make_shared<Domain>(std::move(mesh_ptr), fe_ptr_);
+  domain_ptr->SetUpMesh(global_refinements);
+  domain_ptr->SetUpDOF();
+  return domain_ptr;
+}
+
+template <typename DimensionWrapper>
+double FormulationStamperTestHangingNodes<DimensionWrapper>::SolvePeakedProblem(
+    const std::shared_ptr<Domain>& domain_ptr,
+    system::moments::MomentsMap& moments) const {
+  const dealii::QGauss<dim> quadrature(fe_.degree + 2);
+  dealii::FEValues<dim> fe_values(fe_, quadrature,
+                                  dealii::update_values |
+                                  dealii::update_gradients |
+                                  dealii::update_quadrature_points |
+                                  dealii::update_JxW_values);
+  StamperType stamper(domain_ptr);
+
+  auto matrix_ptr = domain_ptr->MakeSystemMatrix();
+  stamper.StampMatrix(*matrix_ptr, [&](formulation::FullMatrix& to_stamp,
+                                       const domain::CellPtr<dim>& cell_ptr) {
+    fe_values.reinit(cell_ptr);
+    for (unsigned int q = 0; q < quadrature.size(); ++q) {
+      for (unsigned int i = 0; i < fe_.dofs_per_cell; ++i) {
+        for (unsigned int j = 0; j < fe_.dofs_per_cell; ++j) {
+          to_stamp(i, j) += (
+              fe_values.shape_grad(i, q) * fe_values.shape_grad(j, q) +
+              fe_values.shape_value(i, q) * fe_values.shape_value(j, q))
+              * fe_values.JxW(q);
+        }
+      }
+    }
+  });
+  auto rhs_ptr = domain_ptr->MakeSystemVector();
+  stamper.StampVector(*rhs_ptr, [&](formulation::Vector& to_stamp,
+                                    const domain::CellPtr<dim>& cell_ptr) {
+    fe_values.reinit(cell_ptr);
+    for (unsigned int q = 0; q < quadrature.size(); ++q) {
+      const double source = PeakedSource(fe_values.quadrature_point(q));
+      for (unsigned int i = 0; i < fe_.dofs_per_cell; ++i)
+        to_stamp(i) += source * fe_values.shape_value(i, q) * fe_values.JxW(q);
+    }
+  });
+
+  // The solution has no gradient on the boundary, so no boundary terms are
+  // required
+  auto solution_ptr = domain_ptr->MakeSystemVector();
+  dealii::SolverControl solver_control(10000, 1e-12 * rhs_ptr->l2_norm());
+  dealii::PETScWrappers::SolverCG solver(solver_control, MPI_COMM_WORLD);
+  dealii::PETScWrappers::PreconditionJacobi preconditioner(*matrix_ptr);
+  solver.solve(*matrix_ptr, *solution_ptr, *rhs_ptr, preconditioner);
+  domain_ptr->constraints().distribute(*solution_ptr);
+
+  const dealii::Vector<double> solution(*solution_ptr);
+  std::vector<double> solution_values(quadrature.size());
+  double squared_error = 0;
+  for (const auto& cell : domain_ptr->Cells()) {
+    fe_values.reinit(cell);
+    fe_values.get_function_values(solution, solution_values);
+    for (unsigned int q = 0; q < quadrature.size(); ++q) {
+      squared_error += std::pow(
+          solution_values[q] - PeakedSolution(fe_values.quadrature_point(q)),
+          2) * fe_values.JxW(q);
+    }
+  }
+  moments.clear();
+  moments[{0, 0, 0}] = solution;
+  return std::sqrt(dealii::Utilities::MPI::sum(squared_error, MPI_COMM_WORLD));
+}
+
+TYPED_TEST_SUITE(FormulationStamperTestHangingNodes,
+                 bart::testing::AllDimensions);
+
+/* Constrained entries are distributed to the dofs they depend on, so stamped
+ * vectors are zero at hanging nodes and keep the sum of the cell vectors, and
+ * rows of stamped matrices for hanging nodes only hold a diagonal entry. */
+TYPED_TEST(FormulationStamperTestHangingNodes, StampHangingNodesMPI) {
+  constexpr int dim = this->dim;
+  const auto& constraints = this->domain_ptr_->constraints();
+  const int n_constraints = dealii::Utilities::MPI::sum(
+      static_cast<int>(constraints.n_constraints()), MPI_COMM_WORLD);
+  // There are no hanging nodes in 1D
+  if (dim > 1) {
+    EXPECT_GT(n_constraints, 0);
+  } else {
+    EXPECT_EQ(n_constraints, 0);
+  }
+
+  auto vector_ptr = this->domain_ptr_->MakeSystemVector();
+  this->test_stamper_ptr_->StampVector(
+      *vector_ptr, [](formulation::Vector& to_stamp,
+                      const domain::CellPtr<dim>&) {
+        SetVectorToOne(to_stamp); });
+  auto matrix_ptr = this->domain_ptr_->MakeSystemMatrix();
+  this->test_stamper_ptr_->StampMatrix(
+      *matrix_ptr, [](formulation::FullMatrix& to_stamp,
+                      const domain::CellPtr<dim>&) {
+        SetMatrixToOne(to_stamp); });
+
+  const double n_global_cells = this->domain_ptr_->dof_handler()
+      .get_triangulation().n_global_active_cells();
+  EXPECT_NEAR(vector_ptr->mean_value() * vector_ptr->size(),
+              n_global_cells * this->fe_.dofs_per_cell, 1e-10);
+
+  for (const auto dof : this->domain_ptr_->locally_owned_dofs()) {
+    if (constraints.is_constrained(dof)) {
+      EXPECT_EQ((*vector_ptr)[dof], 0);
+      EXPECT_NE(matrix_ptr->diag_element(dof), 0);
+      for (auto entry = matrix_ptr->begin(dof); entry != matrix_ptr->end(dof);
+           ++entry) {
+        if (entry->column() != dof)
+          EXPECT_EQ(entry->value(), 0);
+      }
+    } else {
+      EXPECT_GT((*vector_ptr)[dof], 0);
+    }
+  }
+}
+
+/* Constrained systems on adaptively refined meshes should be solved correctly,
+ * so that refining where the solution is peaked gives a smaller error than a
+ * uniformly refined mesh with at least as many degrees of freedom. */
+TYPED_TEST(FormulationStamperTestHangingNodes, AdaptiveAccuracyPerDoFMPI) {
+  constexpr int dim = this->dim;
+  const int initial_refinements = dim == 1 ? 3 : 2;
+  const int uniform_refinements = dim == 1 ? 4 : 2;
+  const int max_adaptive_cycles = 20;
+  system::moments::MomentsMap moments;
+
+  auto uniform_domain_ptr =
+      this->MakeDomain(initial_refinements + uniform_refinements);
+  const double uniform_error =
+      this->SolvePeakedProblem(uniform_domain_ptr, moments);
+  const int uniform_dofs = uniform_domain_ptr->total_degrees_of_freedom();
+
+  auto adaptive_domain_ptr = this->MakeDomain(initial_refinements);
+  double adaptive_error = this->SolvePeakedProblem(adaptive_domain_ptr, moments);
+  int adaptive_dofs = adaptive_domain_ptr->total_degrees_of_freedom();
+  ASSERT_LT(adaptive_dofs, uniform_dofs);
+
+  // Refine until the adapted mesh would have more dofs than the uniform mesh
+  for (int cycle = 0; cycle < max_adaptive_cycles; ++cycle) {
+    const auto cell_error = adaptive_domain_ptr->EstimateError(moments);
+    adaptive_domain_ptr->RefineAndCoarsen(cell_error, 0.3, 0.0, moments);
+    if (adaptive_domain_ptr->total_degrees_of_freedom() > uniform_dofs)
+      break;
+    adaptive_error = this->SolvePeakedProblem(adaptive_domain_ptr, moments);
+    adaptive_dofs = adaptive_domain_ptr->total_degrees_of_freedom();
+  }
+
+  EXPECT_LE(adaptive_dofs, uniform_dofs);
+  EXPECT_LT(adaptive_error, uniform_error);
+}
+
 } // namespace
@@ -71,6 +71,20 @@ void DiffusionUpdater<dim>::UpdateFixedTerms(
   stamper_ptr_->StampMatrix(*fixed_matrix_ptr, collision_term_function);
   stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr, boundary_function);
   stamper_ptr_->StampVector(*fixed_vector_ptr, fixed_term_function);
+
+  for (auto& [coupling_index, coupling_matrix_ptr] :
+      to_update.group_coupling_terms) {
+    if (coupling_index.first != group)
+      continue;
+    const int source_group = coupling_index.second;
+    auto coupling_term_function = [&](formulation::FullMatrix& cell_matrix,
+                                      const CellPtr& cell_ptr) -> void {
+      formulation_ptr_->FillCellScatteringCouplingTerm(cell_matrix, cell_ptr,
+                                                       group, source_group);
+    };
+    *coupling_matrix_ptr = 0;
+    stamper_ptr_->StampMatrix(*coupling_matrix_ptr, coupling_term_function);
+  }
 }
 template<int dim>
 void DiffusionUpdater<dim>::UpdateScatteringSource(
@@ -33,6 +33,12 @@ class DiffusionUpdater
                    std::unordered_set<problem::Boundary> reflective_boundaries = {});
   virtual ~DiffusionUpdater() = default;
 
+  /*! \brief Updates the fixed terms for a group.
+   *
+   * If the system has group coupling terms for a multigroup block solve, the
+   * scattering transfer into the group from each coupled source group is also
+   * stamped into System::group_coupling_terms.
+   */
   void UpdateFixedTerms(
       system::System&,
       system::EnergyGroup,
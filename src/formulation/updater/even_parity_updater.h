@@ -0,0 +1,67 @@
+#ifndef BART_SRC_FORMULATION_UPDATER_EVEN_PARITY_UPDATER_H_
+#define BART_SRC_FORMULATION_UPDATER_EVEN_PARITY_UPDATER_H_
+
+#include <memory>
+
+#include "formulation/angular/even_parity_i.h"
+#include "formulation/stamper_i.h"
+#include "formulation/updater/fixed_updater_i.h"
+#include "formulation/updater/scattering_source_updater_i.h"
+#include "formulation/updater/fission_source_updater_i.h"
+#include "quadrature/quadrature_set_i.h"
+#include "utility/has_description.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace updater {
+
+/*! \brief Updates the terms of a system using the even-parity formulation.
+ *
+ * Each angle of the quadrature set stands for itself and its reflection across
+ * the origin. Only vacuum boundaries are supported.
+ */
+template <int dim>
+class EvenParityUpdater :
+    public FixedUpdaterI,
+    public ScatteringSourceUpdaterI,
+    public FissionSourceUpdaterI,
+    public utility::HasDescription {
+ public:
+  using EvenParityFormulationType = formulation::angular::EvenParityI<dim>;
+  using StamperType = formulation::StamperI<dim>;
+  using QuadratureSetType = quadrature::QuadratureSetI<dim>;
+
+  EvenParityUpdater(std::unique_ptr<EvenParityFormulationType>,
+                    std::unique_ptr<StamperType>,
+                    const std::shared_ptr<QuadratureSetType>&);
+
+  void UpdateFixedTerms(system::System &to_update,
+                        system::EnergyGroup group,
+                        quadrature::QuadraturePointIndex index) override;
+  void UpdateFissionSource(system::System &to_update,
+                           system::EnergyGroup group,
+                           quadrature::QuadraturePointIndex index) override;
+  void UpdateScatteringSource(system::System &to_update,
+                              system::EnergyGroup group,
+                              quadrature::QuadraturePointIndex index) override;
+
+  EvenParityFormulationType* formulation_ptr() const {
+    return formulation_ptr_.get(); }
+  StamperType* stamper_ptr() const { return stamper_ptr_.get(); }
+  QuadratureSetType* quadrature_set_ptr() const {
+    return quadrature_set_ptr_.get(); }
+ private:
+  std::unique_ptr<EvenParityFormulationType> formulation_ptr_;
+  std::unique_ptr<StamperType> stamper_ptr_;
+  std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+};
+
+} // namespace updater
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_UPDATER_EVEN_PARITY_UPDATER_H_
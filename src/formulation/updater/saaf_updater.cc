@@ -32,14 +32,33 @@ SAAFUpdater<dim>::SAAFUpdater(
     std::unique_ptr<SAAFFormulationType> formulation_ptr,
     std::unique_ptr<StamperType> stamper_ptr,
     const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr,
-    const EnergyGroupToAngularSolutionPtrMap& angular_solution_ptr_map,
+    const std::shared_ptr<BoundaryAngularSolution>& boundary_angular_solution_ptr,
     const std::unordered_set<Boundary> reflective_boundaries)
     : SAAFUpdater(std::move(formulation_ptr), std::move(stamper_ptr),
                   quadrature_set_ptr) {
+  AssertThrow(boundary_angular_solution_ptr != nullptr,
+              dealii::ExcMessage("Error in constructor of SAAFUpdater, "
+                                 "boundary angular solution pointer passed is "
+                                 "null"))
   reflective_boundaries_ = reflective_boundaries;
-  angular_solution_ptr_map_ = angular_solution_ptr_map;
+  boundary_angular_solution_ptr_ = boundary_angular_solution_ptr;
   this->set_description("Self-adjoint angular flux updater with reflective "
-                        "boundaries",
+                        "boundaries (boundary angular flux storage)",
+                        utility::DefaultImplementation(true));
+}
+
+template<int dim>
+SAAFUpdater<dim>::SAAFUpdater(
+    std::unique_ptr<SAAFFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr,
+    const std::unordered_set<Boundary> reflective_boundaries)
+    : SAAFUpdater(std::move(formulation_ptr), std::move(stamper_ptr),
+                  quadrature_set_ptr) {
+  reflective_boundaries_ = reflective_boundaries;
+  is_reflection_implicit_ = true;
+  this->set_description("Self-adjoint angular flux updater with implicit "
+                        "reflective boundaries",
                         utility::DefaultImplementation(true));
 }
 
@@ -48,35 +67,45 @@ void SAAFUpdater<dim>::UpdateBoundaryConditions(
     system::System &to_update,
     system::EnergyGroup group,
     quadrature::QuadraturePointIndex index) {
+  AssertThrow(!is_reflection_implicit_,
+              dealii::ExcMessage("Error in SAAFUpdater, boundary conditions "
+                                 "cannot be updated when reflective boundaries "
+                                 "are treated implicitly"))
   using system::terms::VariableLinearTerms;
   auto boundary_vector_ptr = to_update.right_hand_side_ptr_->GetVariableTermPtr(
           {group.get(), index.get()},
           VariableLinearTerms::kReflectiveBoundaryCondition);
   const auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
 
+  // Incoming flux is read from the stored boundary values at the degrees of
+  // freedom of each boundary cell
+  std::vector<dealii::types::global_dof_index> cell_dofs;
+  std::vector<double> incoming_flux;
   auto reflective_boundary_term_function =
       [&](formulation::Vector &cell_vector,
           const domain::FaceIndex face_index,
           const domain::CellPtr <dim> &cell_ptr) -> void {
-        if (IsOnReflectiveBoundary(cell_ptr, face_index)) {
-          const auto boundary = static_cast<problem::Boundary>(
-              cell_ptr->face(face_index.get())->boundary_id());
-          const auto reflected_quadrature_point_index =
-              quadrature_set_ptr_->GetQuadraturePointIndex(
-                  quadrature_set_ptr_->GetBoundaryReflection(
-                      quadrature_point_ptr,
-                      boundary));
-          const auto incoming_flux = angular_solution_ptr_map_.at(
-              system::SolutionIndex(group, reflected_quadrature_point_index));
-          if (incoming_flux->size() > 0) {
-            formulation_ptr_->FillReflectiveBoundaryLinearTerm(
-                cell_vector,
-                cell_ptr,
-                face_index,
-                quadrature_point_ptr,
-                *incoming_flux);
-          }
-        }
+        if (boundary_angular_solution_ptr_ == nullptr ||
+            !IsOnReflectiveBoundary(cell_ptr, face_index))
+          return;
+        const auto boundary = static_cast<problem::Boundary>(
+            cell_ptr->face(face_index.get())->boundary_id());
+        const system::SolutionIndex reflected_index(
+            group, system::AngleIdx(
+                quadrature_set_ptr_->GetBoundaryReflectionIndex(index,
+                                                                boundary)));
+        if (!boundary_angular_solution_ptr_->is_stored(reflected_index))
+          return;
+        cell_dofs.resize(cell_ptr->get_fe().dofs_per_cell);
+        cell_ptr->get_dof_indices(cell_dofs);
+        boundary_angular_solution_ptr_->FillCellValues(reflected_index,
+                                                       cell_dofs,
+                                                       incoming_flux);
+        formulation_ptr_->FillReflectiveBoundaryLinearTerm(cell_vector,
+                                                           cell_ptr,
+                                                           face_index,
+                                                           quadrature_point_ptr,
+                                                           incoming_flux);
       };
   *boundary_vector_ptr = 0;
   stamper_ptr_->StampBoundaryVector(*boundary_vector_ptr,
@@ -116,12 +145,84 @@ void SAAFUpdater<dim>::UpdateFixedTerms(
         formulation_ptr_->FillCellFixedSourceTerm(cell_vector, cell_ptr, quadrature_point_ptr, group);
   };
   *fixed_vector_ptr = 0;
-  *fixed_matrix_ptr = 0;
-  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, streaming_term_function);
-  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, collision_term_function);
-  stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr,
-                                    boundary_bilinear_term_function);
+
+  // An index that is already assembled starts a new assembly of the system
+  const system::Index system_index{group.get(), index.get()};
+  if (assembled_fixed_terms_.count(system_index)) {
+    assembled_fixed_terms_.clear();
+    stamped_coupling_angles_.clear();
+  }
+
+  /* Angles that share their fixed term matrix with their reflection have their
+   * boundary terms in a separate variable term. The streaming and collision
+   * terms are the same for an angle and its reflection, and are stamped into
+   * the shared matrix only if the reflection has not already done so. */
+  using system::terms::VariableBilinearTerms;
+  auto& left_hand_side = *to_update.left_hand_side_ptr_;
+  std::shared_ptr<system::MPISparseMatrix> boundary_matrix_ptr = nullptr;
+  if (left_hand_side.GetVariableTerms().count(VariableBilinearTerms::kBoundary))
+    boundary_matrix_ptr = left_hand_side.GetVariableTermPtr(
+        system_index, VariableBilinearTerms::kBoundary);
+
+  if (boundary_matrix_ptr != nullptr) {
+    const auto reflection_index =
+        quadrature_set_ptr_->GetReflectionIndex(quadrature_point_ptr);
+    const bool is_shared_term_assembled = reflection_index.has_value() &&
+        assembled_fixed_terms_.count({group.get(), reflection_index.value()}) &&
+        left_hand_side.GetFixedTermPtr(
+            {group.get(), reflection_index.value()}) == fixed_matrix_ptr;
+    if (!is_shared_term_assembled) {
+      *fixed_matrix_ptr = 0;
+      stamper_ptr_->StampMatrix(*fixed_matrix_ptr, streaming_term_function);
+      stamper_ptr_->StampMatrix(*fixed_matrix_ptr, collision_term_function);
+    }
+    *boundary_matrix_ptr = 0;
+    stamper_ptr_->StampBoundaryMatrix(*boundary_matrix_ptr,
+                                      boundary_bilinear_term_function);
+  } else {
+    *fixed_matrix_ptr = 0;
+    stamper_ptr_->StampMatrix(*fixed_matrix_ptr, streaming_term_function);
+    stamper_ptr_->StampMatrix(*fixed_matrix_ptr, collision_term_function);
+    stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr,
+                                      boundary_bilinear_term_function);
+  }
+  assembled_fixed_terms_.insert(system_index);
   stamper_ptr_->StampVector(*fixed_vector_ptr, fixed_source_term_function);
+  if (is_reflection_implicit_ && stamped_coupling_angles_.insert(index.get()).second)
+    UpdateReflectiveCouplingTerms(to_update, index);
+}
+
+template<int dim>
+void SAAFUpdater<dim>::UpdateReflectiveCouplingTerms(
+    system::System &to_update,
+    quadrature::QuadraturePointIndex index) {
+  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
+
+  for (auto& [coupling_index, coupling_matrix_ptr] :
+      to_update.reflective_coupling_terms) {
+    if (coupling_index.first != index.get())
+      continue;
+    const int coupled_angle = coupling_index.second;
+    auto reflective_boundary_term_function =
+        [&](formulation::FullMatrix& cell_matrix,
+            const domain::FaceIndex face_index,
+            const domain::CellPtr<dim>& cell_ptr) -> void {
+          if (IsOnReflectiveBoundary(cell_ptr, face_index)) {
+            const auto boundary = static_cast<problem::Boundary>(
+                cell_ptr->face(face_index.get())->boundary_id());
+            const auto reflected_quadrature_point_index =
+                quadrature_set_ptr_->GetBoundaryReflectionIndex(index,
+                                                                boundary);
+            if (reflected_quadrature_point_index == coupled_angle) {
+              formulation_ptr_->FillReflectiveBoundaryBilinearTerm(
+                  cell_matrix, cell_ptr, face_index, quadrature_point_ptr);
+            }
+          }
+        };
+    *coupling_matrix_ptr = 0;
+    stamper_ptr_->StampBoundaryMatrix(*coupling_matrix_ptr,
+                                      reflective_boundary_term_function);
+  }
 }
 
 template<int dim>
@@ -131,9 +232,16 @@ void SAAFUpdater<dim>::UpdateFissionSource(system::System &to_update,
   auto fission_source_ptr =
       to_update.right_hand_side_ptr_->GetVariableTermPtr({group.get(), index.get()},
                                                          system::terms::VariableLinearTerms::kFissionSource);
-  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
   const auto& current_moments = to_update.current_moments->moments();
   const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
+  if (source_operators_ptr_ != nullptr) {
+    *fission_source_ptr = 0;
+    source_operators_ptr_->AddFissionSource(*fission_source_ptr, group, index,
+                                            to_update.k_effective.value(),
+                                            in_group_moment, current_moments);
+    return;
+  }
+  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
   auto fission_source_function =
       [&](formulation::Vector& cell_vector,
           const domain::CellPtr<dim> &cell_ptr) -> void {
@@ -158,9 +266,15 @@ void SAAFUpdater<dim>::UpdateScatteringSource(
       to_update.right_hand_side_ptr_->GetVariableTermPtr({group.get(), index.get()},
                                                          system::terms::VariableLinearTerms::kScatteringSource);
   *scattering_source_ptr = 0;
-  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
   const auto& current_moments = to_update.current_moments->moments();
   const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
+  if (source_operators_ptr_ != nullptr) {
+    source_operators_ptr_->AddScatteringSource(*scattering_source_ptr, group,
+                                               index, in_group_moment,
+                                               current_moments);
+    return;
+  }
+  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
   auto scattering_source_function =
       [&](formulation::Vector& cell_vector,
           const domain::CellPtr<dim> &cell_ptr) -> void {
@@ -2,8 +2,10 @@
 #define BART_SRC_FORMULATION_UPDATER_TESTS_SAAF_UPDATER_H_
 
 #include <memory>
+#include <set>
 #include <unordered_set>
 
+#include "formulation/angular/saaf_source_operators_i.h"
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
 #include "formulation/stamper_i.h"
 #include "formulation/updater/fixed_updater_i.h"
@@ -12,7 +14,8 @@
 #include "formulation/updater/fission_source_updater_i.h"
 #include "quadrature/quadrature_set_i.h"
 #include "problem/parameter_types.h"
-#include "system/solution/solution_types.h"
+#include "system/solution/boundary_angular_solution.h"
+#include "system/system_types.h"
 #include "utility/has_description.h"
 
 namespace bart {
@@ -30,19 +33,44 @@ class SAAFUpdater :
     public utility::HasDescription {
  public:
   using Boundary = problem::Boundary;
-  using EnergyGroupToAngularSolutionPtrMap = system::solution::EnergyGroupToAngularSolutionPtrMap;
+  using BoundaryAngularSolution = system::solution::BoundaryAngularSolution;
   using SAAFFormulationType = formulation::angular::SelfAdjointAngularFluxI<dim>;
   using StamperType = formulation::StamperI<dim>;
   using QuadratureSetType = quadrature::QuadratureSetI<dim>;
+  using SourceOperatorsType = formulation::angular::SAAFSourceOperatorsI<dim>;
 
   SAAFUpdater(std::unique_ptr<SAAFFormulationType>,
               std::unique_ptr<StamperType>,
               const std::shared_ptr<QuadratureSetType>&);
+  /*! \brief Constructor for reflective boundaries using angular solutions
+   * stored only at reflective boundary degrees of freedom. */
   SAAFUpdater(std::unique_ptr<SAAFFormulationType>,
               std::unique_ptr<StamperType>,
               const std::shared_ptr<QuadratureSetType>&,
-              const EnergyGroupToAngularSolutionPtrMap&,
+              const std::shared_ptr<BoundaryAngularSolution>&,
               const std::unordered_set<Boundary>);
+  /*! \brief Constructor for implicit reflective boundaries.
+   *
+   * Reflective boundaries are not lagged, instead UpdateFixedTerms stamps the
+   * matrices in System::reflective_coupling_terms that couple each angle to
+   * its reflection, to be included in the linear operator by the solver. The
+   * coupling terms do not depend on energy group, and are stamped only for
+   * the first group updated for each angle.
+   */
+  SAAFUpdater(std::unique_ptr<SAAFFormulationType>,
+              std::unique_ptr<StamperType>,
+              const std::shared_ptr<QuadratureSetType>&,
+              const std::unordered_set<Boundary>);
+
+  /*! \brief Sets precomputed source operators.
+   *
+   * If set, scattering and fission sources are calculated by applying the
+   * source operators to the group moments, instead of by cell assembly.
+   */
+  SAAFUpdater& SetSourceOperators(
+      const std::shared_ptr<SourceOperatorsType>& source_operators_ptr) {
+    source_operators_ptr_ = source_operators_ptr;
+    return *this; }
 
   void UpdateBoundaryConditions(system::System &to_update,
                                 system::EnergyGroup group,
@@ -57,14 +85,26 @@ class SAAFUpdater :
                               system::EnergyGroup group,
                               quadrature::QuadraturePointIndex index) override;
 
-  EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map() const {
-    return angular_solution_ptr_map_; }
+  std::shared_ptr<BoundaryAngularSolution> boundary_angular_solution_ptr() const {
+    return boundary_angular_solution_ptr_; }
   std::unordered_set<Boundary> reflective_boundaries() const {
     return reflective_boundaries_; }
+  bool is_reflection_implicit() const { return is_reflection_implicit_; }
+  /*! \brief Groups and angles with fixed terms assembled in the current
+   * assembly of the system.
+   *
+   * If an angle shares its fixed term matrix with its reflection, the shared
+   * matrix is stamped only if the reflection is not in this set. Updating an
+   * index that is already in the set starts a new assembly and clears it.
+   */
+  std::set<system::Index>& assembled_fixed_terms() {
+    return assembled_fixed_terms_; }
   SAAFFormulationType* formulation_ptr() const {return formulation_ptr_.get();};
   StamperType* stamper_ptr() const {return stamper_ptr_.get();};
   QuadratureSetType* quadrature_set_ptr() const {
     return quadrature_set_ptr_.get();};
+  SourceOperatorsType* source_operators_ptr() const {
+    return source_operators_ptr_.get(); }
  private:
   bool IsOnReflectiveBoundary(const domain::CellPtr<dim>& cell_ptr,
                               const domain::FaceIndex face_index) const {
@@ -72,11 +112,18 @@ class SAAFUpdater :
         static_cast<const Boundary>(
             cell_ptr->face(face_index.get())->boundary_id()));
   }
+  void UpdateReflectiveCouplingTerms(system::System& to_update,
+                                     quadrature::QuadraturePointIndex index);
   std::unique_ptr<SAAFFormulationType> formulation_ptr_;
   std::unique_ptr<StamperType> stamper_ptr_;
   std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
-  EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map_;
+  std::shared_ptr<SourceOperatorsType> source_operators_ptr_{ nullptr };
+  std::shared_ptr<BoundaryAngularSolution> boundary_angular_solution_ptr_{ nullptr };
   std::unordered_set<Boundary> reflective_boundaries_ = {};
+  bool is_reflection_implicit_{ false };
+  std::set<system::Index> assembled_fixed_terms_ = {};
+  //! Angles with stamped reflective coupling terms
+  std::set<system::AngleIndex> stamped_coupling_angles_ = {};
 };
 
 } // namespace updater
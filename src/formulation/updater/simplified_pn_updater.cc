@@ -0,0 +1,170 @@
+#include "formulation/updater/simplified_pn_updater.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace updater {
+
+template<int dim>
+SimplifiedPNUpdater<dim>::SimplifiedPNUpdater(
+    std::unique_ptr<SimplifiedPNFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    std::unordered_set<problem::Boundary> reflective_boundaries)
+    : formulation_ptr_(std::move(formulation_ptr)),
+      stamper_ptr_(std::move(stamper_ptr)),
+      reflective_boundaries_(reflective_boundaries) {
+  AssertThrow(formulation_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SimplifiedPNUpdater, "
+                                 "formulation pointer passed is null"))
+  AssertThrow(stamper_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SimplifiedPNUpdater, "
+                                 "stamper pointer passed is null"))
+  this->set_description("simplified PN formulation updater",
+                        utility::DefaultImplementation(true));
+
+  if (!reflective_boundaries_.empty()) {
+    this->set_description(this->description() + " (reflective BCs)",
+                          utility::DefaultImplementation(true));
+  }
+}
+
+template<int dim>
+void SimplifiedPNUpdater<dim>::UpdateFixedTerms(
+    system::System& to_update,
+    system::EnergyGroup energy_group,
+    quadrature::QuadraturePointIndex index) {
+  using CellPtr = domain::CellPtr<dim>;
+  const int group = energy_group.get();
+  const int equation = index.get();
+  auto fixed_matrix_ptr =
+      to_update.left_hand_side_ptr_->GetFixedTermPtr({group, equation});
+  auto fixed_vector_ptr =
+      to_update.right_hand_side_ptr_->GetFixedTermPtr({group, equation});
+  auto streaming_term_function = [&](formulation::FullMatrix& cell_matrix,
+                                     const CellPtr& cell_ptr) -> void {
+    formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr, group,
+                                            equation);
+  };
+  auto collision_term_function = [&](formulation::FullMatrix& cell_matrix,
+                                     const CellPtr& cell_ptr) -> void {
+    formulation_ptr_->FillCellCollisionTerm(cell_matrix, cell_ptr, group,
+                                            equation);
+  };
+  auto fixed_term_function = [&](formulation::Vector& cell_vector,
+                                 const CellPtr& cell_ptr) -> void {
+    formulation_ptr_->FillCellFixedSource(cell_vector, cell_ptr, group,
+                                          equation);
+  };
+  auto boundary_function = [&](formulation::FullMatrix& cell_matrix,
+                               const domain::FaceIndex face_index,
+                               const CellPtr& cell_ptr) -> void {
+    formulation_ptr_->FillBoundaryTerm(cell_matrix, cell_ptr, face_index.get(),
+                                       GetBoundaryType(cell_ptr, face_index),
+                                       equation);
+  };
+  *fixed_matrix_ptr = 0;
+  *fixed_vector_ptr = 0;
+  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, streaming_term_function);
+  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, collision_term_function);
+  stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr, boundary_function);
+  stamper_ptr_->StampVector(*fixed_vector_ptr, fixed_term_function);
+}
+
+template<int dim>
+void SimplifiedPNUpdater<dim>::UpdateScatteringSource(
+    system::System &to_update,
+    system::EnergyGroup energy_group,
+    quadrature::QuadraturePointIndex index) {
+  using CellPtr = domain::CellPtr<dim>;
+  const int group = energy_group.get();
+  const int equation = index.get();
+  auto scattering_source_ptr =
+      to_update.right_hand_side_ptr_->GetVariableTermPtr(
+          {group, equation}, system::terms::VariableLinearTerms::kScatteringSource);
+  *scattering_source_ptr = 0;
+  const auto& current_moments = to_update.current_moments->moments();
+  auto scattering_source_function =
+      [&](formulation::Vector& cell_vector, const CellPtr& cell_ptr) -> void {
+        formulation_ptr_->FillCellScatteringSource(cell_vector, cell_ptr, group,
+                                                   equation, current_moments);
+      };
+  auto boundary_coupling_function =
+      [&](formulation::Vector& cell_vector, const domain::FaceIndex face_index,
+          const CellPtr& cell_ptr) -> void {
+        formulation_ptr_->FillBoundaryCouplingSource(
+            cell_vector, cell_ptr, face_index.get(),
+            GetBoundaryType(cell_ptr, face_index), group, equation,
+            current_moments);
+      };
+  stamper_ptr_->StampVector(*scattering_source_ptr, scattering_source_function);
+  stamper_ptr_->StampBoundaryVector(*scattering_source_ptr,
+                                    boundary_coupling_function);
+}
+
+template<int dim>
+void SimplifiedPNUpdater<dim>::UpdateFissionSource(
+    system::System &to_update,
+    system::EnergyGroup energy_group,
+    quadrature::QuadraturePointIndex index) {
+  const int group = energy_group.get();
+  const int equation = index.get();
+  auto fission_source_ptr =
+      to_update.right_hand_side_ptr_->GetVariableTermPtr(
+          {group, equation}, system::terms::VariableLinearTerms::kFissionSource);
+  *fission_source_ptr = 0;
+  const auto& current_moments = to_update.current_moments->moments();
+  const auto& in_group_moment = current_moments.at({group, 0, 0});
+  auto fission_source_function =
+      [&](formulation::Vector& cell_vector,
+          const domain::CellPtr<dim> &cell_ptr) -> void {
+        formulation_ptr_->FillCellFissionSource(cell_vector,
+                                                cell_ptr,
+                                                group,
+                                                equation,
+                                                to_update.k_effective.value(),
+                                                in_group_moment,
+                                                current_moments);
+      };
+  stamper_ptr_->StampVector(*fission_source_ptr, fission_source_function);
+}
+
+template<int dim>
+void SimplifiedPNUpdater<dim>::UpdateFixedSource(
+    system::System &to_update,
+    system::EnergyGroup energy_group,
+    quadrature::QuadraturePointIndex index) {
+  const int group = energy_group.get();
+  const int equation = index.get();
+  auto fixed_source_ptr =
+      to_update.right_hand_side_ptr_->GetFixedTermPtr({group, equation});
+  *fixed_source_ptr = 0;
+  auto fixed_source_function =
+      [&](formulation::Vector& cell_vector,
+          const domain::CellPtr<dim> &cell_ptr) -> void {
+        formulation_ptr_->FillCellFixedSource(cell_vector, cell_ptr, group,
+                                              equation);
+      };
+  stamper_ptr_->StampVector(*fixed_source_ptr, fixed_source_function);
+}
+
+template<int dim>
+auto SimplifiedPNUpdater<dim>::GetBoundaryType(
+    const domain::CellPtr<dim>& cell_ptr,
+    const domain::FaceIndex face_index) const -> BoundaryType {
+  problem::Boundary boundary = static_cast<problem::Boundary>(
+      cell_ptr->face(face_index.get())->boundary_id());
+  if (reflective_boundaries_.count(boundary) == 1)
+    return BoundaryType::kReflective;
+  return BoundaryType::kVacuum;
+}
+
+template class SimplifiedPNUpdater<1>;
+template class SimplifiedPNUpdater<2>;
+template class SimplifiedPNUpdater<3>;
+
+} // namespace updater
+
+} // namespace formulation
+
+} // namespace bart
@@ -0,0 +1,89 @@
+#ifndef BART_SRC_FORMULATION_UPDATER_SIMPLIFIED_PN_UPDATER_H_
+#define BART_SRC_FORMULATION_UPDATER_SIMPLIFIED_PN_UPDATER_H_
+
+#include <memory>
+#include <unordered_set>
+
+#include "formulation/scalar/simplified_pn_i.h"
+#include "formulation/stamper_i.h"
+#include "formulation/updater/fixed_updater_i.h"
+#include "formulation/updater/fixed_source_updater_i.h"
+#include "formulation/updater/scattering_source_updater_i.h"
+#include "formulation/updater/fission_source_updater_i.h"
+#include "problem/parameter_types.h"
+#include "utility/has_description.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace updater {
+
+/*! \brief Updater for simplified \f$P_N\f$ formulations.
+ *
+ * Each equation of the formulation is stored in the system as an angle of the
+ * group, so the quadrature point index passed to each update is the equation
+ * number. The lagged coupling between the equations of a group is updated
+ * with the scattering source, as it depends on the current in-group moments.
+ */
+template <int dim>
+class SimplifiedPNUpdater
+    : public FixedUpdaterI, public ScatteringSourceUpdaterI,
+      public FissionSourceUpdaterI, public FixedSourceUpdaterI,
+      public utility::HasDescription {
+ public:
+  using SimplifiedPNFormulationType = formulation::scalar::SimplifiedPNI<dim>;
+  using StamperType = formulation::StamperI<dim>;
+  SimplifiedPNUpdater(std::unique_ptr<SimplifiedPNFormulationType>,
+                      std::unique_ptr<StamperType>,
+                      std::unordered_set<problem::Boundary> reflective_boundaries = {});
+  virtual ~SimplifiedPNUpdater() = default;
+
+  void UpdateFixedTerms(
+      system::System&,
+      system::EnergyGroup,
+      quadrature::QuadraturePointIndex) override;
+
+  /*! \brief Updates the scattering source for an equation.
+   *
+   * This includes the out-group scattering source, and the coupling to the
+   * other equations of the group in the cells and on vacuum boundaries.
+   */
+  void UpdateScatteringSource(
+      system::System &,
+      system::EnergyGroup,
+      quadrature::QuadraturePointIndex) override;
+
+  void UpdateFissionSource(
+      system::System &,
+      system::EnergyGroup,
+      quadrature::QuadraturePointIndex) override;
+
+  void UpdateFixedSource(
+      system::System &to_update,
+      system::EnergyGroup group,
+      quadrature::QuadraturePointIndex index) override;
+
+  std::unordered_set<problem::Boundary>& reflective_boundaries() {
+    return reflective_boundaries_; }
+  SimplifiedPNFormulationType* formulation_ptr() const {
+    return formulation_ptr_.get(); }
+  StamperType* stamper_ptr() const { return stamper_ptr_.get(); }
+ private:
+  using BoundaryType = typename SimplifiedPNFormulationType::BoundaryType;
+  //! Boundary type of a boundary face of a cell
+  BoundaryType GetBoundaryType(const domain::CellPtr<dim>& cell_ptr,
+                               const domain::FaceIndex face_index) const;
+
+  std::unique_ptr<SimplifiedPNFormulationType> formulation_ptr_;
+  std::unique_ptr<StamperType> stamper_ptr_;
+  std::unordered_set<problem::Boundary> reflective_boundaries_;
+};
+
+} // namespace updater
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_UPDATER_SIMPLIFIED_PN_UPDATER_H_
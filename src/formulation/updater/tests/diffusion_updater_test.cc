@@ -165,6 +165,44 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFixedTermTest) {
                                      *this->vector_to_stamp));
 }
 
+TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFixedTermGroupCouplingTest) {
+  system::EnergyGroup group_number(this->group_number);
+  quadrature::QuadraturePointIndex angle_index(this->angle_index);
+  const int source_group = this->group_number + 1;
+
+  auto coupling_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  coupling_matrix_ptr->reinit(this->matrix_1);
+  this->StampMatrix(*coupling_matrix_ptr, 2.0);
+  auto other_coupling_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  other_coupling_matrix_ptr->reinit(this->matrix_1);
+  this->test_system_.group_coupling_terms.insert_or_assign(
+      {this->group_number, source_group}, coupling_matrix_ptr);
+  this->test_system_.group_coupling_terms.insert_or_assign(
+      {source_group, this->group_number}, other_coupling_matrix_ptr);
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringCouplingTerm(
+        _, cell, this->group_number, source_group));
+  }
+  EXPECT_CALL(*this->formulation_obs_ptr_,
+              FillCellScatteringCouplingTerm(_, _, source_group, _)).Times(0);
+
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampMatrix(Ref(*this->matrix_to_stamp), _))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampMatrix(Ref(*coupling_matrix_ptr), _))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampMatrix(Ref(*other_coupling_matrix_ptr), _))
+      .Times(0);
+
+  this->test_updater_ptr_->UpdateFixedTerms(this->test_system_, group_number, angle_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result,
+                                     *coupling_matrix_ptr));
+}
+
 // ====== UpdateScatteringSource TESTS =========================================
 
 TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateScatteringSourceTest) {
@@ -1,13 +1,13 @@
 #include "formulation/updater/saaf_updater.h"
 
+#include "quadrature/tests/quadrature_point_mock.h"
 #include "quadrature/tests/quadrature_set_mock.h"
+#include "formulation/angular/tests/saaf_source_operators_mock.h"
 #include "formulation/angular/tests/self_adjoint_angular_flux_mock.h"
 #include "formulation/tests/stamper_mock.h"
 #include "formulation/updater/tests/updater_tests.h"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_assertions.hpp"
-#include "system/solution/solution_types.h"
-#include "system/solution/tests/mpi_group_angular_solution_mock.h"
 
 namespace {
 
@@ -40,7 +40,8 @@ class FormulationUpdaterSAAFTest :
   std::unordered_set<Boundary> reflective_boundaries{Boundary::kXMin,
                                                      Boundary::kYMax,
                                                      Boundary::kZMin};
-  system::solution::EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map_;
+  std::shared_ptr<system::solution::BoundaryAngularSolution>
+      boundary_solution_ptr_;
   void SetUp() override;
   bool IsAReflectiveFace(int boundary_id) {
     return this->reflective_boundaries.count(
@@ -60,17 +61,16 @@ void FormulationUpdaterSAAFTest<DimensionWrapper>::SetUp() {
   ON_CALL(*quadrature_set_ptr_, size())
       .WillByDefault(Return(this->total_angles));
 
-  angular_solution_ptr_map_.insert({system::SolutionIndex(this->group_number,
-                                                          this->angle_index),
-                                    std::make_shared<dealii::Vector<double>>(4)});
-  angular_solution_ptr_map_.insert({system::SolutionIndex(this->group_number,
-                                                          this->reflected_angle_index),
-                                    std::make_shared<dealii::Vector<double>>(4)});
+  boundary_solution_ptr_ =
+      std::make_shared<system::solution::BoundaryAngularSolution>(
+          std::vector<dealii::types::global_dof_index>{0},
+          this->locally_owned_dofs_, this->total_groups,
+          std::max(this->angle_index, this->reflected_angle_index) + 1);
 
   test_updater_ptr = std::make_unique<UpdaterType>(std::move(formulation_ptr),
                                                    std::move(stamper_ptr),
                                                    quadrature_set_ptr_,
-                                                   angular_solution_ptr_map_,
+                                                   boundary_solution_ptr_,
                                                    reflective_boundaries);
 }
 
@@ -107,29 +107,33 @@ TYPED_TEST(FormulationUpdaterSAAFTest, ConstructorReflective) {
   using StamperType = formulation::StamperMock<dim>;
   using UpdaterType = formulation::updater::SAAFUpdater<dim>;
   using QuadratureSetType = quadrature::QuadratureSetMock<dim>;
-  using AngularSolutionType = bart::system::solution::MPIGroupAngularSolutionMock;
 
   auto formulation_ptr = std::make_unique<FormulationType>();
   auto stamper_ptr = std::make_unique<StamperType>();
   auto quadrature_set_ptr = std::make_shared<QuadratureSetType>();
   std::unique_ptr<UpdaterType> test_updater_ptr;
-  system::solution::EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map;
-
-  auto angular_solution_ptr = std::make_shared<AngularSolutionType>();
 
   EXPECT_NO_THROW({
     test_updater_ptr = std::make_unique<UpdaterType>(std::move(formulation_ptr),
                                                      std::move(stamper_ptr),
                                                      quadrature_set_ptr,
-                                                     angular_solution_ptr_map,
+                                                     this->boundary_solution_ptr_,
                                                      this->reflective_boundaries);
                   });
   EXPECT_NE(test_updater_ptr->formulation_ptr(), nullptr);
   EXPECT_NE(test_updater_ptr->stamper_ptr(), nullptr);
   EXPECT_NE(test_updater_ptr->quadrature_set_ptr(), nullptr);
-  EXPECT_EQ(test_updater_ptr->angular_solution_ptr_map(),
-            angular_solution_ptr_map);
+  EXPECT_EQ(test_updater_ptr->boundary_angular_solution_ptr(),
+            this->boundary_solution_ptr_);
+  EXPECT_FALSE(test_updater_ptr->is_reflection_implicit());
   EXPECT_EQ(test_updater_ptr->reflective_boundaries(), this->reflective_boundaries);
+
+  std::shared_ptr<system::solution::BoundaryAngularSolution> null_solution_ptr;
+  EXPECT_ANY_THROW({
+    test_updater_ptr = std::make_unique<UpdaterType>(
+        std::make_unique<FormulationType>(), std::make_unique<StamperType>(),
+        quadrature_set_ptr, null_solution_ptr, this->reflective_boundaries);
+                   });
 }
 
 TYPED_TEST(FormulationUpdaterSAAFTest, ConstructorBadDepdendencies) {
@@ -162,80 +166,65 @@ TYPED_TEST(FormulationUpdaterSAAFTest, ConstructorBadDepdendencies) {
 
 // ===== Update Boundary Conditions Tests ======================================
 
-TYPED_TEST(FormulationUpdaterSAAFTest, UpdateBoundaryConditionsTest) {
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateBoundaryConditionsBoundaryStorageTest) {
   constexpr int dim = this->dim;
-  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
   using VariableLinearTerms = system::terms::VariableLinearTerms;
-  using MockSolutionType = system::solution::MPIGroupAngularSolutionMock;
-
-  system::EnergyGroup group_number(this->group_number);
-
-  // Quadrature point and reflection
-  quadrature::QuadraturePointIndex quad_index(this->angle_index),
-      reflected_index(this->reflected_angle_index);
-  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_,
-      reflected_point_ptr_;
+  auto formulation_obs_ptr = this->formulation_obs_ptr_;
+  auto stamper_obs_ptr = this->stamper_obs_ptr_;
+  auto boundary_solution_ptr = this->boundary_solution_ptr_;
+  auto& test_updater_ptr = this->test_updater_ptr;
 
-  // Mock expectation layout
-  // -- Retrieve the correct variable term to update, returns vector_to_stamp
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
       this->index, VariableLinearTerms::kReflectiveBoundaryCondition))
-      .WillOnce(DoDefault());
-  // -- Get the quadrature point identified by the passed index
-  EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
-      .WillOnce(Return(quadrature_point_ptr_));
-  // -- Get the quadrature point's reflection for angular flux
-  auto angular_flux_vector_ptr = this->angular_solution_ptr_map_.at(
-      system::SolutionIndex(this->group_number, this->reflected_angle_index));
-  // -- For each cell that is on a reflective boundary, we expect a call to the
-  // formulation.
-  int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
-
-  EXPECT_CALL(*this->quadrature_set_ptr_,
-              GetBoundaryReflection(quadrature_point_ptr_, problem::Boundary::kXMin))
-      .Times(::testing::AtLeast(1))
-      .WillRepeatedly(Return(reflected_point_ptr_));
-  if (dim > 1) {
-    EXPECT_CALL(*this->quadrature_set_ptr_,
-                GetBoundaryReflection(quadrature_point_ptr_, problem::Boundary::kYMax))
-        .Times(::testing::AtLeast(1))
-        .WillRepeatedly(Return(reflected_point_ptr_));
-  }
-  if (dim > 2) {
-    EXPECT_CALL(*this->quadrature_set_ptr_,
-                GetBoundaryReflection(quadrature_point_ptr_, problem::Boundary::kZMin))
-        .Times(::testing::AtLeast(1))
-        .WillRepeatedly(Return(reflected_point_ptr_));
-  }
-
-  EXPECT_CALL(*this->quadrature_set_ptr_,
-              GetQuadraturePointIndex(reflected_point_ptr_))
-      .Times(::testing::AtLeast(1))
-      .WillRepeatedly(Return(this->reflected_angle_index));
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  system::EnergyGroup group_number(this->group_number);
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  ON_CALL(*this->quadrature_set_ptr_, GetBoundaryReflectionIndex(quad_index, _))
+      .WillByDefault(Return(this->reflected_angle_index));
 
-  // Gather information about the cells, to set expectations
+  // No stored incoming flux, no boundary terms are filled
+  EXPECT_CALL(*formulation_obs_ptr, FillReflectiveBoundaryLinearTerm(_, _, _, _, _))
+      .Times(0);
+  EXPECT_CALL(*stamper_obs_ptr, StampBoundaryVector(Ref(*this->vector_to_stamp), _))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  test_updater_ptr->UpdateBoundaryConditions(this->test_system_, group_number,
+                                             quad_index);
+  ::testing::Mock::VerifyAndClearExpectations(formulation_obs_ptr);
+
+  this->vector_1 = 2.0;
+  boundary_solution_ptr->Store(
+      system::SolutionIndex(group_number,
+                            system::AngleIdx(this->reflected_angle_index)),
+      this->vector_1);
+
+  // Incoming flux is given at the cell degrees of freedom, only the stored
+  // boundary degree of freedom is non-zero
+  const int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
   for (auto& cell : this->cells_) {
     if (cell->at_boundary()) {
+      std::vector<dealii::types::global_dof_index> cell_dofs(
+          cell->get_fe().dofs_per_cell);
+      cell->get_dof_indices(cell_dofs);
+      std::vector<double> expected_incoming_flux(cell_dofs.size(), 0);
+      for (int i = 0; i < static_cast<int>(cell_dofs.size()); ++i) {
+        if (cell_dofs[i] == 0)
+          expected_incoming_flux[i] = 2.0;
+      }
       for (int face = 0; face < faces_per_cell; ++face) {
         if (const auto boundary_id = cell->face(face)->boundary_id();
             this->IsAReflectiveFace(boundary_id)) {
-          EXPECT_CALL(*this->formulation_obs_ptr_,
-              FillReflectiveBoundaryLinearTerm(_,
-                                               cell,
-                                               domain::FaceIndex(face),
-                                               quadrature_point_ptr_,
-                                               Ref(*angular_flux_vector_ptr)));
+          EXPECT_CALL(*formulation_obs_ptr,
+                      FillReflectiveBoundaryLinearTerm(
+                          _, cell, domain::FaceIndex(face), _,
+                          expected_incoming_flux));
         }
       }
     }
   }
-  // -- We expect the stamper to be called just once to execute the stamping.
-  EXPECT_CALL(*this->stamper_obs_ptr_,
-      StampBoundaryVector(Ref(*this->vector_to_stamp), _))
-      .WillOnce(DoDefault());
-
-  this->test_updater_ptr->UpdateBoundaryConditions(this->test_system_,
-                                                   group_number, quad_index);
+  test_updater_ptr->UpdateBoundaryConditions(this->test_system_, group_number,
+                                             quad_index);
   EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
                                      *this->vector_to_stamp));
 }
@@ -301,6 +290,277 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsTest) {
                                      *this->vector_to_stamp));
 }
 
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsSharedReflectionAssembled) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
+  using VariableBilinearTerms = system::terms::VariableBilinearTerms;
+
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_ =
+      std::make_shared<quadrature::QuadraturePointMock<dim>>();
+
+  // Fixed term shared with the reflection, already assembled
+  *this->matrix_to_stamp = 0;
+  this->StampMatrix(*this->matrix_to_stamp, 2.0);
+  system::MPISparseMatrix expected_shared_matrix;
+  expected_shared_matrix.reinit(this->matrix_1);
+  this->StampMatrix(expected_shared_matrix, 2.0);
+  auto boundary_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  boundary_matrix_ptr->reinit(this->matrix_1);
+  this->StampMatrix(*boundary_matrix_ptr, 3.0);
+  this->test_updater_ptr->assembled_fixed_terms().insert(this->reflected_index);
+
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetVariableTerms())
+      .WillOnce(Return(std::unordered_set<VariableBilinearTerms>{
+          VariableBilinearTerms::kBoundary}));
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetVariableTermPtr(
+      this->index, VariableBilinearTerms::kBoundary))
+      .WillOnce(Return(boundary_matrix_ptr));
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(this->reflected_index))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, SetFixedTermPtr(A<system::Index>(), _))
+      .Times(0);
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
+      .WillOnce(Return(quadrature_point_ptr_));
+  EXPECT_CALL(*this->quadrature_set_ptr_,
+              GetReflectionIndex(quadrature_point_ptr_))
+      .WillOnce(Return(std::optional<int>(this->reflected_angle_index)));
+
+  // Only the boundary terms of this angle are filled
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, _, _, _))
+      .Times(0);
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellCollisionTerm(_, _, _))
+      .Times(0);
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_,
+        FillCellFixedSourceTerm(_, cell, quadrature_point_ptr_, group_number));
+    int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+    if (cell->at_boundary()) {
+      for (int face = 0; face < faces_per_cell; ++face) {
+        if (cell->face(face)->at_boundary()) {
+          EXPECT_CALL(*this->formulation_obs_ptr_,
+                      FillBoundaryBilinearTerm(_, cell, domain::FaceIndex(face),
+                                               quadrature_point_ptr_,
+                                               group_number));
+        }
+      }
+    }
+  }
+
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrix(_,_)).Times(0);
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampBoundaryMatrix(Ref(*boundary_matrix_ptr),_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampVector(Ref(*this->vector_to_stamp),_))
+      .WillOnce(DoDefault());
+
+  this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number,
+                                           quad_index);
+  // Shared matrix is untouched, the boundary term is zeroed before stamping
+  EXPECT_TRUE(test_helpers::AreEqual(expected_shared_matrix,
+                                     *this->matrix_to_stamp));
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result,
+                                     *boundary_matrix_ptr));
+  EXPECT_EQ(this->test_updater_ptr->assembled_fixed_terms().count(this->index),
+            1);
+}
+
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsSharedReflectionNotAssembled) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
+  using VariableBilinearTerms = system::terms::VariableBilinearTerms;
+
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_ =
+      std::make_shared<quadrature::QuadraturePointMock<dim>>();
+
+  auto boundary_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  boundary_matrix_ptr->reinit(this->matrix_1);
+  this->StampMatrix(*boundary_matrix_ptr, 3.0);
+
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetVariableTerms())
+      .WillOnce(Return(std::unordered_set<VariableBilinearTerms>{
+          VariableBilinearTerms::kBoundary}));
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetVariableTermPtr(
+      this->index, VariableBilinearTerms::kBoundary))
+      .WillOnce(Return(boundary_matrix_ptr));
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
+      .WillOnce(Return(quadrature_point_ptr_));
+  EXPECT_CALL(*this->quadrature_set_ptr_,
+              GetReflectionIndex(quadrature_point_ptr_))
+      .WillOnce(Return(std::optional<int>(this->reflected_angle_index)));
+
+  // The shared matrix is stamped without boundary terms
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampMatrix(Ref(*this->matrix_to_stamp),_))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampBoundaryMatrix(Ref(*this->matrix_to_stamp),_))
+      .Times(0);
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampBoundaryMatrix(Ref(*boundary_matrix_ptr),_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampVector(Ref(*this->vector_to_stamp),_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, _, _, _))
+      .Times(this->cells_.size());
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellCollisionTerm(_, _, _))
+      .Times(this->cells_.size());
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFixedSourceTerm(_, _, _, _))
+      .Times(this->cells_.size());
+  EXPECT_CALL(*this->formulation_obs_ptr_,
+              FillBoundaryBilinearTerm(_, _, _, quadrature_point_ptr_,
+                                       group_number))
+      .Times(::testing::AnyNumber());
+
+  this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number,
+                                           quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result,
+                                     *this->matrix_to_stamp));
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result,
+                                     *boundary_matrix_ptr));
+  EXPECT_EQ(this->test_updater_ptr->assembled_fixed_terms(),
+            std::set<system::Index>{this->index});
+}
+
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsNewAssembly) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
+  using VariableBilinearTerms = system::terms::VariableBilinearTerms;
+
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_ =
+      std::make_shared<quadrature::QuadraturePointMock<dim>>();
+
+  auto boundary_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  boundary_matrix_ptr->reinit(this->matrix_1);
+
+  // Both angles were assembled in the previous assembly of the system
+  auto& assembled_fixed_terms = this->test_updater_ptr->assembled_fixed_terms();
+  assembled_fixed_terms.insert(this->index);
+  assembled_fixed_terms.insert(this->reflected_index);
+
+  ON_CALL(*this->mock_lhs_obs_ptr_, GetVariableTerms())
+      .WillByDefault(Return(std::unordered_set<VariableBilinearTerms>{
+          VariableBilinearTerms::kBoundary}));
+  ON_CALL(*this->mock_lhs_obs_ptr_, GetVariableTermPtr(
+      this->index, VariableBilinearTerms::kBoundary))
+      .WillByDefault(Return(boundary_matrix_ptr));
+  ON_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
+      .WillByDefault(Return(quadrature_point_ptr_));
+  ON_CALL(*this->quadrature_set_ptr_, GetReflectionIndex(quadrature_point_ptr_))
+      .WillByDefault(Return(std::optional<int>(this->reflected_angle_index)));
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, _, _, _))
+      .Times(::testing::AnyNumber());
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellCollisionTerm(_, _, _))
+      .Times(::testing::AnyNumber());
+  EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFixedSourceTerm(_, _, _, _))
+      .Times(::testing::AnyNumber());
+  EXPECT_CALL(*this->formulation_obs_ptr_,
+              FillBoundaryBilinearTerm(_, _, _, _, _))
+      .Times(::testing::AnyNumber());
+
+  // The reflection is no longer assembled, the shared matrix is stamped again
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampMatrix(Ref(*this->matrix_to_stamp),_))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampBoundaryMatrix(Ref(*boundary_matrix_ptr),_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .WillOnce(DoDefault());
+
+  this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number,
+                                           quad_index);
+  EXPECT_EQ(this->test_updater_ptr->assembled_fixed_terms(),
+            std::set<system::Index>{this->index});
+}
+
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsImplicitReflectionTest) {
+  constexpr int dim = this->dim;
+  using FormulationType = NiceMock<formulation::angular::SelfAdjointAngularFluxMock<dim>>;
+  using UpdaterType = formulation::updater::SAAFUpdater<dim>;
+  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
+
+  auto formulation_ptr = std::make_unique<FormulationType>();
+  auto formulation_obs_ptr = formulation_ptr.get();
+  auto stamper_ptr = this->MakeStamper();
+  auto stamper_obs_ptr = stamper_ptr.get();
+
+  auto test_updater_ptr = std::make_unique<UpdaterType>(
+      std::move(formulation_ptr), std::move(stamper_ptr),
+      this->quadrature_set_ptr_, this->reflective_boundaries);
+  EXPECT_TRUE(test_updater_ptr->is_reflection_implicit());
+  EXPECT_EQ(test_updater_ptr->reflective_boundaries(),
+            this->reflective_boundaries);
+
+  auto coupling_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  coupling_matrix_ptr->reinit(this->matrix_1);
+  this->StampMatrix(*coupling_matrix_ptr, 2.0);
+  this->test_system_.reflective_coupling_terms.insert_or_assign(
+      {this->angle_index, this->reflected_angle_index}, coupling_matrix_ptr);
+
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+  std::shared_ptr<QuadraturePointType> quadrature_point_ptr_;
+
+  ON_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
+      .WillByDefault(Return(quadrature_point_ptr_));
+  ON_CALL(*this->quadrature_set_ptr_, GetBoundaryReflectionIndex(quad_index, _))
+      .WillByDefault(Return(this->reflected_angle_index));
+
+  const int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  for (auto& cell : this->cells_) {
+    if (cell->at_boundary()) {
+      for (int face = 0; face < faces_per_cell; ++face) {
+        if (const auto boundary_id = cell->face(face)->boundary_id();
+            this->IsAReflectiveFace(boundary_id)) {
+          EXPECT_CALL(*formulation_obs_ptr,
+                      FillReflectiveBoundaryBilinearTerm(
+                          _, cell, domain::FaceIndex(face),
+                          quadrature_point_ptr_));
+        }
+      }
+    }
+  }
+
+  EXPECT_CALL(*stamper_obs_ptr,
+              StampBoundaryMatrix(Ref(*this->matrix_to_stamp), _))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  // Coupling terms are group independent and only stamped once
+  EXPECT_CALL(*stamper_obs_ptr,
+              StampBoundaryMatrix(Ref(*coupling_matrix_ptr), _))
+      .WillOnce(DoDefault());
+
+  const system::EnergyGroup other_group_number(this->group_number + 1);
+  test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number,
+                                     quad_index);
+  test_updater_ptr->UpdateFixedTerms(this->test_system_, other_group_number,
+                                     quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result,
+                                     *coupling_matrix_ptr));
+  EXPECT_ANY_THROW({
+    test_updater_ptr->UpdateBoundaryConditions(this->test_system_,
+                                               group_number, quad_index);
+  });
+}
+
 TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceTest) {
   constexpr int dim = this->dim;
   using QuadraturePointType = quadrature::QuadraturePointI<dim>;
@@ -366,4 +626,67 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceTest) {
                                      *this->vector_to_stamp));
 }
 
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceOperatorsTest) {
+  constexpr int dim = this->dim;
+  auto source_operators_ptr = std::make_shared<
+      formulation::angular::SAAFSourceOperatorsMock<dim>>();
+  this->test_updater_ptr->SetSourceOperators(source_operators_ptr);
+  EXPECT_EQ(this->test_updater_ptr->source_operators_ptr(),
+            source_operators_ptr.get());
+
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index,
+      system::terms::VariableLinearTerms::kScatteringSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*source_operators_ptr, AddScatteringSource(
+      Ref(*this->vector_to_stamp), group_number, quad_index,
+      Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+      Ref(this->current_iteration_moments_)));
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_)).Times(0);
+  EXPECT_CALL(*this->formulation_obs_ptr_,
+              FillCellScatteringSourceTerm(_, _, _, _, _, _)).Times(0);
+
+  this->test_updater_ptr->UpdateScatteringSource(this->test_system_,
+                                                 group_number, quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceOperatorsTest) {
+  constexpr int dim = this->dim;
+  auto source_operators_ptr = std::make_shared<
+      formulation::angular::SAAFSourceOperatorsMock<dim>>();
+  this->test_updater_ptr->SetSourceOperators(source_operators_ptr);
+
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  const double k_effective = 1.045;
+  this->test_system_.k_effective = k_effective;
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index,
+      system::terms::VariableLinearTerms::kFissionSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*source_operators_ptr, AddFissionSource(
+      Ref(*this->vector_to_stamp), group_number, quad_index, k_effective,
+      Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+      Ref(this->current_iteration_moments_)));
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_)).Times(0);
+  EXPECT_CALL(*this->formulation_obs_ptr_,
+              FillCellFissionSourceTerm(_, _, _, _, _, _, _)).Times(0);
+
+  this->test_updater_ptr->UpdateFissionSource(this->test_system_,
+                                              group_number, quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
 } // namespace
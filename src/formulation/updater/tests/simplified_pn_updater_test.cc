@@ -0,0 +1,242 @@
+#include "formulation/updater/simplified_pn_updater.h"
+
+#include "formulation/scalar/tests/simplified_pn_mock.h"
+#include "formulation/tests/stamper_mock.h"
+#include "formulation/updater/tests/updater_tests.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::DoDefault, ::testing::_, ::testing::Ref;
+
+template <typename DimensionWrapper>
+class FormulationUpdaterSimplifiedPNTest :
+    public bart::formulation::updater::test_helpers::UpdaterTests<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+
+  using FormulationType = formulation::scalar::SimplifiedPNMock<dim>;
+  using StamperType = formulation::StamperMock<dim>;
+  using UpdaterType = formulation::updater::SimplifiedPNUpdater<dim>;
+  using Boundary = problem::Boundary;
+  using BoundaryType = typename formulation::scalar::SimplifiedPNI<dim>::BoundaryType;
+
+  std::unique_ptr<UpdaterType> test_updater_ptr_;
+
+  FormulationType* formulation_obs_ptr_;
+  StamperType* stamper_obs_ptr_;
+
+  std::unordered_set<Boundary> reflective_boundaries{Boundary::kXMin, Boundary::kYMax};
+
+  BoundaryType GetBoundaryType(const domain::CellPtr<dim>& cell, const int face) {
+    problem::Boundary boundary_id = static_cast<problem::Boundary>(
+        cell->face(face)->boundary_id());
+    if (reflective_boundaries.count(boundary_id) == 1)
+      return BoundaryType::kReflective;
+    return BoundaryType::kVacuum;
+  }
+
+  void SetUp() override;
+};
+
+TYPED_TEST_SUITE(FormulationUpdaterSimplifiedPNTest, bart::testing::AllDimensions);
+
+template <typename DimensionWrapper>
+void FormulationUpdaterSimplifiedPNTest<DimensionWrapper>::SetUp() {
+  bart::formulation::updater::test_helpers::UpdaterTests<dim>::SetUp();
+  auto formulation_ptr = std::make_unique<FormulationType>();
+  formulation_obs_ptr_ = formulation_ptr.get();
+  auto stamper_ptr = this->MakeStamper();
+  stamper_obs_ptr_ = stamper_ptr.get();
+
+  test_updater_ptr_ = std::make_unique<UpdaterType>(std::move(formulation_ptr),
+                                                    std::move(stamper_ptr),
+                                                    reflective_boundaries);
+}
+
+// ===== CONSTRUCTOR TESTS =====================================================
+
+TYPED_TEST(FormulationUpdaterSimplifiedPNTest, Constructor) {
+  constexpr int dim = this->dim;
+  using FormulationType = formulation::scalar::SimplifiedPNMock<dim>;
+  using StamperType = formulation::StamperMock<dim>;
+  using UpdaterType = formulation::updater::SimplifiedPNUpdater<dim>;
+
+  auto formulation_ptr = std::make_unique<FormulationType>();
+  auto stamper_ptr = std::make_unique<StamperType>();
+  std::unique_ptr<UpdaterType> test_updater_ptr;
+  EXPECT_NO_THROW({
+    test_updater_ptr = std::make_unique<UpdaterType>(
+        std::move(formulation_ptr), std::move(stamper_ptr),
+        this->reflective_boundaries);
+  });
+  ASSERT_NE(test_updater_ptr->formulation_ptr(), nullptr);
+  ASSERT_NE(test_updater_ptr->stamper_ptr(), nullptr);
+  EXPECT_EQ(this->reflective_boundaries, test_updater_ptr->reflective_boundaries());
+}
+
+TYPED_TEST(FormulationUpdaterSimplifiedPNTest, ConstructorBadDependencies) {
+  constexpr int dim = this->dim;
+  using FormulationType = formulation::scalar::SimplifiedPNMock<dim>;
+  using StamperType = formulation::StamperMock<dim>;
+  using UpdaterType = formulation::updater::SimplifiedPNUpdater<dim>;
+
+  auto formulation_ptr = std::make_unique<FormulationType>();
+  auto stamper_ptr = std::make_unique<StamperType>();
+  std::unique_ptr<UpdaterType> test_updater_ptr;
+  EXPECT_ANY_THROW({test_updater_ptr = std::make_unique<UpdaterType>(
+      nullptr, std::move(stamper_ptr)); });
+  EXPECT_ANY_THROW({test_updater_ptr = std::make_unique<UpdaterType>(
+      std::move(formulation_ptr), nullptr); });
+}
+
+// ===== UpdateFixedTerms() TESTS ==============================================
+
+TYPED_TEST(FormulationUpdaterSimplifiedPNTest, UpdateFixedTermTest) {
+  system::EnergyGroup group_number(this->group_number);
+  quadrature::QuadraturePointIndex equation_index(this->angle_index);
+  const int equation = this->angle_index;
+
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_,
+                FillCellStreamingTerm(_, cell, this->group_number, equation));
+    EXPECT_CALL(*this->formulation_obs_ptr_,
+                FillCellCollisionTerm(_, cell, this->group_number, equation));
+    EXPECT_CALL(*this->formulation_obs_ptr_,
+                FillCellFixedSource(_, cell, this->group_number, equation));
+    if (cell->at_boundary()) {
+      int faces_per_cell = dealii::GeometryInfo<this->dim>::faces_per_cell;
+      for (int face = 0; face < faces_per_cell; ++face) {
+        if (cell->face(face)->at_boundary()) {
+          EXPECT_CALL(*this->formulation_obs_ptr_, FillBoundaryTerm(
+              _, cell, face, this->GetBoundaryType(cell, face), equation));
+        }
+      }
+    }
+  }
+
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampMatrix(Ref(*this->matrix_to_stamp), _))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampBoundaryMatrix(Ref(*this->matrix_to_stamp), _))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampVector(Ref(*this->vector_to_stamp), _))
+      .WillOnce(DoDefault());
+
+  this->test_updater_ptr_->UpdateFixedTerms(this->test_system_, group_number,
+                                            equation_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result,
+                                     *this->matrix_to_stamp));
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+// ====== UpdateScatteringSource TESTS =========================================
+
+TYPED_TEST(FormulationUpdaterSimplifiedPNTest, UpdateScatteringSourceTest) {
+  system::EnergyGroup group_number(this->group_number);
+  quadrature::QuadraturePointIndex equation_index(this->angle_index);
+  const int equation = this->angle_index;
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index, system::terms::VariableLinearTerms::kScatteringSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampVector(Ref(*this->vector_to_stamp), _))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+      StampBoundaryVector(Ref(*this->vector_to_stamp), _))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSource(
+        _, cell, this->group_number, equation,
+        Ref(this->current_iteration_moments_)))
+        .WillOnce(DoDefault());
+    if (cell->at_boundary()) {
+      int faces_per_cell = dealii::GeometryInfo<this->dim>::faces_per_cell;
+      for (int face = 0; face < faces_per_cell; ++face) {
+        if (cell->face(face)->at_boundary()) {
+          EXPECT_CALL(*this->formulation_obs_ptr_, FillBoundaryCouplingSource(
+              _, cell, face, this->GetBoundaryType(cell, face),
+              this->group_number, equation,
+              Ref(this->current_iteration_moments_)));
+        }
+      }
+    }
+  }
+
+  this->test_updater_ptr_->UpdateScatteringSource(this->test_system_,
+                                                  group_number, equation_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+// ===== UpdateFissionSource TEST ==============================================
+
+TYPED_TEST(FormulationUpdaterSimplifiedPNTest, UpdateFissionSourceTest) {
+  system::EnergyGroup group_number(this->group_number);
+  quadrature::QuadraturePointIndex equation_index(this->angle_index);
+  const int equation = this->angle_index;
+
+  const double k_effective = bart::test_helpers::RandomDouble(0, 1.5);
+  this->test_system_.k_effective = k_effective;
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index, system::terms::VariableLinearTerms::kFissionSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFissionSource(
+        _, cell, this->group_number, equation, k_effective,
+        Ref(this->current_iteration_moments_.at({this->group_number, 0, 0})),
+        Ref(this->current_iteration_moments_)))
+        .WillOnce(DoDefault());
+  }
+
+  this->test_updater_ptr_->UpdateFissionSource(this->test_system_,
+                                               group_number, equation_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+// ===== UpdateFixedSource TEST ================================================
+
+TYPED_TEST(FormulationUpdaterSimplifiedPNTest, UpdateFixedSourceTest) {
+  system::EnergyGroup group_number(this->group_number);
+  quadrature::QuadraturePointIndex equation_index(this->angle_index);
+  const int equation = this->angle_index;
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .WillOnce(DoDefault());
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_,
+        FillCellFixedSource(_, cell, this->group_number, equation))
+        .WillOnce(DoDefault());
+  }
+
+  this->test_updater_ptr_->UpdateFixedSource(this->test_system_, group_number,
+                                             equation_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+} // namespace
@@ -0,0 +1,151 @@
+#include "formulation/updater/upwind_transport_updater.h"
+
+#include "formulation/angular/tests/upwind_transport_mock.h"
+#include "formulation/tests/stamper_mock.h"
+#include "formulation/updater/tests/updater_tests.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::Ref, ::testing::_, ::testing::DoDefault;
+
+template <typename DimensionWrapper>
+class FormulationUpdaterUpwindTransportTest :
+    public bart::formulation::updater::test_helpers::UpdaterTests<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+
+  using FormulationType = formulation::angular::UpwindTransportMock<dim>;
+  using StamperType = formulation::StamperMock<dim>;
+  using UpdaterType = formulation::updater::UpwindTransportUpdater<dim>;
+
+  // Test object
+  std::unique_ptr<UpdaterType> test_updater_ptr;
+
+  // Pointers to mocks
+  FormulationType* formulation_obs_ptr_;
+  StamperType* stamper_obs_ptr_;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void FormulationUpdaterUpwindTransportTest<DimensionWrapper>::SetUp() {
+  bart::formulation::updater::test_helpers::UpdaterTests<dim>::SetUp();
+  auto formulation_ptr = std::make_unique<FormulationType>();
+  formulation_obs_ptr_ = formulation_ptr.get();
+  auto stamper_ptr = this->MakeStamper();
+  stamper_obs_ptr_ = stamper_ptr.get();
+
+  test_updater_ptr = std::make_unique<UpdaterType>(std::move(formulation_ptr),
+                                                   std::move(stamper_ptr));
+}
+
+TYPED_TEST_SUITE(FormulationUpdaterUpwindTransportTest,
+                 bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationUpdaterUpwindTransportTest, Constructor) {
+  EXPECT_NE(this->test_updater_ptr->formulation_ptr(), nullptr);
+  EXPECT_NE(this->test_updater_ptr->stamper_ptr(), nullptr);
+}
+
+TYPED_TEST(FormulationUpdaterUpwindTransportTest, ConstructorBadDependencies) {
+  constexpr int dim = this->dim;
+  using FormulationType = formulation::angular::UpwindTransportMock<dim>;
+  using StamperType = formulation::StamperMock<dim>;
+  using UpdaterType = formulation::updater::UpwindTransportUpdater<dim>;
+
+  for (bool formulation_good : {true, false}) {
+    for (bool stamper_good : {true, false}) {
+      if (formulation_good && stamper_good)
+        continue;
+      auto formulation_ptr = formulation_good ?
+                             std::make_unique<FormulationType>() : nullptr;
+      auto stamper_ptr = stamper_good ?
+                         std::make_unique<StamperType>() : nullptr;
+      std::unique_ptr<UpdaterType> test_updater_ptr;
+      EXPECT_ANY_THROW({
+        test_updater_ptr = std::make_unique<UpdaterType>(
+            std::move(formulation_ptr), std::move(stamper_ptr));
+      });
+    }
+  }
+}
+
+TYPED_TEST(FormulationUpdaterUpwindTransportTest, UpdateFixedTermsTest) {
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(_)).Times(0);
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index))
+      .WillOnce(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_,
+                FillCellFixedSourceTerm(_, cell, group_number));
+  }
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrix(_, _)).Times(0);
+  EXPECT_CALL(*this->stamper_obs_ptr_,
+              StampVector(Ref(*this->vector_to_stamp), _))
+      .WillOnce(DoDefault());
+
+  this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number,
+                                           quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+TYPED_TEST(FormulationUpdaterUpwindTransportTest, UpdateScatteringSourceTest) {
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index, system::terms::VariableLinearTerms::kScatteringSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_, _))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSourceTerm(
+        _, cell, group_number,
+        Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+        Ref(this->current_iteration_moments_)));
+  }
+
+  this->test_updater_ptr->UpdateScatteringSource(this->test_system_,
+                                                 group_number, quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+TYPED_TEST(FormulationUpdaterUpwindTransportTest, UpdateFissionSourceTest) {
+  quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  system::EnergyGroup group_number(this->group_number);
+
+  const double k_effective = 1.045;
+  this->test_system_.k_effective = k_effective;
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
+      this->index, system::terms::VariableLinearTerms::kFissionSource))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_, _))
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments())
+      .WillOnce(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFissionSourceTerm(
+        _, cell, group_number, k_effective,
+        Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+        Ref(this->current_iteration_moments_)));
+  }
+
+  this->test_updater_ptr->UpdateFissionSource(this->test_system_,
+                                              group_number, quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result,
+                                     *this->vector_to_stamp));
+}
+
+} // namespace
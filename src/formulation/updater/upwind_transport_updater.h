@@ -0,0 +1,63 @@
+#ifndef BART_SRC_FORMULATION_UPDATER_UPWIND_TRANSPORT_UPDATER_H_
+#define BART_SRC_FORMULATION_UPDATER_UPWIND_TRANSPORT_UPDATER_H_
+
+#include <memory>
+
+#include "formulation/angular/upwind_transport_i.h"
+#include "formulation/stamper_i.h"
+#include "formulation/updater/fixed_updater_i.h"
+#include "formulation/updater/scattering_source_updater_i.h"
+#include "formulation/updater/fission_source_updater_i.h"
+#include "utility/has_description.h"
+
+namespace bart {
+
+namespace formulation {
+
+namespace updater {
+
+/*! \brief Updates the source terms of a system solved by transport sweeps.
+ *
+ * The left hand side of the upwind transport equations is inverted cell by
+ * cell by the sweep solver, so only the right hand side source terms are
+ * stamped into the system. All sources are isotropic.
+ */
+template <int dim>
+class UpwindTransportUpdater :
+    public FixedUpdaterI,
+    public ScatteringSourceUpdaterI,
+    public FissionSourceUpdaterI,
+    public utility::HasDescription {
+ public:
+  using UpwindTransportFormulationType = formulation::angular::UpwindTransportI<dim>;
+  using StamperType = formulation::StamperI<dim>;
+
+  UpwindTransportUpdater(std::unique_ptr<UpwindTransportFormulationType>,
+                         std::unique_ptr<StamperType>);
+
+  /*! \brief Updates the fixed source, the fixed left hand side is not used. */
+  void UpdateFixedTerms(system::System &to_update,
+                        system::EnergyGroup group,
+                        quadrature::QuadraturePointIndex index) override;
+  void UpdateFissionSource(system::System &to_update,
+                           system::EnergyGroup group,
+                           quadrature::QuadraturePointIndex index) override;
+  void UpdateScatteringSource(system::System &to_update,
+                              system::EnergyGroup group,
+                              quadrature::QuadraturePointIndex index) override;
+
+  UpwindTransportFormulationType* formulation_ptr() const {
+    return formulation_ptr_.get(); }
+  StamperType* stamper_ptr() const { return stamper_ptr_.get(); }
+ private:
+  std::unique_ptr<UpwindTransportFormulationType> formulation_ptr_;
+  std::unique_ptr<StamperType> stamper_ptr_;
+};
+
+} // namespace updater
+
+} // namespace formulation
+
+} // namespace bart
+
+#endif //BART_SRC_FORMULATION_UPDATER_UPWIND_TRANSPORT_UPDATER_H_
@@ -0,0 +1,38 @@
+#include "framework/adaptive_refinement.hpp"
+
+#include "framework/warm_start.hpp"
+
+namespace bart::framework {
+
+template <int dim>
+AdaptiveRefinement<dim>::AdaptiveRefinement(ParametersType parameters)
+    : parameters_(parameters),
+      n_cycles_(parameters.AdaptiveRefinementCycles()) {
+  AssertThrow(n_cycles_ >= 0,
+              dealii::ExcMessage("Error in AdaptiveRefinement constructor, "
+                                 "number of cycles must be non-negative"))
+}
+
+template <int dim>
+std::unique_ptr<FrameworkI> AdaptiveRefinement<dim>::BuildFramework(
+    std::string name) {
+  WarmStart<dim> warm_start(parameters_, builder_);
+  auto framework_ptr = warm_start.BuildFramework(
+      name + ", adaptive refinement cycle", n_cycles_,
+      parameters_.UniformRefinements(),
+      [this](domain::Definition<dim>& domain,
+             system::moments::MomentsMap& moments) {
+        domain.RefineAndCoarsen(domain.EstimateError(moments),
+                                parameters_.RefineFraction(),
+                                parameters_.CoarsenFraction(),
+                                moments); });
+  cycle_degrees_of_freedom_ = warm_start.step_degrees_of_freedom();
+  cycle_k_effective_ = warm_start.step_k_effective();
+  return framework_ptr;
+}
+
+template class AdaptiveRefinement<1>;
+template class AdaptiveRefinement<2>;
+template class AdaptiveRefinement<3>;
+
+} // namespace bart::framework
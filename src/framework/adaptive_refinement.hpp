@@ -0,0 +1,71 @@
+#ifndef BART_SRC_FRAMEWORK_ADAPTIVE_REFINEMENT_HPP_
+#define BART_SRC_FRAMEWORK_ADAPTIVE_REFINEMENT_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "framework/builder/framework_builder.hpp"
+#include "framework/framework_i.hpp"
+#include "problem/parameters_i.h"
+
+namespace bart::framework {
+
+/*! \brief Builds a framework on an adaptively refined mesh.
+ *
+ * The problem is first solved on the mesh given by the problem parameters. In
+ * each adaptive refinement cycle the error in each cell is estimated from the
+ * group scalar fluxes (see domain::Definition::EstimateError), the fractions of
+ * cells with the largest and smallest errors are refined and coarsened, and the
+ * flux moments are interpolated onto the adapted mesh. The problem is solved
+ * again on the adapted mesh, starting from the interpolated moments and the
+ * previous k_effective (see WarmStart).
+ *
+ * The framework returned by BuildFramework is built on the mesh of the final
+ * cycle and is initialized with the interpolated solution, but has not been
+ * solved.
+ *
+ * \code{.cpp}
+ * framework::AdaptiveRefinement<2> adaptive_refinement(parameters);
+ * auto framework_ptr = adaptive_refinement.BuildFramework("main");
+ * framework_ptr->SolveSystem();
+ * \endcode
+ *
+ * @tparam dim spatial dimension.
+ */
+template <int dim>
+class AdaptiveRefinement {
+ public:
+  using ParametersType = const problem::ParametersI&;
+
+  explicit AdaptiveRefinement(ParametersType parameters);
+
+  /*! \brief Solves the problem on all meshes before the final cycle, and
+   * returns the framework for the final mesh.
+   *
+   * @param name name of the framework.
+   */
+  std::unique_ptr<FrameworkI> BuildFramework(std::string name);
+
+  /*! \brief Total degrees of freedom of the mesh solved in each cycle before
+   * the final cycle. */
+  std::vector<int> cycle_degrees_of_freedom() const {
+    return cycle_degrees_of_freedom_; }
+
+  /*! \brief k_effective solved for in each cycle before the final cycle, for
+   * eigenvalue problems. */
+  std::vector<double> cycle_k_effective() const { return cycle_k_effective_; }
+
+  int n_cycles() const { return n_cycles_; }
+
+ private:
+  ParametersType parameters_;
+  builder::FrameworkBuilder<dim> builder_;
+  const int n_cycles_;
+  std::vector<int> cycle_degrees_of_freedom_{};
+  std::vector<double> cycle_k_effective_{};
+};
+
+} // namespace bart::framework
+
+#endif //BART_SRC_FRAMEWORK_ADAPTIVE_REFINEMENT_HPP_
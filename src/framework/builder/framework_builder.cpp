@@ -4,6 +4,8 @@
 #include <deal.II/base/mpi.h>
 #include <sstream>
 #include <fstream>
+#include <limits>
+#include <map>
 
 // Builders & factories
 #include "solver/builder/solver_builder.hpp"
@@ -20,11 +22,20 @@
 #include "domain/mesh/mesh_cartesian.h"
 
 // Formulation classes
+#include "formulation/angular/even_parity.h"
+#include "formulation/angular/saaf_source_operators.h"
 #include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/angular/self_adjoint_angular_flux_kernel.h"
+#include "formulation/angular/upwind_transport.h"
 #include "formulation/scalar/diffusion.h"
+#include "formulation/scalar/diffusion_kernel.h"
+#include "formulation/scalar/simplified_pn.h"
 #include "formulation/stamper.h"
 #include "formulation/updater/saaf_updater.h"
 #include "formulation/updater/diffusion_updater.h"
+#include "formulation/updater/even_parity_updater.h"
+#include "formulation/updater/simplified_pn_updater.h"
+#include "formulation/updater/upwind_transport_updater.h"
 
 // Framework class
 #include "framework/framework.hpp"
@@ -39,13 +50,19 @@
 
 // Iteration classes
 #include "iteration/initializer/initialize_fixed_terms_once.h"
+#include "iteration/group/all_group_solve_iteration.h"
 #include "iteration/group/group_solve_iteration.h"
 #include "iteration/group/group_source_iteration.h"
 #include "iteration/outer/outer_power_iteration.hpp"
 #include "iteration/outer/outer_fixed_source_iteration.hpp"
 
+// Solver classes
+#include "solver/group/sweep_group_solver.h"
+#include "solver/preconditioner/geometric_multigrid.h"
+
 // Quadrature classes & factories
 #include "quadrature/quadrature_generator_i.h"
+#include "quadrature/calculators/simplified_pn_moments.h"
 #include "quadrature/factory/quadrature_factories.h"
 #include "quadrature/utility/quadrature_utilities.h"
 
@@ -56,7 +73,6 @@
 #include "system/system.h"
 #include "system/solution/mpi_group_angular_solution.h"
 #include "system/system_functions.h"
-#include "system/solution/solution_types.h"
 
 // Instrumentation
 #include "instrumentation/builder/instrument_builder.hpp"
@@ -69,6 +85,21 @@ using InstrumentBuilder = instrumentation::builder::InstrumentBuilder;
 using InstrumentName = instrumentation::builder::InstrumentName;
 using StringColorPair = std::pair<std::string, utility::Color>;
 
+/* Returns one locally owned cell for each refinement level present in the
+ * domain. Cells on a level share the same geometry on Cartesian meshes, so
+ * precalculated terms only need to be calculated once per level. */
+template <int dim>
+auto CellPerRefinementLevel(const domain::DefinitionI<dim>& domain)
+-> std::vector<domain::CellPtr<dim>> {
+  std::map<int, domain::CellPtr<dim>> level_cells;
+  for (const auto& cell : domain.Cells())
+    level_cells.emplace(cell->level(), cell);
+  std::vector<domain::CellPtr<dim>> cells;
+  for (const auto& [level, cell] : level_cells)
+    cells.push_back(cell);
+  return cells;
+}
+
 } // namespace
 
 template <int dim>
@@ -97,10 +128,28 @@ template<int dim>
 auto FrameworkBuilder<dim>::BuildFramework(std::string name,
                                            ParametersType& prm)
 -> std::unique_ptr<FrameworkType> {
+  SetUpInstruments();
+
+  auto finite_element_ptr = Shared(BuildFiniteElement(prm));
+  auto domain_ptr = Shared(BuildDomain(prm, finite_element_ptr));
+  Report("Setting up domain...\n", utility::Color::kReset);
+  domain_ptr->SetUpMesh(prm.UniformRefinements()).SetUpDOF();
+
+  return BuildFramework(name, prm, finite_element_ptr, domain_ptr);
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildFramework(
+    std::string name,
+    ParametersType& prm,
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<DomainType>& domain_ptr)
+-> std::unique_ptr<FrameworkType> {
 
   validator_.Parse(prm);
   // Framework parameters
   int n_angles = 1; // Set to default value of 1 for scalar solve
+  int max_harmonic_l = 0;
   const int n_groups = prm.NEnergyGroups();
   const bool need_angular_solution_storage =
       validator_.NeededParts().count(FrameworkPart::AngularSolutionStorage);
@@ -109,83 +158,168 @@ auto FrameworkBuilder<dim>::BuildFramework(std::string name,
       reflective_boundaries.begin(),
       reflective_boundaries.end(),
       [](std::pair<problem::Boundary, bool> pair){ return pair.second; });
+  const bool has_implicit_reflective =
+      has_reflective &&
+      prm.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux &&
+      prm.ReflectiveBoundaryTreatment() == problem::ReflectiveBoundaryType::kImplicit;
+  const auto storage_precision = prm.UseMixedPrecisionStorage() ?
+      system::StoragePrecision::kSingle : system::StoragePrecision::kDouble;
+  // Group fluxes cannot converge below the rounding error of single precision
+  // stored solutions
+  const double precision_floor =
+      storage_precision == system::StoragePrecision::kSingle ?
+      10 * std::numeric_limits<float>::epsilon() : 0;
+  const bool is_simplified_pn =
+      prm.TransportModel() == problem::EquationType::kSimplifiedP3 ||
+      prm.TransportModel() == problem::EquationType::kSimplifiedP5;
+  const bool use_mixed_precision_gmres =
+      prm.LinearSolver() == problem::LinearSolverType::kMixedPrecisionGMRES;
+  // The second-order formulations have a symmetric left hand side, unless
+  // angles are coupled by implicit reflective boundaries. The first-order
+  // discrete ordinates sweep is not symmetric. The mixed precision solver
+  // copies full rows of the left hand side, and geometric multigrid forms
+  // Galerkin coarse operators from it, so both require full storage.
+  const bool is_second_order =
+      prm.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux ||
+      prm.TransportModel() == problem::EquationType::kDiffusion ||
+      prm.TransportModel() == problem::EquationType::kEvenParity ||
+      is_simplified_pn;
+  const bool use_geometric_multigrid =
+      prm.Preconditioner() == problem::PreconditionerType::kGeometricMultigrid;
+  const bool has_symmetric_system =
+      is_second_order && !has_implicit_reflective &&
+      !use_mixed_precision_gmres && !use_geometric_multigrid;
   filename_ = prm.OutputFilenameBase();
 
-  using InstrumentBuilder = instrumentation::builder::InstrumentBuilder;
-  using InstrumentName = instrumentation::builder::InstrumentName;
-
-  // Set up shared instrument
-  color_status_instrument_ptr_ = Shared(
-      InstrumentBuilder::BuildInstrument<ColorStatusPair>(
-          InstrumentName::kColorStatusToConditionalOstream));
-  convergence_status_instrument_ptr_ = Shared(
-      InstrumentBuilder::BuildInstrument<convergence::Status>(
-          InstrumentName::kConvergenceStatusToConditionalOstream));
-  status_instrument_ptr_ = Shared(
-      InstrumentBuilder::BuildInstrument<std::string>(
-          InstrumentName::kStringToConditionalOstream));
-
-  data_port::StatusDataPort::AddInstrument(color_status_instrument_ptr_);
-  instrumentation::GetPort<data_port::ValidatorStatusPort>(validator_)
-      .AddInstrument(color_status_instrument_ptr_);
+  SetUpInstruments();
 
   Report("Building framework: " + name + "\n", utility::Color::kGreen);
 
-
-  auto finite_element_ptr = Shared(BuildFiniteElement(prm));
   auto cross_sections_ptr = Shared(BuildCrossSections(prm));
 
-  auto domain_ptr = Shared(BuildDomain(prm, finite_element_ptr,
-                                       ReadMappingFile(prm.MaterialMapFilename())));
-  Report("Setting up domain...\n", utility::Color::kReset);
-  domain_ptr->SetUpMesh(prm.UniformRefinements()).SetUpDOF();
-
   // Various objects to be initialized
   std::shared_ptr<QuadratureSetType> quadrature_set_ptr = nullptr;
   UpdaterPointers updater_pointers;
   std::unique_ptr<MomentCalculatorType> moment_calculator_ptr = nullptr;
-  system::solution::EnergyGroupToAngularSolutionPtrMap angular_solutions_;
+  std::shared_ptr<UpwindTransportFormulationType> sweep_formulation_ptr = nullptr;
+  CartesianStencilFunction stencil_function = nullptr;
+  std::shared_ptr<system::solution::BoundaryAngularSolution>
+      boundary_angular_solution_ptr = nullptr;
+  std::unordered_set<problem::Boundary> reflective_boundary_set;
+  for (const auto& [boundary, is_reflective] : reflective_boundaries) {
+    if (is_reflective)
+      reflective_boundary_set.insert(boundary);
+  }
 
-  if (prm.TransportModel() != problem::EquationType::kDiffusion) {
+  if (prm.TransportModel() != problem::EquationType::kDiffusion &&
+      !is_simplified_pn) {
     quadrature_set_ptr = BuildQuadratureSet(prm);
     n_angles = quadrature_set_ptr->size();
   };
 
   if (need_angular_solution_storage) {
-    system::SetUpEnergyGroupToAngularSolutionPtrMap(angular_solutions_,
-                                                    n_groups, n_angles);
+    boundary_angular_solution_ptr = system::MakeBoundaryAngularSolution(
+        *domain_ptr, reflective_boundary_set, n_groups, n_angles,
+        storage_precision);
+    if (storage_precision == system::StoragePrecision::kSingle) {
+      // Storage and memory traffic are both half of double precision
+      const auto storage_bytes = boundary_angular_solution_ptr->storage_bytes();
+      std::ostringstream storage_report;
+      storage_report << "Boundary angular flux storage (single precision): "
+                     << storage_bytes << " bytes, " << storage_bytes
+                     << " bytes saved\n";
+      Report(storage_report.str(), utility::Color::kReset);
+    }
   }
 
+  // Scratch storage shared by the stamper, formulation and group iteration
+  auto workspace_ptr = BuildWorkspace(*finite_element_ptr, *domain_ptr);
 
-  if (prm.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux) {
-    auto stamper_ptr = BuildStamper(domain_ptr);
 
-    auto saaf_formulation_ptr = BuildSAAFFormulation(finite_element_ptr,
-                                                     cross_sections_ptr,
-                                                     quadrature_set_ptr);
-    saaf_formulation_ptr->Initialize(domain_ptr->Cells().at(0));
+  if (prm.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux) {
+    AssertThrow(prm.Discretization() !=
+                    problem::DiscretizationType::kDiscontinuousFEM,
+                dealii::ExcMessage("Error in BuildFramework, SAAF requires a "
+                                   "continuous discretization"))
+    auto stamper_ptr = BuildStamper(domain_ptr, workspace_ptr);
+
+    // Cell terms use kernels specialized on the finite element degree
+    auto saaf_formulation_ptr = BuildSAAFFormulation(
+        finite_element_ptr, cross_sections_ptr, quadrature_set_ptr,
+        formulation::SAAFFormulationImpl::kAssemblyKernel);
+    for (const auto& cell : CellPerRefinementLevel(*domain_ptr))
+      saaf_formulation_ptr->Initialize(cell);
+    if (prm.UseStructuredGridSolver()) {
+      // The updater and the stencil group solver each hold their own formulation
+      auto stencil_formulation_ptr = BuildSAAFFormulation(
+          finite_element_ptr, cross_sections_ptr, quadrature_set_ptr,
+          formulation::SAAFFormulationImpl::kAssemblyKernel);
+      for (const auto& cell : CellPerRefinementLevel(*domain_ptr))
+        stencil_formulation_ptr->Initialize(cell);
+      stencil_function = BuildStencilFunction(
+          Shared(std::move(stencil_formulation_ptr)), quadrature_set_ptr);
+    }
+    if (auto saaf_ptr = dynamic_cast<formulation::angular::SelfAdjointAngularFlux<dim>*>(
+        saaf_formulation_ptr.get()); saaf_ptr != nullptr) {
+      saaf_ptr->SetWorkspace(workspace_ptr);
+    }
 
     if (!has_reflective) {
       updater_pointers = BuildUpdaterPointers(
           std::move(saaf_formulation_ptr),
           std::move(stamper_ptr),
           quadrature_set_ptr);
+    } else if (has_implicit_reflective) {
+      updater_pointers = BuildUpdaterPointers(
+          std::move(saaf_formulation_ptr),
+          std::move(stamper_ptr),
+          quadrature_set_ptr,
+          prm.ReflectiveBoundary());
     } else {
       updater_pointers = BuildUpdaterPointers(
           std::move(saaf_formulation_ptr),
           std::move(stamper_ptr),
           quadrature_set_ptr,
           prm.ReflectiveBoundary(),
-          angular_solutions_);
+          boundary_angular_solution_ptr);
     }
+    // Scattering and fission sources are updated using precomputed operators
+    std::shared_ptr<SAAFSourceOperatorsType> source_operators_ptr =
+        BuildSAAFSourceOperators(domain_ptr, finite_element_ptr,
+                                 cross_sections_ptr, quadrature_set_ptr);
+    source_operators_ptr->Initialize();
+    std::dynamic_pointer_cast<formulation::updater::SAAFUpdater<dim>>(
+        updater_pointers.fixed_updater_ptr)->SetSourceOperators(
+            source_operators_ptr);
     moment_calculator_ptr = std::move(BuildMomentCalculator(quadrature_set_ptr));
 
   } else if (prm.TransportModel() == problem::EquationType::kDiffusion) {
+    AssertThrow(prm.Discretization() !=
+                    problem::DiscretizationType::kDiscontinuousFEM,
+                dealii::ExcMessage("Error in BuildFramework, diffusion requires "
+                                   "a continuous discretization"))
     auto diffusion_formulation_ptr = BuildDiffusionFormulation(
         finite_element_ptr,
-        cross_sections_ptr);
-    diffusion_formulation_ptr->Precalculate(domain_ptr->Cells().at(0));
-    auto stamper_ptr = BuildStamper(domain_ptr);
+        cross_sections_ptr,
+        formulation::DiffusionFormulationImpl::kAssemblyKernel);
+    for (const auto& cell : CellPerRefinementLevel(*domain_ptr))
+      diffusion_formulation_ptr->Precalculate(cell);
+    if (prm.UseStructuredGridSolver()) {
+      // The updater and the stencil group solver each hold their own formulation
+      auto stencil_formulation_ptr = BuildDiffusionFormulation(
+          finite_element_ptr,
+          cross_sections_ptr,
+          formulation::DiffusionFormulationImpl::kAssemblyKernel);
+      for (const auto& cell : CellPerRefinementLevel(*domain_ptr))
+        stencil_formulation_ptr->Precalculate(cell);
+      stencil_function = BuildStencilFunction(
+          Shared(std::move(stencil_formulation_ptr)), prm.ReflectiveBoundary());
+    }
+    if (auto diffusion_ptr = dynamic_cast<formulation::scalar::Diffusion<dim>*>(
+        diffusion_formulation_ptr.get()); diffusion_ptr != nullptr) {
+      diffusion_ptr->SetWorkspace(workspace_ptr);
+    }
+    auto stamper_ptr = BuildStamper(domain_ptr, workspace_ptr);
 
     updater_pointers = BuildUpdaterPointers(
         std::move(diffusion_formulation_ptr),
@@ -193,6 +327,67 @@ auto FrameworkBuilder<dim>::BuildFramework(std::string name,
         prm.ReflectiveBoundary());
 
     moment_calculator_ptr = std::move(BuildMomentCalculator());
+  } else if (prm.TransportModel() == problem::EquationType::kDiscreteOrdinates) {
+    AssertThrow(prm.Discretization() ==
+                    problem::DiscretizationType::kDiscontinuousFEM,
+                dealii::ExcMessage("Error in BuildFramework, discrete ordinates "
+                                   "requires a discontinuous discretization"))
+    AssertThrow(!has_reflective,
+                dealii::ExcMessage("Error in BuildFramework, discrete ordinates "
+                                   "sweeps do not support reflective "
+                                   "boundaries"))
+    auto stamper_ptr = BuildStamper(domain_ptr, workspace_ptr);
+
+    // The updater and the sweep solver each hold their own formulation
+    updater_pointers = BuildUpdaterPointers(
+        BuildUpwindTransportFormulation(finite_element_ptr, cross_sections_ptr,
+                                        quadrature_set_ptr),
+        std::move(stamper_ptr));
+    sweep_formulation_ptr = Shared(BuildUpwindTransportFormulation(
+        finite_element_ptr, cross_sections_ptr, quadrature_set_ptr));
+
+    moment_calculator_ptr = std::move(BuildMomentCalculator(quadrature_set_ptr));
+  } else if (prm.TransportModel() == problem::EquationType::kEvenParity) {
+    AssertThrow(prm.Discretization() !=
+                    problem::DiscretizationType::kDiscontinuousFEM,
+                dealii::ExcMessage("Error in BuildFramework, even-parity "
+                                   "requires a continuous discretization"))
+    AssertThrow(!has_reflective,
+                dealii::ExcMessage("Error in BuildFramework, even-parity does "
+                                   "not support reflective boundaries"))
+    auto stamper_ptr = BuildStamper(domain_ptr, workspace_ptr);
+
+    updater_pointers = BuildUpdaterPointers(
+        BuildEvenParityFormulation(finite_element_ptr, cross_sections_ptr,
+                                   quadrature_set_ptr),
+        std::move(stamper_ptr),
+        quadrature_set_ptr);
+
+    moment_calculator_ptr = std::move(BuildMomentCalculator(quadrature_set_ptr));
+  } else if (is_simplified_pn) {
+    AssertThrow(prm.Discretization() !=
+                    problem::DiscretizationType::kDiscontinuousFEM,
+                dealii::ExcMessage("Error in BuildFramework, simplified PN "
+                                   "requires a continuous discretization"))
+    const int order =
+        prm.TransportModel() == problem::EquationType::kSimplifiedP3 ? 3 : 5;
+    auto simplified_pn_formulation_ptr = BuildSimplifiedPNFormulation(
+        finite_element_ptr, cross_sections_ptr, order);
+    for (const auto& cell : CellPerRefinementLevel(*domain_ptr))
+      simplified_pn_formulation_ptr->Precalculate(cell);
+    // Each equation is solved as an angle, and has an even Legendre moment
+    n_angles = simplified_pn_formulation_ptr->n_equations();
+    max_harmonic_l = order - 1;
+    auto stamper_ptr = BuildStamper(domain_ptr, workspace_ptr);
+
+    updater_pointers = BuildUpdaterPointers(
+        std::move(simplified_pn_formulation_ptr),
+        std::move(stamper_ptr),
+        prm.ReflectiveBoundary());
+
+    moment_calculator_ptr = std::move(BuildMomentCalculator(
+        formulation::scalar::SimplifiedPNCoefficients(order)
+            .unknowns_to_moments()));
   }
 
   auto initializer_ptr = BuildInitializer(
@@ -200,40 +395,220 @@ auto FrameworkBuilder<dim>::BuildFramework(std::string name,
   auto group_solution_ptr = Shared(BuildGroupSolution(n_angles));
   system::SetUpMPIAngularSolution(*group_solution_ptr, *domain_ptr);
 
-  auto iterative_group_solver_ptr = BuildGroupSolveIteration(
-      BuildSingleGroupSolver(),
-      BuildMomentConvergenceChecker(1e-6, 10000),
-      std::move(moment_calculator_ptr),
-      group_solution_ptr,
-      updater_pointers,
-      BuildMomentMapConvergenceChecker(1e-6, 1000));
+  // All groups are solved simultaneously only for scalar (diffusion) problems
+  const bool has_block_multigroup_solve =
+      prm.MultiGroupSolver() == problem::MultiGroupSolverType::kBlock &&
+      prm.TransportModel() == problem::EquationType::kDiffusion &&
+      n_groups > 1;
+  if (prm.MultiGroupSolver() == problem::MultiGroupSolverType::kBlock &&
+      prm.TransportModel() != problem::EquationType::kDiffusion) {
+    Report("Warning: block multi-group solver is only available for "
+           "diffusion, using Gauss-Seidel iteration\n",
+           utility::Color::kYellow);
+  }
+  // The block multi-group solve swaps the system previous moments, so lagged
+  // moments are only stored in single precision by the group solve iteration
+  const auto lagged_moment_precision = has_block_multigroup_solve ?
+      system::StoragePrecision::kDouble : storage_precision;
+
+  if (prm.UseStructuredGridSolver()) {
+    AssertThrow(stencil_function != nullptr,
+                dealii::ExcMessage("Error in BuildFramework, structured grid "
+                                   "solver is only available for diffusion and "
+                                   "SAAF"))
+    AssertThrow(!has_implicit_reflective && !has_block_multigroup_solve,
+                dealii::ExcMessage("Error in BuildFramework, structured grid "
+                                   "solver is not available with implicit "
+                                   "reflective boundaries or the block "
+                                   "multi-group solver"))
+    AssertThrow(prm.Preconditioner() !=
+                    problem::PreconditionerType::kGeometricMultigrid,
+                dealii::ExcMessage("Error in BuildFramework, structured grid "
+                                   "solver cannot use geometric multigrid "
+                                   "preconditioning"))
+  }
 
-  if (need_angular_solution_storage) {
-    dynamic_cast<iteration::group::GroupSolveIteration<dim>*>(
-        iterative_group_solver_ptr.get())->UpdateThisAngularSolutionMap(
-            angular_solutions_);
-    validator_.AddPart(FrameworkPart::AngularSolutionStorage);
-  };
+  if (use_mixed_precision_gmres) {
+    AssertThrow(sweep_formulation_ptr == nullptr && stencil_function == nullptr &&
+                !has_block_multigroup_solve,
+                dealii::ExcMessage("Error in BuildFramework, mixed precision "
+                                   "GMRES is not available with the sweep, "
+                                   "structured grid or block multi-group "
+                                   "solvers"))
+    AssertThrow(!has_implicit_reflective,
+                dealii::ExcMessage("Error in BuildFramework, mixed precision "
+                                   "GMRES is not available with implicit "
+                                   "reflective boundaries"))
+    AssertThrow(prm.Preconditioner() !=
+                    problem::PreconditionerType::kGeometricMultigrid,
+                dealii::ExcMessage("Error in BuildFramework, mixed precision "
+                                   "GMRES cannot use geometric multigrid "
+                                   "preconditioning"))
+  }
+
+  using SolverName = solver::builder::SolverName;
+  std::unique_ptr<GroupSolveIterationType> iterative_group_solver_ptr = nullptr;
+
+  if (has_block_multigroup_solve) {
+    iterative_group_solver_ptr = BuildAllGroupSolveIteration(
+        group_solution_ptr, linear_solver_max_iterations_,
+        linear_solver_tolerance_);
+    auto all_group_solve_iteration_ptr =
+        dynamic_cast<iteration::group::AllGroupSolveIteration<dim>*>(
+            iterative_group_solver_ptr.get());
+    AssertThrow(all_group_solve_iteration_ptr != nullptr,
+                dealii::ExcMessage("Error in BuildFramework, group iteration "
+                                   "is not an AllGroupSolveIteration"))
+    all_group_solve_iteration_ptr->SetDomain(domain_ptr);
+  } else {
+    std::unique_ptr<SingleGroupSolverType> single_group_solver_ptr = nullptr;
+    if (sweep_formulation_ptr != nullptr) {
+      single_group_solver_ptr = BuildSweepGroupSolver(
+          sweep_formulation_ptr, domain_ptr, quadrature_set_ptr);
+    } else if (stencil_function != nullptr) {
+      single_group_solver_ptr = BuildCartesianStencilGroupSolver(
+          domain_ptr, stencil_function);
+    } else {
+      auto solver_name = SolverName::kDefaultCGGroupSolver;
+      if (has_implicit_reflective) {
+        solver_name = SolverName::kReflectiveBlockGMRESGroupSolver;
+      } else if (use_mixed_precision_gmres) {
+        solver_name = SolverName::kMixedPrecisionGMRESGroupSolver;
+      }
+      single_group_solver_ptr = BuildSingleGroupSolver(
+          linear_solver_max_iterations_, linear_solver_tolerance_, solver_name);
+      if (use_geometric_multigrid) {
+        AssertThrow(prm.TransportModel() == problem::EquationType::kDiffusion,
+                    dealii::ExcMessage("Error in BuildFramework, geometric "
+                                       "multigrid preconditioning is only "
+                                       "available for diffusion"))
+        auto default_solver_ptr = dynamic_cast<solver::group::SingleGroupSolver*>(
+            single_group_solver_ptr.get());
+        AssertThrow(default_solver_ptr != nullptr,
+                    dealii::ExcMessage("Error in BuildFramework, geometric "
+                                       "multigrid preconditioning is not "
+                                       "available for the reflective block "
+                                       "group solver"))
+        default_solver_ptr->SetPreconditioner(
+            BuildGeometricMultigridPreconditioner(domain_ptr,
+                                                  prm.MultigridSmoother()));
+      } else if (has_symmetric_system) {
+        auto default_solver_ptr = dynamic_cast<solver::group::SingleGroupSolver*>(
+            single_group_solver_ptr.get());
+        AssertThrow(default_solver_ptr != nullptr,
+                    dealii::ExcMessage("Error in BuildFramework, CG group "
+                                       "solver is not a SingleGroupSolver"))
+        default_solver_ptr->SetPreconditioner(
+            BuildSymmetricStoragePreconditioner());
+      }
+    }
+    iterative_group_solver_ptr = BuildGroupSolveIteration(
+        std::move(single_group_solver_ptr),
+        BuildMomentConvergenceChecker(convergence_tolerance_, 10000,
+                                      precision_floor),
+        std::move(moment_calculator_ptr),
+        group_solution_ptr,
+        updater_pointers,
+        BuildMomentMapConvergenceChecker(convergence_tolerance_, 1000));
+    auto group_solve_iteration_ptr =
+        dynamic_cast<iteration::group::GroupSolveIteration<dim>*>(
+            iterative_group_solver_ptr.get());
+    AssertThrow(group_solve_iteration_ptr != nullptr,
+                dealii::ExcMessage("Error in BuildFramework, group iteration "
+                                   "is not a GroupSolveIteration"))
+    group_solve_iteration_ptr->SetWorkspace(workspace_ptr)
+        .SetDomain(domain_ptr);
+
+    if (lagged_moment_precision == system::StoragePrecision::kSingle) {
+      group_solve_iteration_ptr->StoreLaggedMomentsInSinglePrecision(
+          BuildSinglePrecisionMomentMapConvergenceChecker(
+              convergence_tolerance_, 1000, precision_floor));
+    }
+
+    if (need_angular_solution_storage) {
+      group_solve_iteration_ptr->UpdateThisBoundaryAngularSolution(
+          boundary_angular_solution_ptr);
+      validator_.AddPart(FrameworkPart::AngularSolutionStorage);
+    };
+
+    if (prm.DoSkipConvergedGroups() && n_groups > 1) {
+      group_solve_iteration_ptr->SkipConvergedGroups(
+          prm.SkipConvergedGroupsTolerance());
+    }
+  }
 
   std::unique_ptr<OuterIterationType> outer_iteration_ptr;
 
   if (prm.IsEigenvalueProblem()) {
     outer_iteration_ptr = BuildOuterIteration(
         std::move(iterative_group_solver_ptr),
-        BuildParameterConvergenceChecker(1e-6, 10000),
+        BuildParameterConvergenceChecker(convergence_tolerance_, 10000),
         BuildKEffectiveUpdater(finite_element_ptr, cross_sections_ptr, domain_ptr),
         updater_pointers.fission_source_updater_ptr);
   } else {
     outer_iteration_ptr = BuildOuterIteration(
         std::move(iterative_group_solver_ptr),
-        BuildParameterConvergenceChecker(1e-6, 10000));
+        BuildParameterConvergenceChecker(convergence_tolerance_, 10000));
   };
 
 
   auto system_ptr = BuildSystem(n_groups, n_angles, *domain_ptr,
                                 group_solution_ptr->solutions().at(0).size(),
                                 prm.IsEigenvalueProblem(),
-                                need_angular_solution_storage);
+                                need_angular_solution_storage,
+                                has_symmetric_system,
+                                max_harmonic_l,
+                                lagged_moment_precision);
+
+  if (lagged_moment_precision == system::StoragePrecision::kSingle) {
+    // Lagged moments are written once per group sweep, in double precision
+    // they are swapped with the current moments and not copied
+    const std::size_t lagged_moment_values =
+        system_ptr->current_moments->moments().size() *
+        group_solution_ptr->solutions().at(0).size();
+    std::ostringstream storage_report;
+    storage_report << "Lagged moment storage (single precision): "
+                   << lagged_moment_values * sizeof(float) << " bytes, "
+                   << lagged_moment_values * (sizeof(double) - sizeof(float))
+                   << " bytes saved, "
+                   << lagged_moment_values * sizeof(float)
+                   << " bytes written per group sweep\n";
+    Report(storage_report.str(), utility::Color::kReset);
+  }
+
+  if (prm.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux) {
+    // An angle and its reflection share their streaming and collision terms
+    std::set<system::AngleCouplingIndex> reflected_angles;
+    for (const int angle : quadrature_set_ptr->quadrature_point_indices()) {
+      const auto reflection_index = quadrature_set_ptr->GetReflectionIndex(
+          quadrature_set_ptr->GetQuadraturePoint(
+              quadrature::QuadraturePointIndex(angle)));
+      if (reflection_index.has_value() && angle < reflection_index.value())
+        reflected_angles.insert({angle, reflection_index.value()});
+    }
+    system::SetUpSharedReflectedTerms(*system_ptr, *domain_ptr,
+                                      reflected_angles, has_symmetric_system);
+  }
+
+  if (has_block_multigroup_solve) {
+    std::set<system::GroupCouplingIndex> coupled_groups;
+    for (const auto& [material_id, sigma_s] : cross_sections_ptr->sigma_s) {
+      for (int group = 0; group < n_groups; ++group) {
+        for (int source_group = 0; source_group < n_groups; ++source_group) {
+          if (group != source_group && sigma_s(group, source_group) != 0)
+            coupled_groups.insert({group, source_group});
+        }
+      }
+    }
+    system::SetUpGroupCouplingTerms(*system_ptr, *domain_ptr, coupled_groups);
+  }
+
+  if (has_implicit_reflective) {
+    system::SetUpReflectiveCouplingTerms(
+        *system_ptr, *domain_ptr,
+        quadrature::utility::ReflectedAnglePairs(*quadrature_set_ptr,
+                                                 reflective_boundary_set));
+  }
 
   auto results_output_ptr =
       std::make_unique<results::OutputDealiiVtu<dim>>(domain_ptr);
@@ -284,18 +659,38 @@ auto FrameworkBuilder<dim>::BuildDiffusionFormulation(
     using ReturnType = formulation::scalar::Diffusion<dim>;
     return_ptr = std::move(std::make_unique<ReturnType>(
         finite_element_ptr, cross_sections_ptr));
+  } else if (implementation ==
+      formulation::DiffusionFormulationImpl::kAssemblyKernel) {
+    return_ptr = formulation::scalar::MakeDiffusionKernelPtr<dim>(
+        finite_element_ptr, cross_sections_ptr);
   }
   ReportBuildSuccess(return_ptr->description());
 
   return return_ptr;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildDomain(
+    ParametersType problem_parameters,
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr)
+-> std::unique_ptr<DomainType>{
+  return BuildDomain(problem_parameters, finite_element_ptr,
+                     ReadMappingFile(problem_parameters.MaterialMapFilename()));
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildDomain(
     ParametersType problem_parameters,
     const std::shared_ptr<FiniteElementType>& finite_element_ptr,
     std::string material_mapping)
 -> std::unique_ptr<DomainType>{
+  AssertThrow(problem_parameters.Discretization() !=
+                  problem::DiscretizationType::kDiscontinuousFEM ||
+              problem_parameters.TransportModel() ==
+                  problem::EquationType::kDiscreteOrdinates,
+              dealii::ExcMessage("Error in BuildDomain, only discrete "
+                                 "ordinates supports a discontinuous "
+                                 "discretization"))
   std::unique_ptr<DomainType> return_ptr = nullptr;
 
   ReportBuildingComponant("Mesh");
@@ -306,13 +701,43 @@ auto FrameworkBuilder<dim>::BuildDomain(
   ReportBuildSuccess(mesh_ptr->description());
 
   ReportBuildingComponant("Domain");
-  return_ptr = std::move(std::make_unique<domain::Definition<dim>>(
+  auto definition_ptr = std::make_unique<domain::Definition<dim>>(
       std::move(mesh_ptr),
-      finite_element_ptr));
+      finite_element_ptr,
+      problem_parameters.Discretization() ==
+          problem::DiscretizationType::kDiscontinuousFEM ?
+      problem::DiscretizationType::kDiscontinuousFEM :
+      problem::DiscretizationType::kContinuousFEM);
+
+  // Downstream renumbering orders degrees of freedom along the domain diagonal
+  dealii::Tensor<1, dim> downstream_direction;
+  for (int i = 0; i < dim; ++i)
+    downstream_direction[i] = 1.0;
+  definition_ptr->SetDoFRenumbering(problem_parameters.DoFRenumbering(),
+                                    downstream_direction);
+  return_ptr = std::move(definition_ptr);
   ReportBuildSuccess(return_ptr->description());
   return return_ptr;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildEvenParityFormulation(
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<data::CrossSections>& cross_sections_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> std::unique_ptr<EvenParityFormulationType> {
+  ReportBuildingComponant("Building Even-Parity Formulation");
+  std::unique_ptr<EvenParityFormulationType> return_ptr = nullptr;
+
+  using ReturnType = formulation::angular::EvenParity<dim>;
+  return_ptr = std::move(std::make_unique<ReturnType>(finite_element_ptr,
+                                                      cross_sections_ptr,
+                                                      quadrature_set_ptr));
+  ReportBuildSuccess("Even-parity formulation");
+
+  return return_ptr;
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildFiniteElement(ParametersType problem_parameters)
 -> std::unique_ptr<FiniteElementType>{
@@ -324,6 +749,9 @@ auto FrameworkBuilder<dim>::BuildFiniteElement(ParametersType problem_parameters
 
   try {
     return_ptr = std::move(std::make_unique<FiniteElementGaussianType>(
+        problem_parameters.Discretization() ==
+            problem::DiscretizationType::kDiscontinuousFEM ?
+        problem::DiscretizationType::kDiscontinuousFEM :
         problem::DiscretizationType::kContinuousFEM,
         problem_parameters.FEPolynomialDegree()));
 
@@ -393,14 +821,12 @@ auto FrameworkBuilder<dim>::BuildUpdaterPointers(
     std::unique_ptr<StamperType> stamper_ptr,
     const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr,
     const std::map<problem::Boundary, bool>& reflective_boundaries,
-    const AngularFluxStorage& angular_flux_storage)
+    const std::shared_ptr<BoundaryAngularFluxStorage>& boundary_angular_flux_storage_ptr)
 -> UpdaterPointers {
   ReportBuildingComponant("Building SAAF Formulation updater "
                           "(with boundary conditions update)");
   UpdaterPointers return_struct;
 
-  // Transform map into set
-
   std::unordered_set<problem::Boundary> reflective_boundary_set;
 
   for (const auto boundary_pair : reflective_boundaries) {
@@ -413,7 +839,7 @@ auto FrameworkBuilder<dim>::BuildUpdaterPointers(
       std::move(formulation_ptr),
       std::move(stamper_ptr),
       quadrature_set_ptr,
-      angular_flux_storage,
+      boundary_angular_flux_storage_ptr,
       reflective_boundary_set);
   ReportBuildSuccess(saaf_updater_ptr->description());
 
@@ -425,6 +851,110 @@ auto FrameworkBuilder<dim>::BuildUpdaterPointers(
   return return_struct;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpdaterPointers(
+    std::unique_ptr<SAAFFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr,
+    const std::map<problem::Boundary, bool>& reflective_boundaries)
+-> UpdaterPointers {
+  ReportBuildingComponant("Building SAAF Formulation updater "
+                          "(with implicit reflective boundaries)");
+  UpdaterPointers return_struct;
+
+  std::unordered_set<problem::Boundary> reflective_boundary_set;
+
+  for (const auto boundary_pair : reflective_boundaries) {
+    if (boundary_pair.second)
+      reflective_boundary_set.insert(boundary_pair.first);
+  }
+
+  using ReturnType = formulation::updater::SAAFUpdater<dim>;
+  auto saaf_updater_ptr = std::make_shared<ReturnType>(
+      std::move(formulation_ptr),
+      std::move(stamper_ptr),
+      quadrature_set_ptr,
+      reflective_boundary_set);
+  ReportBuildSuccess(saaf_updater_ptr->description());
+
+  return_struct.fixed_updater_ptr = saaf_updater_ptr;
+  return_struct.scattering_source_updater_ptr = saaf_updater_ptr;
+  return_struct.fission_source_updater_ptr = saaf_updater_ptr;
+
+  return return_struct;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpdaterPointers(
+    std::unique_ptr<UpwindTransportFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr)
+-> UpdaterPointers {
+  ReportBuildingComponant("Building Upwind Transport Formulation updater");
+  UpdaterPointers return_struct;
+
+  using ReturnType = formulation::updater::UpwindTransportUpdater<dim>;
+  auto upwind_updater_ptr = std::make_shared<ReturnType>(
+      std::move(formulation_ptr),
+      std::move(stamper_ptr));
+  ReportBuildSuccess(upwind_updater_ptr->description());
+  return_struct.fixed_updater_ptr = upwind_updater_ptr;
+  return_struct.scattering_source_updater_ptr = upwind_updater_ptr;
+  return_struct.fission_source_updater_ptr = upwind_updater_ptr;
+
+  return return_struct;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpdaterPointers(
+    std::unique_ptr<EvenParityFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> UpdaterPointers {
+  ReportBuildingComponant("Building Even-Parity Formulation updater");
+  UpdaterPointers return_struct;
+
+  using ReturnType = formulation::updater::EvenParityUpdater<dim>;
+  auto even_parity_updater_ptr = std::make_shared<ReturnType>(
+      std::move(formulation_ptr),
+      std::move(stamper_ptr),
+      quadrature_set_ptr);
+  ReportBuildSuccess(even_parity_updater_ptr->description());
+  return_struct.fixed_updater_ptr = even_parity_updater_ptr;
+  return_struct.scattering_source_updater_ptr = even_parity_updater_ptr;
+  return_struct.fission_source_updater_ptr = even_parity_updater_ptr;
+
+  return return_struct;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpdaterPointers(
+    std::unique_ptr<SimplifiedPNFormulationType> formulation_ptr,
+    std::unique_ptr<StamperType> stamper_ptr,
+    const std::map<problem::Boundary, bool>& reflective_boundaries)
+-> UpdaterPointers {
+  ReportBuildingComponant("Building Simplified PN Formulation updater");
+  UpdaterPointers return_struct;
+
+  std::unordered_set<problem::Boundary> reflective_boundary_set;
+
+  for (const auto boundary_pair : reflective_boundaries) {
+    if (boundary_pair.second)
+      reflective_boundary_set.insert(boundary_pair.first);
+  }
+
+  using ReturnType = formulation::updater::SimplifiedPNUpdater<dim>;
+  auto simplified_pn_updater_ptr = std::make_shared<ReturnType>(
+      std::move(formulation_ptr),
+      std::move(stamper_ptr),
+      reflective_boundary_set);
+  ReportBuildSuccess(simplified_pn_updater_ptr->description());
+  return_struct.fixed_updater_ptr = simplified_pn_updater_ptr;
+  return_struct.scattering_source_updater_ptr = simplified_pn_updater_ptr;
+  return_struct.fission_source_updater_ptr = simplified_pn_updater_ptr;
+
+  return return_struct;
+}
+
 template <int dim>
 auto FrameworkBuilder<dim>::BuildGroupSolveIteration(
     std::unique_ptr<SingleGroupSolverType> single_group_solver_ptr,
@@ -474,6 +1004,30 @@ auto FrameworkBuilder<dim>::BuildGroupSolveIteration(
   return return_ptr;
 }
 
+template <int dim>
+auto FrameworkBuilder<dim>::BuildAllGroupSolveIteration(
+    const std::shared_ptr<GroupSolutionType>& group_solution_ptr,
+    const int max_iterations,
+    const double convergence_tolerance)
+-> std::unique_ptr<GroupSolveIterationType> {
+  ReportBuildingComponant("Iterative group solver");
+
+  auto return_ptr =
+      std::make_unique<iteration::group::AllGroupSolveIteration<dim>>(
+          group_solution_ptr, max_iterations, convergence_tolerance);
+
+  using ConvergenceStatusPort = iteration::group::data_ports::ConvergenceStatusPort;
+  using StatusPort = iteration::group::data_ports::StatusPort;
+  instrumentation::GetPort<ConvergenceStatusPort>(*return_ptr)
+      .AddInstrument(convergence_status_instrument_ptr_);
+  instrumentation::GetPort<StatusPort>(*return_ptr)
+      .AddInstrument(status_instrument_ptr_);
+
+  validator_.AddPart(FrameworkPart::ScatteringSourceUpdate);
+  ReportBuildSuccess(return_ptr->description());
+  return return_ptr;
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildGroupSolution(const int n_angles)
 -> std::unique_ptr<GroupSolutionType> {
@@ -566,11 +1120,31 @@ auto FrameworkBuilder<dim>::BuildMomentCalculator(
   return return_ptr;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildMomentCalculator(
+    const dealii::FullMatrix<double>& unknowns_to_moments)
+-> std::unique_ptr<MomentCalculatorType> {
+  ReportBuildingComponant("Moment calculator");
+  std::unique_ptr<MomentCalculatorType> return_ptr = nullptr;
+
+  try {
+    return_ptr = std::move(
+        std::make_unique<quadrature::calculators::SimplifiedPNMoments>(
+            unknowns_to_moments));
+    ReportBuildSuccess("calculator for simplified PN solve");
+  } catch (...) {
+    ReportBuildError();
+    throw;
+  }
+
+  return return_ptr;
+}
+
 
 
 template<int dim>
 auto FrameworkBuilder<dim>::BuildMomentConvergenceChecker(
-    double max_delta, int max_iterations)
+    double max_delta, int max_iterations, double precision_floor)
 -> std::unique_ptr<MomentConvergenceCheckerType>{
   //TODO(Josh): Add option for using other than L1Norm
   ReportBuildingComponant("Moment convergence checker");
@@ -581,6 +1155,7 @@ auto FrameworkBuilder<dim>::BuildMomentConvergenceChecker(
       convergence::moments::SingleMomentCheckerI>;
 
   auto single_checker_ptr = std::make_unique<CheckerType>(max_delta);
+  single_checker_ptr->SetPrecisionFloor(precision_floor);
   auto return_ptr = std::make_unique<FinalCheckerType>(
       std::move(single_checker_ptr));
   return_ptr->SetMaxIterations(max_iterations);
@@ -605,6 +1180,27 @@ auto FrameworkBuilder<dim>::BuildMomentMapConvergenceChecker(
   return_ptr->SetMaxIterations(max_iterations);
   return return_ptr;
 }
+
+template <int dim>
+auto FrameworkBuilder<dim>::BuildSinglePrecisionMomentMapConvergenceChecker(
+    double max_delta, int max_iterations, double precision_floor)
+-> std::unique_ptr<SinglePrecisionMomentMapConvergenceCheckerType> {
+  ReportBuildingComponant("Single precision moment map convergence checker");
+
+  using SingleCheckerType = convergence::moments::SingleMomentCheckerL1Norm;
+  using CheckerType = convergence::moments::MultiMomentCheckerMax;
+  using FinalCheckerType = convergence::FinalCheckerOrN<
+      const system::moments::MomentsMap,
+      convergence::moments::MultiMomentCheckerI,
+      const system::moments::SinglePrecisionMoments>;
+  auto single_checker_ptr = std::make_unique<SingleCheckerType>(max_delta);
+  single_checker_ptr->SetPrecisionFloor(precision_floor);
+  auto return_ptr = std::make_unique<FinalCheckerType>(
+      std::make_unique<CheckerType>(std::move(single_checker_ptr)));
+  return_ptr->SetMaxIterations(max_iterations);
+  return return_ptr;
+}
+
 template <int dim>
 auto FrameworkBuilder<dim>::BuildOuterIteration(
     std::unique_ptr<GroupSolveIterationType> group_iteration_ptr,
@@ -730,8 +1326,14 @@ auto FrameworkBuilder<dim>::BuildQuadratureSet(ParametersType problem_parameters
   auto quadrature_points = quadrature::utility::GenerateAllPositiveX<dim>(
       quadrature_generator_ptr->GenerateSet());
 
-  quadrature::factory::FillQuadratureSet<dim>(return_ptr.get(),
-                                              quadrature_points);
+  // Even-parity angular flux is the same for each direction and its reflection
+  if (problem_parameters.TransportModel() == problem::EquationType::kEvenParity) {
+    quadrature::factory::FillEvenParityQuadratureSet<dim>(return_ptr.get(),
+                                                          quadrature_points);
+  } else {
+    quadrature::factory::FillQuadratureSet<dim>(return_ptr.get(),
+                                                quadrature_points);
+  }
 
   return return_ptr;
 }
@@ -752,13 +1354,53 @@ auto FrameworkBuilder<dim>::BuildSAAFFormulation(
     return_ptr = std::move(std::make_unique<ReturnType>(finite_element_ptr,
                                                         cross_sections_ptr,
                                                         quadrature_set_ptr));
+  } else if (implementation ==
+      formulation::SAAFFormulationImpl::kAssemblyKernel) {
+    return_ptr = formulation::angular::MakeSelfAdjointAngularFluxKernelPtr<dim>(
+        finite_element_ptr, cross_sections_ptr, quadrature_set_ptr);
   }
 
   return return_ptr;
 }
 
 template<int dim>
-auto FrameworkBuilder<dim>::BuildSingleGroupSolver(const int max_iterations, const double convergence_tolerance)
+auto FrameworkBuilder<dim>::BuildSAAFSourceOperators(
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<data::CrossSections>& cross_sections_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> std::unique_ptr<SAAFSourceOperatorsType> {
+  ReportBuildingComponant("SAAF source operators");
+  std::unique_ptr<SAAFSourceOperatorsType> return_ptr = nullptr;
+
+  using ReturnType = formulation::angular::SAAFSourceOperators<dim>;
+  return_ptr = std::move(std::make_unique<ReturnType>(
+      domain_ptr, finite_element_ptr, cross_sections_ptr, quadrature_set_ptr));
+  ReportBuildSuccess(return_ptr->description());
+
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildSimplifiedPNFormulation(
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<data::CrossSections>& cross_sections_ptr,
+    const int order)
+-> std::unique_ptr<SimplifiedPNFormulationType> {
+  ReportBuildingComponant("Simplified PN formulation");
+  std::unique_ptr<SimplifiedPNFormulationType> return_ptr = nullptr;
+
+  using ReturnType = formulation::scalar::SimplifiedPN<dim>;
+  return_ptr = std::move(std::make_unique<ReturnType>(
+      finite_element_ptr, cross_sections_ptr, order));
+  ReportBuildSuccess(return_ptr->description());
+
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildSingleGroupSolver(const int max_iterations, const double convergence_tolerance,
+                                                   const solver::builder::SolverName solver_name)
 -> std::unique_ptr<SingleGroupSolverType> {
   using SolverName = solver::builder::SolverName;
   using SolverBuilder = solver::builder::SolverBuilder;
@@ -766,14 +1408,179 @@ auto FrameworkBuilder<dim>::BuildSingleGroupSolver(const int max_iterations, con
   ReportBuildingComponant("Single group solver");
   std::unique_ptr<SingleGroupSolverType> return_ptr = nullptr;
 
-  return_ptr = std::move(SolverBuilder::BuildSolver(SolverName::kDefaultGMRESGroupSolver, max_iterations,
+  return_ptr = std::move(SolverBuilder::BuildSolver(solver_name, max_iterations,
                                                     convergence_tolerance));
 
-  ReportBuildSuccess("Default implementation with GMRES");
+  if (solver_name == SolverName::kReflectiveBlockGMRESGroupSolver) {
+    ReportBuildSuccess("Reflective block implementation with GMRES");
+  } else if (solver_name == SolverName::kDefaultCGGroupSolver) {
+    ReportBuildSuccess("Default implementation with CG");
+  } else if (solver_name == SolverName::kMixedPrecisionGMRESGroupSolver) {
+    ReportBuildSuccess("Default implementation with mixed precision GMRES");
+  } else {
+    ReportBuildSuccess("Default implementation with GMRES");
+  }
+
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildGeometricMultigridPreconditioner(
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const problem::PreconditionerType smoother)
+-> solver::group::SingleGroupSolver::PreconditionerFactory {
+  using GeometricMultigrid = solver::preconditioner::GeometricMultigrid;
+  using Preconditioner = solver::group::SingleGroupSolver::Preconditioner;
+  ReportBuildingComponant("Geometric multigrid preconditioner");
+
+  auto definition_ptr = dynamic_cast<domain::Definition<dim>*>(domain_ptr.get());
+  AssertThrow(definition_ptr != nullptr,
+              dealii::ExcMessage("Error in BuildGeometricMultigridPreconditioner, "
+                                 "domain must be a domain::Definition"))
+  const auto prolongation_matrices = definition_ptr->MakeProlongationMatrices();
+
+  // Preconditioners are set up for each system using the shared hierarchy
+  auto return_factory = [prolongation_matrices, smoother](
+      const dealii::PETScWrappers::MatrixBase& matrix) {
+    auto preconditioner_ptr = std::make_unique<GeometricMultigrid>(
+        prolongation_matrices, smoother);
+    preconditioner_ptr->initialize(matrix);
+    std::unique_ptr<Preconditioner> return_ptr = std::move(preconditioner_ptr);
+    return return_ptr; };
+
+  ReportBuildSuccess(std::to_string(prolongation_matrices.size() + 1) +
+                     " level V-cycle");
+  return return_factory;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildSymmetricStoragePreconditioner()
+-> solver::group::SingleGroupSolver::PreconditionerFactory {
+  using Preconditioner = solver::group::SingleGroupSolver::Preconditioner;
+  ReportBuildingComponant("Symmetric storage preconditioner");
+
+  // Point Jacobi only needs the diagonal, which is stored by SBAIJ matrices
+  auto return_factory = [](const dealii::PETScWrappers::MatrixBase& matrix) {
+    std::unique_ptr<Preconditioner> return_ptr =
+        std::make_unique<dealii::PETScWrappers::PreconditionJacobi>(matrix);
+    return return_ptr; };
+
+  ReportBuildSuccess("Jacobi");
+  return return_factory;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildSweepGroupSolver(
+    const std::shared_ptr<UpwindTransportFormulationType>& formulation_ptr,
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> std::unique_ptr<SingleGroupSolverType> {
+  ReportBuildingComponant("Single group solver");
+  std::unique_ptr<SingleGroupSolverType> return_ptr = nullptr;
+
+  auto sweep_solver_ptr = std::make_unique<solver::group::SweepGroupSolver<dim>>(
+      formulation_ptr, domain_ptr, quadrature_set_ptr);
+  using SweepStatusPort = solver::group::data_ports::SweepStatusPort;
+  instrumentation::GetPort<SweepStatusPort>(*sweep_solver_ptr)
+      .AddInstrument(status_instrument_ptr_);
+  return_ptr = std::move(sweep_solver_ptr);
+  ReportBuildSuccess("Transport sweep (pipelined across processors)");
+
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildCartesianStencilGroupSolver(
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const CartesianStencilFunction& stencil_function)
+-> std::unique_ptr<SingleGroupSolverType> {
+  ReportBuildingComponant("Single group solver");
+  std::unique_ptr<SingleGroupSolverType> return_ptr =
+      std::make_unique<solver::group::CartesianStencilGroupSolver<dim>>(
+          domain_ptr, stencil_function);
+  const auto lattice_ptr = dynamic_cast<solver::group::CartesianStencilGroupSolver<dim>*>(
+      return_ptr.get())->lattice_ptr();
+  ReportBuildSuccess("Cartesian stencils with CG, " +
+                     std::to_string(lattice_ptr->cell_classes().size()) +
+                     " cell classes in " +
+                     std::to_string(lattice_ptr->runs().size()) + " runs");
 
   return return_ptr;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildStencilFunction(
+    const std::shared_ptr<DiffusionFormulationType>& formulation_ptr,
+    const std::map<problem::Boundary, bool>& reflective_boundaries)
+-> CartesianStencilFunction {
+  using BoundaryType = typename DiffusionFormulationType::BoundaryType;
+  using CellPtr = domain::CellPtr<dim>;
+  using StencilType = formulation::CartesianStencil<dim>;
+
+  return [formulation_ptr, reflective_boundaries](StencilType& stencil,
+                                                  const system::Index& index) {
+    const int group = index.first;
+    auto streaming_term_function = [&](formulation::FullMatrix& cell_matrix,
+                                       const CellPtr& cell_ptr) -> void {
+      formulation_ptr->FillCellStreamingTerm(cell_matrix, cell_ptr, group);
+    };
+    auto collision_term_function = [&](formulation::FullMatrix& cell_matrix,
+                                       const CellPtr& cell_ptr) -> void {
+      formulation_ptr->FillCellCollisionTerm(cell_matrix, cell_ptr, group);
+    };
+    auto boundary_function = [&](formulation::FullMatrix& cell_matrix,
+                                 const domain::FaceIndex face_index,
+                                 const CellPtr& cell_ptr) -> void {
+      const auto boundary = static_cast<problem::Boundary>(
+          cell_ptr->face(face_index.get())->boundary_id());
+      const auto reflective_it = reflective_boundaries.find(boundary);
+      const bool is_reflective = reflective_it != reflective_boundaries.end() &&
+          reflective_it->second;
+      formulation_ptr->FillBoundaryTerm(
+          cell_matrix, cell_ptr, face_index.get(),
+          is_reflective ? BoundaryType::kReflective : BoundaryType::kVacuum);
+    };
+    stencil.StampCellTerm(streaming_term_function)
+        .StampCellTerm(collision_term_function)
+        .StampBoundaryTerm(boundary_function);
+  };
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildStencilFunction(
+    const std::shared_ptr<SAAFFormulationType>& formulation_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> CartesianStencilFunction {
+  using CellPtr = domain::CellPtr<dim>;
+  using StencilType = formulation::CartesianStencil<dim>;
+
+  return [formulation_ptr, quadrature_set_ptr](StencilType& stencil,
+                                               const system::Index& index) {
+    const system::EnergyGroup group(index.first);
+    const auto quadrature_point_ptr = quadrature_set_ptr->GetQuadraturePoint(
+        quadrature::QuadraturePointIndex(index.second));
+    auto streaming_term_function = [&](formulation::FullMatrix& cell_matrix,
+                                       const CellPtr& cell_ptr) -> void {
+      formulation_ptr->FillCellStreamingTerm(cell_matrix, cell_ptr,
+                                             quadrature_point_ptr, group);
+    };
+    auto collision_term_function = [&](formulation::FullMatrix& cell_matrix,
+                                       const CellPtr& cell_ptr) -> void {
+      formulation_ptr->FillCellCollisionTerm(cell_matrix, cell_ptr, group);
+    };
+    auto boundary_bilinear_term_function =
+        [&](formulation::FullMatrix& cell_matrix,
+            const domain::FaceIndex face_index,
+            const CellPtr& cell_ptr) -> void {
+      formulation_ptr->FillBoundaryBilinearTerm(
+          cell_matrix, cell_ptr, face_index, quadrature_point_ptr, group);
+    };
+    stencil.StampCellTerm(streaming_term_function)
+        .StampCellTerm(collision_term_function)
+        .StampBoundaryTerm(boundary_bilinear_term_function);
+  };
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildSystem(
     const int total_groups,
@@ -781,16 +1588,22 @@ auto FrameworkBuilder<dim>::BuildSystem(
     const DomainType& domain,
     const std::size_t solution_size,
     bool is_eigenvalue_problem,
-    bool need_rhs_boundary_condition) -> std::unique_ptr<SystemType> {
+    bool need_rhs_boundary_condition,
+    bool is_symmetric,
+    const int max_harmonic_l,
+    system::StoragePrecision lagged_moment_precision)
+    -> std::unique_ptr<SystemType> {
   std::unique_ptr<SystemType> return_ptr;
 
   ReportBuildingComponant("system");
   try {
     return_ptr = std::move(std::make_unique<SystemType>());
     system::InitializeSystem(*return_ptr, total_groups, total_angles,
-                             is_eigenvalue_problem, need_rhs_boundary_condition);
-    system::SetUpSystemTerms(*return_ptr, domain);
-    system::SetUpSystemMoments(*return_ptr, solution_size);
+                             is_eigenvalue_problem, need_rhs_boundary_condition,
+                             max_harmonic_l);
+    system::SetUpSystemTerms(*return_ptr, domain, is_symmetric);
+    system::SetUpSystemMoments(*return_ptr, solution_size,
+                               lagged_moment_precision);
     ReportBuildSuccess("system");
   } catch (...) {
     ReportBuildError("system initialization error.");
@@ -812,6 +1625,100 @@ auto FrameworkBuilder<dim>::BuildStamper(
   ReportBuildSuccess(return_ptr->description());
   return return_ptr;
 }
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildStamper(
+    const std::shared_ptr<DomainType>& domain_ptr,
+    const std::shared_ptr<WorkspaceType>& workspace_ptr)
+-> std::unique_ptr<StamperType> {
+  ReportBuildingComponant("Stamper");
+  auto stamper_ptr = std::make_unique<formulation::Stamper<dim>>(domain_ptr);
+  stamper_ptr->SetWorkspace(workspace_ptr);
+  ReportBuildSuccess(stamper_ptr->description());
+  return stamper_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildUpwindTransportFormulation(
+    const std::shared_ptr<FiniteElementType>& finite_element_ptr,
+    const std::shared_ptr<data::CrossSections>& cross_sections_ptr,
+    const std::shared_ptr<QuadratureSetType>& quadrature_set_ptr)
+-> std::unique_ptr<UpwindTransportFormulationType> {
+  ReportBuildingComponant("Building Upwind Transport Formulation");
+  std::unique_ptr<UpwindTransportFormulationType> return_ptr = nullptr;
+
+  using ReturnType = formulation::angular::UpwindTransport<dim>;
+  return_ptr = std::move(std::make_unique<ReturnType>(finite_element_ptr,
+                                                      cross_sections_ptr,
+                                                      quadrature_set_ptr));
+  ReportBuildSuccess("Upwind transport formulation");
+
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildWorkspace(const FiniteElementType& finite_element,
+                                           const DomainType& domain)
+-> std::shared_ptr<WorkspaceType> {
+  ReportBuildingComponant("Workspace");
+  auto return_ptr = std::make_shared<WorkspaceType>(
+      finite_element.dofs_per_cell(),
+      finite_element.n_cell_quad_pts(),
+      domain.total_degrees_of_freedom());
+  ReportBuildSuccess("Workspace");
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::SetConvergenceTolerance(const double tolerance)
+-> FrameworkBuilder<dim>& {
+  AssertThrow(tolerance > 0,
+              dealii::ExcMessage("Error in SetConvergenceTolerance, tolerance "
+                                 "must be greater than 0"))
+  convergence_tolerance_ = tolerance;
+  return *this;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::SetLinearSolverSettings(const int max_iterations,
+                                                    const double tolerance)
+-> FrameworkBuilder<dim>& {
+  AssertThrow(max_iterations > 0,
+              dealii::ExcMessage("Error in SetLinearSolverSettings, max "
+                                 "iterations must be greater than 0"))
+  AssertThrow(tolerance > 0,
+              dealii::ExcMessage("Error in SetLinearSolverSettings, tolerance "
+                                 "must be greater than 0"))
+  linear_solver_max_iterations_ = max_iterations;
+  linear_solver_tolerance_ = tolerance;
+  return *this;
+}
+
+template<int dim>
+void FrameworkBuilder<dim>::SetUpInstruments() {
+  // Shared instruments are only added to ports once, frameworks built by the
+  // same builder report to the same instruments
+  if (color_status_instrument_ptr_ != nullptr)
+    return;
+
+  using InstrumentBuilder = instrumentation::builder::InstrumentBuilder;
+  using InstrumentName = instrumentation::builder::InstrumentName;
+
+  color_status_instrument_ptr_ = Shared(
+      InstrumentBuilder::BuildInstrument<ColorStatusPair>(
+          InstrumentName::kColorStatusToConditionalOstream));
+  convergence_status_instrument_ptr_ = Shared(
+      InstrumentBuilder::BuildInstrument<convergence::Status>(
+          InstrumentName::kConvergenceStatusToConditionalOstream));
+  status_instrument_ptr_ = Shared(
+      InstrumentBuilder::BuildInstrument<std::string>(
+          InstrumentName::kStringToConditionalOstream));
+
+  data_port::StatusDataPort::AddInstrument(color_status_instrument_ptr_);
+  instrumentation::GetPort<data_port::ValidatorStatusPort>(validator_)
+      .AddInstrument(color_status_instrument_ptr_);
+}
+
 template<int dim>
 std::string FrameworkBuilder<dim>::ReadMappingFile(std::string filename) {
   ReportBuildingComponant("Reading mapping file: ");
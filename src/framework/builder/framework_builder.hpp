@@ -13,7 +13,6 @@
 #include "framework/builder/framework_validator.h"
 // Problem parameters
 #include "problem/parameters_i.h"
-#include "system/solution/solution_types.h"
 
 // Interface classes built by this factory
 #include "convergence/final_i.h"
@@ -22,8 +21,12 @@
 #include "domain/finite_element/finite_element_i.h"
 #include "eigenvalue/k_effective/k_effective_updater_i.h"
 #include "formulation/stamper_i.h"
+#include "formulation/angular/even_parity_i.h"
+#include "formulation/angular/saaf_source_operators_i.h"
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
+#include "formulation/angular/upwind_transport_i.h"
 #include "formulation/scalar/diffusion_i.h"
+#include "formulation/scalar/simplified_pn_i.h"
 #include "formulation/updater/fission_source_updater_i.h"
 #include "formulation/updater/fixed_updater_i.h"
 #include "formulation/updater/scattering_source_updater_i.h"
@@ -36,10 +39,15 @@
 #include "instrumentation/instrument_i.h"
 #include "quadrature/quadrature_set_i.h"
 #include "quadrature/calculators/spherical_harmonic_moments_i.h"
+#include "solver/builder/solver_builder.hpp"
+#include "solver/group/cartesian_stencil_group_solver.h"
+#include "solver/group/single_group_solver.h"
 #include "solver/group/single_group_solver_i.h"
+#include "system/solution/boundary_angular_solution.h"
 #include "system/solution/mpi_group_angular_solution_i.h"
 #include "system/system.h"
 #include "system/moments/spherical_harmonic_i.h"
+#include "system/workspace.h"
 
 // Dependency clases
 #include "formulation/updater/fixed_updater_i.h"
@@ -65,12 +73,14 @@ class FrameworkBuilder : public data_port::StatusDataPort {
   using Color = utility::Color;
   using MomentCalculatorImpl = quadrature::MomentCalculatorImpl;
 
-  using AngularFluxStorage = system::solution::EnergyGroupToAngularSolutionPtrMap;
+  using BoundaryAngularFluxStorage = system::solution::BoundaryAngularSolution;
 
   using BoundaryConditionsUpdaterType = formulation::updater::BoundaryConditionsUpdaterI;
+  using CartesianStencilFunction = typename solver::group::CartesianStencilGroupSolver<dim>::StencilFunction;
   using CrossSectionType = data::CrossSections;
   using DiffusionFormulationType = formulation::scalar::DiffusionI<dim>;
   using DomainType = domain::DefinitionI<dim>;
+  using EvenParityFormulationType = formulation::angular::EvenParityI<dim>;
   using FiniteElementType = domain::finite_element::FiniteElementI<dim>;
   using FissionSourceUpdaterType = formulation::updater::FissionSourceUpdaterI;
   using FixedUpdaterType = formulation::updater::FixedUpdaterI;
@@ -82,14 +92,21 @@ class FrameworkBuilder : public data_port::StatusDataPort {
   using MomentCalculatorType = quadrature::calculators::SphericalHarmonicMomentsI;
   using MomentConvergenceCheckerType = convergence::FinalI<system::moments::MomentVector>;
   using MomentMapConvergenceCheckerType = convergence::FinalI<const system::moments::MomentsMap>;
+  using SinglePrecisionMomentMapConvergenceCheckerType = convergence::FinalI<
+      const system::moments::MomentsMap,
+      const system::moments::SinglePrecisionMoments>;
   using OuterIterationType = iteration::outer::OuterIterationI;
   using ParameterConvergenceCheckerType = convergence::FinalI<double>;
   using QuadratureSetType = quadrature::QuadratureSetI<dim>;
   using SAAFFormulationType = formulation::angular::SelfAdjointAngularFluxI<dim>;
+  using SAAFSourceOperatorsType = formulation::angular::SAAFSourceOperatorsI<dim>;
   using ScatteringSourceUpdaterType = formulation::updater::ScatteringSourceUpdaterI;
+  using SimplifiedPNFormulationType = formulation::scalar::SimplifiedPNI<dim>;
   using SingleGroupSolverType = solver::group::SingleGroupSolverI;
   using StamperType = formulation::StamperI<dim>;
   using SystemType = system::System;
+  using UpwindTransportFormulationType = formulation::angular::UpwindTransportI<dim>;
+  using WorkspaceType = system::Workspace;
 
   using ColorStatusPair = std::pair<std::string, utility::Color>;
   // Instrumentation
@@ -110,15 +127,39 @@ class FrameworkBuilder : public data_port::StatusDataPort {
   std::unique_ptr<FrameworkType> BuildFramework(std::string name, ParametersType&);
   std::unique_ptr<FrameworkType> BuildFramework(std::string name, ParametersType&,
                                                 system::moments::SphericalHarmonicI*);
+  /*! \brief Builds a framework on a finite element and domain that have
+   * already been set up, such as a domain that has been adaptively refined. */
+  std::unique_ptr<FrameworkType> BuildFramework(
+      std::string name, ParametersType&,
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<DomainType>&);
+
+  /*! \brief Sets the tolerance of the moment and eigenvalue convergence
+   * checkers built by BuildFramework (default 1e-6). */
+  FrameworkBuilder<dim>& SetConvergenceTolerance(const double tolerance);
+  double convergence_tolerance() const { return convergence_tolerance_; }
+  /*! \brief Sets the maximum iterations and tolerance of the linear solvers
+   * built by BuildFramework (defaults 1000 and 1e-10). */
+  FrameworkBuilder<dim>& SetLinearSolverSettings(const int max_iterations,
+                                                 const double tolerance);
+  int linear_solver_max_iterations() const {
+    return linear_solver_max_iterations_; }
+  double linear_solver_tolerance() const { return linear_solver_tolerance_; }
 
   std::unique_ptr<CrossSectionType> BuildCrossSections(ParametersType);
   std::unique_ptr<DiffusionFormulationType> BuildDiffusionFormulation(
       const std::shared_ptr<FiniteElementType>&,
       const std::shared_ptr<data::CrossSections>&,
       const formulation::DiffusionFormulationImpl implementation = formulation::DiffusionFormulationImpl::kDefault);
+  std::unique_ptr<DomainType> BuildDomain(
+      ParametersType, const std::shared_ptr<FiniteElementType>&);
   std::unique_ptr<DomainType> BuildDomain(
       ParametersType, const std::shared_ptr<FiniteElementType>&,
       std::string material_mapping);
+  std::unique_ptr<EvenParityFormulationType> BuildEvenParityFormulation(
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<data::CrossSections>&,
+      const std::shared_ptr<QuadratureSetType>&);
   std::unique_ptr<FiniteElementType> BuildFiniteElement(ParametersType);
   UpdaterPointers BuildUpdaterPointers(
       std::unique_ptr<DiffusionFormulationType>,
@@ -133,7 +174,23 @@ class FrameworkBuilder : public data_port::StatusDataPort {
       std::unique_ptr<StamperType>,
       const std::shared_ptr<QuadratureSetType>&,
       const std::map<problem::Boundary, bool>& reflective_boundaries,
-      const AngularFluxStorage&);
+      const std::shared_ptr<BoundaryAngularFluxStorage>&);
+  UpdaterPointers BuildUpdaterPointers(
+      std::unique_ptr<SAAFFormulationType>,
+      std::unique_ptr<StamperType>,
+      const std::shared_ptr<QuadratureSetType>&,
+      const std::map<problem::Boundary, bool>& reflective_boundaries);
+  UpdaterPointers BuildUpdaterPointers(
+      std::unique_ptr<UpwindTransportFormulationType>,
+      std::unique_ptr<StamperType>);
+  UpdaterPointers BuildUpdaterPointers(
+      std::unique_ptr<EvenParityFormulationType>,
+      std::unique_ptr<StamperType>,
+      const std::shared_ptr<QuadratureSetType>&);
+  UpdaterPointers BuildUpdaterPointers(
+      std::unique_ptr<SimplifiedPNFormulationType>,
+      std::unique_ptr<StamperType>,
+      const std::map<problem::Boundary, bool>& reflective_boundaries);
   std::unique_ptr<GroupSolveIterationType> BuildGroupSolveIteration(
       std::unique_ptr<SingleGroupSolverType>,
       std::unique_ptr<MomentConvergenceCheckerType>,
@@ -141,6 +198,10 @@ class FrameworkBuilder : public data_port::StatusDataPort {
       const std::shared_ptr<GroupSolutionType>&,
       const UpdaterPointers& updater_ptrs,
       std::unique_ptr<MomentMapConvergenceCheckerType> moment_map_convergence_checker_ptr);
+  std::unique_ptr<GroupSolveIterationType> BuildAllGroupSolveIteration(
+      const std::shared_ptr<GroupSolutionType>&,
+      const int max_iterations = 1000,
+      const double convergence_tolerance = 1e-10);
   std::unique_ptr<InitializerType> BuildInitializer(
       const std::shared_ptr<formulation::updater::FixedUpdaterI>&,
       const int total_groups, const int total_angles);
@@ -154,10 +215,18 @@ class FrameworkBuilder : public data_port::StatusDataPort {
   std::unique_ptr<MomentCalculatorType> BuildMomentCalculator(
       std::shared_ptr<QuadratureSetType>,
       MomentCalculatorImpl implementation = MomentCalculatorImpl::kZerothMomentOnly);
+  std::unique_ptr<MomentCalculatorType> BuildMomentCalculator(
+      const dealii::FullMatrix<double>& unknowns_to_moments);
   std::unique_ptr<MomentConvergenceCheckerType> BuildMomentConvergenceChecker(
-      double max_delta, int max_iterations);
+      double max_delta, int max_iterations, double precision_floor = 0);
   std::unique_ptr<MomentMapConvergenceCheckerType> BuildMomentMapConvergenceChecker(
       double max_delta, int max_iterations);
+  /*! \brief Builds a checker comparing moments to lagged moments stored in
+   * single precision, which cannot converge below the given floor. */
+  std::unique_ptr<SinglePrecisionMomentMapConvergenceCheckerType>
+  BuildSinglePrecisionMomentMapConvergenceChecker(double max_delta,
+                                                  int max_iterations,
+                                                  double precision_floor);
   std::unique_ptr<OuterIterationType> BuildOuterIteration(
       std::unique_ptr<GroupSolveIterationType>,
       std::unique_ptr<ParameterConvergenceCheckerType>);
@@ -174,15 +243,69 @@ class FrameworkBuilder : public data_port::StatusDataPort {
       const std::shared_ptr<data::CrossSections>&,
       const std::shared_ptr<QuadratureSetType>&,
       const formulation::SAAFFormulationImpl implementation = formulation::SAAFFormulationImpl::kDefault);
+  std::unique_ptr<SAAFSourceOperatorsType> BuildSAAFSourceOperators(
+      const std::shared_ptr<DomainType>&,
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<data::CrossSections>&,
+      const std::shared_ptr<QuadratureSetType>&);
+  std::unique_ptr<SimplifiedPNFormulationType> BuildSimplifiedPNFormulation(
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<data::CrossSections>&,
+      const int order);
   std::unique_ptr<SingleGroupSolverType> BuildSingleGroupSolver(
       const int max_iterations = 1000,
-      const double convergence_tolerance = 1e-10);
+      const double convergence_tolerance = 1e-10,
+      const solver::builder::SolverName solver_name = solver::builder::SolverName::kDefaultGMRESGroupSolver);
+  /*! \brief Builds a factory for geometric multigrid preconditioners, using the
+   * levels of the (uniformly refined) domain mesh. */
+  solver::group::SingleGroupSolver::PreconditionerFactory
+  BuildGeometricMultigridPreconditioner(
+      const std::shared_ptr<DomainType>&,
+      const problem::PreconditionerType smoother);
+  /*! \brief Builds a factory for the preconditioner used by the CG group
+   * solver with symmetric (SBAIJ) storage.
+   *
+   * Returns point Jacobi preconditioners, which only use the stored diagonal.
+   * Preconditioners that need the lower triangle, such as geometric multigrid
+   * or BoomerAMG, require full storage. */
+  solver::group::SingleGroupSolver::PreconditionerFactory
+  BuildSymmetricStoragePreconditioner();
+  std::unique_ptr<SingleGroupSolverType> BuildSweepGroupSolver(
+      const std::shared_ptr<UpwindTransportFormulationType>&,
+      const std::shared_ptr<DomainType>&,
+      const std::shared_ptr<QuadratureSetType>&);
+  std::unique_ptr<SingleGroupSolverType> BuildCartesianStencilGroupSolver(
+      const std::shared_ptr<DomainType>&,
+      const CartesianStencilFunction&);
+  /*! \brief Builds a function filling diffusion stencils with the terms
+   * stamped into the system matrix by the diffusion updater. */
+  CartesianStencilFunction BuildStencilFunction(
+      const std::shared_ptr<DiffusionFormulationType>&,
+      const std::map<problem::Boundary, bool>& reflective_boundaries);
+  /*! \brief Builds a function filling SAAF stencils with the terms stamped
+   * into the system matrix by the SAAF updater. */
+  CartesianStencilFunction BuildStencilFunction(
+      const std::shared_ptr<SAAFFormulationType>&,
+      const std::shared_ptr<QuadratureSetType>&);
   std::unique_ptr<StamperType> BuildStamper(const std::shared_ptr<DomainType>&);
+  std::unique_ptr<StamperType> BuildStamper(
+      const std::shared_ptr<DomainType>&,
+      const std::shared_ptr<WorkspaceType>&);
   std::unique_ptr<SystemType> BuildSystem(const int n_groups, const int n_angles,
                                           const DomainType& domain,
                                           const std::size_t solution_size,
                                           bool is_eigenvalue_problem = true,
-                                          bool need_rhs_boundary_condition = false);
+                                          bool need_rhs_boundary_condition = false,
+                                          bool is_symmetric = false,
+                                          const int max_harmonic_l = 0,
+                                          system::StoragePrecision lagged_moment_precision =
+                                              system::StoragePrecision::kDouble);
+  std::unique_ptr<UpwindTransportFormulationType> BuildUpwindTransportFormulation(
+      const std::shared_ptr<FiniteElementType>&,
+      const std::shared_ptr<data::CrossSections>&,
+      const std::shared_ptr<QuadratureSetType>&);
+  std::shared_ptr<WorkspaceType> BuildWorkspace(const FiniteElementType&,
+                                               const DomainType&);
 
  private:
   void ReportBuildingComponant(std::string componant) {
@@ -212,6 +335,9 @@ class FrameworkBuilder : public data_port::StatusDataPort {
 
   void Validate() const;
 
+  //! Builds the shared status instruments, if they have not been built
+  void SetUpInstruments();
+
   template <typename T>
   inline std::shared_ptr<T> Shared(std::unique_ptr<T> to_convert_ptr) {
     return to_convert_ptr;
@@ -224,6 +350,9 @@ class FrameworkBuilder : public data_port::StatusDataPort {
   mutable FrameworkValidator validator_;
   bool build_report_closed_ = true;
   std::string filename_{""};
+  double convergence_tolerance_{ 1e-6 };
+  int linear_solver_max_iterations_{ 1000 };
+  double linear_solver_tolerance_{ 1e-10 };
 };
 
 } // namespace builder
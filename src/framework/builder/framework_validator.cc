@@ -2,6 +2,8 @@
 
 #include <algorithm>
 
+#include <deal.II/base/exceptions.h>
+
 namespace bart {
 
 namespace framework {
@@ -14,6 +16,24 @@ FrameworkValidator &FrameworkValidator::AddPart(FrameworkPart to_add) {
 }
 
 void FrameworkValidator::Parse(const problem::ParametersI& to_parse) {
+  // Adaptive refinement produces a non-uniform mesh with hanging nodes
+  const bool is_adaptive = to_parse.AdaptiveRefinementCycles() > 0;
+  AssertThrow(!(is_adaptive && to_parse.DoDiscreteFourierTransformOfError()),
+              dealii::ExcMessage("Fourier transform of the error is not "
+                                 "supported with adaptive refinement"))
+  AssertThrow(!(is_adaptive && to_parse.DoMeshSequencing()),
+              dealii::ExcMessage("Mesh sequencing is not supported with "
+                                 "adaptive refinement"))
+  AssertThrow(!(is_adaptive && to_parse.Preconditioner() ==
+                problem::PreconditionerType::kGeometricMultigrid),
+              dealii::ExcMessage("Geometric multigrid preconditioning "
+                                 "requires a uniformly refined mesh, and is "
+                                 "not supported with adaptive refinement"))
+  AssertThrow(!(is_adaptive && to_parse.UseStructuredGridSolver()),
+              dealii::ExcMessage("Structured grid solver requires a uniform "
+                                 "Cartesian mesh, and is not supported with "
+                                 "adaptive refinement"))
+
   needed_parts_ = {FrameworkPart::ScatteringSourceUpdate};
   if (to_parse.IsEigenvalueProblem())
     needed_parts_.insert(FrameworkPart::FissionSourceUpdate);
@@ -24,8 +44,11 @@ void FrameworkValidator::Parse(const problem::ParametersI& to_parse) {
       reflective_boundary.end(),
       [](std::pair<problem::Boundary, bool> pair){ return pair.second; });
 
+  // Implicit reflective boundaries are coupled in the linear system and do not
+  // need the angular solution from the previous iteration.
   if (has_reflective &&
-      to_parse.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux) {
+      to_parse.TransportModel() == problem::EquationType::kSelfAdjointAngularFlux &&
+      to_parse.ReflectiveBoundaryTreatment() == problem::ReflectiveBoundaryType::kLagged) {
     needed_parts_.insert(FrameworkPart::AngularSolutionStorage);
   }
 }
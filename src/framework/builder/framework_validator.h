@@ -35,6 +35,8 @@ class FrameworkValidator : public data_port::ValidatorStatusPort {
     return parts_.size() > needed_parts_.size(); }
   std::set<FrameworkPart> NeededParts() const {
     return needed_parts_; }
+  /*! \brief Determines the needed parts of a framework from the problem
+   * parameters, throwing if the parameters request incompatible options. */
   void Parse(const problem::ParametersI& to_parse);
   std::set<FrameworkPart> Parts() const {
     return parts_; }
@@ -1,7 +1,9 @@
 #include <stdio.h>
 #include <filesystem>
 
+#include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_q.h>
+#include <deal.II/lac/petsc_sparse_matrix.h>
 
 #include "framework/builder/framework_builder.hpp"
 
@@ -9,30 +11,43 @@
 #include "convergence/final_checker_or_n.h"
 #include "convergence/parameters/single_parameter_checker.h"
 #include "convergence/moments/single_moment_checker_i.h"
+#include "convergence/moments/single_moment_checker_l1_norm.h"
 #include "convergence/moments/multi_moment_checker_i.h"
 #include "data/cross_sections.h"
 #include "domain/finite_element/finite_element_gaussian.h"
 #include "domain/definition.h"
 #include "eigenvalue/k_effective/updater_via_fission_source.h"
 #include "formulation/scalar/diffusion.h"
+#include "formulation/scalar/diffusion_kernel.h"
+#include "formulation/scalar/simplified_pn.h"
+#include "formulation/angular/even_parity.h"
+#include "formulation/angular/saaf_source_operators.h"
 #include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/angular/self_adjoint_angular_flux_kernel.h"
+#include "formulation/angular/upwind_transport.h"
+#include "formulation/updater/even_parity_updater.h"
 #include "formulation/updater/saaf_updater.h"
+#include "formulation/updater/upwind_transport_updater.h"
 #include "formulation/updater/diffusion_updater.h"
+#include "formulation/updater/simplified_pn_updater.h"
 #include "formulation/stamper.h"
 #include "instrumentation/instrument.h"
 #include "instrumentation/basic_instrument.h"
 #include "iteration/outer/outer_power_iteration.hpp"
 #include "iteration/outer/outer_fixed_source_iteration.hpp"
 #include "quadrature/calculators/scalar_moment.h"
+#include "quadrature/calculators/simplified_pn_moments.h"
 #include "quadrature/calculators/spherical_harmonic_zeroth_moment.h"
 #include "quadrature/quadrature_set.h"
 #include "solver/linear/gmres.h"
+#include "solver/group/reflective_block_group_solver.h"
 #include "solver/group/single_group_solver.h"
+#include "solver/group/sweep_group_solver.h"
 #include "system/solution/mpi_group_angular_solution.h"
 #include "iteration/initializer/initialize_fixed_terms_once.h"
+#include "iteration/group/all_group_solve_iteration.h"
 #include "iteration/group/group_source_iteration.h"
 #include "system/system_types.h"
-#include "system/solution/solution_types.h"
 #include "system/system_functions.h"
 
 // Mock objects
@@ -40,8 +55,11 @@
 #include "domain/tests/definition_mock.h"
 #include "domain/finite_element/tests/finite_element_mock.h"
 #include "eigenvalue/k_effective/tests/k_effective_updater_mock.h"
+#include "formulation/angular/tests/even_parity_mock.h"
 #include "formulation/angular/tests/self_adjoint_angular_flux_mock.h"
+#include "formulation/angular/tests/upwind_transport_mock.h"
 #include "formulation/scalar/tests/diffusion_mock.h"
+#include "formulation/scalar/tests/simplified_pn_mock.h"
 #include "formulation/tests/stamper_mock.h"
 #include "formulation/updater/tests/boundary_conditions_updater_mock.h"
 #include "formulation/updater/tests/scattering_source_updater_mock.h"
@@ -244,6 +262,63 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDiffusionFormulationTest) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildDiffusionFormulationAssemblyKernelTest) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr = std::make_shared<
+      NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  auto cross_sections_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material);
+
+  // Linear elements have 2^dim degrees of freedom and quadrature points
+  const int cell_dofs = 1 << dim;
+  ON_CALL(*finite_element_ptr, polynomial_degree()).WillByDefault(Return(1));
+  ON_CALL(*finite_element_ptr, dofs_per_cell()).WillByDefault(Return(cell_dofs));
+  ON_CALL(*finite_element_ptr, n_cell_quad_pts())
+      .WillByDefault(Return(cell_dofs));
+
+  auto diffusion_formulation_ptr =
+      this->test_builder_ptr_->BuildDiffusionFormulation(
+          finite_element_ptr, cross_sections_ptr,
+          formulation::DiffusionFormulationImpl::kAssemblyKernel);
+
+  using ExpectedType = formulation::scalar::DiffusionKernel<dim, 1>;
+  EXPECT_THAT(diffusion_formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildDiffusionFormulationAssemblyKernelFallbackTest) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr = std::make_shared<
+      NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  auto cross_sections_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material);
+
+  // No kernel is compiled for cubic elements
+  int cell_dofs = 1;
+  for (int i = 0; i < dim; ++i)
+    cell_dofs *= 4;
+  ON_CALL(*finite_element_ptr, polynomial_degree()).WillByDefault(Return(3));
+  ON_CALL(*finite_element_ptr, dofs_per_cell()).WillByDefault(Return(cell_dofs));
+  ON_CALL(*finite_element_ptr, n_cell_quad_pts())
+      .WillByDefault(Return(cell_dofs));
+
+  auto diffusion_formulation_ptr =
+      this->test_builder_ptr_->BuildDiffusionFormulation(
+          finite_element_ptr, cross_sections_ptr,
+          formulation::DiffusionFormulationImpl::kAssemblyKernel);
+
+  using ExpectedType = formulation::scalar::Diffusion<dim>;
+  using KernelType = formulation::scalar::DiffusionKernel<dim, 1>;
+  EXPECT_THAT(diffusion_formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(dynamic_cast<KernelType*>(diffusion_formulation_ptr.get()),
+            nullptr);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDiffusionUpdaterPointers) {
   constexpr int dim = this->dim;
   using ExpectedType = formulation::updater::DiffusionUpdater<dim>;
@@ -306,21 +381,78 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFUpdaterPointers) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildUpwindTransportUpdaterPointers) {
+  constexpr int dim = this->dim;
+  using ExpectedType = formulation::updater::UpwindTransportUpdater<dim>;
+  auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
+      std::make_unique<formulation::angular::UpwindTransportMock<dim>>(),
+      std::move(this->stamper_uptr_));
+  EXPECT_THAT(updater_struct.fixed_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(updater_struct.boundary_conditions_updater_ptr, nullptr);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildEvenParityUpdaterPointers) {
+  constexpr int dim = this->dim;
+  using ExpectedType = formulation::updater::EvenParityUpdater<dim>;
+  auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
+      std::make_unique<formulation::angular::EvenParityMock<dim>>(),
+      std::move(this->stamper_uptr_),
+      this->quadrature_set_sptr_);
+  EXPECT_THAT(updater_struct.fixed_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(updater_struct.boundary_conditions_updater_ptr, nullptr);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSimplifiedPNUpdaterPointers) {
+  constexpr int dim = this->dim;
+  using ExpectedType = formulation::updater::SimplifiedPNUpdater<dim>;
+
+  auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
+      std::make_unique<formulation::scalar::SimplifiedPNMock<dim>>(),
+      std::move(this->stamper_uptr_),
+      this->reflective_bcs_);
+  ASSERT_THAT(updater_struct.fixed_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(updater_struct.boundary_conditions_updater_ptr, nullptr);
+
+  auto dynamic_ptr =
+      dynamic_cast<ExpectedType*>(updater_struct.fixed_updater_ptr.get());
+  for (auto& [boundary, is_reflective] : this->reflective_bcs_ ) {
+    EXPECT_EQ(dynamic_ptr->reflective_boundaries().count(boundary),
+              is_reflective ? 1 : 0);
+  }
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest,
-    BuildSAAFUpdaterPointersWithReflectiveBCs) {
+    BuildSAAFUpdaterPointersWithBoundaryAngularFluxStorage) {
   using ExpectedType = formulation::updater::SAAFUpdater<this->dim>;
-  system::solution::EnergyGroupToAngularSolutionPtrMap angular_flux_storage;
-
-  system::SetUpEnergyGroupToAngularSolutionPtrMap(
-      angular_flux_storage, this->n_energy_groups, this->n_angles);
+  dealii::IndexSet locally_owned_dofs(4);
+  locally_owned_dofs.add_range(0, 4);
+  auto boundary_storage_ptr =
+      std::make_shared<system::solution::BoundaryAngularSolution>(
+          std::vector<dealii::types::global_dof_index>{0, 3}, locally_owned_dofs,
+          this->n_energy_groups, this->n_angles);
 
   auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
       std::move(this->saaf_formulation_uptr_),
       std::move(this->stamper_uptr_),
       this->quadrature_set_sptr_,
       this->reflective_bcs_,
-      angular_flux_storage);
-  EXPECT_THAT(updater_struct.fixed_updater_ptr.get(),
+      boundary_storage_ptr);
+  ASSERT_THAT(updater_struct.fixed_updater_ptr.get(),
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
   EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
@@ -328,6 +460,31 @@ TYPED_TEST(FrameworkBuilderIntegrationTest,
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
   EXPECT_THAT(updater_struct.boundary_conditions_updater_ptr.get(),
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  auto dynamic_ptr =
+      dynamic_cast<ExpectedType*>(updater_struct.fixed_updater_ptr.get());
+  EXPECT_EQ(dynamic_ptr->boundary_angular_solution_ptr(), boundary_storage_ptr);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+    BuildSAAFUpdaterPointersWithImplicitReflectiveBCs) {
+  using ExpectedType = formulation::updater::SAAFUpdater<this->dim>;
+
+  auto updater_struct = this->test_builder_ptr_->BuildUpdaterPointers(
+      std::move(this->saaf_formulation_uptr_),
+      std::move(this->stamper_uptr_),
+      this->quadrature_set_sptr_,
+      this->reflective_bcs_);
+  ASSERT_THAT(updater_struct.fixed_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.scattering_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(updater_struct.boundary_conditions_updater_ptr, nullptr);
+
+  auto dynamic_ptr =
+      dynamic_cast<ExpectedType*>(updater_struct.fixed_updater_ptr.get());
+  EXPECT_TRUE(dynamic_ptr->is_reflection_implicit());
 }
 
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainTest) {
@@ -349,6 +506,56 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainTest) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainDiscontinuous) {
+  constexpr int dim = this->dim;
+  auto finite_element_ptr =
+      std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  ON_CALL(this->parameters, Discretization())
+      .WillByDefault(Return(problem::DiscretizationType::kDiscontinuousFEM));
+
+  // Only discrete ordinates is solved on a discontinuous discretization
+  EXPECT_ANY_THROW({
+    this->test_builder_ptr_->BuildDomain(
+        this->parameters, finite_element_ptr, "1 1 2 2");
+  });
+
+  ON_CALL(this->parameters, TransportModel())
+      .WillByDefault(Return(problem::EquationType::kDiscreteOrdinates));
+  auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(
+      this->parameters, finite_element_ptr, "1 1 2 2");
+  ASSERT_NE(test_domain_ptr, nullptr);
+  EXPECT_EQ(test_domain_ptr->discretization_type(),
+            problem::DiscretizationType::kDiscontinuousFEM);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, SetConvergenceTolerance) {
+  EXPECT_EQ(this->test_builder_ptr_->convergence_tolerance(), 1e-6);
+  auto& returned_builder = this->test_builder_ptr_->SetConvergenceTolerance(1e-3);
+  EXPECT_EQ(&returned_builder, this->test_builder_ptr_.get());
+  EXPECT_EQ(this->test_builder_ptr_->convergence_tolerance(), 1e-3);
+  for (const double bad_tolerance : {0.0, -1e-3}) {
+    EXPECT_ANY_THROW({
+      this->test_builder_ptr_->SetConvergenceTolerance(bad_tolerance);
+    });
+  }
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, SetLinearSolverSettings) {
+  EXPECT_EQ(this->test_builder_ptr_->linear_solver_max_iterations(), 1000);
+  EXPECT_EQ(this->test_builder_ptr_->linear_solver_tolerance(), 1e-10);
+  auto& returned_builder =
+      this->test_builder_ptr_->SetLinearSolverSettings(100, 1e-8);
+  EXPECT_EQ(&returned_builder, this->test_builder_ptr_.get());
+  EXPECT_EQ(this->test_builder_ptr_->linear_solver_max_iterations(), 100);
+  EXPECT_EQ(this->test_builder_ptr_->linear_solver_tolerance(), 1e-8);
+  EXPECT_ANY_THROW({
+    this->test_builder_ptr_->SetLinearSolverSettings(0, 1e-8);
+  });
+  EXPECT_ANY_THROW({
+    this->test_builder_ptr_->SetLinearSolverSettings(100, 0);
+  });
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGroupSourceIterationTest) {
   using ExpectedType = iteration::group::GroupSourceIteration<this->dim>;
   using UpdaterPointersStruct = typename framework::builder::FrameworkBuilder<this->dim>::UpdaterPointers;
@@ -386,6 +593,20 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGroupSourceIterationWithBCUpdat
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildAllGroupSolveIterationTest) {
+  using ExpectedType = iteration::group::AllGroupSolveIteration<this->dim>;
+
+  auto block_iteration_ptr =
+      this->test_builder_ptr_->BuildAllGroupSolveIteration(
+          this->group_solution_sptr_, 100, 1e-12);
+  ASSERT_THAT(block_iteration_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  auto dynamic_ptr = dynamic_cast<ExpectedType*>(block_iteration_ptr.get());
+  EXPECT_EQ(dynamic_ptr->group_solution_ptr(), this->group_solution_sptr_);
+  EXPECT_EQ(dynamic_ptr->max_iterations(), 100);
+  EXPECT_EQ(dynamic_ptr->convergence_tolerance(), 1e-12);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGroupSolution) {
   using ExpectedType = system::solution::MPIGroupAngularSolution;
   const int n_angles = bart::test_helpers::RandomDouble(1, 10);
@@ -413,6 +634,19 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildFiniteElementTest) {
   EXPECT_NE(dealii_finite_element_ptr, nullptr);
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildFiniteElementDiscontinuous) {
+  constexpr int dim = this->dim;
+  ON_CALL(this->parameters, Discretization())
+      .WillByDefault(Return(problem::DiscretizationType::kDiscontinuousFEM));
+
+  auto finite_element_ptr = this->test_builder_ptr_->BuildFiniteElement(this->parameters);
+
+  EXPECT_EQ(finite_element_ptr->polynomial_degree(), this->polynomial_degree);
+  auto dealii_finite_element_ptr = dynamic_cast<dealii::FE_DGQ<dim>*>(
+      finite_element_ptr->finite_element());
+  EXPECT_NE(dealii_finite_element_ptr, nullptr);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildKeffectiveUpdater) {
   using ExpectedType = eigenvalue::k_effective::UpdaterViaFissionSource;
   EXPECT_CALL(*this->finite_element_sptr_, n_cell_quad_pts())
@@ -452,6 +686,16 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BulidMomentCalculatorAngular) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildMomentCalculatorSimplifiedPN) {
+  using ExpectedType = quadrature::calculators::SimplifiedPNMoments;
+  formulation::scalar::SimplifiedPNCoefficients coefficients(3);
+
+  auto moment_calculator_ptr = this->test_builder_ptr_->BuildMomentCalculator(
+      coefficients.unknowns_to_moments());
+  ASSERT_THAT(moment_calculator_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildPowerIterationTest) {
   auto power_iteration_ptr = this->test_builder_ptr_->BuildOuterIteration(
       std::move(this->group_solve_iteration_uptr_),
@@ -496,6 +740,34 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildGaussLegendreQuadratureSet) {
   }
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildEvenParityQuadratureSet) {
+  constexpr int dim = this->dim;
+  const int order = 4;
+  EXPECT_CALL(this->parameters, AngularQuad())
+      .WillOnce(Return(problem::AngularQuadType::kGaussLegendre));
+  EXPECT_CALL(this->parameters, AngularQuadOrder())
+      .WillOnce(Return(order));
+  ON_CALL(this->parameters, TransportModel())
+      .WillByDefault(Return(problem::EquationType::kEvenParity));
+
+  if (dim == 1) {
+    auto quadrature_set = this->test_builder_ptr_->BuildQuadratureSet(this->parameters);
+    ASSERT_NE(nullptr, quadrature_set);
+    // Only one of each pair of reflected directions, with the weight of both
+    EXPECT_EQ(quadrature_set->size(), order);
+    double total_weight = 0;
+    for (const auto& quadrature_point : *quadrature_set) {
+      EXPECT_GT(quadrature_point->cartesian_position().at(0), 0);
+      total_weight += quadrature_point->weight();
+    }
+    EXPECT_NEAR(total_weight, 4 * M_PI, 1e-10);
+  } else {
+    EXPECT_ANY_THROW({
+      auto quadrature_set = this->test_builder_ptr_->BuildQuadratureSet(this->parameters);
+                     });
+  }
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildLSAngularQuadratureSet) {
   constexpr int dim = this->dim;
   const int order = 4;
@@ -537,6 +809,20 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolver) {
   EXPECT_EQ(linear_solver_ptr->max_iterations(), 100);
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildReflectiveBlockGroupSolver) {
+  using ExpectedType = solver::group::ReflectiveBlockGroupSolver;
+
+  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(
+      100, 1e-12, solver::builder::SolverName::kReflectiveBlockGMRESGroupSolver);
+
+  ASSERT_NE(nullptr, solver_ptr);
+
+  auto dynamic_ptr = dynamic_cast<ExpectedType*>(solver_ptr.get());
+  ASSERT_NE(nullptr, dynamic_ptr);
+  EXPECT_EQ(dynamic_ptr->convergence_tolerance(), 1e-12);
+  EXPECT_EQ(dynamic_ptr->max_iterations(), 100);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildConvergenceChecker) {
   const double max_delta = 1e-4;
   const int max_iterations = 100;
@@ -575,6 +861,28 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildMomentConvergenceChecker) {
 
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildMomentConvergenceCheckerPrecisionFloor) {
+  const double max_delta = 1e-6, precision_floor = 1e-5;
+  const int max_iterations = 73;
+
+  auto convergence_ptr =
+      this->test_builder_ptr_->BuildMomentConvergenceChecker(
+          max_delta, max_iterations, precision_floor);
+
+  using FinalType =
+  convergence::FinalCheckerOrN<system::moments::MomentVector,
+                               convergence::moments::SingleMomentCheckerI>;
+  using CheckerType = convergence::moments::SingleMomentCheckerL1Norm;
+
+  auto final_ptr = dynamic_cast<FinalType*>(convergence_ptr.get());
+  ASSERT_NE(final_ptr, nullptr);
+  auto checker_ptr = dynamic_cast<CheckerType*>(final_ptr->checker_ptr());
+  ASSERT_NE(checker_ptr, nullptr);
+  EXPECT_EQ(checker_ptr->max_delta(), max_delta);
+  EXPECT_EQ(checker_ptr->precision_floor(), precision_floor);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildMomentMapConvergenceChecker) {
   const double max_delta = 1e-4;
   const int max_iterations = 73;
@@ -596,6 +904,25 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildMomentMapConvergenceChecker) {
 
 
 
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildSinglePrecisionMomentMapConvergenceChecker) {
+  const double max_delta = 1e-4, precision_floor = 1e-5;
+  const int max_iterations = 73;
+
+  auto convergence_ptr =
+      this->test_builder_ptr_->BuildSinglePrecisionMomentMapConvergenceChecker(
+          max_delta, max_iterations, precision_floor);
+
+  using ExpectedType =
+  convergence::FinalCheckerOrN<const system::moments::MomentsMap,
+                               convergence::moments::MultiMomentCheckerI,
+                               const system::moments::SinglePrecisionMoments>;
+
+  ASSERT_THAT(convergence_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(convergence_ptr->max_iterations(), max_iterations);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFFormulationTest) {
   constexpr int dim = this->dim;
 
@@ -619,6 +946,185 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFFormulationTest) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildSAAFFormulationAssemblyKernelTest) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr = std::make_shared<
+      NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  auto cross_sections_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material);
+  auto quadrature_set_ptr =
+      std::make_shared<quadrature::QuadratureSetMock<dim>>();
+
+  // Linear elements have 2^dim degrees of freedom and quadrature points
+  const int cell_dofs = 1 << dim;
+  ON_CALL(*finite_element_ptr, polynomial_degree()).WillByDefault(Return(1));
+  ON_CALL(*finite_element_ptr, dofs_per_cell()).WillByDefault(Return(cell_dofs));
+  ON_CALL(*finite_element_ptr, n_cell_quad_pts())
+      .WillByDefault(Return(cell_dofs));
+
+  auto saaf_formulation_ptr = this->test_builder_ptr_->BuildSAAFFormulation(
+      finite_element_ptr, cross_sections_ptr, quadrature_set_ptr,
+      formulation::SAAFFormulationImpl::kAssemblyKernel);
+
+  using ExpectedType = formulation::angular::SelfAdjointAngularFluxKernel<dim, 1>;
+
+  EXPECT_THAT(saaf_formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildUpwindTransportFormulationTest) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr =
+      std::make_shared<domain::finite_element::FiniteElementMock<dim>>();
+  auto cross_sections_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material);
+  auto quadrature_set_ptr =
+      std::make_shared<quadrature::QuadratureSetMock<dim>>();
+
+  EXPECT_CALL(*finite_element_ptr, dofs_per_cell());
+  EXPECT_CALL(*finite_element_ptr, n_cell_quad_pts());
+  EXPECT_CALL(*finite_element_ptr, n_face_quad_pts());
+
+  auto formulation_ptr = this->test_builder_ptr_->BuildUpwindTransportFormulation(
+      finite_element_ptr, cross_sections_ptr, quadrature_set_ptr);
+
+  using ExpectedType = formulation::angular::UpwindTransport<dim>;
+
+  EXPECT_THAT(formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildEvenParityFormulationTest) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr =
+      std::make_shared<domain::finite_element::FiniteElementMock<dim>>();
+  auto cross_sections_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material);
+  auto quadrature_set_ptr =
+      std::make_shared<quadrature::QuadratureSetMock<dim>>();
+
+  EXPECT_CALL(*finite_element_ptr, dofs_per_cell());
+  EXPECT_CALL(*finite_element_ptr, n_cell_quad_pts());
+  EXPECT_CALL(*finite_element_ptr, n_face_quad_pts());
+
+  auto formulation_ptr = this->test_builder_ptr_->BuildEvenParityFormulation(
+      finite_element_ptr, cross_sections_ptr, quadrature_set_ptr);
+
+  using ExpectedType = formulation::angular::EvenParity<dim>;
+
+  EXPECT_THAT(formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFSourceOperatorsTest) {
+  constexpr int dim = this->dim;
+
+  auto domain_ptr = std::make_shared<NiceMock<domain::DefinitionMock<dim>>>();
+  auto finite_element_ptr =
+      std::make_shared<domain::finite_element::FiniteElementMock<dim>>();
+  auto cross_sections_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material);
+  auto quadrature_set_ptr =
+      std::make_shared<quadrature::QuadratureSetMock<dim>>();
+
+  auto source_operators_ptr =
+      this->test_builder_ptr_->BuildSAAFSourceOperators(
+          domain_ptr, finite_element_ptr, cross_sections_ptr,
+          quadrature_set_ptr);
+
+  using ExpectedType = formulation::angular::SAAFSourceOperators<dim>;
+
+  ASSERT_THAT(source_operators_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_FALSE(source_operators_ptr->is_initialized());
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSimplifiedPNFormulationTest) {
+  constexpr int dim = this->dim;
+
+  auto finite_element_ptr =
+      std::make_shared<domain::finite_element::FiniteElementMock<dim>>();
+  auto cross_sections_ptr =
+      std::make_shared<data::CrossSections>(this->mock_material);
+
+  EXPECT_CALL(*finite_element_ptr, dofs_per_cell());
+  EXPECT_CALL(*finite_element_ptr, n_cell_quad_pts());
+  EXPECT_CALL(*finite_element_ptr, n_face_quad_pts());
+
+  auto formulation_ptr = this->test_builder_ptr_->BuildSimplifiedPNFormulation(
+      finite_element_ptr, cross_sections_ptr, 3);
+
+  using ExpectedType = formulation::scalar::SimplifiedPN<dim>;
+
+  ASSERT_THAT(formulation_ptr.get(),
+              WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_EQ(formulation_ptr->n_equations(), 2);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSweepGroupSolver) {
+  constexpr int dim = this->dim;
+  using ExpectedType = solver::group::SweepGroupSolver<dim>;
+
+  auto formulation_ptr =
+      std::make_shared<formulation::angular::UpwindTransportMock<dim>>();
+  auto domain_ptr = std::make_shared<NiceMock<domain::DefinitionMock<dim>>>();
+  ON_CALL(*domain_ptr, discretization_type())
+      .WillByDefault(Return(problem::DiscretizationType::kDiscontinuousFEM));
+
+  auto solver_ptr = this->test_builder_ptr_->BuildSweepGroupSolver(
+      formulation_ptr, domain_ptr, this->quadrature_set_sptr_);
+
+  ASSERT_THAT(solver_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  auto dynamic_ptr = dynamic_cast<ExpectedType*>(solver_ptr.get());
+  EXPECT_EQ(dynamic_ptr->formulation_ptr(), formulation_ptr.get());
+  EXPECT_EQ(dynamic_ptr->domain_ptr(), domain_ptr.get());
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildCartesianStencilGroupSolverBadDomain) {
+  constexpr int dim = this->dim;
+  auto domain_ptr = std::make_shared<NiceMock<domain::DefinitionMock<dim>>>();
+  ON_CALL(*domain_ptr, discretization_type())
+      .WillByDefault(Return(problem::DiscretizationType::kDiscontinuousFEM));
+
+  EXPECT_ANY_THROW({
+    this->test_builder_ptr_->BuildCartesianStencilGroupSolver(
+        domain_ptr, [](formulation::CartesianStencil<dim>&,
+                       const system::Index&) {});
+  });
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildGeometricMultigridPreconditionerBadDomain) {
+  constexpr int dim = this->dim;
+  auto domain_ptr = std::make_shared<NiceMock<domain::DefinitionMock<dim>>>();
+
+  EXPECT_ANY_THROW({
+    this->test_builder_ptr_->BuildGeometricMultigridPreconditioner(
+        domain_ptr, problem::PreconditionerType::kJacobi);
+  });
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest,
+           BuildSymmetricStoragePreconditioner) {
+  dealii::PETScWrappers::SparseMatrix matrix(2, 2, 1);
+  matrix.set(0, 0, 2.0);
+  matrix.set(1, 1, 4.0);
+  matrix.compress(dealii::VectorOperation::insert);
+
+  auto preconditioner_factory =
+      this->test_builder_ptr_->BuildSymmetricStoragePreconditioner();
+  ASSERT_NE(preconditioner_factory, nullptr);
+  auto preconditioner_ptr = preconditioner_factory(matrix);
+  EXPECT_THAT(preconditioner_ptr.get(),
+              WhenDynamicCastTo<dealii::PETScWrappers::PreconditionJacobi*>(
+                  NotNull()));
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildStamper) {
   constexpr int dim = this->dim;
 
@@ -630,6 +1136,47 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildStamper) {
   EXPECT_THAT(stamper_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildStamperWorkspace) {
+  constexpr int dim = this->dim;
+
+  auto domain_ptr = std::make_shared<domain::DefinitionMock<dim>>();
+  auto workspace_ptr = std::make_shared<system::Workspace>(4, 4, 10);
+
+  using ExpectedType = formulation::Stamper<dim>;
+  auto stamper_ptr = this->test_builder_ptr_->BuildStamper(domain_ptr,
+                                                           workspace_ptr);
+
+  ASSERT_THAT(stamper_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  auto dynamic_ptr = dynamic_cast<ExpectedType*>(stamper_ptr.get());
+  EXPECT_EQ(dynamic_ptr->domain_ptr(), domain_ptr.get());
+  EXPECT_EQ(dynamic_ptr->workspace_ptr(), workspace_ptr.get());
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildWorkspace) {
+  constexpr int dim = this->dim;
+  const int cell_dofs = test_helpers::RandomInt(2, 10);
+  const int cell_quadrature_points = test_helpers::RandomInt(2, 10);
+  const int total_dofs = test_helpers::RandomInt(10, 100);
+
+  domain::finite_element::FiniteElementMock<dim> finite_element_mock;
+  domain::DefinitionMock<dim> domain_mock;
+
+  EXPECT_CALL(finite_element_mock, dofs_per_cell())
+      .WillOnce(Return(cell_dofs));
+  EXPECT_CALL(finite_element_mock, n_cell_quad_pts())
+      .WillOnce(Return(cell_quadrature_points));
+  EXPECT_CALL(domain_mock, total_degrees_of_freedom())
+      .WillOnce(Return(total_dofs));
+
+  auto workspace_ptr = this->test_builder_ptr_->BuildWorkspace(
+      finite_element_mock, domain_mock);
+
+  ASSERT_NE(workspace_ptr, nullptr);
+  EXPECT_EQ(workspace_ptr->cell_degrees_of_freedom(), cell_dofs);
+  EXPECT_EQ(workspace_ptr->cell_quadrature_points(), cell_quadrature_points);
+  EXPECT_EQ(workspace_ptr->total_degrees_of_freedom(), total_dofs);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSystem) {
   constexpr int dim = this->dim;
   using VariableLinearTerms = system::terms::VariableLinearTerms;
@@ -671,6 +1218,55 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSystem) {
   }
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSystemSymmetric) {
+  constexpr int dim = this->dim;
+
+  domain::DefinitionMock<dim> mock_domain;
+  const int total_groups = 2, total_angles = 3;
+  const std::size_t solution_size = 10;
+
+  EXPECT_CALL(mock_domain, MakeSymmetricSystemMatrix())
+      .Times(total_angles * total_groups)
+      .WillRepeatedly(Return(std::make_shared<system::MPISparseMatrix>()));
+  EXPECT_CALL(mock_domain, MakeSystemMatrix()).Times(0);
+  EXPECT_CALL(mock_domain, MakeSystemVector())
+      .Times(3*total_angles * total_groups)
+      .WillRepeatedly(Return(std::make_shared<system::MPIVector>()));
+
+  auto system_ptr = this->test_builder_ptr_->BuildSystem(
+      total_groups, total_angles, mock_domain, solution_size, true, false,
+      true);
+
+  ASSERT_NE(system_ptr, nullptr);
+  ASSERT_NE(nullptr, system_ptr->left_hand_side_ptr_);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSystemSinglePrecisionLagged) {
+  constexpr int dim = this->dim;
+
+  domain::DefinitionMock<dim> mock_domain;
+  const int total_groups = 2, total_angles = 3;
+  const std::size_t solution_size = 10;
+
+  EXPECT_CALL(mock_domain, MakeSystemMatrix())
+      .Times(total_angles * total_groups)
+      .WillRepeatedly(Return(std::make_shared<system::MPISparseMatrix>()));
+  EXPECT_CALL(mock_domain, MakeSystemVector())
+      .Times(3*total_angles * total_groups)
+      .WillRepeatedly(Return(std::make_shared<system::MPIVector>()));
+
+  auto system_ptr = this->test_builder_ptr_->BuildSystem(
+      total_groups, total_angles, mock_domain, solution_size, true, false,
+      false, 0, system::StoragePrecision::kSingle);
+
+  ASSERT_NE(system_ptr, nullptr);
+  for (const auto& moment : *system_ptr->current_moments)
+    EXPECT_EQ(moment.second.size(), solution_size);
+  // Lagged moments are stored by the group iteration
+  for (const auto& moment : *system_ptr->previous_moments)
+    EXPECT_EQ(moment.second.size(), 0);
+}
+
 /* ===== Non-dimensional tests =================================================
  * These tests instantiate classes and use depdent classes that do not have a
  * dimension template varaible and therefore only need to be run in a single
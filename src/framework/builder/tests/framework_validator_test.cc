@@ -111,6 +111,28 @@ TEST_F(FrameworkBuilderFrameworkValidatorTest, ParseTestSAAFWithReflective) {
   EXPECT_TRUE(test_validator->Parts().empty());
 }
 
+TEST_F(FrameworkBuilderFrameworkValidatorTest, ParseTestSAAFWithImplicitReflective) {
+  using Boundary = problem::Boundary;
+  EXPECT_FALSE(test_validator->HasNeededParts());
+
+  EXPECT_CALL(mock_parameters, TransportModel())
+      .WillOnce(Return(problem::EquationType::kSelfAdjointAngularFlux));
+  EXPECT_CALL(mock_parameters, ReflectiveBoundary())
+      .WillOnce(Return(std::map<Boundary, bool>{
+          {Boundary::kXMin, true},
+          {Boundary::kXMax, false}}));
+  EXPECT_CALL(mock_parameters, ReflectiveBoundaryTreatment())
+      .WillOnce(Return(problem::ReflectiveBoundaryType::kImplicit));
+
+  test_validator->Parse(mock_parameters);
+
+  EXPECT_TRUE(test_validator->HasNeededParts());
+  EXPECT_THAT(test_validator->NeededParts(),
+              UnorderedElementsAreArray({Part::FissionSourceUpdate,
+                                         Part::ScatteringSourceUpdate}));
+  EXPECT_TRUE(test_validator->Parts().empty());
+}
+
 TEST_F(FrameworkBuilderFrameworkValidatorTest, AddPart) {
   test_validator->Parse(mock_parameters);
   EXPECT_TRUE(test_validator->Parts().empty());
@@ -148,6 +170,44 @@ TEST_F(FrameworkBuilderFrameworkValidatorTest, ReportValidationMissing) {
   test_validator->ReportValidation();
 }
 
+TEST_F(FrameworkBuilderFrameworkValidatorTest, ParseAdaptiveRefinement) {
+  ON_CALL(mock_parameters, AdaptiveRefinementCycles())
+      .WillByDefault(Return(2));
+  EXPECT_NO_THROW(test_validator->Parse(mock_parameters));
+
+  EXPECT_CALL(mock_parameters, DoDiscreteFourierTransformOfError())
+      .WillOnce(Return(true))
+      .WillRepeatedly(Return(false));
+  EXPECT_ANY_THROW(test_validator->Parse(mock_parameters));
+
+  EXPECT_CALL(mock_parameters, DoMeshSequencing())
+      .WillOnce(Return(true))
+      .WillRepeatedly(Return(false));
+  EXPECT_ANY_THROW(test_validator->Parse(mock_parameters));
+
+  EXPECT_CALL(mock_parameters, Preconditioner())
+      .WillOnce(Return(problem::PreconditionerType::kGeometricMultigrid))
+      .WillRepeatedly(Return(problem::PreconditionerType::kAMG));
+  EXPECT_ANY_THROW(test_validator->Parse(mock_parameters));
+
+  EXPECT_CALL(mock_parameters, UseStructuredGridSolver())
+      .WillOnce(Return(true))
+      .WillRepeatedly(Return(false));
+  EXPECT_ANY_THROW(test_validator->Parse(mock_parameters));
+}
+
+TEST_F(FrameworkBuilderFrameworkValidatorTest, ParseNonAdaptiveOptions) {
+  ON_CALL(mock_parameters, DoDiscreteFourierTransformOfError())
+      .WillByDefault(Return(true));
+  ON_CALL(mock_parameters, DoMeshSequencing())
+      .WillByDefault(Return(true));
+  ON_CALL(mock_parameters, Preconditioner())
+      .WillByDefault(Return(problem::PreconditionerType::kGeometricMultigrid));
+  ON_CALL(mock_parameters, UseStructuredGridSolver())
+      .WillByDefault(Return(true));
+  EXPECT_NO_THROW(test_validator->Parse(mock_parameters));
+}
+
 TEST_F(FrameworkBuilderFrameworkValidatorTest, ReportValidationPresent) {
   test_validator->Parse(mock_parameters);
 
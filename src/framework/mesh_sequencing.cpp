@@ -0,0 +1,40 @@
+#include "framework/mesh_sequencing.hpp"
+
+#include "framework/warm_start.hpp"
+
+namespace bart::framework {
+
+template <int dim>
+MeshSequencing<dim>::MeshSequencing(ParametersType parameters)
+    : parameters_(parameters),
+      coarse_tolerance_(parameters.MeshSequencingTolerance()) {
+  AssertThrow(coarse_tolerance_ > 0,
+              dealii::ExcMessage("Error in MeshSequencing constructor, coarse "
+                                 "tolerance must be greater than 0"))
+}
+
+template <int dim>
+std::unique_ptr<FrameworkI> MeshSequencing<dim>::BuildFramework(
+    std::string name) {
+  const int n_levels = parameters_.UniformRefinements();
+  const double fine_tolerance = builder_.convergence_tolerance();
+
+  WarmStart<dim> warm_start(parameters_, builder_);
+  auto framework_ptr = warm_start.BuildFramework(
+      name + ", refinement level", n_levels, 0,
+      [](domain::Definition<dim>& domain,
+         system::moments::MomentsMap& moments) {
+        domain.RefineGlobal(moments); },
+      [this, n_levels, fine_tolerance](const int level) {
+        builder_.SetConvergenceTolerance(level < n_levels ? coarse_tolerance_ :
+                                         fine_tolerance); });
+  level_degrees_of_freedom_ = warm_start.step_degrees_of_freedom();
+  level_k_effective_ = warm_start.step_k_effective();
+  return framework_ptr;
+}
+
+template class MeshSequencing<1>;
+template class MeshSequencing<2>;
+template class MeshSequencing<3>;
+
+} // namespace bart::framework
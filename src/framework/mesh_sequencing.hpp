@@ -0,0 +1,70 @@
+#ifndef BART_SRC_FRAMEWORK_MESH_SEQUENCING_HPP_
+#define BART_SRC_FRAMEWORK_MESH_SEQUENCING_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "framework/builder/framework_builder.hpp"
+#include "framework/framework_i.hpp"
+#include "problem/parameters_i.h"
+
+namespace bart::framework {
+
+/*! \brief Builds a framework warm started from solutions on coarser meshes.
+ *
+ * For a problem with \f$R\f$ uniform refinements, the problem is first solved
+ * on the unrefined mesh and then on each level of refinement up to \f$R - 1\f$,
+ * using the loose mesh sequencing tolerance. After each solve the mesh is
+ * refined once and the flux moments are interpolated onto the refined mesh.
+ * Flux moments and k_effective from each level are the initial guess for the
+ * next (see WarmStart), so most outer iterations are performed on small
+ * meshes.
+ *
+ * The framework returned by BuildFramework is built on the mesh with \f$R\f$
+ * refinements using the default tolerances, and is initialized with the
+ * interpolated solution, but has not been solved.
+ *
+ * \code{.cpp}
+ * framework::MeshSequencing<2> mesh_sequencing(parameters);
+ * auto framework_ptr = mesh_sequencing.BuildFramework("main");
+ * framework_ptr->SolveSystem();
+ * \endcode
+ *
+ * @tparam dim spatial dimension.
+ */
+template <int dim>
+class MeshSequencing {
+ public:
+  using ParametersType = const problem::ParametersI&;
+
+  explicit MeshSequencing(ParametersType parameters);
+
+  /*! \brief Solves the problem on all coarser levels of refinement, and
+   * returns the framework for the finest level.
+   *
+   * @param name name of the framework.
+   */
+  std::unique_ptr<FrameworkI> BuildFramework(std::string name);
+
+  /*! \brief Total degrees of freedom of each coarse level solved. */
+  std::vector<int> level_degrees_of_freedom() const {
+    return level_degrees_of_freedom_; }
+
+  /*! \brief k_effective solved for on each coarse level, for eigenvalue
+   * problems. */
+  std::vector<double> level_k_effective() const { return level_k_effective_; }
+
+  double coarse_tolerance() const { return coarse_tolerance_; }
+
+ private:
+  ParametersType parameters_;
+  builder::FrameworkBuilder<dim> builder_;
+  const double coarse_tolerance_;
+  std::vector<int> level_degrees_of_freedom_{};
+  std::vector<double> level_k_effective_{};
+};
+
+} // namespace bart::framework
+
+#endif //BART_SRC_FRAMEWORK_MESH_SEQUENCING_HPP_
@@ -0,0 +1,36 @@
+#include "framework/warm_start.hpp"
+
+#include "problem/tests/parameters_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock;
+
+template <typename DimensionWrapper>
+class FrameworkWarmStartTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using WarmStart = framework::WarmStart<dim>;
+
+  NiceMock<problem::ParametersMock> mock_parameters;
+  framework::builder::FrameworkBuilder<dim> builder;
+};
+
+TYPED_TEST_SUITE(FrameworkWarmStartTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FrameworkWarmStartTest, BadArguments) {
+  constexpr int dim = this->dim;
+  typename TestFixture::WarmStart warm_start(this->mock_parameters,
+                                             this->builder);
+  auto refine = [](domain::Definition<dim>&, system::moments::MomentsMap&) {};
+
+  EXPECT_ANY_THROW(warm_start.BuildFramework("test", -1, 0, refine));
+  EXPECT_ANY_THROW(warm_start.BuildFramework("test", 1, 0, nullptr));
+  EXPECT_TRUE(warm_start.step_degrees_of_freedom().empty());
+  EXPECT_TRUE(warm_start.step_k_effective().empty());
+}
+
+} // namespace
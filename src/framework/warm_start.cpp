@@ -0,0 +1,79 @@
+#include "framework/warm_start.hpp"
+
+#include <optional>
+
+#include "system/system_functions.h"
+
+namespace bart::framework {
+
+template <int dim>
+WarmStart<dim>::WarmStart(ParametersType parameters,
+                          builder::FrameworkBuilder<dim>& builder)
+    : parameters_(parameters),
+      builder_(builder) {}
+
+template <int dim>
+std::unique_ptr<FrameworkI> WarmStart<dim>::BuildFramework(
+    const std::string& name, const int n_steps, const int initial_refinements,
+    const RefineFunction& refine, const StepFunction& before_step) {
+  AssertThrow(n_steps >= 0,
+              dealii::ExcMessage("Error in WarmStart BuildFramework, number "
+                                 "of steps must be non-negative"))
+  AssertThrow(refine != nullptr,
+              dealii::ExcMessage("Error in WarmStart BuildFramework, refine "
+                                 "function is empty"))
+  step_degrees_of_freedom_.clear();
+  step_k_effective_.clear();
+
+  std::shared_ptr<domain::finite_element::FiniteElementI<dim>>
+      finite_element_ptr = builder_.BuildFiniteElement(parameters_);
+  std::shared_ptr<domain::Definition<dim>> domain_ptr =
+      std::dynamic_pointer_cast<domain::Definition<dim>>(
+          std::shared_ptr<domain::DefinitionI<dim>>(
+              builder_.BuildDomain(parameters_, finite_element_ptr)));
+  AssertThrow(domain_ptr != nullptr,
+              dealii::ExcMessage("Error in WarmStart, domain does not support "
+                                 "refinement"))
+  domain_ptr->SetUpMesh(initial_refinements).SetUpDOF();
+
+  std::unique_ptr<FrameworkI> framework_ptr = nullptr;
+  system::moments::MomentsMap moments;
+  std::optional<double> k_effective = std::nullopt;
+
+  for (int step = 0; step <= n_steps; ++step) {
+    if (step > 0) {
+      const auto& system = *framework_ptr->system();
+      moments = system.current_moments->moments();
+      k_effective = system.k_effective;
+      // Matrices and cell iterators of the previous framework are invalidated
+      // by changing the mesh
+      framework_ptr.reset();
+      refine(*domain_ptr, moments);
+    }
+
+    if (before_step)
+      before_step(step);
+    framework_ptr = builder_.BuildFramework(
+        name + " " + std::to_string(step), parameters_, finite_element_ptr,
+        domain_ptr);
+    if (step > 0)
+      system::SetInitialSolution(*framework_ptr->system(), moments, k_effective);
+
+    if (step < n_steps) {
+      framework_ptr->SolveSystem();
+      step_degrees_of_freedom_.push_back(
+          domain_ptr->total_degrees_of_freedom());
+      if (framework_ptr->system()->k_effective.has_value())
+        step_k_effective_.push_back(
+            framework_ptr->system()->k_effective.value());
+    }
+  }
+
+  return framework_ptr;
+}
+
+template class WarmStart<1>;
+template class WarmStart<2>;
+template class WarmStart<3>;
+
+} // namespace bart::framework
@@ -0,0 +1,77 @@
+#ifndef BART_SRC_FRAMEWORK_WARM_START_HPP_
+#define BART_SRC_FRAMEWORK_WARM_START_HPP_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "domain/definition.h"
+#include "framework/builder/framework_builder.hpp"
+#include "framework/framework_i.hpp"
+#include "problem/parameters_i.h"
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart::framework {
+
+/*! \brief Solves a problem on a sequence of meshes, each warm started from
+ * the solution on the previous mesh.
+ *
+ * The problem is solved on the initial mesh, then the mesh is changed by a
+ * refine function that also interpolates the flux moments onto the new mesh.
+ * The problem on the new mesh starts from the interpolated moments and the
+ * previous k_effective. This is repeated for each step.
+ *
+ * The framework returned by BuildFramework is built on the mesh of the final
+ * step and is initialized with the interpolated solution, but has not been
+ * solved. This is used by AdaptiveRefinement and MeshSequencing.
+ *
+ * @tparam dim spatial dimension.
+ */
+template <int dim>
+class WarmStart {
+ public:
+  using ParametersType = const problem::ParametersI&;
+  /*! \brief Changes the mesh after a solve, interpolating the given moments
+   * onto the new mesh. */
+  using RefineFunction = std::function<void(domain::Definition<dim>&,
+                                            system::moments::MomentsMap&)>;
+  //! Called with the step number before the framework of each step is built
+  using StepFunction = std::function<void(const int)>;
+
+  WarmStart(ParametersType parameters, builder::FrameworkBuilder<dim>& builder);
+
+  /*! \brief Solves the problem for all steps before the final step, and
+   * returns the framework for the final step.
+   *
+   * @param name name of the framework, the step number is appended.
+   * @param n_steps number of mesh changes, frameworks are built for steps
+   *        \f$0\f$ to n_steps.
+   * @param initial_refinements uniform refinements of the initial mesh.
+   * @param refine function that changes the mesh between steps.
+   * @param before_step optional function called before each step is built.
+   */
+  std::unique_ptr<FrameworkI> BuildFramework(
+      const std::string& name, const int n_steps,
+      const int initial_refinements, const RefineFunction& refine,
+      const StepFunction& before_step = nullptr);
+
+  /*! \brief Total degrees of freedom of the mesh solved in each step before
+   * the final step. */
+  std::vector<int> step_degrees_of_freedom() const {
+    return step_degrees_of_freedom_; }
+
+  /*! \brief k_effective solved for in each step before the final step, for
+   * eigenvalue problems. */
+  std::vector<double> step_k_effective() const { return step_k_effective_; }
+
+ private:
+  ParametersType parameters_;
+  builder::FrameworkBuilder<dim>& builder_;
+  std::vector<int> step_degrees_of_freedom_{};
+  std::vector<double> step_k_effective_{};
+};
+
+} // namespace bart::framework
+
+#endif //BART_SRC_FRAMEWORK_WARM_START_HPP_
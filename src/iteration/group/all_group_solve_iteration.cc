@@ -0,0 +1,186 @@
+#include "iteration/group/all_group_solve_iteration.h"
+
+#include <string>
+#include <vector>
+
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/solver_gmres.h>
+
+#include "system/moments/moment_functions.h"
+#include "system/system.h"
+
+namespace bart {
+
+namespace iteration {
+
+namespace group {
+
+namespace {
+
+using BlockVector = dealii::PETScWrappers::MPI::BlockVector;
+
+/* Linear operator for the multigroup system. The diagonal blocks are the full
+ * left hand side for each group, the off-diagonal blocks are the group
+ * coupling terms. */
+class MultigroupOperator {
+ public:
+  struct CouplingBlock {
+    int row_block;
+    int column_block;
+    std::shared_ptr<system::MPISparseMatrix> matrix_ptr;
+  };
+
+  void vmult(BlockVector& dst, const BlockVector& src) const {
+    for (unsigned int block = 0; block < diagonal_blocks.size(); ++block)
+      diagonal_blocks.at(block)->vmult(dst.block(block), src.block(block));
+    for (const auto& coupling : coupling_blocks)
+      coupling.matrix_ptr->vmult_add(dst.block(coupling.row_block),
+                                     src.block(coupling.column_block));
+  }
+
+  std::vector<std::shared_ptr<system::MPISparseMatrix>> diagonal_blocks{};
+  std::vector<CouplingBlock> coupling_blocks{};
+};
+
+/* Block diagonal preconditioner, applies a preconditioner of each diagonal
+ * block of the multigroup operator. */
+class BlockDiagonalPreconditioner {
+ public:
+  void vmult(BlockVector& dst, const BlockVector& src) const {
+    for (unsigned int block = 0; block < block_preconditioners.size(); ++block)
+      block_preconditioners.at(block)->vmult(dst.block(block), src.block(block));
+  }
+
+  std::vector<std::unique_ptr<dealii::PETScWrappers::PreconditionJacobi>>
+      block_preconditioners{};
+};
+
+} // namespace
+
+template <int dim>
+AllGroupSolveIteration<dim>::AllGroupSolveIteration(
+    const std::shared_ptr<GroupSolution>& group_solution_ptr,
+    const int max_iterations,
+    const double convergence_tolerance)
+    : group_solution_ptr_(group_solution_ptr),
+      solver_control_(max_iterations, convergence_tolerance) {
+  AssertThrow(group_solution_ptr_ != nullptr,
+              dealii::ExcMessage("Group solution pointer passed to "
+                                 "AllGroupSolveIteration constructor is null"))
+  AssertThrow(max_iterations > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "AllGroupSolveIteration, max iterations must "
+                                 "be greater than 0"))
+  AssertThrow(convergence_tolerance > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "AllGroupSolveIteration, convergence "
+                                 "tolerance must be greater than 0"))
+  this->set_description("All group block solve iteration",
+                        utility::DefaultImplementation(true));
+}
+
+template <int dim>
+void AllGroupSolveIteration<dim>::Iterate(system::System &system) {
+  using VariableLinearTerms = system::terms::VariableLinearTerms;
+  const int total_groups = system.total_groups;
+  AssertThrow(system.total_angles == 1,
+              dealii::ExcMessage("Error in AllGroupSolveIteration::Iterate, "
+                                 "only systems with a single angle can be "
+                                 "solved as a multigroup block system"))
+
+  data_ports::StatusPort::Expose("..All group block solve\n");
+
+  const auto& layout = (*group_solution_ptr_)[0];
+  const bool is_initial_guess_set =
+      static_cast<int>(solution_.n_blocks()) == total_groups;
+  if (!is_initial_guess_set)
+    solution_.reinit(total_groups);
+
+  MultigroupOperator multigroup_operator;
+  BlockDiagonalPreconditioner preconditioner;
+  BlockVector right_hand_side;
+  right_hand_side.reinit(total_groups);
+
+  for (int group = 0; group < total_groups; ++group) {
+    system::Index index{group, 0};
+    auto left_hand_side_ptr = system.left_hand_side_ptr_->GetFullTermPtr(index);
+    multigroup_operator.diagonal_blocks.push_back(left_hand_side_ptr);
+    preconditioner.block_preconditioners.push_back(
+        std::make_unique<dealii::PETScWrappers::PreconditionJacobi>(
+            *left_hand_side_ptr));
+
+    // The scattering source is included in the block system
+    auto& group_right_hand_side = right_hand_side.block(group);
+    group_right_hand_side.reinit(layout, true);
+    group_right_hand_side = *system.right_hand_side_ptr_->GetFixedTermPtr(index);
+    for (const auto term : system.right_hand_side_ptr_->GetVariableTerms()) {
+      if (term != VariableLinearTerms::kScatteringSource)
+        group_right_hand_side.add(
+            1, *system.right_hand_side_ptr_->GetVariableTermPtr(index, term));
+    }
+
+    if (!is_initial_guess_set) {
+      solution_.block(group).reinit(layout, true);
+      solution_.block(group) = layout;
+    }
+  }
+  solution_.collect_sizes();
+  right_hand_side.collect_sizes();
+
+  for (const auto& [coupling_index, coupling_matrix_ptr] :
+      system.group_coupling_terms) {
+    const auto [group, source_group] = coupling_index;
+    AssertThrow(group >= 0 && group < total_groups &&
+                source_group >= 0 && source_group < total_groups,
+                dealii::ExcMessage("Error in AllGroupSolveIteration, group "
+                                   "coupling term index is not a valid group"))
+    multigroup_operator.coupling_blocks.push_back(
+        {group, source_group, coupling_matrix_ptr});
+  }
+
+  dealii::SolverGMRES<BlockVector> solver(solver_control_);
+  try {
+    solver.solve(multigroup_operator, solution_, right_hand_side,
+                 preconditioner);
+  } catch (dealii::SolverControl::NoConvergence& exception) {
+    ExposeSolverStatus();
+    data_ports::StatusPort::Expose(
+        "..All group block solve did not converge after " +
+        std::to_string(exception.last_step) + " GMRES iterations, residual: " +
+        std::to_string(exception.last_residual) + "\n");
+    throw;
+  }
+  ExposeSolverStatus();
+
+  if (domain_ptr_ != nullptr) {
+    for (int group = 0; group < total_groups; ++group)
+      domain_ptr_->constraints().distribute(solution_.block(group));
+  }
+
+  for (int group = 0; group < total_groups; ++group) {
+    system::moments::SwapGroupMoments(*system.current_moments,
+                                      *system.previous_moments, group);
+    (*system.current_moments)[{group, 0, 0}] = solution_.block(group);
+  }
+}
+
+template <int dim>
+void AllGroupSolveIteration<dim>::ExposeSolverStatus() {
+  convergence::Status convergence_status;
+  convergence_status.iteration_number = solver_control_.last_step();
+  convergence_status.max_iterations = solver_control_.max_steps();
+  convergence_status.is_complete =
+      solver_control_.last_check() == dealii::SolverControl::success;
+  convergence_status.delta = solver_control_.last_value();
+  data_ports::ConvergenceStatusPort::Expose(convergence_status);
+}
+
+template class AllGroupSolveIteration<1>;
+template class AllGroupSolveIteration<2>;
+template class AllGroupSolveIteration<3>;
+
+} // namespace group
+
+} // namespace iteration
+
+} // namespace bart
@@ -0,0 +1,100 @@
+#ifndef BART_SRC_ITERATION_GROUP_ALL_GROUP_SOLVE_ITERATION_H_
+#define BART_SRC_ITERATION_GROUP_ALL_GROUP_SOLVE_ITERATION_H_
+
+#include <memory>
+
+#include <deal.II/lac/petsc_block_vector.h>
+#include <deal.II/lac/solver_control.h>
+
+#include "domain/definition_i.h"
+#include "iteration/group/group_solve_iteration.h"
+#include "iteration/group/group_solve_iteration_i.h"
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace iteration {
+
+namespace group {
+
+/*! \brief Solves all energy groups simultaneously as a single block system.
+ *
+ * Instead of Gauss-Seidel iteration over the groups, the within-group left
+ * hand sides are the diagonal blocks of a multigroup system, and the
+ * scattering transfer matrices in System::group_coupling_terms are the
+ * off-diagonal blocks. The block system is solved with GMRES, preconditioned
+ * by a Jacobi preconditioner of each diagonal block, so no multigroup
+ * iteration (and no scattering source update) is required.
+ *
+ * The right hand side of each group is the fixed term and all variable terms
+ * other than the scattering source, which is included in the block system.
+ * Only scalar formulations (a single angle) are supported, as the scattering
+ * transfer couples groups through the scalar flux. The solution is kept as the
+ * initial guess for the next call, and the scalar flux of each group is stored
+ * in the current moments, the previous moments hold the values at the start of
+ * the call.
+ *
+ * After each block solve, the GMRES iteration count and final residual are
+ * exposed through the convergence status port. If GMRES does not converge, the
+ * iteration count and residual are also reported through the status port
+ * before the exception is rethrown.
+ */
+template <int dim>
+class AllGroupSolveIteration : public GroupSolveIterationI,
+                               public data_ports::ConvergenceStatusPort,
+                               public data_ports::StatusPort {
+ public:
+  using GroupSolution = system::solution::MPIGroupAngularSolutionI;
+  using data_ports::ConvergenceStatusPort::Expose, data_ports::ConvergenceStatusPort::AddInstrument;
+  using data_ports::StatusPort::Expose, data_ports::StatusPort::AddInstrument;
+
+  /*! \brief Constructor.
+   *
+   * @param group_solution_ptr group solution, used for the parallel layout of
+   *        each group block.
+   * @param max_iterations maximum GMRES iterations for the block system.
+   * @param convergence_tolerance GMRES convergence tolerance.
+   */
+  AllGroupSolveIteration(const std::shared_ptr<GroupSolution>& group_solution_ptr,
+                         const int max_iterations = 1000,
+                         const double convergence_tolerance = 1e-10);
+  virtual ~AllGroupSolveIteration() = default;
+
+  /*! \brief Distributes the constraints of a domain, such as hanging node
+   * constraints, to the solution of each group after the block solve. */
+  AllGroupSolveIteration& SetDomain(
+      const std::shared_ptr<domain::DefinitionI<dim>>& domain_ptr) {
+    AssertThrow(domain_ptr != nullptr,
+                dealii::ExcMessage("Domain pointer passed to all group solve "
+                                   "iteration is null"))
+    domain_ptr_ = domain_ptr;
+    return *this;
+  }
+
+  void Iterate(system::System &system) override;
+
+  std::shared_ptr<GroupSolution> group_solution_ptr() const {
+    return group_solution_ptr_; }
+  int max_iterations() const { return solver_control_.max_steps(); }
+  double convergence_tolerance() const { return solver_control_.tolerance(); }
+  const dealii::SolverControl& solver_control() const {
+    return solver_control_; }
+  domain::DefinitionI<dim>* domain_ptr() const { return domain_ptr_.get(); }
+
+ protected:
+  //! Exposes the iteration count and residual of the last block solve
+  void ExposeSolverStatus();
+  std::shared_ptr<GroupSolution> group_solution_ptr_ = nullptr;
+  std::shared_ptr<domain::DefinitionI<dim>> domain_ptr_ = nullptr;
+  dealii::SolverControl solver_control_;
+  //! Solution of the last block solve, used as the next initial guess
+  dealii::PETScWrappers::MPI::BlockVector solution_;
+};
+
+} // namespace group
+
+} // namespace iteration
+
+} // namespace bart
+
+#endif //BART_SRC_ITERATION_GROUP_ALL_GROUP_SOLVE_ITERATION_H_
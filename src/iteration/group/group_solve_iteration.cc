@@ -1,5 +1,11 @@
 #include "iteration/group/group_solve_iteration.h"
 
+#include <limits>
+
+#include <deal.II/base/mpi.h>
+
+#include "system/moments/moment_functions.h"
+
 namespace bart {
 
 namespace iteration {
@@ -33,90 +39,195 @@ GroupSolveIteration<dim>::GroupSolveIteration(
                                  "GroupSolveIteration constructor is null"));
 }
 
+template <int dim>
+GroupSolveIteration<dim>& GroupSolveIteration<dim>::StoreLaggedMomentsInSinglePrecision(
+    std::unique_ptr<SinglePrecisionMomentMapConvergenceChecker>
+        convergence_checker_ptr) {
+  AssertThrow(convergence_checker_ptr != nullptr,
+              dealii::ExcMessage("Single precision convergence checker "
+                                 "pointer passed to group solve iteration is "
+                                 "null"));
+  single_precision_convergence_checker_ptr_ = std::move(convergence_checker_ptr);
+  return *this;
+}
+
 template<int dim>
 void GroupSolveIteration<dim>::Iterate(system::System &system) {
 
   const int total_groups = system.total_groups;
   const int total_angles = system.total_angles;
-  system::moments::MomentVector current_scalar_flux, previous_scalar_flux;
-  system::moments::MomentsMap previous_moments_map;
-
-  for (int group = 0; group < total_groups; ++group) {
-    auto& current_moments = *system.current_moments;
-    auto& previous_moments = *system.previous_moments;
-    const int max_harmonic_l = current_moments.max_harmonic_l();
-    for (int l = 0; l <= max_harmonic_l; ++l) {
-      for (int m = -l; m <= l; ++m) {
-        previous_moments[{group, l, m}] = current_moments[{group, l, m}];
-      }
-    }
-  }
-  data_ports::StatusPort::Expose("..Inner group iteration\n");
-  moment_map_convergence_checker_ptr_->Reset();
+  system::moments::MomentVector owned_current_scalar_flux,
+      owned_previous_scalar_flux;
+  auto& current_scalar_flux = workspace_ptr_ == nullptr ?
+      owned_current_scalar_flux : workspace_ptr_->current_scalar_flux();
+  auto& previous_scalar_flux = workspace_ptr_ == nullptr ?
+      owned_previous_scalar_flux : workspace_ptr_->previous_scalar_flux();
+
+  // Status messages are only made if they are read by an instrument
+  const bool is_reporting_status =
+      data_ports::StatusPort::instrument_ptr() != nullptr;
+  if (is_reporting_status)
+    data_ports::StatusPort::Expose("..Inner group iteration\n");
+  const bool is_lagged_single_precision =
+      single_precision_convergence_checker_ptr_ != nullptr;
+  if (is_lagged_single_precision) {
+    // Storage is only allocated if the shape of the moments has changed
+    lagged_moments_.reinit(total_groups,
+                           system.current_moments->max_harmonic_l(),
+                           (*system.current_moments)[{0, 0, 0}].size());
+    single_precision_convergence_checker_ptr_->Reset();
+  } else
+    moment_map_convergence_checker_ptr_->Reset();
   convergence::Status all_group_convergence_status;
   all_group_convergence_status.is_complete = true;
+  int skipped_group_solves = 0;
+
+  // The sources may have changed since the last call, every group must be
+  // solved on the first sweep.
+  if (is_skipping_converged_groups_) {
+    group_flux_change_.assign(total_groups, std::numeric_limits<double>::max());
+    group_incoming_change_.assign(total_groups, 0);
+    group_sweeps_skipped_.assign(total_groups, 0);
+  }
+
+  /* The previous moments hold the moments at the start of each sweep. They are
+   * double buffered with the current moments: the storage of a group's
+   * moments is swapped the first time they are updated in a sweep, instead of
+   * copying all moments at the start of each sweep. If lagged moments are
+   * stored in single precision they are converted instead. */
   do {
     for (int group = 0; group < total_groups; ++group) {
-      const auto& current_moments = *system.current_moments;
-      const int max_harmonic_l = current_moments.max_harmonic_l();
-      for (int l = 0; l <= max_harmonic_l; ++l) {
-        for (int m = -l; m <= l; ++m) {
-          previous_moments_map[{group, l, m}] = current_moments[{group, l, m}];
-        }
+      if (is_skipping_converged_groups_ && IsGroupConverged(group)) {
+        StorePreviousMoments(system, group, false);
+        ++group_sweeps_skipped_.at(group);
+        ++skipped_group_solves;
+        continue;
       }
-    }
-    for (int group = 0; group < total_groups; ++group) {
+
       PerformPerGroup(system, group);
 
       convergence::Status convergence_status;
       convergence_checker_ptr_->Reset();
+      bool is_previous_moment_stored = false;
       do {
         if (!convergence_status.is_complete) {
           for (int angle = 0; angle < total_angles; ++angle)
             UpdateSystem(system, group, angle);
         }
 
-        previous_scalar_flux = current_scalar_flux;
+        // The scalar fluxes are double buffered, the previous flux storage is
+        // reused for the new current flux
+        previous_scalar_flux.swap(current_scalar_flux);
 
         SolveGroup(group, system);
 
-        current_scalar_flux = GetScalarFlux(group, system);
+        GetScalarFlux(current_scalar_flux, group, system);
 
-        if (convergence_status.iteration_number == 0) {
-          previous_scalar_flux = current_scalar_flux;
-          previous_scalar_flux = 0;
-        }
+        if (convergence_status.iteration_number == 0)
+          previous_scalar_flux.reinit(current_scalar_flux);
 
         convergence_status = CheckConvergence(current_scalar_flux,
                                               previous_scalar_flux);
 
         data_ports::ConvergenceStatusPort::Expose(convergence_status);
+        if (!is_previous_moment_stored) {
+          StorePreviousMoments(system, group, true);
+          is_previous_moment_stored = true;
+        }
         UpdateCurrentMoments(system, group);
       } while (!convergence_status.is_complete);
 
       if (is_storing_angular_solution_)
         StoreAngularSolution(system, group);
+
+      if (is_skipping_converged_groups_)
+        UpdateGroupChange(system, group);
     }
-    if (moment_map_convergence_checker_ptr_ != nullptr) {
-      all_group_convergence_status =
+    if (is_lagged_single_precision ||
+        moment_map_convergence_checker_ptr_ != nullptr) {
+      all_group_convergence_status = is_lagged_single_precision ?
+          single_precision_convergence_checker_ptr_->CheckFinalConvergence(
+              system.current_moments->moments(), lagged_moments_) :
           moment_map_convergence_checker_ptr_->CheckFinalConvergence(
-              system.current_moments->moments(), previous_moments_map);
-      data_ports::StatusPort::Expose("....All group convergence: ");
+              system.current_moments->moments(),
+              system.previous_moments->moments());
+      if (is_skipping_converged_groups_)
+        all_group_convergence_status.skipped_solves = skipped_group_solves;
+      if (is_reporting_status)
+        data_ports::StatusPort::Expose("....All group convergence: ");
       data_ports::ConvergenceStatusPort::Expose(all_group_convergence_status);
     }
   } while(!all_group_convergence_status.is_complete);
 }
 
+template <int dim>
+bool GroupSolveIteration<dim>::IsGroupConverged(const int group) const {
+  return group_flux_change_.at(group) < group_skip_tolerance_ &&
+      group_incoming_change_.at(group) < group_skip_tolerance_ &&
+      group_sweeps_skipped_.at(group) < group_recheck_interval_;
+}
+
+template <int dim>
+void GroupSolveIteration<dim>::UpdateGroupChange(
+    const system::System& system, const int group) {
+  const system::moments::MomentIndex index{group, 0, 0};
+  const auto& current_flux = (*system.current_moments)[index];
+
+  double change = single_precision_convergence_checker_ptr_ != nullptr ?
+      system::moments::L1NormOfDifference(current_flux,
+                                          lagged_moments_[index]) :
+      system::moments::L1NormOfDifference(current_flux,
+                                          (*system.previous_moments)[index]);
+  if (const double norm = current_flux.l1_norm(); norm > 0)
+    change /= norm;
+
+  // The scattering coupling between groups is not known here, so all other
+  // groups are assumed to be sourced by this group.
+  for (int other_group = 0; other_group < system.total_groups; ++other_group) {
+    if (other_group != group)
+      group_incoming_change_.at(other_group) += change;
+  }
+  group_flux_change_.at(group) = change;
+  group_incoming_change_.at(group) = 0;
+  group_sweeps_skipped_.at(group) = 0;
+}
+
+template <int dim>
+void GroupSolveIteration<dim>::StorePreviousMoments(
+    system::System& system, const int group, const bool is_current_overwritten) {
+  if (single_precision_convergence_checker_ptr_ != nullptr) {
+    system::moments::StoreGroupMoments(*system.current_moments,
+                                       lagged_moments_, group);
+  } else if (is_current_overwritten) {
+    system::moments::SwapGroupMoments(*system.current_moments,
+                                      *system.previous_moments, group);
+  } else {
+    system::moments::CopyGroupMoments(*system.current_moments,
+                                      *system.previous_moments, group);
+  }
+}
+
 template <int dim>
 void GroupSolveIteration<dim>::SolveGroup(int group, system::System &system) {
   group_solver_ptr_->SolveGroup(group, system, *group_solution_ptr_);
+  if (domain_ptr_ != nullptr) {
+    // Solutions are only copied if any process has constrained dofs
+    const auto& constraints = domain_ptr_->constraints();
+    const int total_constraints = dealii::Utilities::MPI::sum(
+        static_cast<int>(constraints.n_constraints()), MPI_COMM_WORLD);
+    if (total_constraints > 0) {
+      for (int angle = 0; angle < group_solution_ptr_->total_angles(); ++angle)
+        constraints.distribute((*group_solution_ptr_)[angle]);
+    }
+  }
 }
 
 template <int dim>
-system::moments::MomentVector GroupSolveIteration<dim>::GetScalarFlux(
+void GroupSolveIteration<dim>::GetScalarFlux(
+    system::moments::MomentVector& to_fill,
     const int group, system::System &) {
-  return moment_calculator_ptr_->CalculateMoment(group_solution_ptr_.get(),
-                                                 group, 0, 0);
+  moment_calculator_ptr_->CalculateMoment(to_fill, group_solution_ptr_.get(),
+                                          group, 0, 0);
 }
 
 template <int dim>
@@ -136,8 +247,9 @@ void GroupSolveIteration<dim>::UpdateCurrentMoments(system::System &system,
 
   for (int l = 0; l <= max_harmonic_l; ++l) {
     for (int m = -l; m <= l; ++m) {
-      current_moments[{group, l, m}] = moment_calculator_ptr_->CalculateMoment(
-          group_solution_ptr_.get(), group, l, m);
+      moment_calculator_ptr_->CalculateMoment(current_moments[{group, l, m}],
+                                              group_solution_ptr_.get(),
+                                              group, l, m);
     }
   }
 }
@@ -145,6 +257,8 @@ void GroupSolveIteration<dim>::UpdateCurrentMoments(system::System &system,
 template<int dim>
 void GroupSolveIteration<dim>::PerformPerGroup(system::System &/*system*/,
                                                const int group) {
+  if (data_ports::StatusPort::instrument_ptr() == nullptr)
+    return;
   std::string report{"....Group: "};
   report += std::to_string(group);
   report += "\n";
@@ -154,10 +268,9 @@ template<int dim>
 void GroupSolveIteration<dim>::StoreAngularSolution(system::System& system,
                                                     const int group) {
   for (int angle = 0; angle < system.total_angles; ++angle) {
-    auto& stored_solution = angular_solution_ptr_map_.at(
-        system::SolutionIndex(group, angle));
-    auto& current_solution = group_solution_ptr_->GetSolution(angle);
-    *stored_solution = current_solution;
+    boundary_angular_solution_ptr_->Store(
+        system::SolutionIndex(group, angle),
+        group_solution_ptr_->GetSolution(angle));
   }
 }
 
@@ -2,15 +2,19 @@
 #define BART_SRC_ITERATION_GROUP_GROUP_SOLVE_ITERATION_H_
 
 #include "convergence/final_i.h"
+#include "domain/definition_i.h"
 #include "instrumentation/port.h"
 #include "iteration/group/group_solve_iteration_i.h"
 #include "quadrature/calculators/spherical_harmonic_moments_i.h"
+#include "system/moments/moment_block.h"
 #include "system/solution/mpi_group_angular_solution_i.h"
 
 #include <memory>
+#include <vector>
 
 #include "solver/group/single_group_solver_i.h"
-#include "system/solution/solution_types.h"
+#include "system/solution/boundary_angular_solution.h"
+#include "system/workspace.h"
 
 namespace bart {
 
@@ -34,9 +38,12 @@ class GroupSolveIteration
   using GroupSolver = solver::group::SingleGroupSolverI;
   using ConvergenceChecker = convergence::FinalI<system::moments::MomentVector>;
   using MomentMapConvergenceChecker = convergence::FinalI<const system::moments::MomentsMap>;
+  using SinglePrecisionMomentMapConvergenceChecker = convergence::FinalI<
+      const system::moments::MomentsMap,
+      const system::moments::SinglePrecisionMoments>;
   using MomentCalculator = quadrature::calculators::SphericalHarmonicMomentsI;
   using GroupSolution = system::solution::MPIGroupAngularSolutionI;
-  using EnergyGroupToAngularSolutionPtrMap = system::solution::EnergyGroupToAngularSolutionPtrMap;
+  using BoundaryAngularSolution = system::solution::BoundaryAngularSolution;
 
   // Data ports
   using data_ports::ConvergenceStatusPort::Expose, data_ports::ConvergenceStatusPort::AddInstrument;
@@ -49,10 +56,77 @@ class GroupSolveIteration
       const std::shared_ptr<GroupSolution> &group_solution_ptr,
       std::unique_ptr<MomentMapConvergenceChecker> moment_map_convergence_checker_ptr = nullptr);
 
-  GroupSolveIteration& UpdateThisAngularSolutionMap(
-      EnergyGroupToAngularSolutionPtrMap& to_update) {
+  /*! \brief Stores angular solutions at reflective boundary degrees of
+   * freedom after each group is solved. */
+  GroupSolveIteration& UpdateThisBoundaryAngularSolution(
+      const std::shared_ptr<BoundaryAngularSolution>& to_update) {
+    AssertThrow(to_update != nullptr,
+                dealii::ExcMessage("Boundary angular solution pointer passed "
+                                   "to group solve iteration is null"));
     is_storing_angular_solution_ = true;
-    angular_solution_ptr_map_ = to_update;
+    boundary_angular_solution_ptr_ = to_update;
+    return *this;
+  }
+
+  /*! \brief Enables skipping of groups that are already converged.
+   *
+   * During an all-group sweep, a group is not re-solved if the change in its
+   * scalar flux on its last solve and the accumulated change of all other
+   * group fluxes since then (a conservative bound on the change of its
+   * incoming scattering source) are both below the tolerance. A group is
+   * always re-solved after it has been skipped for the given number of
+   * consecutive sweeps.
+   *
+   * \param tolerance maximum relative L1 change to consider a group converged.
+   * \param recheck_interval maximum number of consecutive sweeps a group can
+   * be skipped.
+   */
+  GroupSolveIteration& SkipConvergedGroups(const double tolerance,
+                                           const int recheck_interval = 10) {
+    AssertThrow(tolerance > 0,
+                dealii::ExcMessage("Group skipping tolerance must be greater "
+                                   "than zero"));
+    AssertThrow(recheck_interval > 0,
+                dealii::ExcMessage("Group skipping re-check interval must be "
+                                   "greater than zero"));
+    is_skipping_converged_groups_ = true;
+    group_skip_tolerance_ = tolerance;
+    group_recheck_interval_ = recheck_interval;
+    return *this;
+  }
+
+  /*! \brief Stores the moments at the start of each all-group sweep in single
+   * precision.
+   *
+   * The lagged moments replace the system previous moments, which are not
+   * read or written, so they do not need to be allocated. The lagged moments
+   * are stored in one contiguous block, sized at the start of each call to
+   * Iterate. Differences to the lagged moments are accumulated in double
+   * precision.
+   *
+   * \param convergence_checker_ptr checker used for all-group convergence in
+   * place of the moment map convergence checker.
+   */
+  GroupSolveIteration& StoreLaggedMomentsInSinglePrecision(
+      std::unique_ptr<SinglePrecisionMomentMapConvergenceChecker>
+          convergence_checker_ptr);
+
+  /*! \brief Uses the scalar flux buffers of a workspace instead of making
+   * them on each call to Iterate. */
+  GroupSolveIteration& SetWorkspace(
+      const std::shared_ptr<system::Workspace>& workspace_ptr) {
+    workspace_ptr_ = workspace_ptr;
+    return *this;
+  }
+
+  /*! \brief Distributes the constraints of a domain, such as hanging node
+   * constraints, to the angular solutions of each group after it is solved. */
+  GroupSolveIteration& SetDomain(
+      const std::shared_ptr<domain::DefinitionI<dim>>& domain_ptr) {
+    AssertThrow(domain_ptr != nullptr,
+                dealii::ExcMessage("Domain pointer passed to group solve "
+                                   "iteration is null"));
+    domain_ptr_ = domain_ptr;
     return *this;
   }
 
@@ -64,8 +138,8 @@ class GroupSolveIteration
     return is_storing_angular_solution_;
   }
 
-  EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map() const {
-    return angular_solution_ptr_map_;
+  std::shared_ptr<BoundaryAngularSolution> boundary_angular_solution_ptr() const {
+    return boundary_angular_solution_ptr_;
   }
 
   GroupSolver* group_solver_ptr() const {
@@ -80,26 +154,62 @@ class GroupSolveIteration
     return moment_calculator_ptr_.get();
   }
 
+  bool is_skipping_converged_groups() const {
+    return is_skipping_converged_groups_;
+  }
+
+  double group_skip_tolerance() const { return group_skip_tolerance_; }
+
+  int group_recheck_interval() const { return group_recheck_interval_; }
+
   MomentMapConvergenceChecker* moment_map_convergence_checker_ptr() const {
     return moment_map_convergence_checker_ptr_.get();
   }
 
+  bool is_storing_lagged_moments_in_single_precision() const {
+    return single_precision_convergence_checker_ptr_ != nullptr;
+  }
+
+  SinglePrecisionMomentMapConvergenceChecker*
+  single_precision_convergence_checker_ptr() const {
+    return single_precision_convergence_checker_ptr_.get();
+  }
+
+  const system::moments::SinglePrecisionMoments& lagged_moments() const {
+    return lagged_moments_;
+  }
+
   std::shared_ptr<GroupSolution> group_solution_ptr() const {
     return group_solution_ptr_;
   }
 
+  system::Workspace* workspace_ptr() const { return workspace_ptr_.get(); }
+
+  domain::DefinitionI<dim>* domain_ptr() const { return domain_ptr_.get(); }
+
  protected:
   virtual void PerformPerGroup(system::System& system, const int group);
   virtual void SolveGroup(const int group, system::System &system);
   virtual void StoreAngularSolution(system::System& system, const int group);
-  virtual system::moments::MomentVector GetScalarFlux(const int group,
-                                                      system::System& system);
+  /*! \brief Fills a moment vector with the scalar flux of a group. */
+  virtual void GetScalarFlux(system::moments::MomentVector& to_fill,
+                             const int group,
+                             system::System& system);
   virtual convergence::Status CheckConvergence(
       system::moments::MomentVector& current_iteration,
       system::moments::MomentVector& previous_iteration);
   virtual void UpdateSystem(system::System& system, const int group,
                             const int angle) = 0;
   virtual void UpdateCurrentMoments(system::System &system, const int group);
+  /*! \brief Returns true if the group can be skipped in the current sweep. */
+  bool IsGroupConverged(const int group) const;
+  /*! \brief Records the change in the group flux after it has been solved. */
+  void UpdateGroupChange(const system::System& system, const int group);
+  /*! \brief Saves the moments of a group at the start of a sweep, before they
+   * are updated. The system previous moments are swapped with the current
+   * moments if the current moments will be overwritten, or copied if not. */
+  void StorePreviousMoments(system::System& system, const int group,
+                            const bool is_current_overwritten);
 
   std::unique_ptr<GroupSolver> group_solver_ptr_ = nullptr;
   std::unique_ptr<ConvergenceChecker> convergence_checker_ptr_ = nullptr;
@@ -108,7 +218,23 @@ class GroupSolveIteration
   std::unique_ptr<MomentMapConvergenceChecker>
       moment_map_convergence_checker_ptr_ = nullptr;
   bool is_storing_angular_solution_ = false;
-  EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map_;
+  std::shared_ptr<BoundaryAngularSolution> boundary_angular_solution_ptr_ = nullptr;
+  std::shared_ptr<system::Workspace> workspace_ptr_ = nullptr;
+  std::shared_ptr<domain::DefinitionI<dim>> domain_ptr_ = nullptr;
+  std::unique_ptr<SinglePrecisionMomentMapConvergenceChecker>
+      single_precision_convergence_checker_ptr_ = nullptr;
+  //! Moments at the start of the current sweep, if stored in single precision
+  system::moments::SinglePrecisionMoments lagged_moments_;
+
+  bool is_skipping_converged_groups_ = false;
+  double group_skip_tolerance_ = 1e-6;
+  int group_recheck_interval_ = 10;
+  //! Relative change of each group flux on its last solve
+  std::vector<double> group_flux_change_;
+  //! Accumulated change of all other group fluxes since each group was solved
+  std::vector<double> group_incoming_change_;
+  //! Number of consecutive sweeps each group has been skipped
+  std::vector<int> group_sweeps_skipped_;
 };
 
 } // namespace group
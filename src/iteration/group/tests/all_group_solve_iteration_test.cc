@@ -0,0 +1,217 @@
+#include "iteration/group/all_group_solve_iteration.h"
+
+#include <memory>
+
+#include "domain/tests/definition_mock.h"
+#include "instrumentation/tests/instrument_mock.h"
+#include "system/solution/mpi_group_angular_solution.h"
+#include "system/system.h"
+#include "system/system_functions.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::_, ::testing::AtLeast, ::testing::HasSubstr, ::testing::NiceMock,
+    ::testing::ReturnRef;
+
+template <typename DimensionWrapper>
+class IterationAllGroupSolveIterationTest
+    : public ::testing::Test,
+      public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using TestIterator = iteration::group::AllGroupSolveIteration<dim>;
+  using GroupSolution = system::solution::MPIGroupAngularSolution;
+  using VariableLinearTerms = system::terms::VariableLinearTerms;
+
+  static constexpr int total_groups_ = 2;
+
+  std::shared_ptr<GroupSolution> group_solution_ptr_;
+  system::System test_system_;
+
+  std::shared_ptr<system::MPISparseMatrix> MakeDiagonalMatrix(double value);
+  std::shared_ptr<system::MPIVector> MakeVector(double value);
+  void SetUp() override;
+};
+
+TYPED_TEST_SUITE(IterationAllGroupSolveIterationTest,
+                 bart::testing::AllDimensions);
+
+template <typename DimensionWrapper>
+auto IterationAllGroupSolveIterationTest<DimensionWrapper>::MakeDiagonalMatrix(
+    const double value) -> std::shared_ptr<system::MPISparseMatrix> {
+  auto matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  matrix_ptr->reinit(this->matrix_1);
+  for (const auto dof : this->locally_owned_dofs_)
+    matrix_ptr->set(dof, dof, value);
+  matrix_ptr->compress(dealii::VectorOperation::insert);
+  return matrix_ptr;
+}
+
+template <typename DimensionWrapper>
+auto IterationAllGroupSolveIterationTest<DimensionWrapper>::MakeVector(
+    const double value) -> std::shared_ptr<system::MPIVector> {
+  auto vector_ptr = std::make_shared<system::MPIVector>();
+  vector_ptr->reinit(this->vector_1);
+  *vector_ptr = value;
+  return vector_ptr;
+}
+
+template <typename DimensionWrapper>
+void IterationAllGroupSolveIterationTest<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  group_solution_ptr_ = std::make_shared<GroupSolution>(1);
+  (*group_solution_ptr_)[0].reinit(this->vector_1);
+
+  system::InitializeSystem(test_system_, total_groups_, 1, true);
+  system::SetUpSystemMoments(test_system_, this->locally_owned_dofs_.size());
+
+  /* Two group system, with group 1 sourced by group 0:
+   *  | 2   0 | |x_0|   |1 + 1|
+   *  |-1   3 | |x_1| = |1 + 1|
+   * The scattering source is included in the block system, and must be
+   * ignored. The solution is x_0 = x_1 = 1. */
+  for (int group = 0; group < total_groups_; ++group) {
+    const system::Index index{group, 0};
+    test_system_.left_hand_side_ptr_->SetFixedTermPtr(
+        index, MakeDiagonalMatrix(group + 2));
+    test_system_.right_hand_side_ptr_->SetFixedTermPtr(index, MakeVector(1));
+    test_system_.right_hand_side_ptr_->SetVariableTermPtr(
+        index, VariableLinearTerms::kFissionSource, MakeVector(1));
+    test_system_.right_hand_side_ptr_->SetVariableTermPtr(
+        index, VariableLinearTerms::kScatteringSource, MakeVector(100));
+  }
+  test_system_.group_coupling_terms.insert_or_assign({1, 0},
+                                                     MakeDiagonalMatrix(-1));
+}
+
+TYPED_TEST(IterationAllGroupSolveIterationTest, Constructor) {
+  using TestIterator = typename TestFixture::TestIterator;
+  const int max_iterations = 123;
+  const double tolerance = 1e-8;
+  TestIterator test_iterator(this->group_solution_ptr_, max_iterations,
+                             tolerance);
+  EXPECT_EQ(test_iterator.group_solution_ptr(), this->group_solution_ptr_);
+  EXPECT_EQ(test_iterator.max_iterations(), max_iterations);
+  EXPECT_EQ(test_iterator.convergence_tolerance(), tolerance);
+}
+
+TYPED_TEST(IterationAllGroupSolveIterationTest, ConstructorBadDependencies) {
+  using TestIterator = typename TestFixture::TestIterator;
+  EXPECT_ANY_THROW({ TestIterator test_iterator(nullptr); });
+  EXPECT_ANY_THROW({ TestIterator test_iterator(this->group_solution_ptr_, 0); });
+  EXPECT_ANY_THROW({
+    TestIterator test_iterator(this->group_solution_ptr_, 100, 0); });
+}
+
+TYPED_TEST(IterationAllGroupSolveIterationTest, Iterate) {
+  using TestIterator = typename TestFixture::TestIterator;
+  TestIterator test_iterator(this->group_solution_ptr_, 100, 1e-12);
+
+  const auto initial_moments = this->test_system_.current_moments->moments();
+  test_iterator.Iterate(this->test_system_);
+
+  for (int group = 0; group < this->total_groups_; ++group) {
+    const system::moments::MomentIndex index{group, 0, 0};
+    const auto& scalar_flux = (*this->test_system_.current_moments)[index];
+    ASSERT_EQ(scalar_flux.size(), this->locally_owned_dofs_.size());
+    for (const auto dof : this->locally_owned_dofs_)
+      EXPECT_NEAR(scalar_flux[dof], 1.0, 1e-8);
+    EXPECT_EQ((*this->test_system_.previous_moments)[index],
+              initial_moments.at(index));
+  }
+
+  // Second call starts from the converged solution
+  test_iterator.Iterate(this->test_system_);
+  EXPECT_LE(test_iterator.solver_control().last_step(), 1);
+}
+
+// Constraints of the domain are distributed to the solution of each group
+TYPED_TEST(IterationAllGroupSolveIterationTest, IterateSetDomain) {
+  using TestIterator = typename TestFixture::TestIterator;
+  TestIterator test_iterator(this->group_solution_ptr_, 100, 1e-12);
+  auto domain_ptr = std::make_shared<domain::DefinitionMock<this->dim>>();
+  EXPECT_EQ(test_iterator.domain_ptr(), nullptr);
+  EXPECT_ANY_THROW(test_iterator.SetDomain(nullptr));
+  test_iterator.SetDomain(domain_ptr);
+  EXPECT_EQ(test_iterator.domain_ptr(), domain_ptr.get());
+
+  EXPECT_CALL(*domain_ptr, constraints())
+      .Times(this->total_groups_)
+      .WillRepeatedly(ReturnRef(this->constraint_matrix_));
+  test_iterator.Iterate(this->test_system_);
+
+  for (int group = 0; group < this->total_groups_; ++group) {
+    const auto& scalar_flux =
+        (*this->test_system_.current_moments)[{group, 0, 0}];
+    for (const auto dof : this->locally_owned_dofs_)
+      EXPECT_NEAR(scalar_flux[dof], 1.0, 1e-8);
+  }
+}
+
+TYPED_TEST(IterationAllGroupSolveIterationTest, IterateConvergenceStatus) {
+  using TestIterator = typename TestFixture::TestIterator;
+  using ConvergenceInstrument = instrumentation::InstrumentMock<convergence::Status>;
+  using ConvergenceStatusPort = iteration::group::data_ports::ConvergenceStatusPort;
+  TestIterator test_iterator(this->group_solution_ptr_, 100, 1e-12);
+  auto convergence_instrument_ptr = std::make_shared<ConvergenceInstrument>();
+  test_iterator.ConvergenceStatusPort::AddInstrument(convergence_instrument_ptr);
+
+  convergence::Status reported_status;
+  EXPECT_CALL(*convergence_instrument_ptr, Read(_))
+      .WillOnce(::testing::SaveArg<0>(&reported_status));
+  test_iterator.Iterate(this->test_system_);
+
+  const auto& solver_control = test_iterator.solver_control();
+  EXPECT_TRUE(reported_status.is_complete);
+  EXPECT_EQ(reported_status.iteration_number, solver_control.last_step());
+  EXPECT_EQ(reported_status.max_iterations, 100);
+  ASSERT_TRUE(reported_status.delta.has_value());
+  EXPECT_EQ(reported_status.delta.value(), solver_control.last_value());
+  EXPECT_LE(reported_status.delta.value(), 1e-12);
+}
+
+TYPED_TEST(IterationAllGroupSolveIterationTest, IterateNoConvergence) {
+  using TestIterator = typename TestFixture::TestIterator;
+  using ConvergenceInstrument = instrumentation::InstrumentMock<convergence::Status>;
+  using StatusInstrument = NiceMock<instrumentation::InstrumentMock<std::string>>;
+  using ConvergenceStatusPort = iteration::group::data_ports::ConvergenceStatusPort;
+  using StatusPort = iteration::group::data_ports::StatusPort;
+  // Block system is not solved by a single GMRES iteration
+  TestIterator test_iterator(this->group_solution_ptr_, 1, 1e-14);
+  auto convergence_instrument_ptr = std::make_shared<ConvergenceInstrument>();
+  auto status_instrument_ptr = std::make_shared<StatusInstrument>();
+  test_iterator.ConvergenceStatusPort::AddInstrument(convergence_instrument_ptr);
+  test_iterator.StatusPort::AddInstrument(status_instrument_ptr);
+
+  convergence::Status reported_status;
+  EXPECT_CALL(*convergence_instrument_ptr, Read(_))
+      .WillOnce(::testing::SaveArg<0>(&reported_status));
+  EXPECT_CALL(*status_instrument_ptr, Read(HasSubstr("did not converge")));
+  EXPECT_CALL(*status_instrument_ptr, Read(HasSubstr("All group block solve\n")))
+      .Times(AtLeast(1));
+  EXPECT_ANY_THROW(test_iterator.Iterate(this->test_system_));
+  EXPECT_FALSE(reported_status.is_complete);
+  EXPECT_EQ(reported_status.iteration_number, 1);
+  EXPECT_TRUE(reported_status.delta.has_value());
+}
+
+TYPED_TEST(IterationAllGroupSolveIterationTest, IterateMultipleAngles) {
+  using TestIterator = typename TestFixture::TestIterator;
+  TestIterator test_iterator(this->group_solution_ptr_);
+  this->test_system_.total_angles = 2;
+  EXPECT_ANY_THROW(test_iterator.Iterate(this->test_system_));
+}
+
+TYPED_TEST(IterationAllGroupSolveIterationTest, IterateBadCouplingIndex) {
+  using TestIterator = typename TestFixture::TestIterator;
+  TestIterator test_iterator(this->group_solution_ptr_);
+  this->test_system_.group_coupling_terms.insert_or_assign(
+      {0, this->total_groups_}, this->MakeDiagonalMatrix(-1));
+  EXPECT_ANY_THROW(test_iterator.Iterate(this->test_system_));
+}
+
+} // namespace
@@ -0,0 +1,203 @@
+#include "iteration/group/group_source_iteration.h"
+
+#include <memory>
+#include <set>
+
+#include "convergence/final_i.h"
+#include "formulation/updater/scattering_source_updater_i.h"
+#include "quadrature/calculators/spherical_harmonic_moments_i.h"
+#include "solver/group/single_group_solver_i.h"
+#include "system/moments/spherical_harmonic.h"
+#include "system/solution/mpi_group_angular_solution.h"
+#include "system/system.h"
+#include "system/workspace.h"
+#include "test_helpers/allocation_counter.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+/* gMock records each call to a mock method, which allocates, so the
+ * dependencies of the iteration are replaced by fakes that do not allocate.
+ * Any allocation counted is then made by the iteration itself. */
+
+//! Converges after a fixed number of checks, counting all checks made
+template <typename CompareType>
+class FakeFinalChecker : public convergence::FinalI<CompareType> {
+ public:
+  using IterationNumber = typename convergence::FinalI<CompareType>::IterationNumber;
+  FakeFinalChecker(const int checks_to_converge, int& total_checks)
+      : checks_to_converge_(checks_to_converge), total_checks_(total_checks) {}
+  convergence::Status CheckFinalConvergence(CompareType&, CompareType&) override {
+    ++total_checks_;
+    status_.iteration_number = ++iteration_;
+    status_.is_complete = iteration_ >= checks_to_converge_;
+    return status_;
+  }
+  convergence::Status convergence_status() const override { return status_; }
+  bool convergence_is_complete() const override { return status_.is_complete; }
+  IterationNumber max_iterations() const override { return checks_to_converge_; }
+  IterationNumber iteration() const override { return iteration_; }
+  FakeFinalChecker& SetMaxIterations(IterationNumber) override { return *this; }
+  FakeFinalChecker& SetIteration(IterationNumber to_set) override {
+    iteration_ = to_set;
+    return *this; }
+  void Reset() override {
+    iteration_ = 0;
+    status_ = convergence::Status();
+  }
+ private:
+  const int checks_to_converge_;
+  int& total_checks_;
+  int iteration_{0};
+  convergence::Status status_;
+};
+
+//! Fills moments in place with a value that depends only on the group
+class FakeMomentCalculator
+    : public quadrature::calculators::SphericalHarmonicMomentsI {
+ public:
+  explicit FakeMomentCalculator(const int total_dofs) : total_dofs_(total_dofs) {}
+  system::moments::MomentVector CalculateMoment(
+      system::solution::MPIGroupAngularSolutionI*, system::GroupNumber,
+      system::moments::HarmonicL, system::moments::HarmonicL) const override {
+    return system::moments::MomentVector(total_dofs_); }
+  void CalculateMoment(system::moments::MomentVector& to_fill,
+                       system::solution::MPIGroupAngularSolutionI*,
+                       system::GroupNumber group,
+                       system::moments::HarmonicL,
+                       system::moments::HarmonicL) const override {
+    // Storage is only reallocated if the size changes
+    to_fill.reinit(total_dofs_, true);
+    to_fill = 1.0 + group;
+  }
+ private:
+  const int total_dofs_;
+};
+
+class FakeGroupSolver : public solver::group::SingleGroupSolverI {
+ public:
+  void SolveGroup(const int, const system::System&,
+                  system::solution::MPIGroupAngularSolutionI&) override {
+    ++solves; }
+  int solves{0};
+};
+
+class FakeSourceUpdater : public formulation::updater::ScatteringSourceUpdaterI {
+ public:
+  void UpdateScatteringSource(system::System&, system::EnergyGroup,
+                              quadrature::QuadraturePointIndex) override {
+    ++updates; }
+  int updates{0};
+};
+
+/* Checks heap allocations made by GroupSolveIteration::Iterate once the
+ * moments and workspace have been sized by a first call.
+ *
+ * This test is built into bart_allocation_test, the only executable that
+ * replaces the global operator new. */
+template <typename DimensionWrapper>
+class IterationGroupSolveIterationAllocationTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+  using TestIterator = iteration::group::GroupSourceIteration<dim>;
+  using ConvergenceChecker = FakeFinalChecker<system::moments::MomentVector>;
+  using MomentMapConvergenceChecker =
+      FakeFinalChecker<const system::moments::MomentsMap>;
+
+  static constexpr int total_groups_{2};
+  static constexpr int total_angles_{2};
+  static constexpr int max_harmonic_l_{1};
+  static constexpr int total_dofs_{50};
+  //! Inner iterations of each group solve
+  static constexpr int inner_iterations_{3};
+
+  system::System test_system_;
+  std::shared_ptr<system::solution::MPIGroupAngularSolution> group_solution_ptr_;
+  std::shared_ptr<FakeSourceUpdater> source_updater_ptr_;
+  //! Number of group convergence checks made by all iterators
+  int convergence_checks_{0};
+  //! Number of all group convergence checks made by all iterators
+  int all_group_convergence_checks_{0};
+
+  void SetUp() override;
+  //! Makes a group iteration using the fake dependencies
+  std::unique_ptr<TestIterator> MakeIterator();
+};
+
+TYPED_TEST_CASE(IterationGroupSolveIterationAllocationTest,
+                bart::testing::AllDimensions);
+
+template <typename DimensionWrapper>
+void IterationGroupSolveIterationAllocationTest<DimensionWrapper>::SetUp() {
+  test_system_.total_groups = total_groups_;
+  test_system_.total_angles = total_angles_;
+  test_system_.current_moments =
+      std::make_unique<system::moments::SphericalHarmonic>(total_groups_,
+                                                           max_harmonic_l_);
+  test_system_.previous_moments =
+      std::make_unique<system::moments::SphericalHarmonic>(total_groups_,
+                                                           max_harmonic_l_);
+  group_solution_ptr_ =
+      std::make_shared<system::solution::MPIGroupAngularSolution>(total_angles_);
+  source_updater_ptr_ = std::make_shared<FakeSourceUpdater>();
+}
+
+template <typename DimensionWrapper>
+auto IterationGroupSolveIterationAllocationTest<DimensionWrapper>::MakeIterator()
+-> std::unique_ptr<TestIterator> {
+  return std::make_unique<TestIterator>(
+      std::make_unique<FakeGroupSolver>(),
+      std::make_unique<ConvergenceChecker>(inner_iterations_,
+                                           convergence_checks_),
+      std::make_unique<FakeMomentCalculator>(total_dofs_),
+      group_solution_ptr_,
+      source_updater_ptr_,
+      std::make_unique<MomentMapConvergenceChecker>(
+          1, all_group_convergence_checks_));
+}
+
+/* The workspace scalar flux buffers are reused by steady-state iterations, and
+ * status messages are not made without an instrument, so an iteration with a
+ * workspace makes no allocations. An iteration without a workspace allocates
+ * its scalar flux buffers on each call. */
+TYPED_TEST(IterationGroupSolveIterationAllocationTest, SteadyStateIterate) {
+  auto workspace_ptr = std::make_shared<system::Workspace>(
+      1, 1, this->total_dofs_);
+  auto workspace_iterator_ptr = this->MakeIterator();
+  workspace_iterator_ptr->SetWorkspace(workspace_ptr);
+  auto owned_iterator_ptr = this->MakeIterator();
+
+  // The first call sizes the moments
+  owned_iterator_ptr->Iterate(this->test_system_);
+  workspace_iterator_ptr->Iterate(this->test_system_);
+
+  const std::set<const double*> buffers{
+      workspace_ptr->current_scalar_flux().begin(),
+      workspace_ptr->previous_scalar_flux().begin()};
+
+  test_helpers::AllocationCounter workspace_counter;
+  workspace_iterator_ptr->Iterate(this->test_system_);
+  const auto workspace_allocations = workspace_counter.allocations();
+
+  test_helpers::AllocationCounter owned_counter;
+  owned_iterator_ptr->Iterate(this->test_system_);
+  const auto owned_allocations = owned_counter.allocations();
+
+  const std::set<const double*> steady_state_buffers{
+      workspace_ptr->current_scalar_flux().begin(),
+      workspace_ptr->previous_scalar_flux().begin()};
+
+  EXPECT_EQ(steady_state_buffers, buffers);
+  EXPECT_EQ(workspace_allocations, 0);
+  EXPECT_GT(owned_allocations, 0);
+  EXPECT_EQ(this->convergence_checks_,
+            4 * this->total_groups_ * this->inner_iterations_);
+  EXPECT_EQ(this->all_group_convergence_checks_, 4);
+  EXPECT_EQ(this->source_updater_ptr_->updates,
+            4 * this->total_groups_ * this->total_angles_ *
+                this->inner_iterations_);
+}
+
+} // namespace
@@ -8,6 +8,7 @@
 #include <deal.II/lac/petsc_solver.h>
 #include <deal.II/lac/petsc_full_matrix.h>
 
+#include "domain/tests/definition_mock.h"
 #include "formulation/updater/tests/boundary_conditions_updater_mock.h"
 #include "formulation/updater/tests/scattering_source_updater_mock.h"
 #include "quadrature/calculators/tests/spherical_harmonic_moments_mock.h"
@@ -17,7 +18,6 @@
 #include "system/moments/tests/spherical_harmonic_mock.h"
 #include "system/solution/tests/mpi_group_angular_solution_mock.h"
 #include "system/system.h"
-#include "system/solution/solution_types.h"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_assertions.hpp"
 
@@ -32,13 +32,13 @@ using ::testing::Sequence, ::testing::_;
 using ::testing::InvokeWithoutArgs;
 using ::testing::Unused;
 using ::testing::A;
+using ::testing::Truly;
 
 template <typename DimensionWrapper>
 class IterationGroupSourceIterationTest : public ::testing::Test {
  public:
   static constexpr int dim = DimensionWrapper::value;
 
-  using EnergyGroupToAngularSolutionPtrMap = bart::system::solution::EnergyGroupToAngularSolutionPtrMap;
   using TestGroupIterator = iteration::group::GroupSourceIteration<dim>;
   using GroupSolver = solver::group::SingleGroupSolverMock;
   using ConvergenceChecker = convergence::FinalCheckerMock<system::moments::MomentVector>;
@@ -64,7 +64,6 @@ class IterationGroupSourceIterationTest : public ::testing::Test {
 
   // Supporting objects
   system::System test_system;
-  EnergyGroupToAngularSolutionPtrMap energy_group_angular_solution_ptr_map_;
   std::shared_ptr<ConvergenceInstrumentType> convergence_instrument_ptr_;
   std::shared_ptr<StatusInstrumentType> status_instrument_ptr_;
 
@@ -173,6 +172,48 @@ TYPED_TEST(IterationGroupSourceIterationTest, ConstructorThrows) {
   }
 }
 
+TYPED_TEST(IterationGroupSourceIterationTest, SkipConvergedGroups) {
+  EXPECT_FALSE(this->test_iterator_ptr_->is_skipping_converged_groups());
+  this->test_iterator_ptr_->SkipConvergedGroups(1e-4, 5);
+  EXPECT_TRUE(this->test_iterator_ptr_->is_skipping_converged_groups());
+  EXPECT_EQ(this->test_iterator_ptr_->group_skip_tolerance(), 1e-4);
+  EXPECT_EQ(this->test_iterator_ptr_->group_recheck_interval(), 5);
+}
+
+TYPED_TEST(IterationGroupSourceIterationTest, SkipConvergedGroupsBadValues) {
+  EXPECT_ANY_THROW(this->test_iterator_ptr_->SkipConvergedGroups(0, 5));
+  EXPECT_ANY_THROW(this->test_iterator_ptr_->SkipConvergedGroups(-1e-4, 5));
+  EXPECT_ANY_THROW(this->test_iterator_ptr_->SkipConvergedGroups(1e-4, 0));
+  EXPECT_FALSE(this->test_iterator_ptr_->is_skipping_converged_groups());
+}
+
+TYPED_TEST(IterationGroupSourceIterationTest, SetDomain) {
+  auto domain_ptr = std::make_shared<domain::DefinitionMock<this->dim>>();
+  EXPECT_EQ(this->test_iterator_ptr_->domain_ptr(), nullptr);
+  EXPECT_ANY_THROW(this->test_iterator_ptr_->SetDomain(nullptr));
+  this->test_iterator_ptr_->SetDomain(domain_ptr);
+  EXPECT_EQ(this->test_iterator_ptr_->domain_ptr(), domain_ptr.get());
+}
+
+TYPED_TEST(IterationGroupSourceIterationTest, StoreLaggedMomentsInSinglePrecision) {
+  using SinglePrecisionChecker = convergence::FinalCheckerMock<
+      const system::moments::MomentsMap,
+      const system::moments::SinglePrecisionMoments>;
+  EXPECT_FALSE(
+      this->test_iterator_ptr_->is_storing_lagged_moments_in_single_precision());
+  EXPECT_ANY_THROW(
+      this->test_iterator_ptr_->StoreLaggedMomentsInSinglePrecision(nullptr));
+
+  auto checker_ptr = std::make_unique<SinglePrecisionChecker>();
+  auto checker_obs_ptr = checker_ptr.get();
+  this->test_iterator_ptr_->StoreLaggedMomentsInSinglePrecision(
+      std::move(checker_ptr));
+  EXPECT_TRUE(
+      this->test_iterator_ptr_->is_storing_lagged_moments_in_single_precision());
+  EXPECT_EQ(this->test_iterator_ptr_->single_precision_convergence_checker_ptr(),
+            checker_obs_ptr);
+}
+
 TYPED_TEST(IterationGroupSourceIterationTest, ConstructorThrowNoBoundaryUpdater) {
   using BoundaryConditionsUpdater = formulation::updater::BoundaryConditionsUpdaterMock;
 
@@ -274,12 +315,6 @@ void IterationGroupSourceSystemSolvingTest<DimensionWrapper>::SetUp() {
       group_solution[i] = 1;
     }
 
-    for (int angle = 0; angle < this->total_angles; ++angle) {
-      this->energy_group_angular_solution_ptr_map_.insert(
-          {system::SolutionIndex(group, angle),
-           std::make_shared<dealii::Vector<double>>()});
-    }
-
     group_solution.compress(dealii::VectorOperation::insert);
     // Generate initial RHS, b - Ux_0
     U_.vmult_add(group_rhs_vector, group_solution);
@@ -337,12 +372,19 @@ ACTION_P(ResetIterations, test_class) {
 
 TYPED_TEST_CASE(IterationGroupSourceSystemSolvingTest, bart::testing::AllDimensions);
 
-TYPED_TEST(IterationGroupSourceSystemSolvingTest, UpdateThisAngularSolution) {
-  this->test_iterator_ptr_->UpdateThisAngularSolutionMap(
-      this->energy_group_angular_solution_ptr_map_);
+TYPED_TEST(IterationGroupSourceSystemSolvingTest, UpdateThisBoundaryAngularSolution) {
+  dealii::IndexSet locally_owned_dofs(4);
+  locally_owned_dofs.add_range(0, 4);
+  auto boundary_solution_ptr =
+      std::make_shared<system::solution::BoundaryAngularSolution>(
+          std::vector<dealii::types::global_dof_index>{0, 3}, locally_owned_dofs,
+          this->total_groups, this->total_angles);
+
+  EXPECT_ANY_THROW(this->test_iterator_ptr_->UpdateThisBoundaryAngularSolution(nullptr));
+  this->test_iterator_ptr_->UpdateThisBoundaryAngularSolution(boundary_solution_ptr);
   EXPECT_TRUE(this->test_iterator_ptr_->is_storing_angular_solution());
-  EXPECT_EQ(this->test_iterator_ptr_->angular_solution_ptr_map().size(),
-            this->total_groups*this->total_angles);
+  EXPECT_EQ(this->test_iterator_ptr_->boundary_angular_solution_ptr(),
+            boundary_solution_ptr);
 }
 
 TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
@@ -360,7 +402,6 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
             .WillRepeatedly(ReturnRef(current_moments.at(index)));
         const auto& const_mock_current_moments = *this->moments_obs_ptr_;
         EXPECT_CALL(const_mock_current_moments, BracketOp(index))
-            .Times(AtLeast(1))
             .WillRepeatedly(ReturnRef(current_moments.at(index)));
         EXPECT_CALL(*this->previous_moments_obs_ptr_, BracketOp(index))
             .Times(AtLeast(1))
@@ -397,8 +438,10 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
   moment_map_status.is_complete = true;
   EXPECT_CALL(*this->moments_obs_ptr_, moments())
       .WillOnce(ReturnRef(current_moments));
+  EXPECT_CALL(*this->previous_moments_obs_ptr_, moments())
+      .WillOnce(ReturnRef(previous_moments));
   EXPECT_CALL(*this->moment_map_convergence_checker_obs_ptr_,
-              CheckFinalConvergence(Ref(current_moments), _))
+              CheckFinalConvergence(Ref(current_moments), Ref(previous_moments)))
               .WillOnce(Return(moment_map_status));
   EXPECT_CALL(*this->moment_map_convergence_checker_obs_ptr_, Reset())
       .Times(AtLeast(1));
@@ -426,8 +469,14 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
   EXPECT_CALL(*this->moments_obs_ptr_, max_harmonic_l())
       .WillRepeatedly(Return(this->max_harmonic_l));
 
-  this->test_iterator_ptr_->UpdateThisAngularSolutionMap(
-      this->energy_group_angular_solution_ptr_map_);
+  dealii::IndexSet locally_owned_dofs(4);
+  locally_owned_dofs.add_range(0, 4);
+  auto boundary_solution_ptr =
+      std::make_shared<system::solution::BoundaryAngularSolution>(
+          std::vector<dealii::types::global_dof_index>{0, 3}, locally_owned_dofs,
+          this->total_groups, this->total_angles);
+  this->test_iterator_ptr_->UpdateThisBoundaryAngularSolution(
+      boundary_solution_ptr);
 
   this->test_iterator_ptr_->Iterate(this->test_system);
   EXPECT_LT(this->iterations, this->max_iterations);
@@ -435,10 +484,184 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
     EXPECT_NEAR(current_moments.at({0, 0, 0})[i],
                      this->true_scalar_flux_[i], 1e-6);
   }
-  for (const auto& [index, solution_ptr] : this->energy_group_angular_solution_ptr_map_) {
-    dealii::Vector<double> expected_solution;
-    expected_solution = this->expected_stored_solution_;
-    EXPECT_TRUE(test_helpers::AreEqual(expected_solution, *solution_ptr));
+  for (int group = 0; group < this->total_groups; ++group) {
+    for (int angle = 0; angle < this->total_angles; ++angle) {
+      const system::SolutionIndex index(group, angle);
+      ASSERT_TRUE(boundary_solution_ptr->is_stored(index));
+      for (const dealii::types::global_dof_index dof : {0, 3}) {
+        EXPECT_DOUBLE_EQ(boundary_solution_ptr->Value(index, dof),
+                         this->expected_stored_solution_[dof]);
+      }
+    }
   }
 }
-} // namespace
\ No newline at end of file
+
+TYPED_TEST(IterationGroupSourceSystemSolvingTest,
+           IterateSinglePrecisionLaggedMoments) {
+  using SinglePrecisionChecker = convergence::FinalCheckerMock<
+      const system::moments::MomentsMap,
+      const system::moments::SinglePrecisionMoments>;
+  auto single_precision_checker_ptr = std::make_unique<SinglePrecisionChecker>();
+  auto single_precision_checker_obs_ptr = single_precision_checker_ptr.get();
+  this->test_iterator_ptr_->StoreLaggedMomentsInSinglePrecision(
+      std::move(single_precision_checker_ptr));
+
+  system::moments::MomentsMap current_moments;
+  for (int group = 0; group < this->total_groups; ++group) {
+    for (int l = 0; l <= this->max_harmonic_l; ++l) {
+      for (int m = -l; m <= l; ++m) {
+        system::moments::MomentIndex index{group, l, m};
+        current_moments.emplace(index, 4);
+        EXPECT_CALL(*this->moments_obs_ptr_, BracketOp(index))
+            .WillRepeatedly(ReturnRef(current_moments.at(index)));
+        const auto& const_mock_current_moments = *this->moments_obs_ptr_;
+        EXPECT_CALL(const_mock_current_moments, BracketOp(index))
+            .WillRepeatedly(ReturnRef(current_moments.at(index)));
+        EXPECT_CALL(*this->moment_calculator_obs_ptr_, CalculateMoment(
+            this->group_solution_ptr_.get(), group, l, m))
+            .WillRepeatedly(CalculatedScalarFlux(this));
+      }
+    }
+    EXPECT_CALL(*this->single_group_obs_ptr_, SolveGroup(
+        group, Ref(this->test_system), Ref(*this->group_solution_ptr_)))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Solve(this));
+    for (int angle = 0; angle < this->total_angles; ++angle) {
+      EXPECT_CALL(*this->source_updater_ptr_, UpdateScatteringSource(
+          Ref(this->test_system),
+          bart::system::EnergyGroup(group),
+          quadrature::QuadraturePointIndex(angle)))
+          .WillRepeatedly(Update(this));
+      EXPECT_CALL(*this->boundary_conditions_updater_ptr_,
+                  UpdateBoundaryConditions(
+                      Ref(this->test_system),
+                      bart::system::EnergyGroup(group),
+                      quadrature::QuadraturePointIndex(angle)));
+    }
+  }
+
+  // The system previous moments and the double precision checker are unused
+  EXPECT_CALL(*this->previous_moments_obs_ptr_, BracketOp(_)).Times(0);
+  EXPECT_CALL(*this->previous_moments_obs_ptr_, moments()).Times(0);
+  EXPECT_CALL(*this->moment_map_convergence_checker_obs_ptr_,
+              CheckFinalConvergence(_, _)).Times(0);
+
+  convergence::Status moment_map_status;
+  moment_map_status.is_complete = true;
+  EXPECT_CALL(*this->moments_obs_ptr_, moments())
+      .WillOnce(ReturnRef(current_moments));
+  EXPECT_CALL(*single_precision_checker_obs_ptr,
+              CheckFinalConvergence(Ref(current_moments), _))
+      .WillOnce(Return(moment_map_status));
+  EXPECT_CALL(*single_precision_checker_obs_ptr, Reset());
+  EXPECT_CALL(*this->convergence_checker_obs_ptr_, Reset())
+      .WillRepeatedly(ResetIterations(this));
+  EXPECT_CALL(*this->convergence_checker_obs_ptr_, CheckFinalConvergence(_, _))
+      .WillRepeatedly(ReturnConvergence(this));
+  EXPECT_CALL(*this->moments_obs_ptr_, max_harmonic_l())
+      .WillRepeatedly(Return(this->max_harmonic_l));
+  EXPECT_CALL(*this->convergence_instrument_ptr_,
+              Read(A<const convergence::Status&>()))
+      .Times(AtLeast(1));
+  EXPECT_CALL(*this->status_instrument_ptr_, Read(_))
+      .Times(AtLeast(1));
+
+  this->test_system.total_groups = this->total_groups;
+  this->test_system.total_angles = this->total_angles;
+
+  this->test_iterator_ptr_->Iterate(this->test_system);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NEAR(current_moments.at({0, 0, 0})[i],
+                this->true_scalar_flux_[i], 1e-6);
+  }
+  const auto& lagged_moments = this->test_iterator_ptr_->lagged_moments();
+  EXPECT_EQ(lagged_moments.total_groups(), this->total_groups);
+  EXPECT_EQ(lagged_moments.max_harmonic_l(), this->max_harmonic_l);
+  EXPECT_EQ(lagged_moments.moment_size(), 4);
+}
+
+TYPED_TEST(IterationGroupSourceSystemSolvingTest, IterateSkipsConvergedGroups) {
+  system::moments::MomentsMap current_moments, previous_moments;
+  for (int group = 0; group < this->total_groups; ++group) {
+    for (int l = 0; l <= this->max_harmonic_l; ++l) {
+      for (int m = -l; m <= l; ++m) {
+        system::moments::MomentIndex index{group, l, m};
+        current_moments.emplace(index, 4);
+        previous_moments.emplace(index, 4);
+        EXPECT_CALL(*this->moments_obs_ptr_, BracketOp(index))
+            .WillRepeatedly(ReturnRef(current_moments.at(index)));
+        const auto& const_mock_current_moments = *this->moments_obs_ptr_;
+        EXPECT_CALL(const_mock_current_moments, BracketOp(index))
+            .WillRepeatedly(ReturnRef(current_moments.at(index)));
+        EXPECT_CALL(*this->previous_moments_obs_ptr_, BracketOp(index))
+            .WillRepeatedly(ReturnRef(previous_moments.at(index)));
+        const auto& const_mock_previous_moments = *this->previous_moments_obs_ptr_;
+        EXPECT_CALL(const_mock_previous_moments, BracketOp(index))
+            .WillRepeatedly(ReturnRef(previous_moments.at(index)));
+        EXPECT_CALL(*this->moment_calculator_obs_ptr_, CalculateMoment(
+            this->group_solution_ptr_.get(), group, l, m))
+            .WillRepeatedly(CalculatedScalarFlux(this));
+      }
+    }
+    // Each group is solved on the first two sweeps only, the third sweep
+    // skips both groups.
+    EXPECT_CALL(*this->single_group_obs_ptr_, SolveGroup(
+        group, Ref(this->test_system), Ref(*this->group_solution_ptr_)))
+        .Times(AtLeast(2))
+        .WillRepeatedly(Solve(this));
+    for (int angle = 0; angle < this->total_angles; ++angle) {
+      EXPECT_CALL(*this->source_updater_ptr_, UpdateScatteringSource(
+          Ref(this->test_system),
+          bart::system::EnergyGroup(group),
+          quadrature::QuadraturePointIndex(angle)))
+          .WillRepeatedly(Update(this));
+      EXPECT_CALL(*this->boundary_conditions_updater_ptr_,
+                  UpdateBoundaryConditions(
+                      Ref(this->test_system),
+                      bart::system::EnergyGroup(group),
+                      quadrature::QuadraturePointIndex(angle)))
+          .Times(2);
+    }
+  }
+
+  convergence::Status not_converged, converged;
+  converged.is_complete = true;
+  EXPECT_CALL(*this->moments_obs_ptr_, moments())
+      .WillRepeatedly(ReturnRef(current_moments));
+  EXPECT_CALL(*this->previous_moments_obs_ptr_, moments())
+      .WillRepeatedly(ReturnRef(previous_moments));
+  EXPECT_CALL(*this->moment_map_convergence_checker_obs_ptr_,
+              CheckFinalConvergence(Ref(current_moments), Ref(previous_moments)))
+      .WillOnce(Return(not_converged))
+      .WillOnce(Return(not_converged))
+      .WillOnce(Return(converged));
+  EXPECT_CALL(*this->moment_map_convergence_checker_obs_ptr_, Reset());
+  EXPECT_CALL(*this->convergence_checker_obs_ptr_, Reset())
+      .WillRepeatedly(ResetIterations(this));
+  EXPECT_CALL(*this->convergence_checker_obs_ptr_, CheckFinalConvergence(_, _))
+      .WillRepeatedly(ReturnConvergence(this));
+  EXPECT_CALL(*this->moments_obs_ptr_, max_harmonic_l())
+      .WillRepeatedly(Return(this->max_harmonic_l));
+
+  EXPECT_CALL(*this->convergence_instrument_ptr_, Read(A<const convergence::Status&>()))
+      .Times(AtLeast(1));
+  EXPECT_CALL(*this->convergence_instrument_ptr_,
+              Read(Truly([](const convergence::Status& status) {
+                return status.skipped_solves == 2; })));
+  EXPECT_CALL(*this->status_instrument_ptr_, Read(_))
+      .Times(AtLeast(1));
+
+  this->test_system.total_groups = this->total_groups;
+  this->test_system.total_angles = this->total_angles;
+
+  this->test_iterator_ptr_->SkipConvergedGroups(1e-4);
+  this->test_iterator_ptr_->Iterate(this->test_system);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NEAR(current_moments.at({1, 0, 0})[i],
+                this->true_scalar_flux_[i], 1e-6);
+  }
+}
+
+} // namespace
@@ -6,10 +6,52 @@
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/mpi.h>
 
+#include "framework/adaptive_refinement.hpp"
 #include "framework/builder/framework_builder.hpp"
+#include "framework/mesh_sequencing.hpp"
 #include "problem/parameters_dealii_handler.h"
 #include "utility/runtime/runtime_helper.h"
 
+namespace {
+
+void ReportSolves(const std::string& solve_name,
+                  const std::vector<int>& degrees_of_freedom,
+                  const std::vector<double>& k_effective) {
+  for (std::size_t i = 0; i < degrees_of_freedom.size(); ++i) {
+    std::cout << solve_name << " " << i << ": " << degrees_of_freedom[i]
+              << " degrees of freedom";
+    if (i < k_effective.size())
+      std::cout << ", k_effective: " << k_effective[i];
+    std::cout << std::endl;
+  }
+}
+
+/* Builds the main framework, solving the problem on coarser or adapted meshes
+ * first if requested. */
+template <int dim>
+std::unique_ptr<bart::framework::FrameworkI> BuildMainFramework(
+    const bart::problem::ParametersI& prm) {
+  if (prm.AdaptiveRefinementCycles() > 0) {
+    bart::framework::AdaptiveRefinement<dim> adaptive_refinement(prm);
+    auto framework_ptr = adaptive_refinement.BuildFramework("main");
+    ReportSolves("Adaptive refinement cycle",
+                 adaptive_refinement.cycle_degrees_of_freedom(),
+                 adaptive_refinement.cycle_k_effective());
+    return framework_ptr;
+  } else if (prm.DoMeshSequencing()) {
+    bart::framework::MeshSequencing<dim> mesh_sequencing(prm);
+    auto framework_ptr = mesh_sequencing.BuildFramework("main");
+    ReportSolves("Mesh sequencing level",
+                 mesh_sequencing.level_degrees_of_freedom(),
+                 mesh_sequencing.level_k_effective());
+    return framework_ptr;
+  }
+  bart::framework::builder::FrameworkBuilder<dim> builder;
+  return builder.BuildFramework("main", prm);
+}
+
+} // namespace
+
 int main(int argc, char* argv[]) {
   try {
     bart::utility::runtime::RuntimeHelper runtime_helper("0.2.0");
@@ -65,18 +107,15 @@ int main(int argc, char* argv[]) {
 
     switch(prm.SpatialDimension()) {
       case 1: {
-        bart::framework::builder::FrameworkBuilder<1> builder;
-        framework_ptr = builder.BuildFramework("main", prm);
+        framework_ptr = BuildMainFramework<1>(prm);
         break;
       }
       case 2: {
-        bart::framework::builder::FrameworkBuilder<2> builder;
-        framework_ptr = builder.BuildFramework("main", prm);
+        framework_ptr = BuildMainFramework<2>(prm);
         break;
       }
       case 3: {
-        bart::framework::builder::FrameworkBuilder<3> builder;
-        framework_ptr = builder.BuildFramework("main", prm);
+        framework_ptr = BuildMainFramework<3>(prm);
         break;
       }
     }
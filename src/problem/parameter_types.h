@@ -17,6 +17,19 @@ enum class DiscretizationType {
   kContinuousFEM,
 };
 
+/*! \brief Renumbering of degrees of freedom (and of the cell traversal order).
+ *
+ * - kCuthillMcKee: bandwidth reducing Cuthill-McKee renumbering.
+ * - kHilbert: cells ordered along a Hilbert space-filling curve.
+ * - kDownstream: degrees of freedom ordered along a direction.
+ */
+enum class DoFRenumberingType {
+  kNone = 0,
+  kCuthillMcKee = 1,
+  kHilbert = 2,
+  kDownstream = 3,
+};
+
 enum class Boundary {
   kXMin = 0,
   kXMax = 1,
@@ -36,6 +49,14 @@ enum class EquationType {
   kDiffusion,
   kEvenParity,
   kSelfAdjointAngularFlux,
+  kDiscreteOrdinates,
+  kSimplifiedP3,
+  kSimplifiedP5,
+};
+
+enum class ReflectiveBoundaryType {
+  kLagged,
+  kImplicit,
 };
 
 enum class FuelPinTriangulationType {
@@ -55,11 +76,13 @@ enum class LinearSolverType {
   kGMRES,
   kBiCGSTAB,
   kDirect,
+  kMixedPrecisionGMRES,
 };
 
 enum class MultiGroupSolverType {
   kNone,
   kGaussSeidel,
+  kBlock,
 };
 
 enum class PreconditionerType {
@@ -69,6 +92,7 @@ enum class PreconditionerType {
   kBlockJacobi,
   kJacobi,
   kBlockSSOR,
+  kGeometricMultigrid,
 };  
 
 } // namespace problem
@@ -36,6 +36,8 @@ void ParametersDealiiHandler::Parse(dealii::ParameterHandler &handler) {
   reflective_boundary_ = ParseDealiiMultiple(
       handler.get(key_words_.kReflectiveBoundary_),
       kBoundaryMap_);
+  reflective_boundary_treatment_ = kReflectiveBoundaryTypeMap_.at(
+      handler.get(key_words_.kReflectiveBoundaryTreatment_));
   spatial_dimension_ = handler.get_integer(key_words_.kSpatialDimension_);
   spatial_max = ParseDealiiList(handler.get(key_words_.kSpatialMax_));
   transport_model_ = kEquationTypeMap_.at(
@@ -49,6 +51,15 @@ void ParametersDealiiHandler::Parse(dealii::ParameterHandler &handler) {
   fuel_pin_triangulation_ = kFuelPinTriangulationTypeMap_.at(
       handler.get(key_words_.kFuelPinTriangulation_));
   is_mesh_pin_resolved_ = handler.get_bool(key_words_.kMeshPinResolved_);
+  dof_renumbering_ = kDoFRenumberingTypeMap_.at(
+      handler.get(key_words_.kDoFRenumbering_));
+  adaptive_refinement_cycles_ =
+      handler.get_integer(key_words_.kAdaptiveRefinementCycles_);
+  refine_fraction_ = handler.get_double(key_words_.kRefineFraction_);
+  coarsen_fraction_ = handler.get_double(key_words_.kCoarsenFraction_);
+  do_mesh_sequencing_ = handler.get_bool(key_words_.kMeshSequencing_);
+  mesh_sequencing_tolerance_ =
+      handler.get_double(key_words_.kMeshSequencingTolerance_);
 
   // Material parameters
   n_materials_ = handler.get_integer(key_words_.kNumberOfMaterials_);
@@ -66,6 +77,8 @@ void ParametersDealiiHandler::Parse(dealii::ParameterHandler &handler) {
   preconditioner_ = kPreconditionerTypeMap_.at(
       handler.get(key_words_.kPreconditioner_));
   block_ssor_factor_ = handler.get_double(key_words_.kBSSOR_Factor_);
+  multigrid_smoother_ = kPreconditionerTypeMap_.at(
+      handler.get(key_words_.kMultigridSmoother_));
   do_nda_ = handler.get_bool(key_words_.kDoNDA_);
   nda_discretization_ = kDiscretizationTypeMap_.at(
       handler.get(key_words_.kNDA_Discretization_));
@@ -84,6 +97,14 @@ void ParametersDealiiHandler::Parse(dealii::ParameterHandler &handler) {
       handler.get(key_words_.kLinearSolver_));
   multi_group_solver_ =
       kMultiGroupSolverTypeMap_.at(handler.get(key_words_.kMultiGroupSolver_));
+  use_mixed_precision_storage_ =
+      handler.get_bool(key_words_.kMixedPrecisionStorage_);
+  use_structured_grid_solver_ =
+      handler.get_bool(key_words_.kStructuredGridSolver_);
+  do_skip_converged_groups_ =
+      handler.get_bool(key_words_.kSkipConvergedGroups_);
+  skip_converged_groups_tolerance_ =
+      handler.get_double(key_words_.kSkipConvergedGroupsTolerance_);
 
   // Angular Quadrature parameters
   angular_quad_ = kAngularQuadTypeMap_.at(handler.get(key_words_.kAngularQuad_));
@@ -159,6 +180,12 @@ void ParametersDealiiHandler::SetUpBasicParameters(
                         Pattern::MultipleSelection(
                             GetOptionString(kBoundaryMap_)),
                         "lower case boundary names (xmin, ymax) etc)");
+
+  handler.declare_entry(key_words_.kReflectiveBoundaryTreatment_, "lagged",
+                        Pattern::Selection(
+                            GetOptionString(kReflectiveBoundaryTypeMap_)),
+                        "lagged uses the previous iteration incoming flux, "
+                        "implicit couples reflected angles in the linear system");
   
   handler.declare_entry(key_words_.kSpatialDimension_, "2",
                         Pattern::Integer(1, 3), "");
@@ -199,6 +226,35 @@ void ParametersDealiiHandler::SetUpMeshParameters(
                         "fuel Pin triangulation type");
   handler.declare_entry(key_words_.kMeshPinResolved_, "false", Pattern::Bool(),
                         "Boolean to determine if pPinucing pin-resolved mesh");
+
+  handler.declare_entry(key_words_.kDoFRenumbering_, "none",
+                        Pattern::Selection(
+                            GetOptionString(kDoFRenumberingTypeMap_)),
+                        "renumbering of degrees of freedom and cells");
+
+  handler.declare_entry(key_words_.kAdaptiveRefinementCycles_, "0",
+                        Pattern::Integer(0),
+                        "number of adaptive refinement cycles after the "
+                        "initial solve");
+
+  handler.declare_entry(key_words_.kRefineFraction_, "0.3",
+                        Pattern::Double(0, 1),
+                        "fraction of cells with the largest estimated error "
+                        "refined in each adaptive refinement cycle");
+
+  handler.declare_entry(key_words_.kCoarsenFraction_, "0.03",
+                        Pattern::Double(0, 1),
+                        "fraction of cells with the smallest estimated error "
+                        "coarsened in each adaptive refinement cycle");
+
+  handler.declare_entry(key_words_.kMeshSequencing_, "false", Pattern::Bool(),
+                        "Boolean to determine if the problem is first solved "
+                        "on coarser levels of uniform refinement");
+
+  handler.declare_entry(key_words_.kMeshSequencingTolerance_, "1e-3",
+                        Pattern::Double(0),
+                        "convergence tolerance of solves on coarser levels "
+                        "of uniform refinement");
                         
 }
 
@@ -232,10 +288,17 @@ void ParametersDealiiHandler::SetUpAccelerationParameters(
   std::string preconditioner_options{GetOptionString(kPreconditionerTypeMap_)};
   handler.declare_entry(key_words_.kPreconditioner_, "amg",
                         Pattern::Selection(preconditioner_options),
-                        "Preconditioner");
+                        "Preconditioner, gmg forces full matrix storage, "
+                        "symmetric upper triangular storage is solved by CG "
+                        "with jacobi");
 
   handler.declare_entry(key_words_.kBSSOR_Factor_, "1.0", Pattern::Double(0),
                         "damping factor of block SSOR");
+
+  handler.declare_entry(key_words_.kMultigridSmoother_, "jacobi",
+                        Pattern::Selection("jacobi|bjacobi|bssor"),
+                        "smoother used by the geometric multigrid "
+                        "preconditioner");
   
   handler.declare_entry(key_words_.kDoNDA_, "false", Pattern::Bool(),
                         "Boolean to determine NDA or not");
@@ -245,13 +308,16 @@ void ParametersDealiiHandler::SetUpAccelerationParameters(
                             GetOptionString(kDiscretizationTypeMap_)),
                         "NDA equation spatial discretization");
   
-  // Remove Conjugate Gradient from options for NDA linear solver
+  // Remove Conjugate Gradient and mixed precision GMRES from options for NDA
+  // linear solver
 
   handler.declare_entry(key_words_.kNDALinearSolver_, "none",
                         Pattern::Selection(
                             GetOptionString(
                                 kLinearSolverTypeMap_,
-                                LinearSolverType::kConjugateGradient)),
+                                std::vector<LinearSolverType>{
+                                    LinearSolverType::kConjugateGradient,
+                                    LinearSolverType::kMixedPrecisionGMRES})),
                         "NDA linear solver");
 
   handler.declare_entry(key_words_.kNDAPreconditioner_, "jacobi",
@@ -286,7 +352,32 @@ void ParametersDealiiHandler::SetUpSolverParameters(
   handler.declare_entry(key_words_.kMultiGroupSolver_, "gs",
                         Pattern::Selection(
                             GetOptionString(kMultiGroupSolverTypeMap_)),
-                        "Multi-group solvers");
+                        "Multi-group solvers, the block solver is only "
+                        "available for diffusion, other transport models "
+                        "use Gauss-Seidel");
+
+  handler.declare_entry(key_words_.kMixedPrecisionStorage_, "false",
+                        Pattern::Bool(),
+                        "Store boundary angular fluxes and lagged flux "
+                        "moments between iterations in single precision, "
+                        "solve vectors and accumulation remain double "
+                        "precision");
+
+  handler.declare_entry(key_words_.kStructuredGridSolver_, "false",
+                        Pattern::Bool(),
+                        "Solve groups using stencils on uniform Cartesian "
+                        "meshes");
+
+  handler.declare_entry(key_words_.kSkipConvergedGroups_, "false",
+                        Pattern::Bool(),
+                        "Skip solving groups that have converged in "
+                        "multigroup sweeps, re-checking them periodically");
+
+  handler.declare_entry(key_words_.kSkipConvergedGroupsTolerance_, "1e-7",
+                        Pattern::Double(0),
+                        "relative L1 change in a group flux, and in all group "
+                        "fluxes since it was solved, below which the group is "
+                        "skipped");
   
 }
 
@@ -42,6 +42,7 @@ class ParametersDealiiHandler : public ParametersI {
     const std::string kNEnergyGroups_ = "number of groups";
     const std::string kOutputFilenameBase_ = "output file name base";
     const std::string kReflectiveBoundary_ = "reflective boundary names";
+    const std::string kReflectiveBoundaryTreatment_ = "reflective boundary treatment";
     const std::string kSpatialDimension_ = "problem dimension";
     const std::string kSpatialMax_ = "x, y, z max values of boundary locations";
     const std::string kTransportModel_ = "transport model";
@@ -53,6 +54,12 @@ class ParametersDealiiHandler : public ParametersI {
     const std::string kFuelPinRadius_ = "fuel Pin radius";
     const std::string kFuelPinTriangulation_ = "triangulation type of fuel Pin";
     const std::string kMeshPinResolved_ = "is mesh pin-resolved";
+    const std::string kDoFRenumbering_ = "dof renumbering";
+    const std::string kAdaptiveRefinementCycles_ = "adaptive refinement cycles";
+    const std::string kRefineFraction_ = "adaptive refine fraction";
+    const std::string kCoarsenFraction_ = "adaptive coarsen fraction";
+    const std::string kMeshSequencing_ = "do mesh sequencing";
+    const std::string kMeshSequencingTolerance_ = "mesh sequencing tolerance";
 
     // Material parameters
     const std::string kMaterialSubsection_ = "material ID map";
@@ -65,6 +72,7 @@ class ParametersDealiiHandler : public ParametersI {
     // Acceleration parameters
     const std::string kPreconditioner_ = "ho preconditioner name";
     const std::string kBSSOR_Factor_ = "ho ssor factor";
+    const std::string kMultigridSmoother_ = "ho multigrid smoother";
     const std::string kDoNDA_ = "do nda";
     const std::string kNDA_Discretization_ = "nda spatial discretization";
     const std::string kNDALinearSolver_ = "nda linear solver name";
@@ -76,6 +84,11 @@ class ParametersDealiiHandler : public ParametersI {
     const std::string kInGroupSolver_ = "in group solver name";
     const std::string kLinearSolver_ = "ho linear solver name";
     const std::string kMultiGroupSolver_ = "mg solver name";
+    const std::string kMixedPrecisionStorage_ = "mixed precision storage";
+    const std::string kStructuredGridSolver_ = "structured grid solver";
+    const std::string kSkipConvergedGroups_ = "skip converged groups";
+    const std::string kSkipConvergedGroupsTolerance_ =
+        "skip converged groups tolerance";
 
     // Angular quadrature
     const std::string kAngularQuad_ = "angular quadrature name";
@@ -126,6 +139,9 @@ class ParametersDealiiHandler : public ParametersI {
   std::map<Boundary, bool> ReflectiveBoundary() const override {
     return reflective_boundary_; }
 
+  ReflectiveBoundaryType ReflectiveBoundaryTreatment() const override {
+    return reflective_boundary_treatment_; }
+
   int SpatialDimension() const override { return spatial_dimension_; }
 
   std::vector<double> SpatialMax() const override { return spatial_max; }
@@ -144,6 +160,21 @@ class ParametersDealiiHandler : public ParametersI {
 
   bool IsMeshPinResolved() const override { return is_mesh_pin_resolved_;}
 
+  DoFRenumberingType DoFRenumbering() const override {
+    return dof_renumbering_; }
+
+  int AdaptiveRefinementCycles() const override {
+    return adaptive_refinement_cycles_; }
+
+  double RefineFraction() const override { return refine_fraction_; }
+
+  double CoarsenFraction() const override { return coarsen_fraction_; }
+
+  bool DoMeshSequencing() const override { return do_mesh_sequencing_; }
+
+  double MeshSequencingTolerance() const override {
+    return mesh_sequencing_tolerance_; }
+
   // MATERIAL PARAMETERS =======================================================
   std::string MaterialMapFilename() const override { 
     return material_map_filename_; }
@@ -161,6 +192,9 @@ class ParametersDealiiHandler : public ParametersI {
   PreconditionerType Preconditioner() const override { return preconditioner_; }
 
   double BlockSSORFactor() const override { return block_ssor_factor_; }
+
+  PreconditionerType MultigridSmoother() const override {
+    return multigrid_smoother_; }
   
   bool DoNDA() const override { return do_nda_; }
   
@@ -187,6 +221,18 @@ class ParametersDealiiHandler : public ParametersI {
   MultiGroupSolverType MultiGroupSolver() const override {
     return multi_group_solver_; }
 
+  bool UseMixedPrecisionStorage() const override {
+    return use_mixed_precision_storage_; }
+
+  bool UseStructuredGridSolver() const override {
+    return use_structured_grid_solver_; }
+
+  bool DoSkipConvergedGroups() const override {
+    return do_skip_converged_groups_; }
+
+  double SkipConvergedGroupsTolerance() const override {
+    return skip_converged_groups_tolerance_; }
+
   // Angular Quadrature Parameters =============================================
   AngularQuadType AngularQuad() const override { return angular_quad_; }
 
@@ -209,6 +255,7 @@ class ParametersDealiiHandler : public ParametersI {
   int                                  n_groups_;
   std::string                          output_filename_base_;
   std::map<Boundary, bool>             reflective_boundary_;    
+  ReflectiveBoundaryType               reflective_boundary_treatment_;
   int                                  spatial_dimension_;
   std::vector<double>                  spatial_max;
                                        
@@ -219,6 +266,12 @@ class ParametersDealiiHandler : public ParametersI {
   double                               fuel_pin_radius_;
   FuelPinTriangulationType             fuel_pin_triangulation_;
   bool                                 is_mesh_pin_resolved_;
+  DoFRenumberingType                   dof_renumbering_;
+  int                                  adaptive_refinement_cycles_{ 0 };
+  double                               refine_fraction_{ 0.3 };
+  double                               coarsen_fraction_{ 0.03 };
+  bool                                 do_mesh_sequencing_{ false };
+  double                               mesh_sequencing_tolerance_{ 1e-3 };
                                        
   // Material Parameters
   std::string                          material_map_filename_;
@@ -229,6 +282,7 @@ class ParametersDealiiHandler : public ParametersI {
   // Acceleration parameters
   PreconditionerType                   preconditioner_;
   double                               block_ssor_factor_;
+  PreconditionerType                   multigrid_smoother_;
   bool                                 do_nda_;
   DiscretizationType                   nda_discretization_;
   LinearSolverType                     nda_linear_solver_;
@@ -240,6 +294,10 @@ class ParametersDealiiHandler : public ParametersI {
   InGroupSolverType                    in_group_solver_;
   LinearSolverType                     linear_solver_;
   MultiGroupSolverType                 multi_group_solver_;
+  bool                                 use_mixed_precision_storage_{ false };
+  bool                                 use_structured_grid_solver_{ false };
+  bool                                 do_skip_converged_groups_{ false };
+  double                               skip_converged_groups_tolerance_{ 1e-7 };
                                        
   // Angular Quadrature                
   AngularQuadType                      angular_quad_;
@@ -267,13 +325,32 @@ class ParametersDealiiHandler : public ParametersI {
         }; /*!< Maps discretization type to strings used in parsed input
             * files. */
 
+  const std::unordered_map<std::string, DoFRenumberingType>
+  kDoFRenumberingTypeMap_ {
+    {"none",          DoFRenumberingType::kNone},
+    {"cuthill_mckee", DoFRenumberingType::kCuthillMcKee},
+    {"hilbert",       DoFRenumberingType::kHilbert},
+    {"downstream",    DoFRenumberingType::kDownstream},
+        }; /*!< Maps dof renumbering type to strings used in parsed input
+            * files. */
+
   const std::unordered_map<std::string, EquationType> kEquationTypeMap_ {
     {"diffusion", EquationType::kDiffusion},
     {"ep",        EquationType::kEvenParity},
     {"saaf",      EquationType::kSelfAdjointAngularFlux},
+    {"sn",        EquationType::kDiscreteOrdinates},
+    {"sp3",       EquationType::kSimplifiedP3},
+    {"sp5",       EquationType::kSimplifiedP5},
     {"none",      EquationType::kNone},
         }; /*!< Maps equation type to strings used in parsed input files. */
 
+  const std::unordered_map<std::string, ReflectiveBoundaryType>
+  kReflectiveBoundaryTypeMap_ {
+    {"lagged",   ReflectiveBoundaryType::kLagged},
+    {"implicit", ReflectiveBoundaryType::kImplicit},
+        }; /*!< Maps reflective boundary treatment to strings used in parsed
+            * input files. */
+
   const std::unordered_map<std::string, EigenSolverType> kEigenSolverTypeMap_ {
     {"pi",   EigenSolverType::kPowerIteration},
     {"none", EigenSolverType::kNone},
@@ -300,13 +377,15 @@ class ParametersDealiiHandler : public ParametersI {
     {"bicgstab", LinearSolverType::kBiCGSTAB},
     {"direct",   LinearSolverType::kDirect},
     {"none",     LinearSolverType::kNone},
+    {"mixed precision gmres", LinearSolverType::kMixedPrecisionGMRES},
         };  /*!< Maps linear solver type to strings used in parsed input
              * files. */
 
   const std::unordered_map<std::string, MultiGroupSolverType>
   kMultiGroupSolverTypeMap_ {
-    {"gs",   MultiGroupSolverType::kGaussSeidel},
-    {"none", MultiGroupSolverType::kNone},
+    {"gs",    MultiGroupSolverType::kGaussSeidel},
+    {"block", MultiGroupSolverType::kBlock},
+    {"none",  MultiGroupSolverType::kNone},
   }; /*!< Maps multi-group solver type to strings used in parsed input files. */
 
   const std::unordered_map<std::string, PreconditionerType>
@@ -316,6 +395,7 @@ class ParametersDealiiHandler : public ParametersI {
     {"bjacobi",   PreconditionerType::kBlockJacobi},
     {"jacobi",    PreconditionerType::kJacobi},
     {"bssor",     PreconditionerType::kBlockSSOR},
+    {"gmg",       PreconditionerType::kGeometricMultigrid},
     {"none",      PreconditionerType::kNone},
         }; /*!< Maps preconditioner type to strings used in parsed input
             * files. */
@@ -50,6 +50,9 @@ class ParametersI {
   /*! \brief Gets a mapping of each boundary to a bool indicating if it is
    * a reflective boundary */
   virtual std::map<Boundary, bool>   ReflectiveBoundary()             const = 0;
+  /*! \brief Gets how reflective boundary conditions are coupled to the
+   * solution, lagged by one iteration or implicitly in the linear system */
+  virtual ReflectiveBoundaryType     ReflectiveBoundaryTreatment()    const = 0;
   /*! \brief Gets the number of spatial dimensions in the problem */
   virtual int                        SpatialDimension()               const = 0;
   /*! \brief Gets the size of the spatial dimensions */
@@ -70,6 +73,18 @@ class ParametersI {
   virtual FuelPinTriangulationType   FuelPinTriangulation()           const = 0;
   /*! \brief Gets if the problem is pin resolved */
   virtual bool                       IsMeshPinResolved()              const = 0;
+  /*! \brief Gets the renumbering of degrees of freedom and cells */
+  virtual DoFRenumberingType         DoFRenumbering()                 const = 0;
+  /*! \brief Gets the number of adaptive refinement cycles after the first solve */
+  virtual int                        AdaptiveRefinementCycles()       const = 0;
+  /*! \brief Gets the fraction of cells refined in each adaptive cycle */
+  virtual double                     RefineFraction()                 const = 0;
+  /*! \brief Gets the fraction of cells coarsened in each adaptive cycle */
+  virtual double                     CoarsenFraction()                const = 0;
+  /*! \brief Gets if the problem is first solved on coarser uniform refinements */
+  virtual bool                       DoMeshSequencing()               const = 0;
+  /*! \brief Gets the convergence tolerance of coarse mesh sequencing solves */
+  virtual double                     MeshSequencingTolerance()        const = 0;
                                                                       
   // Material parameters
   /*! \brief Gets total number of materials in the problem */
@@ -85,10 +100,16 @@ class ParametersI {
   virtual std::string                FuelPinMaterialMapFilename()        const = 0;
                                                             
   // Acceleration parameters
-  /*! \brief Gets the type of preconditioner to use */
+  /*! \brief Gets the type of preconditioner to use.
+   *
+   * Geometric multigrid requires full storage of the system matrices. Other
+   * symmetric second-order systems are stored as upper triangles and solved
+   * by CG with point Jacobi. */
   virtual PreconditionerType         Preconditioner()                 const = 0;
   /*! \brief Gets the damping factor for block SSOR if used */
   virtual double                     BlockSSORFactor()                const = 0;
+  /*! \brief Gets the smoother for the geometric multigrid preconditioner */
+  virtual PreconditionerType         MultigridSmoother()              const = 0;
   /*! \brief Gets if NDA should be used */
   virtual bool                       DoNDA()                          const = 0;
   /*! \brief Gets the NDA discretization to use */
@@ -107,8 +128,22 @@ class ParametersI {
   virtual InGroupSolverType          InGroupSolver()                  const = 0;
   /*! \brief Gets solver type for linear solves */
   virtual LinearSolverType           LinearSolver()                   const = 0;
-  /*! \brief Gets solver type for multi-group solves */
+  /*! \brief Gets solver type for multi-group solves.
+   *
+   * The block solver couples groups through the scalar flux, and is only
+   * used for diffusion. Angular transport models, such as SAAF, are solved
+   * with Gauss-Seidel iteration if the block solver is selected. */
   virtual MultiGroupSolverType       MultiGroupSolver()               const = 0;
+  /*! \brief Gets if stored boundary angular fluxes and lagged moments should
+   * use single precision */
+  virtual bool                       UseMixedPrecisionStorage()       const = 0;
+  /*! \brief Gets if groups should be solved using Cartesian mesh stencils */
+  virtual bool                       UseStructuredGridSolver()        const = 0;
+  /*! \brief Gets if converged groups are skipped in multigroup sweeps */
+  virtual bool                       DoSkipConvergedGroups()          const = 0;
+  /*! \brief Gets the relative change below which a group is considered
+   * converged and skipped */
+  virtual double                     SkipConvergedGroupsTolerance()   const = 0;
                                                                       
   // Angular quadrature parameters
   /*! \brief Gets type of angular quadrature to use */
@@ -52,6 +52,9 @@ TEST_F(ParametersDealiiHandlerTest, BasicParametersDefault) {
       << "Default spatial dimension";
   ASSERT_EQ(test_parameters.ReflectiveBoundary(), test_reflective_map)
       << "Default first reflective boundaries";
+  ASSERT_EQ(test_parameters.ReflectiveBoundaryTreatment(),
+            bart::problem::ReflectiveBoundaryType::kLagged)
+      << "Default reflective boundary treatment";
   ASSERT_EQ(test_parameters.OutputFilenameBase(), "bart_output")
       << "Default spatial dimension";
   ASSERT_EQ(test_parameters.TransportModel(), bart::problem::EquationType::kNone)
@@ -74,6 +77,19 @@ TEST_F(ParametersDealiiHandlerTest, MeshParametersDefault) {
       << "Default fuel Pin triangulation type";
   ASSERT_EQ(test_parameters.IsMeshPinResolved(), false)
       << "Default is mesh pin resolved";
+  ASSERT_EQ(test_parameters.DoFRenumbering(),
+            bart::problem::DoFRenumberingType::kNone)
+      << "Default dof renumbering";
+  ASSERT_EQ(test_parameters.AdaptiveRefinementCycles(), 0)
+      << "Default adaptive refinement cycles";
+  ASSERT_EQ(test_parameters.RefineFraction(), 0.3)
+      << "Default adaptive refine fraction";
+  ASSERT_EQ(test_parameters.CoarsenFraction(), 0.03)
+      << "Default adaptive coarsen fraction";
+  ASSERT_FALSE(test_parameters.DoMeshSequencing())
+      << "Default mesh sequencing";
+  ASSERT_EQ(test_parameters.MeshSequencingTolerance(), 1e-3)
+      << "Default mesh sequencing tolerance";
 }
 
 TEST_F(ParametersDealiiHandlerTest, MaterialParametersDefault) {
@@ -100,6 +116,9 @@ TEST_F(ParametersDealiiHandlerTest, AccelerationParametersDefault) {
         << "Default preconditioner";
   ASSERT_EQ(test_parameters.BlockSSORFactor(), 1.0)
       << "Default BSSOR Factor"; 
+  ASSERT_EQ(test_parameters.MultigridSmoother(),
+            bart::problem::PreconditionerType::kJacobi)
+      << "Default multigrid smoother";
   ASSERT_EQ(test_parameters.DoNDA(), false)
       << "Default NDA usage";
   ASSERT_EQ(test_parameters.NDADiscretization(),
@@ -130,6 +149,14 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersDefault) {
   ASSERT_EQ(test_parameters.MultiGroupSolver(),
             bart::problem::MultiGroupSolverType::kGaussSeidel)
       << "Default multi-group solver";
+  ASSERT_FALSE(test_parameters.UseMixedPrecisionStorage())
+      << "Default mixed precision storage";
+  ASSERT_FALSE(test_parameters.UseStructuredGridSolver())
+      << "Default structured grid solver";
+  ASSERT_FALSE(test_parameters.DoSkipConvergedGroups())
+      << "Default skip converged groups";
+  ASSERT_EQ(test_parameters.SkipConvergedGroupsTolerance(), 1e-7)
+      << "Default skip converged groups tolerance";
 
 }
 
@@ -168,6 +195,7 @@ TEST_F(ParametersDealiiHandlerTest, BasicParametersParse) {
   test_parameter_handler.set(key_words.kNEnergyGroups_, "10");
   test_parameter_handler.set(key_words.kOutputFilenameBase_, output_filename_base);
   test_parameter_handler.set(key_words.kReflectiveBoundary_, "xmin, ymax");
+  test_parameter_handler.set(key_words.kReflectiveBoundaryTreatment_, "implicit");
   test_parameter_handler.set(key_words.kSpatialDimension_, 3.0);
   test_parameter_handler.set(key_words.kSpatialMax_, "10.0, 5.0, 8.0");
   test_parameter_handler.set(key_words.kTransportModel_, "saaf");
@@ -194,6 +222,9 @@ TEST_F(ParametersDealiiHandlerTest, BasicParametersParse) {
       << "Parsed output filename base";
   ASSERT_EQ(test_parameters.ReflectiveBoundary(), parsed_reflective_map)
       << "Default first thermal group";
+  ASSERT_EQ(test_parameters.ReflectiveBoundaryTreatment(),
+            bart::problem::ReflectiveBoundaryType::kImplicit)
+      << "Parsed reflective boundary treatment";
   ASSERT_EQ(test_parameters.SpatialDimension(), 3.0)
       << "Parsed spatial dimension";
   ASSERT_EQ(test_parameters.SpatialMax(), spatial_max)            
@@ -211,6 +242,12 @@ TEST_F(ParametersDealiiHandlerTest, MeshParametersParsed) {
   test_parameter_handler.set(key_words.kFuelPinRadius_, "1.0");
   test_parameter_handler.set(key_words.kFuelPinTriangulation_, "simple");
   test_parameter_handler.set(key_words.kMeshPinResolved_, "true");
+  test_parameter_handler.set(key_words.kDoFRenumbering_, "hilbert");
+  test_parameter_handler.set(key_words.kAdaptiveRefinementCycles_, "3");
+  test_parameter_handler.set(key_words.kRefineFraction_, "0.5");
+  test_parameter_handler.set(key_words.kCoarsenFraction_, "0.1");
+  test_parameter_handler.set(key_words.kMeshSequencing_, "true");
+  test_parameter_handler.set(key_words.kMeshSequencingTolerance_, "1e-2");
 
   test_parameters.Parse(test_parameter_handler);
 
@@ -227,6 +264,19 @@ TEST_F(ParametersDealiiHandlerTest, MeshParametersParsed) {
       << "Parsed fuel Pin triangulation type";
   ASSERT_EQ(test_parameters.IsMeshPinResolved(), true)
       << "Parsed is mesh pin resolved";
+  ASSERT_EQ(test_parameters.DoFRenumbering(),
+            bart::problem::DoFRenumberingType::kHilbert)
+      << "Parsed dof renumbering";
+  ASSERT_EQ(test_parameters.AdaptiveRefinementCycles(), 3)
+      << "Parsed adaptive refinement cycles";
+  ASSERT_EQ(test_parameters.RefineFraction(), 0.5)
+      << "Parsed adaptive refine fraction";
+  ASSERT_EQ(test_parameters.CoarsenFraction(), 0.1)
+      << "Parsed adaptive coarsen fraction";
+  ASSERT_TRUE(test_parameters.DoMeshSequencing())
+      << "Parsed mesh sequencing";
+  ASSERT_EQ(test_parameters.MeshSequencingTolerance(), 1e-2)
+      << "Parsed mesh sequencing tolerance";
 }
 
 TEST_F(ParametersDealiiHandlerTest, MaterialParametersParsed) {
@@ -261,6 +311,7 @@ TEST_F(ParametersDealiiHandlerTest, MaterialParametersParsed) {
 TEST_F(ParametersDealiiHandlerTest, AccelerationParametersParsed) {
   test_parameter_handler.set(key_words.kPreconditioner_, "bjacobi");
   test_parameter_handler.set(key_words.kBSSOR_Factor_, "1.5");
+  test_parameter_handler.set(key_words.kMultigridSmoother_, "bssor");
   test_parameter_handler.set(key_words.kDoNDA_, "true");
   test_parameter_handler.set(key_words.kNDA_Discretization_, "dfem");
   test_parameter_handler.set(key_words.kNDALinearSolver_, "gmres");
@@ -274,6 +325,9 @@ TEST_F(ParametersDealiiHandlerTest, AccelerationParametersParsed) {
         << "Parsed preconditioner";
   ASSERT_EQ(test_parameters.BlockSSORFactor(), 1.5)
       << "Parsed BSSOR Factor"; 
+  ASSERT_EQ(test_parameters.MultigridSmoother(),
+            bart::problem::PreconditionerType::kBlockSSOR)
+      << "Parsed multigrid smoother";
   ASSERT_EQ(test_parameters.DoNDA(), true)
       << "Parsed NDA usage";
   ASSERT_EQ(test_parameters.NDADiscretization(),
@@ -295,6 +349,10 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersParsed) {
   test_parameter_handler.set(key_words.kInGroupSolver_, "none");
   test_parameter_handler.set(key_words.kLinearSolver_, "gmres");
   test_parameter_handler.set(key_words.kMultiGroupSolver_, "none");
+  test_parameter_handler.set(key_words.kMixedPrecisionStorage_, "true");
+  test_parameter_handler.set(key_words.kStructuredGridSolver_, "true");
+  test_parameter_handler.set(key_words.kSkipConvergedGroups_, "true");
+  test_parameter_handler.set(key_words.kSkipConvergedGroupsTolerance_, "1e-5");
   
   test_parameters.Parse(test_parameter_handler);
   
@@ -310,7 +368,69 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersParsed) {
   ASSERT_EQ(test_parameters.MultiGroupSolver(),
             bart::problem::MultiGroupSolverType::kNone)
       << "Parsed multi-group solver";
+  ASSERT_TRUE(test_parameters.UseMixedPrecisionStorage())
+      << "Parsed mixed precision storage";
+  ASSERT_TRUE(test_parameters.UseStructuredGridSolver())
+      << "Parsed structured grid solver";
+  ASSERT_TRUE(test_parameters.DoSkipConvergedGroups())
+      << "Parsed skip converged groups";
+  ASSERT_EQ(test_parameters.SkipConvergedGroupsTolerance(), 1e-5)
+      << "Parsed skip converged groups tolerance";
+
+}
+
+TEST_F(ParametersDealiiHandlerTest, BlockMultiGroupSolverParsed) {
+  test_parameter_handler.set(key_words.kMultiGroupSolver_, "block");
+
+  test_parameters.Parse(test_parameter_handler);
+
+  ASSERT_EQ(test_parameters.MultiGroupSolver(),
+            bart::problem::MultiGroupSolverType::kBlock)
+      << "Parsed multi-group solver";
+}
+
+TEST_F(ParametersDealiiHandlerTest, MixedPrecisionGMRESLinearSolverParsed) {
+  test_parameter_handler.set(key_words.kLinearSolver_, "mixed precision gmres");
+
+  test_parameters.Parse(test_parameter_handler);
+
+  ASSERT_EQ(test_parameters.LinearSolver(),
+            bart::problem::LinearSolverType::kMixedPrecisionGMRES)
+      << "Parsed linear solver";
+  EXPECT_ANY_THROW({
+    test_parameter_handler.set(key_words.kNDALinearSolver_,
+                               "mixed precision gmres");
+  });
+}
+
+TEST_F(ParametersDealiiHandlerTest, DiscreteOrdinatesTransportModelParsed) {
+  test_parameter_handler.set(key_words.kTransportModel_, "sn");
+  test_parameter_handler.set(key_words.kDiscretization_, "dfem");
+
+  test_parameters.Parse(test_parameter_handler);
+
+  ASSERT_EQ(test_parameters.TransportModel(),
+            bart::problem::EquationType::kDiscreteOrdinates)
+      << "Parsed transport model";
+  ASSERT_EQ(test_parameters.Discretization(),
+            bart::problem::DiscretizationType::kDiscontinuousFEM)
+      << "Parsed discretization";
+}
+
+TEST_F(ParametersDealiiHandlerTest, SimplifiedPNTransportModelParsed) {
+  using EquationType = bart::problem::EquationType;
+  const std::vector<std::pair<std::string, EquationType>> transport_models{
+      {"sp3", EquationType::kSimplifiedP3},
+      {"sp5", EquationType::kSimplifiedP5}};
+
+  for (const auto& [name, equation_type] : transport_models) {
+    test_parameter_handler.set(key_words.kTransportModel_, name);
+
+    test_parameters.Parse(test_parameter_handler);
 
+    ASSERT_EQ(test_parameters.TransportModel(), equation_type)
+        << "Parsed transport model " << name;
+  }
 }
 
 TEST_F(ParametersDealiiHandlerTest, AngularQuadParametersParsed) {
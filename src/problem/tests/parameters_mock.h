@@ -31,6 +31,8 @@ class ParametersMock : public ParametersI {
 
   MOCK_CONST_METHOD0(ReflectiveBoundary, std::map<Boundary, bool>());
 
+  MOCK_CONST_METHOD0(ReflectiveBoundaryTreatment, ReflectiveBoundaryType());
+
   MOCK_CONST_METHOD0(SpatialDimension, int());
 
   MOCK_CONST_METHOD0(SpatialMax, std::vector<double>());
@@ -49,6 +51,18 @@ class ParametersMock : public ParametersI {
 
   MOCK_CONST_METHOD0(IsMeshPinResolved, bool());
 
+  MOCK_CONST_METHOD0(DoFRenumbering, DoFRenumberingType());
+
+  MOCK_CONST_METHOD0(AdaptiveRefinementCycles, int());
+
+  MOCK_CONST_METHOD0(RefineFraction, double());
+
+  MOCK_CONST_METHOD0(CoarsenFraction, double());
+
+  MOCK_CONST_METHOD0(DoMeshSequencing, bool());
+
+  MOCK_CONST_METHOD0(MeshSequencingTolerance, double());
+
   MOCK_CONST_METHOD0(NumberOfMaterials, int());
 
   MOCK_CONST_METHOD0(MaterialMapFilename, std::string());
@@ -61,6 +75,8 @@ class ParametersMock : public ParametersI {
 
   MOCK_CONST_METHOD0(BlockSSORFactor, double());
 
+  MOCK_CONST_METHOD0(MultigridSmoother, PreconditionerType());
+
   MOCK_CONST_METHOD0(DoNDA, bool());
 
   MOCK_CONST_METHOD0(NDADiscretization, DiscretizationType());
@@ -79,6 +95,14 @@ class ParametersMock : public ParametersI {
 
   MOCK_CONST_METHOD0(MultiGroupSolver, MultiGroupSolverType());
 
+  MOCK_CONST_METHOD0(UseMixedPrecisionStorage, bool());
+
+  MOCK_CONST_METHOD0(UseStructuredGridSolver, bool());
+
+  MOCK_CONST_METHOD0(DoSkipConvergedGroups, bool());
+
+  MOCK_CONST_METHOD0(SkipConvergedGroupsTolerance, double());
+
   MOCK_CONST_METHOD0(AngularQuad, AngularQuadType());
 
   MOCK_CONST_METHOD0(AngularQuadOrder, int());
@@ -9,6 +9,17 @@ namespace quadrature {
 namespace calculators {
 
 system::moments::MomentVector ScalarMoment::CalculateMoment(
+    system::solution::MPIGroupAngularSolutionI *solution,
+    system::GroupNumber group,
+    system::moments::HarmonicL harmonic_l,
+    system::moments::HarmonicL harmonic_m) const {
+  system::moments::MomentVector return_vector;
+  CalculateMoment(return_vector, solution, group, harmonic_l, harmonic_m);
+  return return_vector;
+}
+
+void ScalarMoment::CalculateMoment(
+    system::moments::MomentVector& to_fill,
     system::solution::MPIGroupAngularSolutionI *solution,
     system::GroupNumber /*group*/,
     system::moments::HarmonicL /*harmonic_l*/,
@@ -18,11 +29,7 @@ system::moments::MomentVector ScalarMoment::CalculateMoment(
       dealii::ExcMessage("Error: Using ScalarMoment quadrature calculator "
                          "but solution appears to have more than one angle"));
 
-  auto mpi_solution = solution->GetSolution(0);
-
-  system::moments::MomentVector return_vector(mpi_solution);
-
-  return return_vector;
+  to_fill = solution->GetSolution(0);
 }
 
 } // namespace calculators
@@ -21,6 +21,13 @@ class ScalarMoment : public SphericalHarmonicMomentsI {
       system::GroupNumber group,
       system::moments::HarmonicL harmonic_l,
       system::moments::HarmonicL harmonic_m) const override;
+
+  void CalculateMoment(
+      system::moments::MomentVector& to_fill,
+      system::solution::MPIGroupAngularSolutionI *solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL harmonic_l,
+      system::moments::HarmonicL harmonic_m) const override;
 };
 
 } // namespace calculators
@@ -0,0 +1,68 @@
+#include "quadrature/calculators/simplified_pn_moments.h"
+
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace calculators {
+
+SimplifiedPNMoments::SimplifiedPNMoments(
+    const dealii::FullMatrix<double>& unknowns_to_moments)
+    : unknowns_to_moments_(unknowns_to_moments) {
+  AssertThrow(unknowns_to_moments_.m() == unknowns_to_moments_.n() &&
+                  unknowns_to_moments_.m() > 0,
+              dealii::ExcMessage("Error in constructor of SimplifiedPNMoments, "
+                                 "matrix mapping unknowns to moments must be "
+                                 "square and non-empty"))
+}
+
+system::moments::MomentVector SimplifiedPNMoments::CalculateMoment(
+    system::solution::MPIGroupAngularSolutionI *solution,
+    system::GroupNumber group,
+    system::moments::HarmonicL harmonic_l,
+    system::moments::HarmonicL harmonic_m) const {
+  system::moments::MomentVector return_vector;
+  CalculateMoment(return_vector, solution, group, harmonic_l, harmonic_m);
+  return return_vector;
+}
+
+void SimplifiedPNMoments::CalculateMoment(
+    system::moments::MomentVector& to_fill,
+    system::solution::MPIGroupAngularSolutionI *solution,
+    system::GroupNumber /*group*/,
+    system::moments::HarmonicL harmonic_l,
+    system::moments::HarmonicL harmonic_m) const {
+  const int n_equations = unknowns_to_moments_.m();
+
+  AssertThrow(solution->total_angles() == n_equations,
+              dealii::ExcMessage("Error: Using SimplifiedPNMoments quadrature "
+                                 "calculator but solution does not have one "
+                                 "angle per equation"))
+
+  const int moment_index = harmonic_l / 2;
+  const bool is_nonzero_moment = harmonic_m == 0 && harmonic_l % 2 == 0 &&
+      moment_index < n_equations;
+
+  const auto& first_solution = solution->GetSolution(0);
+  if (distributed_moment_.size() != first_solution.size())
+    distributed_moment_.reinit(first_solution);
+  distributed_moment_ = 0;
+
+  if (is_nonzero_moment) {
+    for (int k = 0; k < n_equations; ++k) {
+      const double factor = unknowns_to_moments_(moment_index, k);
+      if (factor != 0)
+        distributed_moment_.add(factor, solution->GetSolution(k));
+    }
+  }
+
+  to_fill = distributed_moment_;
+}
+
+} // namespace calculators
+
+} // namespace quadrature
+
+} // namespace bart
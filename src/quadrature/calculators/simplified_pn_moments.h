@@ -0,0 +1,63 @@
+#ifndef BART_SRC_QUADRATURE_CALCULATORS_SIMPLIFIED_PN_MOMENTS_H_
+#define BART_SRC_QUADRATURE_CALCULATORS_SIMPLIFIED_PN_MOMENTS_H_
+
+#include <deal.II/lac/full_matrix.h>
+
+#include "quadrature/calculators/spherical_harmonic_moments_i.h"
+
+namespace bart {
+
+namespace quadrature {
+
+namespace calculators {
+
+/*! \brief Moment calculator for simplified \f$P_N\f$ solves.
+ *
+ * The solution of a simplified \f$P_N\f$ solve has one entry for each
+ * equation, holding the unknowns \f$\Psi_k\f$. The even Legendre moments are
+ * a linear combination of the unknowns,
+ * \f[
+ * \phi_{2i} = \sum_k T^{-1}_{ik}\Psi_k\;,
+ * \f]
+ * and are returned as the moments with \f$\ell = 2i\f$ and \f$m = 0\f$. All
+ * other moments are zero.
+ */
+class SimplifiedPNMoments : public SphericalHarmonicMomentsI {
+ public:
+  /*! \brief Constructor.
+   *
+   * \param unknowns_to_moments matrix \f$T^{-1}\f$ mapping the unknowns to the
+   *        even moments.
+   */
+  explicit SimplifiedPNMoments(
+      const dealii::FullMatrix<double>& unknowns_to_moments);
+
+  system::moments::MomentVector CalculateMoment(
+      system::solution::MPIGroupAngularSolutionI *solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL harmonic_l,
+      system::moments::HarmonicL harmonic_m) const override;
+
+  void CalculateMoment(
+      system::moments::MomentVector& to_fill,
+      system::solution::MPIGroupAngularSolutionI *solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL harmonic_l,
+      system::moments::HarmonicL harmonic_m) const override;
+
+  const dealii::FullMatrix<double>& unknowns_to_moments() const {
+    return unknowns_to_moments_; }
+
+ private:
+  const dealii::FullMatrix<double> unknowns_to_moments_;
+  //! Work vector for the combination of the distributed unknowns
+  mutable system::MPIVector distributed_moment_;
+};
+
+} // namespace calculators
+
+} // namespace quadrature
+
+} //namespace bart
+
+#endif //BART_SRC_QUADRATURE_CALCULATORS_SIMPLIFIED_PN_MOMENTS_H_
@@ -56,6 +56,20 @@ class SphericalHarmonicMomentsI {
       system::GroupNumber group,
       system::moments::HarmonicL harmonic_l,
       system::moments::HarmonicL harmonic_m) const = 0;
+
+  /*! \brief Calculates a moment into an existing moment vector.
+   *
+   * Storage of the moment vector is reused if it is the correct size, so
+   * repeated calculations do not allocate.
+   */
+  virtual void CalculateMoment(
+      system::moments::MomentVector& to_fill,
+      system::solution::MPIGroupAngularSolutionI* solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL harmonic_l,
+      system::moments::HarmonicL harmonic_m) const {
+    to_fill = CalculateMoment(solution, group, harmonic_l, harmonic_m);
+  }
 };
 
 } // namespace calculators
@@ -9,6 +9,18 @@ namespace calculators {
 
 template<int dim>
 system::moments::MomentVector SphericalHarmonicZerothMoment<dim>::CalculateMoment(
+    system::solution::MPIGroupAngularSolutionI* solution,
+    system::GroupNumber group,
+    system::moments::HarmonicL harmonic_l,
+    system::moments::HarmonicL harmonic_m) const {
+  system::moments::MomentVector return_vector;
+  CalculateMoment(return_vector, solution, group, harmonic_l, harmonic_m);
+  return return_vector;
+}
+
+template<int dim>
+void SphericalHarmonicZerothMoment<dim>::CalculateMoment(
+    system::moments::MomentVector& to_fill,
     system::solution::MPIGroupAngularSolutionI* solution,
     system::GroupNumber,
     system::moments::HarmonicL,
@@ -24,26 +36,33 @@ system::moments::MomentVector SphericalHarmonicZerothMoment<dim>::CalculateMomen
       dealii::ExcMessage("Error: angular quadrature set and solution must "
                          "have the same number of angles."))
 
-  system::moments::MomentVector return_vector;
+  // The weighted sum is accumulated using the distributed solutions, so only
+  // the final moment is gathered into a full length vector on each processor.
+  // The distributed moment is only re-initialized if the solution size
+  // changes.
+  bool is_first_angle = true;
 
   for (auto quadrature_point_ptr : *quadrature_set_ptr_) {
     const int angle_index =
         quadrature_set_ptr_->GetQuadraturePointIndex(quadrature_point_ptr);
-    auto mpi_solution = solution->GetSolution(angle_index);
-
-    system::moments::MomentVector angle_vector(mpi_solution);
+    const auto& mpi_solution = solution->GetSolution(angle_index);
     const double quadrature_point_weight = quadrature_point_ptr->weight();
 
-    if (return_vector.size() == 0) {
-      return_vector.reinit(angle_vector);
-      return_vector = 0.0;
+    if (is_first_angle) {
+      if (distributed_moment_.size() != mpi_solution.size())
+        distributed_moment_.reinit(mpi_solution);
+      distributed_moment_ = 0;
+      is_first_angle = false;
     }
 
-    return_vector.add(quadrature_point_weight, angle_vector);
-
+    distributed_moment_.add(quadrature_point_weight, mpi_solution);
   }
 
-  return return_vector;
+  if (is_first_angle) {
+    to_fill.reinit(0);
+  } else {
+    to_fill = distributed_moment_;
+  }
 }
 
 template class SphericalHarmonicZerothMoment<1>;
@@ -22,10 +22,19 @@ class SphericalHarmonicZerothMoment : public SphericalHarmonicMoments<dim> {
       system::moments::HarmonicL harmonic_l,
       system::moments::HarmonicL harmonic_m) const override;
 
+  void CalculateMoment(
+      system::moments::MomentVector& to_fill,
+      system::solution::MPIGroupAngularSolutionI *solution,
+      system::GroupNumber group,
+      system::moments::HarmonicL harmonic_l,
+      system::moments::HarmonicL harmonic_m) const override;
+
   virtual ~SphericalHarmonicZerothMoment() = default;
 
  protected:
   using SphericalHarmonicMoments<dim>::quadrature_set_ptr_;
+  //! Work vector for the weighted sum of the distributed angular solutions
+  mutable system::MPIVector distributed_moment_;
 };
 
 } // namespace calculators
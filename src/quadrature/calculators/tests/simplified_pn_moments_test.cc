@@ -0,0 +1,103 @@
+#include "quadrature/calculators/simplified_pn_moments.h"
+
+#include <array>
+
+#include <deal.II/base/mpi.h>
+
+#include "system/system_types.h"
+#include "system/moments/spherical_harmonic_types.h"
+#include "system/solution/tests/mpi_group_angular_solution_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::Return, ::testing::ReturnRef;
+
+void SetVector(system::MPIVector& to_set, double value) {
+  auto [first_row, last_row] = to_set.local_range();
+  for (unsigned int i = first_row; i < last_row; ++i)
+    to_set[i] = value;
+  to_set.compress(dealii::VectorOperation::insert);
+}
+
+/* Tests for the quadrature::calculators::SimplifiedPNMoments class, using the
+ * SP3 mapping from unknowns to moments.
+ */
+class QuadratureCalculatorsSimplifiedPNMomentsTest : public ::testing::Test {
+ protected:
+  QuadratureCalculatorsSimplifiedPNMomentsTest()
+      : unknowns_to_moments_(2, 2, unknowns_to_moments_values_.begin()) {}
+  // Supporting objects
+  system::solution::MPIGroupAngularSolutionMock mock_solution_;
+  std::array<system::MPIVector, 2> mpi_vectors_;
+  const std::array<double, 4> unknowns_to_moments_values_{1.0, -2.0/3.0,
+                                                          0.0, 1.0/3.0};
+  const dealii::FullMatrix<double> unknowns_to_moments_;
+
+  // Test parameters
+  const int n_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const int n_entries_per_proc = 10;
+
+  void SetUp() override;
+};
+
+void QuadratureCalculatorsSimplifiedPNMomentsTest::SetUp() {
+  for (int k = 0; k < 2; ++k) {
+    mpi_vectors_.at(k).reinit(MPI_COMM_WORLD,
+                              n_processes * n_entries_per_proc,
+                              n_entries_per_proc);
+    SetVector(mpi_vectors_.at(k), k + 1);
+    ON_CALL(mock_solution_, GetSolution(k))
+        .WillByDefault(ReturnRef(mpi_vectors_.at(k)));
+  }
+  ON_CALL(mock_solution_, total_angles()).WillByDefault(Return(2));
+}
+
+TEST_F(QuadratureCalculatorsSimplifiedPNMomentsTest, Constructor) {
+  quadrature::calculators::SimplifiedPNMoments test_calculator(
+      unknowns_to_moments_);
+  EXPECT_EQ(test_calculator.unknowns_to_moments(), unknowns_to_moments_);
+  EXPECT_ANY_THROW({
+    quadrature::calculators::SimplifiedPNMoments bad_calculator(
+        dealii::FullMatrix<double>(2, 3));
+  });
+}
+
+TEST_F(QuadratureCalculatorsSimplifiedPNMomentsTest, BadNumberOfAngles) {
+  quadrature::calculators::SimplifiedPNMoments test_calculator(
+      unknowns_to_moments_);
+
+  EXPECT_CALL(mock_solution_, total_angles()).WillOnce(Return(3));
+  EXPECT_ANY_THROW(test_calculator.CalculateMoment(&mock_solution_, 0, 0, 0));
+}
+
+TEST_F(QuadratureCalculatorsSimplifiedPNMomentsTest, CalculateMoment) {
+  quadrature::calculators::SimplifiedPNMoments test_calculator(
+      unknowns_to_moments_);
+  const int result_size = this->n_entries_per_proc*this->n_processes;
+
+  // Psi_0 = 1, Psi_1 = 2, so phi_0 = 1 - 4/3 and phi_2 = 2/3
+  struct MomentResult {
+    int harmonic_l;
+    int harmonic_m;
+    double value;
+  };
+  std::array<MomentResult, 5> expected_results{{{0, 0, -1.0/3.0},
+                                                {2, 0, 2.0/3.0},
+                                                {1, 0, 0.0},
+                                                {2, 1, 0.0},
+                                                {4, 0, 0.0}}};
+
+  for (const auto& [harmonic_l, harmonic_m, value] : expected_results) {
+    auto result = test_calculator.CalculateMoment(&mock_solution_, 0,
+                                                  harmonic_l, harmonic_m);
+    ASSERT_EQ(result.size(), result_size);
+    for (unsigned int i = 0; i < result.size(); ++i)
+      EXPECT_NEAR(result[i], value, 1e-12)
+          << "Moment l = " << harmonic_l << ", m = " << harmonic_m;
+  }
+}
+
+} // namespace
@@ -152,6 +152,35 @@ void FillQuadratureSet(
   }
 }
 
+template <int dim>
+void FillEvenParityQuadratureSet(
+    QuadratureSetI<dim>* to_fill,
+    const std::vector<std::pair<quadrature::CartesianPosition<dim>, quadrature::Weight>>& point_vector) {
+
+  AssertThrow(to_fill->size() == 0,
+      dealii::ExcMessage("Error in FillEvenParityQuadratureSet, set is not "
+                         "empty"))
+
+  for (const auto& [position, weight] : point_vector) {
+    auto ordinate_ptr = MakeOrdinatePtr<dim>();
+    ordinate_ptr->set_cartesian_position(position);
+
+    const auto reflected_position =
+        utility::ReflectAcrossOrigin<dim>(*ordinate_ptr);
+
+    // Each point also stands in for its reflection, unless it is the origin
+    double even_parity_weight = weight.get();
+    if (reflected_position != ordinate_ptr->cartesian_position())
+      even_parity_weight *= 2;
+
+    auto quadrature_point_ptr = MakeQuadraturePointPtr<dim>();
+    quadrature_point_ptr->SetOrdinate(ordinate_ptr).SetWeight(
+        quadrature::Weight(even_parity_weight));
+
+    to_fill->AddPoint(quadrature_point_ptr);
+  }
+}
+
 
 template std::shared_ptr<OrdinateI<1>> MakeOrdinatePtr(const OrdinateType);
 template std::shared_ptr<OrdinateI<2>> MakeOrdinatePtr(const OrdinateType);
@@ -175,6 +204,10 @@ template void FillQuadratureSet<1>(QuadratureSetI<1>*, const std::vector<std::pa
 template void FillQuadratureSet<2>(QuadratureSetI<2>*, const std::vector<std::pair<quadrature::CartesianPosition<2>, quadrature::Weight>>&);
 template void FillQuadratureSet<3>(QuadratureSetI<3>*, const std::vector<std::pair<quadrature::CartesianPosition<3>, quadrature::Weight>>&);
 
+template void FillEvenParityQuadratureSet<1>(QuadratureSetI<1>*, const std::vector<std::pair<quadrature::CartesianPosition<1>, quadrature::Weight>>&);
+template void FillEvenParityQuadratureSet<2>(QuadratureSetI<2>*, const std::vector<std::pair<quadrature::CartesianPosition<2>, quadrature::Weight>>&);
+template void FillEvenParityQuadratureSet<3>(QuadratureSetI<3>*, const std::vector<std::pair<quadrature::CartesianPosition<3>, quadrature::Weight>>&);
+
 } // namespace factory
 
 } // namespace quadrature
@@ -102,6 +102,27 @@ void FillQuadratureSet(
     const std::vector<std::pair<quadrature::CartesianPosition<dim>,
                                 quadrature::Weight>>& point_vector);
 
+/*! \brief Function to fill a quadrature set for even-parity formulations.
+ *
+ * The even-parity angular flux is the same for each direction and its
+ * reflection across the origin, so only one of each pair is needed. The points
+ * passed are added without their reflections, and the weight of each point is
+ * doubled so that the weights still sum to the same total (unless the point is
+ * its own reflection, i.e. the origin). The points passed should not contain
+ * any pair of reflections, which is the case for points generated by
+ * quadrature::utility::GenerateAllPositiveX. The quadrature set to fill must be
+ * empty or this will throw an error.
+ *
+ * @tparam dim spatial dimension of quadrature set to fill.
+ * @param to_fill quadrature set to fill.
+ * @param point_vector vector containing points to fill the quadrature set.
+ */
+template <int dim>
+void FillEvenParityQuadratureSet(
+    QuadratureSetI<dim>* to_fill,
+    const std::vector<std::pair<quadrature::CartesianPosition<dim>,
+                                quadrature::Weight>>& point_vector);
+
 } // namespace factory
 
 } // namespace quadrature
@@ -231,6 +231,62 @@ TYPED_TEST(QuadratureFactoriesIntegrationTest, FillQuadratureSetScalar) {
   }
 }
 
+// FillEvenParityQuadratureSet should only add the given points, with doubled weight
+TYPED_TEST(QuadratureFactoriesIntegrationTest, FillEvenParityQuadratureSet) {
+  const int dim = this->dim;
+  const int n_points = 3;
+  const int n_quadrants = std::pow(2, dim);
+
+  std::vector<std::pair<quadrature::CartesianPosition<dim>, quadrature::Weight>>
+      quadrature_points;
+
+  for (int i = 0; i < n_points; ++i) {
+    auto random_position = test_helpers::RandomVector(dim, 1, 10);
+    auto random_weight = test_helpers::RandomDouble(0, 2);
+    std::array<double, dim> position;
+    for (int j = 0; j < dim; ++j)
+      position.at(j) = random_position.at(j);
+    quadrature_points.emplace_back(quadrature::CartesianPosition<dim>(position),
+                                   quadrature::Weight(random_weight));
+  }
+
+  auto distributed_points =
+      quadrature::utility::GenerateAllPositiveX<dim>(quadrature_points);
+
+  auto quadrature_set_ptr = quadrature::factory::MakeQuadratureSetPtr<dim>();
+
+  quadrature::factory::FillEvenParityQuadratureSet<dim>(quadrature_set_ptr.get(),
+                                                        distributed_points);
+
+  // Only half of the points of the full set
+  EXPECT_EQ(quadrature_set_ptr->size(), n_points*n_quadrants/2);
+
+  double total_weight = 0, expected_total_weight = 0;
+  for (const auto& [position, weight] : distributed_points)
+    expected_total_weight += 2 * weight.get();
+
+  for (const auto& quadrature_point_ptr : *quadrature_set_ptr) {
+    quadrature::CartesianPosition<dim> position(
+        quadrature_point_ptr->ordinate()->cartesian_position());
+    total_weight += quadrature_point_ptr->weight();
+    EXPECT_GT(position.get().at(0), 0);
+    EXPECT_EQ(nullptr, quadrature_set_ptr->GetReflection(quadrature_point_ptr));
+
+    auto point_it = std::find_if(
+        distributed_points.cbegin(), distributed_points.cend(),
+        [&](const auto& point_pair) { return point_pair.first == position; });
+    ASSERT_NE(point_it, distributed_points.cend());
+    EXPECT_DOUBLE_EQ(quadrature_point_ptr->weight(), 2 * point_it->second.get());
+  }
+  EXPECT_NEAR(total_weight, expected_total_weight, 1e-12);
+
+  // Subsequent calls should throw an error (quadrature set is not empty)
+  EXPECT_ANY_THROW({
+    quadrature::factory::FillEvenParityQuadratureSet<dim>(
+        quadrature_set_ptr.get(), distributed_points);
+                   });
+}
+
 // MakeMomentCalculator should return the correct scalar moment implementation
 TYPED_TEST(QuadratureFactoriesIntegrationTest, MakeMomentCalculatorScalar) {
   const int dim = this->dim;
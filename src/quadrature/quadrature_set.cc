@@ -1,6 +1,7 @@
 #include "quadrature/quadrature_set.h"
 
 #include <algorithm>
+#include <cmath>
 
 namespace bart {
 
@@ -26,6 +27,7 @@ bool QuadratureSet<dim>::AddPoint(
     quadrature_point_indices_.insert(new_index);
     index_to_quadrature_point_map_.insert_or_assign(new_index, new_point_ptr);
     quadrature_point_to_index_map_.insert_or_assign(new_point_ptr, new_index);
+    AddBoundaryReflections(new_point_ptr, new_index);
   }
 
   return status.second;
@@ -35,62 +37,71 @@ template<int dim>
 std::shared_ptr<QuadraturePointI<dim>> QuadratureSet<dim>::GetBoundaryReflection(
     const std::shared_ptr<QuadraturePointI<dim>> &quadrature_point_to_reflect,
     problem::Boundary boundary) const {
-  using Boundary = problem::Boundary;
-
-  switch (boundary) {
-    case Boundary::kXMin: boundary = Boundary::kXMax; break;
-    case Boundary::kYMin: boundary = Boundary::kYMax; break;
-    case Boundary::kZMin: boundary = Boundary::kZMax; break;
-    default: break;
-  }
-
-  std::shared_ptr<QuadraturePointI<dim>> return_ptr = nullptr;
-
-  if (auto boundary_mapping = boundary_reflections_.find(boundary);
-      boundary_mapping != boundary_reflections_.end()) {
-    if (auto reflection_pair = boundary_mapping->second.find(quadrature_point_to_reflect);
-        reflection_pair != boundary_mapping->second.end()) {
-      return_ptr = reflection_pair->second;
-    }
-  } else {
-    boundary_reflections_.insert({boundary, {}});
-  }
+  auto index_it = quadrature_point_to_index_map_.find(quadrature_point_to_reflect);
+  AssertThrow(index_it != quadrature_point_to_index_map_.end(),
+              dealii::ExcMessage("Error in GetBoundaryReflection, quadrature "
+                                 "point is not in quadrature set."))
+  const int reflection_index =
+      GetBoundaryReflectionIndex(QuadraturePointIndex(index_it->second),
+                                 boundary);
+  return index_to_quadrature_point_map_.at(reflection_index);
+}
 
-  if (return_ptr == nullptr) {
-    auto position = quadrature_point_to_reflect->cartesian_position();
+template<int dim>
+int QuadratureSet<dim>::GetBoundaryReflectionIndex(
+    QuadraturePointIndex index, problem::Boundary boundary) const {
+  // Boundaries are ordered min, max for each direction x, y, z
+  const int direction = static_cast<int>(boundary) / 2;
+  AssertThrow(direction < dim,
+              dealii::ExcMessage("Error in GetBoundaryReflectionIndex, "
+                                 "boundary is not valid for this dimension"))
+  const auto& reflection_indices = boundary_reflection_indices_.at(direction);
+  AssertThrow(index.get() >= 0 &&
+              index.get() < static_cast<int>(reflection_indices.size()),
+              dealii::ExcMessage("Error in GetBoundaryReflectionIndex, index "
+                                 "is not in quadrature set."))
+  const int reflection_index = reflection_indices[index.get()];
+  AssertThrow(reflection_index >= 0,
+              dealii::ExcMessage("GetBoundaryReflection returned null reflection"))
+  return reflection_index;
+}
 
-    switch (boundary) {
-      case Boundary::kXMax: case Boundary::kXMin: {
-        position.at(0) *= -1;
-        break;
-      }
-      case Boundary::kYMin: case Boundary::kYMax: {
-        position.at(1) *= -1;
-        break;
-      }
-      case Boundary::kZMin: case Boundary::kZMax: {
-        position.at(2) *= -1;
-        break;
+template<int dim>
+void QuadratureSet<dim>::AddBoundaryReflections(
+    const std::shared_ptr<QuadraturePointI<dim>>& new_point_ptr,
+    const int new_index) {
+  const auto new_position = new_point_ptr->cartesian_position();
+
+  for (int direction = 0; direction < dim; ++direction) {
+    auto& reflection_indices = boundary_reflection_indices_.at(direction);
+    if (static_cast<int>(reflection_indices.size()) <= new_index)
+      reflection_indices.resize(new_index + 1, -1);
+
+    auto reflected_position = new_position;
+    reflected_position.at(direction) *= -1;
+
+    auto is_reflection = [&](const std::array<double, dim>& position) {
+      for (int i = 0; i < dim; ++i) {
+        if (std::abs(position.at(i) - reflected_position.at(i)) >
+            reflection_tolerance_ * std::max(1.0, std::abs(position.at(i))))
+          return false;
       }
+      return true;
+    };
+
+    if (is_reflection(new_position)) {
+      reflection_indices.at(new_index) = new_index;
+      continue;
     }
 
-    for (const auto& quadrature_point : this->quadrature_point_ptrs_) {
-      if (quadrature_point->cartesian_position() == position) {
-        return_ptr = quadrature_point;
+    for (const auto& [index, point_ptr] : index_to_quadrature_point_map_) {
+      if (index != new_index && is_reflection(point_ptr->cartesian_position())) {
+        reflection_indices.at(new_index) = index;
+        reflection_indices.at(index) = new_index;
         break;
       }
     }
-
-    boundary_reflections_.at(boundary).insert({quadrature_point_to_reflect,
-                                               return_ptr});
-    boundary_reflections_.at(boundary).insert({return_ptr,
-                                               quadrature_point_to_reflect});
-
-    AssertThrow(return_ptr != nullptr,
-                dealii::ExcMessage("GetBoundaryReflection returned null reflection"))
   }
-
-  return return_ptr;
 }
 
 template<int dim>
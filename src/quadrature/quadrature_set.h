@@ -4,6 +4,9 @@
 #include "quadrature/quadrature_set_i.h"
 #include "quadrature/utility/quadrature_utilities.h"
 
+#include <array>
+#include <vector>
+
 namespace bart {
 
 namespace quadrature {
@@ -22,6 +25,8 @@ class QuadratureSet : public QuadratureSetI<dim> {
   std::shared_ptr<QuadraturePointI<dim>> GetBoundaryReflection(
       const std::shared_ptr<QuadraturePointI<dim>>& quadrature_point_to_reflect,
       problem::Boundary boundary) const override;
+  int GetBoundaryReflectionIndex(QuadraturePointIndex index,
+                                 problem::Boundary boundary) const override;
   std::shared_ptr<QuadraturePointI<dim>> GetReflection(
       std::shared_ptr<QuadraturePointI<dim>>) const override;
   std::optional<int> GetReflectionIndex(
@@ -57,10 +62,20 @@ class QuadratureSet : public QuadratureSetI<dim> {
   //! Mapping of indices to quadrature point
   std::map<std::shared_ptr<QuadraturePointI<dim>>, int>
       quadrature_point_to_index_map_ = {};
-  //! Internal mapping of boundary reflections
-  mutable std::map<problem::Boundary, std::map<std::shared_ptr<QuadraturePointI<dim>>,
-                                               std::shared_ptr<QuadraturePointI<dim>>>>
-           boundary_reflections_;
+  /*! \brief Boundary reflection index tables, by direction (x, y, z) and
+   * quadrature point index. Points without a reflection are stored as -1.
+   */
+  std::array<std::vector<int>, 3> boundary_reflection_indices_;
+  //! Relative tolerance used to match reflected cartesian positions
+  static constexpr double reflection_tolerance_ = 1e-12;
+
+ private:
+  /*! \brief Adds a new point to the boundary reflection tables, pairing it
+   * with any existing point that is its reflection in each direction.
+   */
+  void AddBoundaryReflections(
+      const std::shared_ptr<QuadraturePointI<dim>>& new_point_ptr,
+      int new_index);
 };
 
 } // namespace quadrature
@@ -41,6 +41,19 @@ class QuadratureSetI {
       const std::shared_ptr<QuadraturePointI<dim>>&,
       const problem::Boundary) const = 0;
 
+  /*! \brief Returns the index of the reflection of a quadrature point against a
+   * boundary.
+   *
+   * Boundary reflections are tabulated as points are added, so this is a
+   * lookup that does not modify the set and is safe to call concurrently.
+   *
+   * @param index index of the quadrature point to reflect.
+   * @param boundary boundary to reflect against.
+   * @return index of the reflected quadrature point.
+   */
+  virtual int GetBoundaryReflectionIndex(QuadraturePointIndex index,
+                                         problem::Boundary boundary) const = 0;
+
   /// \brief Sets two points as reflections of each other.
   virtual void SetReflection(std::shared_ptr<QuadraturePointI<dim>>,
                              std::shared_ptr<QuadraturePointI<dim>>) = 0;
@@ -21,6 +21,8 @@ class QuadratureSetMock : public QuadratureSetI<dim> {
   MOCK_METHOD(std::shared_ptr<QuadraturePointI<dim>>, GetBoundaryReflection,
       (const std::shared_ptr<QuadraturePointI<dim>>&, const problem::Boundary),
       (override,const));
+  MOCK_METHOD(int, GetBoundaryReflectionIndex,
+              (QuadraturePointIndex, problem::Boundary), (override, const));
   MOCK_METHOD(std::shared_ptr<QuadraturePointI<dim>>, GetReflection,
               (std::shared_ptr<QuadraturePointI<dim>>), (override, const));
   MOCK_METHOD(std::optional<int>, GetReflectionIndex,
@@ -168,6 +168,62 @@ TYPED_TEST(QuadratureSetTest, GetBoundaryReflection) {
 
 }
 
+// Boundary reflection indices are tabulated as points are added
+TYPED_TEST(QuadratureSetTest, GetBoundaryReflectionIndex) {
+  constexpr int dim = this->dim;
+  using MockQuadraturePointType =  NiceMock<quadrature::QuadraturePointMock<dim>>;
+  using Boundary = problem::Boundary;
+  const quadrature::QuadraturePointIndex first_index(0), second_index(1);
+
+  EXPECT_ANY_THROW(this->test_set_.GetBoundaryReflectionIndex(first_index,
+                                                              Boundary::kXMin));
+
+  // Reflection with a small round-off error in the reflected position
+  auto mock_x_reflection = std::make_shared<MockQuadraturePointType>();
+  std::array<double, dim> x_reflected_position;
+  x_reflected_position.fill(1 + 1e-15);
+  x_reflected_position.at(0) = -1;
+  ON_CALL(*mock_x_reflection, cartesian_position())
+      .WillByDefault(Return(x_reflected_position));
+  this->test_set_.AddPoint(mock_x_reflection);
+  const int x_reflection_index =
+      this->test_set_.GetQuadraturePointIndex(mock_x_reflection);
+
+  for (const auto boundary : {Boundary::kXMin, Boundary::kXMax}) {
+    EXPECT_EQ(this->test_set_.GetBoundaryReflectionIndex(first_index, boundary),
+              x_reflection_index);
+    EXPECT_EQ(this->test_set_.GetBoundaryReflectionIndex(
+        quadrature::QuadraturePointIndex(x_reflection_index), boundary), 0);
+  }
+  EXPECT_ANY_THROW(this->test_set_.GetBoundaryReflectionIndex(second_index,
+                                                              Boundary::kXMax));
+  EXPECT_ANY_THROW(this->test_set_.GetBoundaryReflectionIndex(
+      quadrature::QuadraturePointIndex(x_reflection_index + 1),
+      Boundary::kXMax));
+
+  if (dim < 3) {
+    EXPECT_ANY_THROW(this->test_set_.GetBoundaryReflectionIndex(
+        first_index, Boundary::kZMax));
+  }
+}
+
+// Points with no component in a direction are their own boundary reflection
+TYPED_TEST(QuadratureSetTest, GetBoundaryReflectionIndexSelfReflection) {
+  constexpr int dim = this->dim;
+  using MockQuadraturePointType =  NiceMock<quadrature::QuadraturePointMock<dim>>;
+  auto mock_point = std::make_shared<MockQuadraturePointType>();
+  std::array<double, dim> position;
+  position.fill(0);
+  ON_CALL(*mock_point, cartesian_position()).WillByDefault(Return(position));
+
+  quadrature::QuadratureSet<dim> test_set;
+  test_set.AddPoint(mock_point);
+  EXPECT_EQ(test_set.GetBoundaryReflectionIndex(
+      quadrature::QuadraturePointIndex(0), problem::Boundary::kXMin), 0);
+  EXPECT_EQ(test_set.GetBoundaryReflection(mock_point, problem::Boundary::kXMax),
+            mock_point);
+}
+
 // Getters for quadrature point and index should retrieve the correct values
 TYPED_TEST(QuadratureSetTest, GetQuadraturePointAndIndex) {
   constexpr int dim = this->dim;
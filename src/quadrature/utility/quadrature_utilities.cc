@@ -67,10 +67,46 @@ std::vector<std::pair<CartesianPosition<3>, Weight>> GenerateAllPositiveX<3>(
   return quadrature_pairs;
 }
 
+template <int dim>
+std::set<std::pair<int, int>> ReflectedAnglePairs(
+    const QuadratureSetI<dim>& quadrature_set,
+    const std::unordered_set<problem::Boundary>& reflective_boundaries) {
+  std::set<std::pair<int, int>> return_set;
+
+  for (const int angle : quadrature_set.quadrature_point_indices()) {
+    const auto quadrature_point_ptr =
+        quadrature_set.GetQuadraturePoint(QuadraturePointIndex(angle));
+    const auto position = quadrature_point_ptr->cartesian_position();
+
+    for (const auto boundary : reflective_boundaries) {
+      // Boundaries are ordered min, max for each direction x, y, z
+      const int boundary_id = static_cast<int>(boundary);
+      const int direction = boundary_id / 2;
+      if (direction >= dim)
+        continue;
+      const double normal = (boundary_id % 2 == 0) ? -1.0 : 1.0;
+
+      if (normal * position.at(direction) < 0) {
+        const int reflected_angle = quadrature_set.GetBoundaryReflectionIndex(
+            QuadraturePointIndex(angle), boundary);
+        return_set.insert({angle, reflected_angle});
+      }
+    }
+  }
+  return return_set;
+}
+
 template std::array<double, 1> ReflectAcrossOrigin<1>(const OrdinateI<1>&);
 template std::array<double, 2> ReflectAcrossOrigin<2>(const OrdinateI<2>&);
 template std::array<double, 3> ReflectAcrossOrigin<3>(const OrdinateI<3>&);
 
+template std::set<std::pair<int, int>> ReflectedAnglePairs<1>(
+    const QuadratureSetI<1>&, const std::unordered_set<problem::Boundary>&);
+template std::set<std::pair<int, int>> ReflectedAnglePairs<2>(
+    const QuadratureSetI<2>&, const std::unordered_set<problem::Boundary>&);
+template std::set<std::pair<int, int>> ReflectedAnglePairs<3>(
+    const QuadratureSetI<3>&, const std::unordered_set<problem::Boundary>&);
+
 } // namespace utility
 
 } // namespace quadrature
@@ -1,8 +1,14 @@
 #ifndef BART_SRC_QUADRATURE_UTILITY_QUADRATURE_UTILITIES_H_
 #define BART_SRC_QUADRATURE_UTILITY_QUADRATURE_UTILITIES_H_
 
+#include <set>
+#include <unordered_set>
+#include <utility>
+
 #include "quadrature/quadrature_point_i.h"
+#include "quadrature/quadrature_set_i.h"
 #include "quadrature/ordinate_i.h"
+#include "problem/parameter_types.h"
 
 namespace bart {
 
@@ -33,6 +39,22 @@ template <int dim>
 std::vector<std::pair<CartesianPosition<dim>, Weight>> GenerateAllPositiveX(
     const std::vector<std::pair<CartesianPosition<dim>, Weight>>&);
 
+/*! \brief Gets all pairs of angles that are coupled by reflective boundaries.
+ *
+ * An angle is coupled to its reflection across a reflective boundary if it is
+ * incoming on that boundary, \f$\hat{n}\cdot\vec{\Omega} < 0\f$. Boundaries
+ * that do not exist in the given spatial dimension are ignored.
+ *
+ * @tparam dim spatial dimension.
+ * @param quadrature_set quadrature set to get the angles from.
+ * @param reflective_boundaries reflective boundaries.
+ * @return set of pairs of (incoming angle index, reflected angle index).
+ */
+template <int dim>
+std::set<std::pair<int, int>> ReflectedAnglePairs(
+    const QuadratureSetI<dim>& quadrature_set,
+    const std::unordered_set<problem::Boundary>& reflective_boundaries);
+
 /*! \brief Struct to compare two quadrature points based on cartesian position.
  * This is required for using quadrature points in any associative container
  * such as maps, sets, etc.
@@ -151,4 +151,46 @@ TYPED_TEST(QuadratureUtilityTests, QuadraturePointCompare) {
   EXPECT_EQ(const_result, expected_result);
 }
 
-} // namespace
\ No newline at end of file
+// ReflectedAnglePairs should only pair angles incoming on reflective boundaries
+TYPED_TEST(QuadratureUtilityTests, ReflectedAnglePairs) {
+  constexpr int dim = this->dim;
+  using ::testing::Return, ::testing::_;
+
+  quadrature::QuadratureSetMock<dim> mock_quadrature_set;
+  std::array<std::shared_ptr<quadrature::QuadraturePointMock<dim>>, 2> mock_points;
+
+  for (int i = 0; i < 2; ++i) {
+    mock_points.at(i) = std::make_shared<quadrature::QuadraturePointMock<dim>>();
+    std::array<double, dim> position;
+    position.fill(0.5);
+    // Second point is the reflection of the first across the x-axis
+    if (i == 1)
+      position.at(0) *= -1;
+    ON_CALL(*mock_points.at(i), cartesian_position())
+        .WillByDefault(Return(position));
+    ON_CALL(mock_quadrature_set,
+            GetQuadraturePoint(quadrature::QuadraturePointIndex(i)))
+        .WillByDefault(Return(mock_points.at(i)));
+  }
+  EXPECT_CALL(mock_quadrature_set, quadrature_point_indices())
+      .WillOnce(Return(std::set<int>{0, 1}));
+  EXPECT_CALL(mock_quadrature_set, GetQuadraturePoint(_)).Times(2);
+  EXPECT_CALL(mock_quadrature_set,
+              GetBoundaryReflectionIndex(quadrature::QuadraturePointIndex(0),
+                                         problem::Boundary::kXMin))
+      .WillOnce(Return(1));
+  EXPECT_CALL(mock_quadrature_set,
+              GetBoundaryReflectionIndex(quadrature::QuadraturePointIndex(1),
+                                         problem::Boundary::kXMax))
+      .WillOnce(Return(0));
+
+  const std::unordered_set<problem::Boundary> reflective_boundaries{
+      problem::Boundary::kXMin, problem::Boundary::kXMax,
+      problem::Boundary::kZMax};
+  const std::set<std::pair<int, int>> expected_pairs{{0, 1}, {1, 0}};
+
+  EXPECT_EQ(quadrature::utility::ReflectedAnglePairs<dim>(
+      mock_quadrature_set, reflective_boundaries), expected_pairs);
+}
+
+} // namespace
@@ -11,21 +11,42 @@ auto SolverBuilder::BuildSolver(const SolverName name, const int max_iterations,
   // Build linear solver
   std::unique_ptr<linear::LinearI> linear_solver_ptr;
   switch (name) {
-    case SolverName::kDefaultGMRESGroupSolver: {
+    case SolverName::kDefaultGMRESGroupSolver:
+    case SolverName::kReflectiveBlockGMRESGroupSolver: {
       linear_solver_ptr = std::move(linear::LinearIFactory<int, double>::get()
                                         .GetConstructor(linear::LinearSolverName::kGMRES)
                                             (max_iterations, convergence_tolerance));
+      break;
+    }
+    case SolverName::kDefaultCGGroupSolver: {
+      linear_solver_ptr = std::move(linear::LinearIFactory<int, double>::get()
+                                        .GetConstructor(linear::LinearSolverName::kCG)
+                                            (max_iterations, convergence_tolerance));
+      break;
+    }
+    case SolverName::kMixedPrecisionGMRESGroupSolver: {
+      linear_solver_ptr = std::move(linear::LinearIFactory<int, double>::get()
+                                        .GetConstructor(linear::LinearSolverName::kMixedPrecisionGMRES)
+                                            (max_iterations, convergence_tolerance));
+      break;
     }
   }
 
   // Build group solver
   std::unique_ptr<group::SingleGroupSolverI> return_ptr;
   switch (name) {
-    case SolverName::kDefaultGMRESGroupSolver: {
+    case SolverName::kDefaultGMRESGroupSolver:
+    case SolverName::kDefaultCGGroupSolver:
+    case SolverName::kMixedPrecisionGMRESGroupSolver: {
       return solver::group::SingleGroupSolverIFactory<std::unique_ptr<linear::LinearI>>::get()
           .GetConstructor(solver::group::GroupSolverName::kDefaultImplementation)
               (std::move(linear_solver_ptr));
     }
+    case SolverName::kReflectiveBlockGMRESGroupSolver: {
+      return solver::group::SingleGroupSolverIFactory<std::unique_ptr<linear::LinearI>, int, double>::get()
+          .GetConstructor(solver::group::GroupSolverName::kReflectiveBlock)
+              (std::move(linear_solver_ptr), max_iterations, convergence_tolerance);
+    }
   }
   return nullptr;
 }
@@ -36,6 +57,15 @@ auto SolverBuilder::BuildSolver(const SolverName name) -> std::unique_ptr<group:
     case SolverName::kDefaultGMRESGroupSolver: {
       return BuildSolver(SolverName::kDefaultGMRESGroupSolver, 100, 1e-10);
     }
+    case SolverName::kReflectiveBlockGMRESGroupSolver: {
+      return BuildSolver(SolverName::kReflectiveBlockGMRESGroupSolver, 100, 1e-10);
+    }
+    case SolverName::kDefaultCGGroupSolver: {
+      return BuildSolver(SolverName::kDefaultCGGroupSolver, 100, 1e-10);
+    }
+    case SolverName::kMixedPrecisionGMRESGroupSolver: {
+      return BuildSolver(SolverName::kMixedPrecisionGMRESGroupSolver, 100, 1e-10);
+    }
   }
   return nullptr;
 }
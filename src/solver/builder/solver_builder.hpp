@@ -7,6 +7,9 @@ namespace bart::solver::builder {
 
 enum class SolverName {
   kDefaultGMRESGroupSolver = 0,
+  kReflectiveBlockGMRESGroupSolver = 1,
+  kDefaultCGGroupSolver = 2,
+  kMixedPrecisionGMRESGroupSolver = 3,
 };
 
 class SolverBuilder {
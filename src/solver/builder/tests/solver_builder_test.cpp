@@ -1,7 +1,10 @@
 #include "solver/builder/solver_builder.hpp"
 
+#include "solver/group/reflective_block_group_solver.h"
 #include "solver/group/single_group_solver.h"
+#include "solver/linear/cg.h"
 #include "solver/linear/gmres.h"
+#include "solver/linear/mixed_precision_gmres.h"
 
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_helper_functions.h"
@@ -46,4 +49,54 @@ TEST_F(SolverBuilderDefaultGMRESTest, SetParameters) {
   EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), convergence_tolerance);
 }
 
+TEST(SolverBuilderDefaultCGTest, SetParameters) {
+  using ExpectedGroupSolver = solver::group::SingleGroupSolver;
+  using ExpectedLinearSolver = solver::linear::CG;
+  const int max_iterations { test_helpers::RandomInt(150, 200) };
+  const double convergence_tolerance { test_helpers::RandomDouble(1e-10, 1e-6) };
+  auto solver_ptr = builder::SolverBuilder::BuildSolver(SolverName::kDefaultCGGroupSolver,
+                                                        max_iterations, convergence_tolerance);
+  ASSERT_NE(solver_ptr, nullptr);
+  auto group_solver_ptr = dynamic_cast<ExpectedGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(group_solver_ptr, nullptr);
+  auto linear_solver_ptr = dynamic_cast<ExpectedLinearSolver*>(group_solver_ptr->linear_solver_ptr());
+  ASSERT_NE(linear_solver_ptr, nullptr);
+  EXPECT_EQ(linear_solver_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), convergence_tolerance);
+}
+
+TEST(SolverBuilderMixedPrecisionGMRESTest, SetParameters) {
+  using ExpectedGroupSolver = solver::group::SingleGroupSolver;
+  using ExpectedLinearSolver = solver::linear::MixedPrecisionGMRES;
+  const int max_iterations { test_helpers::RandomInt(150, 200) };
+  const double convergence_tolerance { test_helpers::RandomDouble(1e-10, 1e-6) };
+  auto solver_ptr = builder::SolverBuilder::BuildSolver(SolverName::kMixedPrecisionGMRESGroupSolver,
+                                                        max_iterations, convergence_tolerance);
+  ASSERT_NE(solver_ptr, nullptr);
+  auto group_solver_ptr = dynamic_cast<ExpectedGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(group_solver_ptr, nullptr);
+  auto linear_solver_ptr = dynamic_cast<ExpectedLinearSolver*>(group_solver_ptr->linear_solver_ptr());
+  ASSERT_NE(linear_solver_ptr, nullptr);
+  EXPECT_EQ(linear_solver_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), convergence_tolerance);
+}
+
+TEST(SolverBuilderReflectiveBlockGMRESTest, SetParameters) {
+  using ExpectedGroupSolver = solver::group::ReflectiveBlockGroupSolver;
+  using ExpectedLinearSolver = solver::linear::GMRES;
+  const int max_iterations { test_helpers::RandomInt(150, 200) };
+  const double convergence_tolerance { test_helpers::RandomDouble(1e-10, 1e-6) };
+  auto solver_ptr = builder::SolverBuilder::BuildSolver(SolverName::kReflectiveBlockGMRESGroupSolver,
+                                                        max_iterations, convergence_tolerance);
+  ASSERT_NE(solver_ptr, nullptr);
+  auto group_solver_ptr = dynamic_cast<ExpectedGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(group_solver_ptr, nullptr);
+  EXPECT_EQ(group_solver_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(group_solver_ptr->convergence_tolerance(), convergence_tolerance);
+  auto linear_solver_ptr = dynamic_cast<ExpectedLinearSolver*>(group_solver_ptr->linear_solver_ptr());
+  ASSERT_NE(linear_solver_ptr, nullptr);
+  EXPECT_EQ(linear_solver_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), convergence_tolerance);
+}
+
 } // namespace
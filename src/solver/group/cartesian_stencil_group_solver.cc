@@ -0,0 +1,103 @@
+#include "solver/group/cartesian_stencil_group_solver.h"
+
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include "system/system.h"
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+template <int dim>
+CartesianStencilGroupSolver<dim>::CartesianStencilGroupSolver(
+    std::shared_ptr<DomainType> domain_ptr,
+    StencilFunction stencil_function,
+    const int max_iterations,
+    const double convergence_tolerance)
+    : domain_ptr_(domain_ptr),
+      stencil_function_(std::move(stencil_function)),
+      max_iterations_(max_iterations),
+      convergence_tolerance_(convergence_tolerance) {
+  AssertThrow(domain_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of "
+                                 "CartesianStencilGroupSolver, domain pointer "
+                                 "passed is null"))
+  AssertThrow(stencil_function_ != nullptr,
+              dealii::ExcMessage("Error in constructor of "
+                                 "CartesianStencilGroupSolver, stencil "
+                                 "function is empty"))
+  AssertThrow(max_iterations_ > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "CartesianStencilGroupSolver, max iterations "
+                                 "must be > 0"))
+  AssertThrow(convergence_tolerance_ > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "CartesianStencilGroupSolver, convergence "
+                                 "tolerance must be > 0"))
+  lattice_ptr_ = std::make_shared<const domain::CartesianLattice<dim>>(
+      *domain_ptr_);
+}
+
+template <int dim>
+auto CartesianStencilGroupSolver<dim>::GetStencil(
+    const system::Index& index) -> const StencilType& {
+  auto& stencil_ptr = stencils_[index];
+  if (stencil_ptr == nullptr) {
+    stencil_ptr = std::make_unique<StencilType>(lattice_ptr_);
+    stencil_function_(*stencil_ptr, index);
+
+    dealii::Vector<double> inverse_diagonal;
+    stencil_ptr->Diagonal(inverse_diagonal);
+    for (auto& entry : inverse_diagonal)
+      entry = 1.0/entry;
+    preconditioners_[index].reinit(std::move(inverse_diagonal));
+  }
+  return *stencil_ptr;
+}
+
+template <int dim>
+void CartesianStencilGroupSolver<dim>::SolveGroup(
+    const int group,
+    const system::System &system,
+    system::solution::MPIGroupAngularSolutionI &group_solution) {
+  const int total_angles = group_solution.total_angles();
+  AssertThrow(total_angles > 0,
+              dealii::ExcMessage("Error in SolveGroup, total angles provided by "
+                                 "group solution must be > 0"))
+  AssertThrow(group >= 0,
+              dealii::ExcMessage("Error in SolveGroup, invalid group index "
+                                 "provided, value is less than zero"))
+
+  for (int angle = 0; angle < total_angles; ++angle) {
+    system::Index index{group, angle};
+    auto& solution = group_solution[angle];
+    auto right_hand_side_ptr = system.right_hand_side_ptr_->GetFullTermPtr(index);
+    const auto& stencil = GetStencil(index);
+
+    // The previous solution is used as the initial guess
+    lattice_ptr_->ToLattice(*right_hand_side_ptr, right_hand_side_);
+    lattice_ptr_->ToLattice(solution, solution_);
+
+    dealii::SolverControl solver_control(max_iterations_,
+                                         convergence_tolerance_);
+    dealii::SolverCG<dealii::Vector<double>> solver(solver_control);
+    solver.solve(stencil, solution_, right_hand_side_,
+                 preconditioners_.at(index));
+
+    lattice_ptr_->FromLattice(solution_, solution);
+  }
+}
+
+template class CartesianStencilGroupSolver<1>;
+template class CartesianStencilGroupSolver<2>;
+template class CartesianStencilGroupSolver<3>;
+
+} // namespace group
+
+} // namespace solver
+
+} // namespace bart
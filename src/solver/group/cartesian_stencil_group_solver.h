@@ -0,0 +1,86 @@
+#ifndef BART_SRC_SOLVER_GROUP_CARTESIAN_STENCIL_GROUP_SOLVER_H_
+#define BART_SRC_SOLVER_GROUP_CARTESIAN_STENCIL_GROUP_SOLVER_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "domain/cartesian_lattice.h"
+#include "domain/definition_i.h"
+#include "formulation/cartesian_stencil.h"
+#include "solver/group/single_group_solver_i.h"
+#include "system/system_types.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+/*! \brief Solves a group on a uniform Cartesian mesh using stencil operators.
+ *
+ * Instead of the assembled left hand side of the system, each angle is solved
+ * using a formulation::CartesianStencil, filled by the provided stencil
+ * function with the same terms the updaters stamp into the system matrix. The
+ * right hand side and solution are copied to lattice ordering and the system
+ * is solved with Jacobi preconditioned conjugate gradient, so the left hand
+ * side must be symmetric positive definite (diffusion and SAAF without
+ * implicit reflective boundaries).
+ *
+ * Stencils only depend on the group and angle, they are filled on the first
+ * solve of each and reused. Only available when running on a single process.
+ *
+ * @tparam dim spatial dimension.
+ */
+template <int dim>
+class CartesianStencilGroupSolver : public SingleGroupSolverI {
+ public:
+  using DomainType = domain::DefinitionI<dim>;
+  using StencilType = formulation::CartesianStencil<dim>;
+  //! Fills the stencil of the left hand side for a group and angle
+  using StencilFunction = std::function<void(StencilType&, const system::Index&)>;
+
+  CartesianStencilGroupSolver(std::shared_ptr<DomainType> domain_ptr,
+                              StencilFunction stencil_function,
+                              const int max_iterations = 1000,
+                              const double convergence_tolerance = 1e-10);
+  virtual ~CartesianStencilGroupSolver() = default;
+
+  void SolveGroup(const int group,
+                  const system::System &system,
+                  system::solution::MPIGroupAngularSolutionI &group_solution) override;
+
+  /*! \brief Returns the stencil for a group and angle, filling it if needed. */
+  const StencilType& GetStencil(const system::Index& index);
+
+  DomainType* domain_ptr() const { return domain_ptr_.get(); }
+  const domain::CartesianLattice<dim>* lattice_ptr() const {
+    return lattice_ptr_.get(); }
+  int max_iterations() const { return max_iterations_; }
+  double convergence_tolerance() const { return convergence_tolerance_; }
+
+ private:
+  using Preconditioner = dealii::DiagonalMatrix<dealii::Vector<double>>;
+
+  std::shared_ptr<DomainType> domain_ptr_;
+  std::shared_ptr<const domain::CartesianLattice<dim>> lattice_ptr_;
+  StencilFunction stencil_function_;
+  const int max_iterations_;
+  const double convergence_tolerance_;
+  std::map<system::Index, std::unique_ptr<StencilType>> stencils_;
+  //! Inverse of the diagonal of each stencil
+  std::map<system::Index, Preconditioner> preconditioners_;
+  //! Lattice ordered right hand side and solution
+  dealii::Vector<double> right_hand_side_, solution_;
+};
+
+} // namespace group
+
+} // namespace solver
+
+} // namespace bart
+
+#endif //BART_SRC_SOLVER_GROUP_CARTESIAN_STENCIL_GROUP_SOLVER_H_
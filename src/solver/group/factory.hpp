@@ -9,6 +9,7 @@ class SingleGroupSolverI;
 
 enum class GroupSolverName {
   kDefaultImplementation = 0, // solver::group::SingleGroupSolver
+  kReflectiveBlock = 1, // solver::group::ReflectiveBlockGroupSolver
 };
 
 BART_INTERFACE_FACTORY(SingleGroupSolverI, GroupSolverName)
@@ -17,6 +18,8 @@ BART_INTERFACE_FACTORY(SingleGroupSolverI, GroupSolverName)
   switch (to_convert) {
     case GroupSolverName::kDefaultImplementation:
       return std::string{"GroupSolverName::kDefaultImplementation"};
+    case GroupSolverName::kReflectiveBlock:
+      return std::string{"GroupSolverName::kReflectiveBlock"};
   }
 }
 
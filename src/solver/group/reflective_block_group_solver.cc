@@ -0,0 +1,220 @@
+#include "solver/group/reflective_block_group_solver.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <utility>
+
+#include <deal.II/lac/petsc_block_vector.h>
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/solver_gmres.h>
+
+#include "solver/group/factory.hpp"
+#include "system/system.h"
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+namespace {
+
+using BlockVector = dealii::PETScWrappers::MPI::BlockVector;
+
+/* Linear operator for an orbit of reflectively coupled angles. The diagonal
+ * blocks are the full left hand side for each angle, the off-diagonal blocks
+ * are the reflective coupling terms. */
+class OrbitOperator {
+ public:
+  struct CouplingBlock {
+    int row_block;
+    int column_block;
+    std::shared_ptr<system::MPISparseMatrix> matrix_ptr;
+  };
+
+  void vmult(BlockVector& dst, const BlockVector& src) const {
+    for (unsigned int block = 0; block < diagonal_blocks.size(); ++block)
+      diagonal_blocks.at(block)->vmult(dst.block(block), src.block(block));
+    for (const auto& coupling : coupling_blocks)
+      coupling.matrix_ptr->vmult_add(dst.block(coupling.row_block),
+                                     src.block(coupling.column_block));
+  }
+
+  std::vector<std::shared_ptr<system::MPISparseMatrix>> diagonal_blocks{};
+  std::vector<CouplingBlock> coupling_blocks{};
+};
+
+/* Block Jacobi preconditioner, applies a Jacobi preconditioner of each
+ * diagonal angular block of the orbit operator. */
+class BlockJacobiPreconditioner {
+ public:
+  void vmult(BlockVector& dst, const BlockVector& src) const {
+    for (unsigned int block = 0; block < block_preconditioners.size(); ++block)
+      block_preconditioners.at(block)->vmult(dst.block(block), src.block(block));
+  }
+
+  std::vector<std::unique_ptr<dealii::PETScWrappers::PreconditionJacobi>>
+      block_preconditioners{};
+};
+
+} // namespace
+
+ReflectiveBlockGroupSolver::ReflectiveBlockGroupSolver(
+    std::unique_ptr<LinearSolver> linear_solver_ptr,
+    const int max_iterations,
+    const double convergence_tolerance)
+    : SingleGroupSolver(std::move(linear_solver_ptr)),
+      block_solver_control_(max_iterations, convergence_tolerance) {
+  AssertThrow(linear_solver_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of "
+                                 "ReflectiveBlockGroupSolver, linear solver "
+                                 "pointer passed is null"))
+  AssertThrow(max_iterations > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "ReflectiveBlockGroupSolver, max iterations "
+                                 "must be greater than 0"))
+  AssertThrow(convergence_tolerance > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "ReflectiveBlockGroupSolver, convergence "
+                                 "tolerance must be greater than 0"))
+}
+
+bool ReflectiveBlockGroupSolver::is_registered_ =
+    SingleGroupSolverIFactory<std::unique_ptr<LinearSolver>, int, double>::get()
+    .RegisterConstructor(GroupSolverName::kReflectiveBlock,
+        [](std::unique_ptr<LinearSolver> linear_solver_ptr,
+           int max_iterations, double convergence_tolerance) {
+          std::unique_ptr<SingleGroupSolverI> return_ptr =
+              std::make_unique<ReflectiveBlockGroupSolver>(
+                  std::move(linear_solver_ptr), max_iterations,
+                  convergence_tolerance);
+          return return_ptr; });
+
+auto ReflectiveBlockGroupSolver::GetAngleOrbits(const system::System& system,
+                                                const int total_angles)
+-> std::vector<AngleOrbit> {
+  // Union-find over the coupled angles
+  std::vector<int> parent(total_angles);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find_root = [&parent](int angle) {
+    while (parent.at(angle) != angle) {
+      parent.at(angle) = parent.at(parent.at(angle));
+      angle = parent.at(angle);
+    }
+    return angle;
+  };
+
+  for (const auto& [coupling_index, coupling_matrix_ptr] :
+      system.reflective_coupling_terms) {
+    const auto [angle, coupled_angle] = coupling_index;
+    AssertThrow(angle >= 0 && angle < total_angles &&
+                coupled_angle >= 0 && coupled_angle < total_angles,
+                dealii::ExcMessage("Error in ReflectiveBlockGroupSolver, "
+                                   "reflective coupling term index is not a "
+                                   "valid angle"))
+    const int angle_root = find_root(angle), coupled_root = find_root(coupled_angle);
+    if (angle_root != coupled_root)
+      parent.at(std::max(angle_root, coupled_root)) = std::min(angle_root,
+                                                               coupled_root);
+  }
+
+  std::map<int, AngleOrbit> orbits_by_root;
+  for (int angle = 0; angle < total_angles; ++angle)
+    orbits_by_root[find_root(angle)].push_back(angle);
+
+  std::vector<AngleOrbit> return_vector;
+  return_vector.reserve(orbits_by_root.size());
+  for (auto& [root, orbit] : orbits_by_root)
+    return_vector.push_back(std::move(orbit));
+  return return_vector;
+}
+
+void ReflectiveBlockGroupSolver::SolveGroup(
+    const int group,
+    const system::System &system,
+    system::solution::MPIGroupAngularSolutionI &group_solution) {
+  const int total_angles = group_solution.total_angles();
+  AssertThrow(total_angles > 0,
+      dealii::ExcMessage("Error in SolveGroup, total angles provided by group "
+                         "solution must be > 0"));
+  AssertThrow(group >= 0,
+      dealii::ExcMessage("Error in SolveGroup, invalid group index provided, "
+                         "value is less than zero"));
+
+  for (const auto& orbit : GetAngleOrbits(system, total_angles)) {
+    if (orbit.size() == 1) {
+      const int angle = orbit.front();
+      system::Index index{group, angle};
+      auto& solution = group_solution[angle];
+      auto left_hand_side_ptr = system.left_hand_side_ptr_->GetFullTermPtr(index);
+      auto right_hand_side_ptr = system.right_hand_side_ptr_->GetFullTermPtr(index);
+      dealii::PETScWrappers::PreconditionNone no_conditioner(*left_hand_side_ptr);
+
+      linear_solver_ptr_->Solve(
+          left_hand_side_ptr.get(),
+          &solution,
+          right_hand_side_ptr.get(),
+          &no_conditioner);
+    } else {
+      SolveOrbit(group, orbit, system, group_solution);
+    }
+  }
+}
+
+void ReflectiveBlockGroupSolver::SolveOrbit(
+    const int group,
+    const AngleOrbit& orbit,
+    const system::System& system,
+    system::solution::MPIGroupAngularSolutionI& group_solution) {
+  const int n_blocks = orbit.size();
+  std::map<system::AngleIndex, int> block_by_angle;
+  for (int block = 0; block < n_blocks; ++block)
+    block_by_angle[orbit.at(block)] = block;
+
+  OrbitOperator orbit_operator;
+  BlockJacobiPreconditioner preconditioner;
+  BlockVector solution, right_hand_side;
+  solution.reinit(n_blocks);
+  right_hand_side.reinit(n_blocks);
+
+  for (int block = 0; block < n_blocks; ++block) {
+    system::Index index{group, orbit.at(block)};
+    auto left_hand_side_ptr = system.left_hand_side_ptr_->GetFullTermPtr(index);
+    orbit_operator.diagonal_blocks.push_back(left_hand_side_ptr);
+    preconditioner.block_preconditioners.push_back(
+        std::make_unique<dealii::PETScWrappers::PreconditionJacobi>(
+            *left_hand_side_ptr));
+    auto right_hand_side_ptr = system.right_hand_side_ptr_->GetFullTermPtr(index);
+    right_hand_side.block(block).reinit(*right_hand_side_ptr, true);
+    right_hand_side.block(block) = *right_hand_side_ptr;
+    auto& angle_solution = group_solution[orbit.at(block)];
+    solution.block(block).reinit(angle_solution, true);
+    solution.block(block) = angle_solution;
+  }
+  solution.collect_sizes();
+  right_hand_side.collect_sizes();
+
+  for (const auto& [coupling_index, coupling_matrix_ptr] :
+      system.reflective_coupling_terms) {
+    if (const auto row = block_by_angle.find(coupling_index.first);
+        row != block_by_angle.end()) {
+      orbit_operator.coupling_blocks.push_back(
+          {row->second, block_by_angle.at(coupling_index.second),
+           coupling_matrix_ptr});
+    }
+  }
+
+  dealii::SolverGMRES<BlockVector> solver(block_solver_control_);
+  solver.solve(orbit_operator, solution, right_hand_side, preconditioner);
+
+  for (int block = 0; block < n_blocks; ++block)
+    group_solution[orbit.at(block)] = solution.block(block);
+}
+
+} // namespace group
+
+} // namespace solver
+
+} //namespace bart
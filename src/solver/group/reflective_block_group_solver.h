@@ -0,0 +1,70 @@
+#ifndef BART_SRC_SOLVER_GROUP_REFLECTIVE_BLOCK_GROUP_SOLVER_H_
+#define BART_SRC_SOLVER_GROUP_REFLECTIVE_BLOCK_GROUP_SOLVER_H_
+
+#include <memory>
+#include <vector>
+
+#include <deal.II/lac/solver_control.h>
+
+#include "solver/group/single_group_solver.h"
+#include "system/system_types.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+/*! \brief Group solver that treats reflective boundaries implicitly.
+ *
+ * Angles that are coupled through the reflective coupling terms in the system,
+ * System::reflective_coupling_terms, are gathered into orbits (connected sets
+ * of angles that reflect into each other). Each orbit is solved as a single
+ * block system with GMRES, where the operator applies the diagonal angular
+ * left hand side and adds the off-diagonal coupling terms, so the incoming
+ * reflected flux is resolved inside the Krylov iteration instead of being
+ * lagged. The block system is preconditioned with a Jacobi preconditioner of
+ * each diagonal angular block. Angles that are not coupled are solved individually by the provided
+ * linear solver, as in SingleGroupSolver.
+ */
+class ReflectiveBlockGroupSolver : public SingleGroupSolver {
+ public:
+  using AngleOrbit = std::vector<system::AngleIndex>;
+
+  ReflectiveBlockGroupSolver(std::unique_ptr<LinearSolver> linear_solver_ptr,
+                             const int max_iterations = 1000,
+                             const double convergence_tolerance = 1e-10);
+  virtual ~ReflectiveBlockGroupSolver() = default;
+
+  void SolveGroup(const int group,
+                  const system::System &system,
+                  system::solution::MPIGroupAngularSolutionI &group_solution) override;
+
+  /*! \brief Returns the orbits of coupled angles in a system.
+   *
+   * Each orbit is sorted, and angles not coupled to any other angle are
+   * returned as single angle orbits.
+   */
+  static std::vector<AngleOrbit> GetAngleOrbits(const system::System& system,
+                                                const int total_angles);
+
+  int max_iterations() const { return block_solver_control_.max_steps(); }
+  double convergence_tolerance() const {
+    return block_solver_control_.tolerance(); }
+  const dealii::SolverControl& block_solver_control() const {
+    return block_solver_control_; }
+ protected:
+  void SolveOrbit(const int group, const AngleOrbit& orbit,
+                  const system::System& system,
+                  system::solution::MPIGroupAngularSolutionI& group_solution);
+  dealii::SolverControl block_solver_control_;
+  static bool is_registered_;
+};
+
+} // namespace group
+
+} // namespace solver
+
+} //namespace bart
+
+#endif //BART_SRC_SOLVER_GROUP_REFLECTIVE_BLOCK_GROUP_SOLVER_H_
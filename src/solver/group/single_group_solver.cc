@@ -22,6 +22,13 @@ bool SingleGroupSolver::is_registered_ =
               std::make_unique<SingleGroupSolver>(std::move(linear_solver_ptr));
           return return_ptr; });
 
+SingleGroupSolver& SingleGroupSolver::SetPreconditioner(
+    PreconditionerFactory preconditioner_factory) {
+  preconditioner_factory_ = std::move(preconditioner_factory);
+  preconditioners_.clear();
+  return *this;
+}
+
 void SingleGroupSolver::SolveGroup(const int group,
                                    const system::System &system,
                                    system::solution::MPIGroupAngularSolutionI &group_solution) {
@@ -38,13 +45,27 @@ void SingleGroupSolver::SolveGroup(const int group,
     auto& solution = group_solution[angle];
     auto left_hand_side_ptr = system.left_hand_side_ptr_->GetFullTermPtr(index);
     auto right_hand_side_ptr = system.right_hand_side_ptr_->GetFullTermPtr(index);
-    dealii::PETScWrappers::PreconditionNone no_conditioner(*left_hand_side_ptr);
 
-    linear_solver_ptr_->Solve(
-        left_hand_side_ptr.get(),
-        &solution,
-        right_hand_side_ptr.get(),
-        &no_conditioner);
+    if (preconditioner_factory_) {
+      auto& preconditioner_ptr = preconditioners_[index];
+      if (preconditioner_ptr == nullptr)
+        preconditioner_ptr = preconditioner_factory_(*left_hand_side_ptr);
+      linear_solver_ptr_->Solve(
+          index,
+          left_hand_side_ptr.get(),
+          &solution,
+          right_hand_side_ptr.get(),
+          preconditioner_ptr.get());
+    } else {
+      dealii::PETScWrappers::PreconditionNone no_conditioner(*left_hand_side_ptr);
+
+      linear_solver_ptr_->Solve(
+          index,
+          left_hand_side_ptr.get(),
+          &solution,
+          right_hand_side_ptr.get(),
+          &no_conditioner);
+    }
   }
 }
 
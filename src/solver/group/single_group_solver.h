@@ -1,8 +1,13 @@
 #ifndef BART_SRC_SOLVER_GROUP_SINGLE_GROUP_SOLVER_H_
 #define BART_SRC_SOLVER_GROUP_SINGLE_GROUP_SOLVER_H_
 
+#include <functional>
+#include <map>
 #include <memory>
 
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_precondition.h>
+
 #include "solver/group/single_group_solver_i.h"
 #include "solver/linear/linear_i.hpp"
 
@@ -16,6 +21,9 @@ class SingleGroupSolver : public SingleGroupSolverI {
  public:
 
   using LinearSolver = bart::solver::linear::LinearI;
+  using Preconditioner = dealii::PETScWrappers::PreconditionerBase;
+  using PreconditionerFactory = std::function<std::unique_ptr<Preconditioner>(
+      const dealii::PETScWrappers::MatrixBase&)>;
 
   SingleGroupSolver(std::unique_ptr<LinearSolver> linear_solver_ptr);
   virtual ~SingleGroupSolver() = default;
@@ -24,11 +32,27 @@ class SingleGroupSolver : public SingleGroupSolverI {
                   const system::System &system,
                   system::solution::MPIGroupAngularSolutionI &group_solution) override;
 
+  /*! \brief Sets the preconditioner used to solve each system.
+   *
+   * The factory is called with the left hand side the first time each group
+   * and angle is solved, and the returned preconditioner is reused by later
+   * solves of the same group and angle. If the left hand side of a system
+   * changes, ClearPreconditioners must be called. If no factory is set,
+   * systems are not preconditioned.
+   */
+  SingleGroupSolver& SetPreconditioner(PreconditionerFactory preconditioner_factory);
+
+  /*! \brief Removes all preconditioners set up by previous solves. */
+  void ClearPreconditioners() { preconditioners_.clear(); }
+
   LinearSolver* linear_solver_ptr() const {
     return linear_solver_ptr_.get();
   }
  protected:
   std::unique_ptr<LinearSolver> linear_solver_ptr_ = nullptr;
+  PreconditionerFactory preconditioner_factory_ = nullptr;
+  //! Preconditioners set up by previous solves, one for each group and angle
+  std::map<system::Index, std::unique_ptr<Preconditioner>> preconditioners_;
   static bool is_registered_;
 };
 
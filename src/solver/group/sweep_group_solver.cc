@@ -0,0 +1,441 @@
+#include "solver/group/sweep_group_solver.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <queue>
+#include <sstream>
+
+#include <deal.II/base/geometry_info.h>
+
+#include "system/system.h"
+#include "system/solution/mpi_group_angular_solution_i.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+namespace {
+
+/* Octants are numbered by the signs of the components of the direction, so
+ * that all angles in the same octant sweep the mesh in the same order. */
+template <int dim>
+int Octant(const dealii::Tensor<1, dim>& omega) {
+  int octant = 0;
+  for (int i = 0; i < dim; ++i) {
+    if (omega[i] < 0)
+      octant += 1 << i;
+  }
+  return octant;
+}
+
+} // namespace
+
+template <int dim>
+SweepGroupSolver<dim>::SweepGroupSolver(
+    std::shared_ptr<FormulationType> formulation_ptr,
+    std::shared_ptr<DomainType> domain_ptr,
+    std::shared_ptr<QuadratureSetType> quadrature_set_ptr)
+    : formulation_ptr_(formulation_ptr),
+      domain_ptr_(domain_ptr),
+      quadrature_set_ptr_(quadrature_set_ptr) {
+  AssertThrow(formulation_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SweepGroupSolver, "
+                                 "formulation pointer passed is null"))
+  AssertThrow(domain_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SweepGroupSolver, "
+                                 "domain pointer passed is null"))
+  AssertThrow(quadrature_set_ptr_ != nullptr,
+              dealii::ExcMessage("Error in constructor of SweepGroupSolver, "
+                                 "quadrature set pointer passed is null"))
+  AssertThrow(domain_ptr_->discretization_type() ==
+                  problem::DiscretizationType::kDiscontinuousFEM,
+              dealii::ExcMessage("Error in constructor of SweepGroupSolver, "
+                                 "domain must use a discontinuous "
+                                 "discretization"))
+}
+
+template <int dim>
+void SweepGroupSolver<dim>::SolveGroup(
+    const int group,
+    const system::System &system,
+    system::solution::MPIGroupAngularSolutionI &group_solution) {
+  const int total_angles = group_solution.total_angles();
+  const int n_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  AssertThrow(total_angles > 0,
+              dealii::ExcMessage("Error in SolveGroup, total angles provided by "
+                                 "group solution must be > 0"))
+  AssertThrow(group >= 0,
+              dealii::ExcMessage("Error in SolveGroup, invalid group index "
+                                 "provided, value is less than zero"))
+  AssertThrow(dim > 1 || n_processes == 1,
+              dealii::ExcMessage("Error in SolveGroup, sweeps in 1D are only "
+                                 "supported on a single processor"))
+
+  const auto& angle_order = GetAngleOrder(total_angles);
+  if (!model_efficiency_.has_value())
+    model_efficiency_ = CalculateModelEfficiency();
+
+  const auto sweep_start = std::chrono::steady_clock::now();
+  cell_solve_time_ = std::chrono::duration<double>::zero();
+
+  for (const int angle : angle_order)
+    SweepAngle(group, angle, system, group_solution[angle]);
+
+  MPI_Waitall(static_cast<int>(send_requests_.size()), send_requests_.data(),
+              MPI_STATUSES_IGNORE);
+  send_requests_.clear();
+  send_buffers_.clear();
+
+  const std::chrono::duration<double> sweep_time =
+      std::chrono::steady_clock::now() - sweep_start;
+  const double total_cell_solve_time =
+      dealii::Utilities::MPI::sum(cell_solve_time_.count(), MPI_COMM_WORLD);
+  const double max_sweep_time =
+      dealii::Utilities::MPI::max(sweep_time.count(), MPI_COMM_WORLD);
+
+  parallel_efficiency_.model = model_efficiency_.value();
+  parallel_efficiency_.measured = max_sweep_time > 0 ?
+      total_cell_solve_time / (n_processes * max_sweep_time) : 1.0;
+
+  if (n_processes > 1) {
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(3)
+           << "....Sweep parallel efficiency, group " << group << ": model "
+           << parallel_efficiency_.model << ", measured "
+           << parallel_efficiency_.measured << "\n";
+    data_ports::SweepStatusPort::Expose(report.str());
+  }
+}
+
+template <int dim>
+void SweepGroupSolver<dim>::SweepAngle(const int group,
+                                       const int angle,
+                                       const system::System &system,
+                                       system::MPIVector &solution) {
+  constexpr int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  const system::EnergyGroup energy_group(group);
+  const auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(
+      quadrature::QuadraturePointIndex(angle));
+  const auto right_hand_side_ptr =
+      system.right_hand_side_ptr_->GetFullTermPtr({group, angle});
+  const auto locally_owned_dofs = domain_ptr_->locally_owned_dofs();
+
+  auto cell_matrix = domain_ptr_->GetCellMatrix();
+  auto inflow_matrix = domain_ptr_->GetCellMatrix();
+  auto cell_right_hand_side = domain_ptr_->GetCellVector();
+  auto cell_solution = domain_ptr_->GetCellVector();
+  const int dofs_per_cell = cell_solution.size();
+  std::vector<dealii::types::global_dof_index> local_dof_indices(dofs_per_cell);
+  std::vector<dealii::types::global_dof_index> neighbor_dof_indices(dofs_per_cell);
+  std::array<double, faces_per_cell> normal_dot_omega;
+
+  dealii::Vector<double> angular_flux(locally_owned_dofs.n_elements());
+  GhostAngularFlux ghost_angular_flux;
+  AngularFluxBuffers outgoing_angular_flux;
+  auto upwind_angular_flux =
+      [&](const dealii::types::global_dof_index index) -> double {
+        if (locally_owned_dofs.is_element(index))
+          return angular_flux(locally_owned_dofs.index_within_set(index));
+        return ghost_angular_flux.at(index);
+      };
+
+  for (const auto& cell : GetSweepOrder(angle)) {
+    cell->get_dof_indices(local_dof_indices);
+    for (int face = 0; face < faces_per_cell; ++face) {
+      normal_dot_omega[face] = formulation_ptr_->NormalDotOmega(
+          cell, domain::FaceIndex(face), quadrature_point_ptr);
+    }
+
+    // Inflow from cells owned by other processors must be received first
+    for (int face = 0; face < faces_per_cell; ++face) {
+      if (cell->at_boundary(face) || normal_dot_omega[face] >= 0 ||
+          cell->neighbor(face)->is_locally_owned())
+        continue;
+      const auto neighbor = cell->neighbor(face);
+      neighbor->get_dof_indices(neighbor_dof_indices);
+      if (ghost_angular_flux.count(neighbor_dof_indices.front()) == 0) {
+        SendAngularFlux(angle, outgoing_angular_flux);
+        ReceiveAngularFlux(angle, neighbor->subdomain_id(),
+                           neighbor_dof_indices.front(), ghost_angular_flux);
+      }
+    }
+
+    const auto cell_solve_start = std::chrono::steady_clock::now();
+    cell_matrix = 0;
+    formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell,
+                                            quadrature_point_ptr);
+    formulation_ptr_->FillCellCollisionTerm(cell_matrix, cell, energy_group);
+    for (int i = 0; i < dofs_per_cell; ++i)
+      cell_right_hand_side(i) = (*right_hand_side_ptr)(local_dof_indices[i]);
+
+    for (int face = 0; face < faces_per_cell; ++face) {
+      const domain::FaceIndex face_index(face);
+      formulation_ptr_->FillFaceOutflowTerm(cell_matrix, cell, face_index,
+                                            quadrature_point_ptr);
+      // Inflow on boundary faces is zero for vacuum boundaries
+      if (cell->at_boundary(face) || normal_dot_omega[face] >= 0)
+        continue;
+      inflow_matrix = 0;
+      formulation_ptr_->FillFaceInflowTerm(inflow_matrix, cell, face_index,
+                                           quadrature_point_ptr);
+      cell->neighbor(face)->get_dof_indices(neighbor_dof_indices);
+      for (int i = 0; i < dofs_per_cell; ++i) {
+        for (int j = 0; j < dofs_per_cell; ++j) {
+          cell_right_hand_side(i) -=
+              inflow_matrix(i, j) * upwind_angular_flux(neighbor_dof_indices[j]);
+        }
+      }
+    }
+
+    cell_matrix.gauss_jordan();
+    cell_matrix.vmult(cell_solution, cell_right_hand_side);
+    for (int i = 0; i < dofs_per_cell; ++i) {
+      angular_flux(locally_owned_dofs.index_within_set(local_dof_indices[i])) =
+          cell_solution(i);
+    }
+    cell_solve_time_ += std::chrono::steady_clock::now() - cell_solve_start;
+
+    // Outflow to cells owned by other processors is buffered until sent
+    for (int face = 0; face < faces_per_cell; ++face) {
+      if (cell->at_boundary(face) || normal_dot_omega[face] <= 0 ||
+          cell->neighbor(face)->is_locally_owned())
+        continue;
+      auto& buffer = outgoing_angular_flux[cell->neighbor(face)->subdomain_id()];
+      if (!buffer.empty() && buffer.back().index == local_dof_indices.back())
+        continue;
+      for (int i = 0; i < dofs_per_cell; ++i)
+        buffer.push_back({local_dof_indices[i], cell_solution(i)});
+    }
+  }
+  SendAngularFlux(angle, outgoing_angular_flux);
+
+  for (const auto index : locally_owned_dofs)
+    solution[index] = angular_flux(locally_owned_dofs.index_within_set(index));
+  solution.compress(dealii::VectorOperation::insert);
+}
+
+template <int dim>
+void SweepGroupSolver<dim>::SendAngularFlux(const int angle,
+                                            AngularFluxBuffers& buffers) {
+  for (auto& [process, values] : buffers) {
+    if (values.empty())
+      continue;
+    auto& buffer = send_buffers_.emplace_back(std::move(values));
+    values.clear();
+    auto& request = send_requests_.emplace_back();
+    MPI_Isend(buffer.data(),
+              static_cast<int>(buffer.size() * sizeof(AngularFluxValue)),
+              MPI_BYTE, static_cast<int>(process), angle, MPI_COMM_WORLD,
+              &request);
+  }
+}
+
+template <int dim>
+void SweepGroupSolver<dim>::ReceiveAngularFlux(
+    const int angle,
+    const unsigned int source,
+    const dealii::types::global_dof_index index,
+    GhostAngularFlux& ghost_angular_flux) {
+  /* Messages from each processor for an angle are received in the order they
+   * were sent, and only contain flux needed by cells on this processor, so all
+   * messages are received by the end of the angle. */
+  while (ghost_angular_flux.count(index) == 0) {
+    MPI_Status status;
+    MPI_Probe(static_cast<int>(source), angle, MPI_COMM_WORLD, &status);
+    int message_size = 0;
+    MPI_Get_count(&status, MPI_BYTE, &message_size);
+    std::vector<AngularFluxValue> received(
+        message_size / sizeof(AngularFluxValue));
+    MPI_Recv(received.data(), message_size, MPI_BYTE, static_cast<int>(source),
+             angle, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    for (const auto& [received_index, value] : received)
+      ghost_angular_flux[received_index] = value;
+  }
+}
+
+template <int dim>
+auto SweepGroupSolver<dim>::GetSweepOrder(const int angle) -> const SweepOrder& {
+  if (auto order_it = sweep_order_by_angle_.find(angle);
+      order_it != sweep_order_by_angle_.end())
+    return order_it->second;
+  return sweep_order_by_angle_.insert_or_assign(
+      angle, CalculateSweepOrder(angle)).first->second;
+}
+
+template <int dim>
+auto SweepGroupSolver<dim>::GetAngleOrder(const int total_angles)
+-> const std::vector<int>& {
+  if (static_cast<int>(angle_order_.size()) == total_angles)
+    return angle_order_;
+
+  std::vector<int> octant(total_angles);
+  for (int angle = 0; angle < total_angles; ++angle) {
+    octant.at(angle) = Octant<dim>(quadrature_set_ptr_->GetQuadraturePoint(
+        quadrature::QuadraturePointIndex(angle))->cartesian_position_tensor());
+  }
+  angle_order_.resize(total_angles);
+  std::iota(angle_order_.begin(), angle_order_.end(), 0);
+  std::stable_sort(angle_order_.begin(), angle_order_.end(),
+                   [&octant](const int lhs, const int rhs) {
+                     return octant.at(lhs) < octant.at(rhs); });
+  model_efficiency_.reset();
+  return angle_order_;
+}
+
+template <int dim>
+auto SweepGroupSolver<dim>::CalculateSweepOrder(const int angle) -> SweepOrder {
+  const auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(
+      quadrature::QuadraturePointIndex(angle));
+  const auto omega = quadrature_point_ptr->cartesian_position_tensor();
+  const auto cells = domain_ptr_->Cells();
+  const int n_cells = cells.size();
+  const int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  const int total_cells =
+      domain_ptr_->dof_handler().get_triangulation().n_active_cells();
+
+  /* Each cell is solved once all of its locally owned upwind neighbors, across
+   * faces where the angle is incoming, have been solved (a topological sort of
+   * the cells in the direction of the angle). Cells that are ready are solved
+   * in order of distance in the direction of the angle, which is consistent
+   * with the upwind dependencies of cells on all processors. */
+  std::vector<int> cell_position(total_cells, -1);
+  for (int i = 0; i < n_cells; ++i)
+    cell_position.at(cells.at(i)->active_cell_index()) = i;
+
+  std::vector<int> n_upwind_neighbors(n_cells, 0);
+  std::vector<std::vector<int>> downwind_neighbors(n_cells);
+
+  for (int i = 0; i < n_cells; ++i) {
+    const auto& cell = cells.at(i);
+    for (int face = 0; face < faces_per_cell; ++face) {
+      if (cell->at_boundary(face))
+        continue;
+      AssertThrow(!cell->neighbor(face)->has_children(),
+                  dealii::ExcMessage("Error in SweepGroupSolver, sweeps "
+                                     "require a conforming mesh"))
+      if (!cell->neighbor(face)->is_locally_owned())
+        continue;
+      if (formulation_ptr_->NormalDotOmega(cell, domain::FaceIndex(face),
+                                           quadrature_point_ptr) < 0) {
+        ++n_upwind_neighbors.at(i);
+        downwind_neighbors.at(
+            cell_position.at(cell->neighbor(face)->active_cell_index()))
+            .push_back(i);
+      }
+    }
+  }
+
+  using ReadyCell = std::pair<double, int>;
+  std::priority_queue<ReadyCell, std::vector<ReadyCell>,
+                      std::greater<ReadyCell>> ready_cells;
+  auto distance = [&](const int i) { return omega * cells.at(i)->center(); };
+  for (int i = 0; i < n_cells; ++i) {
+    if (n_upwind_neighbors.at(i) == 0)
+      ready_cells.emplace(distance(i), i);
+  }
+
+  SweepOrder sweep_order;
+  sweep_order.reserve(n_cells);
+  while (!ready_cells.empty()) {
+    const int i = ready_cells.top().second;
+    ready_cells.pop();
+    sweep_order.push_back(cells.at(i));
+    for (const int downwind_cell : downwind_neighbors.at(i)) {
+      if (--n_upwind_neighbors.at(downwind_cell) == 0)
+        ready_cells.emplace(distance(downwind_cell), downwind_cell);
+    }
+  }
+
+  AssertThrow(static_cast<int>(sweep_order.size()) == n_cells,
+              dealii::ExcMessage("Error in SweepGroupSolver, no sweep order "
+                                 "exists for angle " + std::to_string(angle) +
+                                 ", cells have cyclic dependencies"))
+  return sweep_order;
+}
+
+template <int dim>
+int SweepGroupSolver<dim>::CalculatePipelineStages(const int angle) {
+  const int n_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+  const auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(
+      quadrature::QuadraturePointIndex(angle));
+
+  std::vector<int> is_upwind_process(n_processes, 0);
+  for (const auto& cell : domain_ptr_->Cells()) {
+    for (int face = 0; face < faces_per_cell; ++face) {
+      if (cell->at_boundary(face) || cell->neighbor(face)->is_locally_owned())
+        continue;
+      if (formulation_ptr_->NormalDotOmega(cell, domain::FaceIndex(face),
+                                           quadrature_point_ptr) < 0)
+        is_upwind_process.at(cell->neighbor(face)->subdomain_id()) = 1;
+    }
+  }
+  std::vector<int> upwind_processes(n_processes * n_processes, 0);
+  MPI_Allgather(is_upwind_process.data(), n_processes, MPI_INT,
+                upwind_processes.data(), n_processes, MPI_INT, MPI_COMM_WORLD);
+
+  /* The stage of each processor is one after the last stage of its upwind
+   * processors. Stages are limited to the number of processors, in case the
+   * partition has cyclic dependencies between processors. */
+  std::vector<int> stage(n_processes, 1);
+  bool stages_changed = true;
+  for (int iteration = 0; iteration < n_processes && stages_changed; ++iteration) {
+    stages_changed = false;
+    for (int process = 0; process < n_processes; ++process) {
+      for (int upwind = 0; upwind < n_processes; ++upwind) {
+        if (upwind_processes.at(process * n_processes + upwind) == 0)
+          continue;
+        const int upwind_stage = std::min(stage.at(upwind) + 1, n_processes);
+        if (upwind_stage > stage.at(process)) {
+          stage.at(process) = upwind_stage;
+          stages_changed = true;
+        }
+      }
+    }
+  }
+  return *std::max_element(stage.begin(), stage.end());
+}
+
+template <int dim>
+double SweepGroupSolver<dim>::CalculateModelEfficiency() {
+  const int n_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  if (n_processes == 1)
+    return 1.0;
+
+  // The pipeline fills each time the sweep changes octant
+  const double total_angles = angle_order_.size();
+  int pipeline_fill = 0;
+  int previous_octant = -1;
+  for (const int angle : angle_order_) {
+    const int octant = Octant<dim>(quadrature_set_ptr_->GetQuadraturePoint(
+        quadrature::QuadraturePointIndex(angle))->cartesian_position_tensor());
+    if (octant != previous_octant) {
+      pipeline_fill += CalculatePipelineStages(angle) - 1;
+      previous_octant = octant;
+    }
+  }
+
+  const double local_cells = domain_ptr_->Cells().size();
+  const double load_balance =
+      dealii::Utilities::MPI::sum(local_cells, MPI_COMM_WORLD) /
+      (n_processes * dealii::Utilities::MPI::max(local_cells, MPI_COMM_WORLD));
+  return total_angles / (total_angles + pipeline_fill) * load_balance;
+}
+
+template class SweepGroupSolver<1>;
+template class SweepGroupSolver<2>;
+template class SweepGroupSolver<3>;
+
+} // namespace group
+
+} // namespace solver
+
+} // namespace bart
@@ -0,0 +1,158 @@
+#ifndef BART_SRC_SOLVER_GROUP_SWEEP_GROUP_SOLVER_H_
+#define BART_SRC_SOLVER_GROUP_SWEEP_GROUP_SOLVER_H_
+
+#include <chrono>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <deal.II/base/mpi.h>
+
+#include "domain/definition_i.h"
+#include "formulation/angular/upwind_transport_i.h"
+#include "instrumentation/port.h"
+#include "quadrature/quadrature_set_i.h"
+#include "solver/group/single_group_solver_i.h"
+#include "system/system_types.h"
+
+namespace bart {
+
+namespace solver {
+
+namespace group {
+
+namespace data_ports {
+struct SweepStatus;
+using SweepStatusPort = instrumentation::Port<std::string, SweepStatus>;
+} // namespace data_ports
+
+/*! \brief Parallel efficiency of a sweep.
+ *
+ * The model efficiency is that of a Koch-Baker-Alcouffe pipeline, in which the
+ * angles of each octant are pipelined through the processors in the sweep
+ * direction:
+ * \f[
+ * \epsilon_{\text{model}} = \frac{M}{M + \sum_{o}(S_o - 1)}\frac{\bar{N}}{N_{\max}}
+ * \f]
+ * where \f$M\f$ is the total number of angles, \f$S_o\f$ the number of
+ * pipeline stages (processors along the longest chain of upwind dependencies)
+ * for octant \f$o\f$, and \f$\bar{N}/N_{\max}\f$ the cell load balance. The
+ * measured efficiency is the total time spent solving cells on all processors,
+ * divided by the number of processors times the wall time of the sweep.
+ */
+struct SweepEfficiency {
+  double model = 1.0;
+  double measured = 1.0;
+};
+
+/*! \brief Solves the upwind transport equations for a group by sweeping.
+ *
+ * For each angle, cells are visited in downwind order, so that the angular
+ * flux in all upwind neighbors of a cell is known when it is solved. The
+ * streaming and collision operator of each cell is then inverted with a small
+ * dense solve, and the inflow from upwind neighbors is moved to the right hand
+ * side. This applies the inverse of the transport operator exactly, without
+ * a global linear solve. The left hand side of the system is not used.
+ *
+ * The sweep order of each angle is calculated on the first solve and reused.
+ * Sweeps are only supported with vacuum boundaries.
+ *
+ * ## Parallel sweeps
+ *
+ * In 2D and 3D, sweeps are pipelined across processors using the partition of
+ * the domain. Each processor orders its cells by distance in the direction of
+ * the angle, which is consistent with the upwind dependencies of all cells on
+ * a Cartesian mesh, so that no processor can wait on a cell that is itself
+ * waiting. Angular flux on cells with downwind neighbors owned by another
+ * processor is sent without blocking when a processor finishes an angle, or
+ * before it waits on inflow from another processor. Angles are swept grouped
+ * by octant, so that downwind processors can work on one angle while upwind
+ * processors work on the next, and the pipeline only refills when the sweep
+ * direction changes. Energy groups are not pipelined, as each group depends
+ * on the solution of the previous groups through scattering.
+ *
+ * After each solve, the model and measured parallel efficiency are available
+ * via parallel_efficiency() and, when running on more than one processor,
+ * are reported through the sweep status port.
+ */
+template <int dim>
+class SweepGroupSolver : public SingleGroupSolverI,
+                         public data_ports::SweepStatusPort {
+ public:
+  using FormulationType = formulation::angular::UpwindTransportI<dim>;
+  using DomainType = domain::DefinitionI<dim>;
+  using QuadratureSetType = quadrature::QuadratureSetI<dim>;
+  using SweepOrder = std::vector<domain::CellPtr<dim>>;
+
+  SweepGroupSolver(std::shared_ptr<FormulationType>,
+                   std::shared_ptr<DomainType>,
+                   std::shared_ptr<QuadratureSetType>);
+  virtual ~SweepGroupSolver() = default;
+
+  void SolveGroup(const int group,
+                  const system::System &system,
+                  system::solution::MPIGroupAngularSolutionI &group_solution) override;
+
+  /*! \brief Returns the order locally owned cells are solved in for an angle. */
+  const SweepOrder& GetSweepOrder(const int angle);
+
+  /*! \brief Returns the order angles are swept in, grouped by octant. */
+  const std::vector<int>& GetAngleOrder(const int total_angles);
+
+  FormulationType* formulation_ptr() const { return formulation_ptr_.get(); }
+  DomainType* domain_ptr() const { return domain_ptr_.get(); }
+  QuadratureSetType* quadrature_set_ptr() const {
+    return quadrature_set_ptr_.get(); }
+  //! Parallel efficiency of the last solve
+  SweepEfficiency parallel_efficiency() const { return parallel_efficiency_; }
+ protected:
+  //! Angular flux in one degree of freedom, sent to downwind processors
+  struct AngularFluxValue {
+    dealii::types::global_dof_index index;
+    double value;
+  };
+  using AngularFluxBuffers = std::map<unsigned int, std::vector<AngularFluxValue>>;
+  using GhostAngularFlux = std::unordered_map<dealii::types::global_dof_index, double>;
+
+  //! Sweeps one angle, solving all locally owned cells
+  void SweepAngle(const int group, const int angle, const system::System &system,
+                  system::MPIVector &solution);
+  //! Orders cells so that each cell follows all of its upwind neighbors
+  SweepOrder CalculateSweepOrder(const int angle);
+  //! Number of processors along the longest chain of upwind dependencies
+  int CalculatePipelineStages(const int angle);
+  //! Model efficiency of pipelining the angles in the sweep order
+  double CalculateModelEfficiency();
+  //! Sends all buffered angular flux to downwind processors without blocking
+  void SendAngularFlux(const int angle, AngularFluxBuffers& buffers);
+  //! Receives angular flux from a processor until the given index is received
+  void ReceiveAngularFlux(const int angle, const unsigned int source,
+                          const dealii::types::global_dof_index index,
+                          GhostAngularFlux& ghost_angular_flux);
+
+  std::shared_ptr<FormulationType> formulation_ptr_;
+  std::shared_ptr<DomainType> domain_ptr_;
+  std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+  std::unordered_map<int, SweepOrder> sweep_order_by_angle_;
+  std::vector<int> angle_order_;
+  std::optional<double> model_efficiency_;
+  SweepEfficiency parallel_efficiency_;
+
+  //! Time spent solving cells on this processor during the current solve
+  std::chrono::duration<double> cell_solve_time_{0};
+  //! Buffers and requests of sends that have not been completed
+  std::list<std::vector<AngularFluxValue>> send_buffers_;
+  std::vector<MPI_Request> send_requests_;
+};
+
+} // namespace group
+
+} // namespace solver
+
+} // namespace bart
+
+#endif //BART_SRC_SOLVER_GROUP_SWEEP_GROUP_SOLVER_H_
@@ -0,0 +1,164 @@
+#include "solver/group/cartesian_stencil_group_solver.h"
+
+#include <map>
+#include <memory>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include "domain/definition.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "domain/mesh/tests/mesh_mock.h"
+#include "system/system.h"
+#include "system/solution/tests/mpi_group_angular_solution_mock.h"
+#include "system/terms/tests/linear_term_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::_, ::testing::NiceMock, ::testing::Return, ::testing::ReturnRef;
+
+template <typename DimensionWrapper>
+class SolverGroupCartesianStencilGroupSolverTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+  using Domain = domain::Definition<dim>;
+  using GroupSolver = solver::group::CartesianStencilGroupSolver<dim>;
+  using GroupSolution = NiceMock<system::solution::MPIGroupAngularSolutionMock>;
+  using RightHandSide = system::terms::LinearTermMock;
+
+  SolverGroupCartesianStencilGroupSolverTest() : fe_(1) {}
+
+  dealii::FE_Q<dim> fe_;
+  std::shared_ptr<domain::finite_element::FiniteElementMock<dim>> fe_ptr_;
+  std::shared_ptr<Domain> domain_ptr_;
+  typename GroupSolver::StencilFunction stencil_function_;
+  //! Number of times the stencil of each index was filled
+  std::map<system::Index, int> stencil_calls_;
+
+  system::System test_system_;
+  GroupSolution solution_;
+  RightHandSide* rhs_obs_ptr_;
+
+  const int total_angles_ = 2;
+  const int test_group_ = 1;
+
+  void SetUp() override;
+  static void SetTriangulation(dealii::Triangulation<dim>& to_fill) {
+    dealii::GridGenerator::hyper_cube(to_fill, 0, 1);
+  }
+};
+
+TYPED_TEST_CASE(SolverGroupCartesianStencilGroupSolverTest,
+                bart::testing::AllDimensions);
+
+template <typename DimensionWrapper>
+void SolverGroupCartesianStencilGroupSolverTest<DimensionWrapper>::SetUp() {
+  fe_ptr_ = std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  ON_CALL(*fe_ptr_, finite_element()).WillByDefault(Return(&fe_));
+
+  auto mesh_ptr = std::make_unique<NiceMock<domain::mesh::MeshMock<dim>>>();
+  ON_CALL(*mesh_ptr, has_material_mapping()).WillByDefault(Return(true));
+  ON_CALL(*mesh_ptr, FillTriangulation(_))
+      .WillByDefault(::testing::Invoke(SetTriangulation));
+  domain_ptr_ = std::make_shared<Domain>(std::move(mesh_ptr), fe_ptr_);
+  domain_ptr_->SetUpMesh(3);
+  domain_ptr_->SetUpDOF();
+
+  // Symmetric positive definite cell matrix, scaled by group and angle
+  stencil_function_ = [this](formulation::CartesianStencil<dim>& stencil,
+                             const system::Index& index) {
+    ++stencil_calls_[index];
+    const double coefficient = 1.0 + index.first + index.second;
+    stencil.StampCellTerm([&](formulation::FullMatrix& to_fill,
+                              const domain::CellPtr<dim>&) {
+      for (unsigned int i = 0; i < to_fill.m(); ++i) {
+        for (unsigned int j = 0; j < to_fill.n(); ++j)
+          to_fill(i, j) += coefficient * (i == j ? to_fill.m() : -0.5);
+      }
+    });
+  };
+
+  auto rhs_ptr = std::make_unique<RightHandSide>();
+  rhs_obs_ptr_ = rhs_ptr.get();
+  test_system_.right_hand_side_ptr_ = std::move(rhs_ptr);
+  ON_CALL(solution_, total_angles()).WillByDefault(Return(total_angles_));
+}
+
+TYPED_TEST(SolverGroupCartesianStencilGroupSolverTest, Constructor) {
+  typename TestFixture::GroupSolver test_solver(this->domain_ptr_,
+                                                this->stencil_function_,
+                                                100, 1e-12);
+  EXPECT_EQ(test_solver.domain_ptr(), this->domain_ptr_.get());
+  ASSERT_NE(test_solver.lattice_ptr(), nullptr);
+  EXPECT_EQ(test_solver.lattice_ptr()->n_nodes(),
+            this->domain_ptr_->total_degrees_of_freedom());
+  EXPECT_EQ(test_solver.max_iterations(), 100);
+  EXPECT_EQ(test_solver.convergence_tolerance(), 1e-12);
+}
+
+TYPED_TEST(SolverGroupCartesianStencilGroupSolverTest, ConstructorBadParameters) {
+  using GroupSolver = typename TestFixture::GroupSolver;
+  EXPECT_ANY_THROW({
+    GroupSolver test_solver(nullptr, this->stencil_function_);
+  });
+  EXPECT_ANY_THROW({
+    GroupSolver test_solver(this->domain_ptr_, nullptr);
+  });
+  EXPECT_ANY_THROW({
+    GroupSolver test_solver(this->domain_ptr_, this->stencil_function_, 0);
+  });
+  EXPECT_ANY_THROW({
+    GroupSolver test_solver(this->domain_ptr_, this->stencil_function_, 100, 0);
+  });
+}
+
+TYPED_TEST(SolverGroupCartesianStencilGroupSolverTest, SolveGroup) {
+  typename TestFixture::GroupSolver test_solver(this->domain_ptr_,
+                                                this->stencil_function_,
+                                                100, 1e-12);
+  const auto& lattice = *test_solver.lattice_ptr();
+  const int n_solves = 2;
+
+  std::vector<system::MPIVector> solution_vectors(this->total_angles_);
+  std::vector<std::shared_ptr<system::MPIVector>> rhs_vectors(this->total_angles_);
+
+  for (int angle = 0; angle < this->total_angles_; ++angle) {
+    system::Index index{this->test_group_, angle};
+    // Right hand side is set so that the solution is a vector of ones
+    dealii::Vector<double> ones(lattice.n_nodes()), lattice_rhs;
+    ones = 1.0;
+    test_solver.GetStencil(index).vmult(lattice_rhs, ones);
+    rhs_vectors[angle] = this->domain_ptr_->MakeSystemVector();
+    lattice.FromLattice(lattice_rhs, *rhs_vectors[angle]);
+    solution_vectors[angle].reinit(*rhs_vectors[angle]);
+
+    EXPECT_CALL(this->solution_, BracketOp(angle))
+        .Times(n_solves)
+        .WillRepeatedly(ReturnRef(solution_vectors[angle]));
+    EXPECT_CALL(*this->rhs_obs_ptr_, GetFullTermPtr(index))
+        .Times(n_solves)
+        .WillRepeatedly(Return(rhs_vectors[angle]));
+  }
+
+  for (int solve = 0; solve < n_solves; ++solve)
+    test_solver.SolveGroup(this->test_group_, this->test_system_, this->solution_);
+
+  for (int angle = 0; angle < this->total_angles_; ++angle) {
+    EXPECT_EQ(this->stencil_calls_.at({this->test_group_, angle}), 1);
+    for (unsigned int dof = 0; dof < solution_vectors[angle].size(); ++dof)
+      EXPECT_NEAR(solution_vectors[angle][dof], 1.0, 1e-8);
+  }
+}
+
+TYPED_TEST(SolverGroupCartesianStencilGroupSolverTest, SolveGroupBadGroup) {
+  typename TestFixture::GroupSolver test_solver(this->domain_ptr_,
+                                                this->stencil_function_);
+  EXPECT_ANY_THROW({
+    test_solver.SolveGroup(-1, this->test_system_, this->solution_);
+  });
+}
+
+} // namespace
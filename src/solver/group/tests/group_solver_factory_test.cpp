@@ -1,5 +1,6 @@
 #include "solver/group/factory.hpp"
 
+#include "solver/group/reflective_block_group_solver.h"
 #include "solver/group/single_group_solver.h"
 #include "solver/linear/tests/linear_mock.h"
 #include "test_helpers/gmock_wrapper.h"
@@ -21,4 +22,17 @@ TEST(SolverGroupFactoryTests, SingleGroupSolverDefaultImplementation) {
   ASSERT_NE(dynamic_cast<ExpectedType*>(group_solver_ptr.get()), nullptr);
 }
 
+TEST(SolverGroupFactoryTests, ReflectiveBlockGroupSolver) {
+  using SolverName = solver::group::GroupSolverName;
+  using ExpectedType = solver::group::ReflectiveBlockGroupSolver;
+  using LinearSolver = solver::linear::LinearI;
+
+  auto group_solver_ptr =
+      solver::group::SingleGroupSolverIFactory<std::unique_ptr<LinearSolver>, int, double>::get()
+          .GetConstructor(SolverName::kReflectiveBlock)(
+              std::make_unique<solver::linear::LinearMock>(), 100, 1e-10);
+  ASSERT_NE(group_solver_ptr, nullptr);
+  ASSERT_NE(dynamic_cast<ExpectedType*>(group_solver_ptr.get()), nullptr);
+}
+
 } // namespace
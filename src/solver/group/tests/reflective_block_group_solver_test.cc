@@ -0,0 +1,144 @@
+#include "solver/group/reflective_block_group_solver.h"
+
+#include <memory>
+
+#include "system/system.h"
+#include "system/solution/tests/mpi_group_angular_solution_mock.h"
+#include "system/terms/tests/linear_term_mock.h"
+#include "system/terms/tests/bilinear_term_mock.h"
+#include "solver/linear/tests/linear_mock.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return, ::testing::ReturnRef, ::testing::_;
+using ::testing::Pointee;
+
+class SolverGroupReflectiveBlockGroupSolverTest :
+    public ::testing::Test,
+    public bart::testing::DealiiTestDomain<2> {
+ protected:
+  using LinearSolver = solver::linear::LinearMock;
+  using LeftHandSide = NiceMock<system::terms::BilinearTermMock>;
+  using RightHandSide = NiceMock<system::terms::LinearTermMock>;
+  using GroupSolution = NiceMock<system::solution::MPIGroupAngularSolutionMock>;
+  using TestSolver = solver::group::ReflectiveBlockGroupSolver;
+
+  system::System test_system_;
+  GroupSolution solution_;
+  std::unique_ptr<LinearSolver> linear_solver_ptr_;
+
+  LinearSolver* linear_solver_obs_ptr_;
+  RightHandSide* rhs_obs_ptr_;
+  LeftHandSide* lhs_obs_ptr_;
+
+  const int total_angles_ = 3;
+  const int test_group_ = 1;
+
+  // Returns a matrix with the sparsity of the test domain and the given value
+  // on the diagonal.
+  std::shared_ptr<system::MPISparseMatrix> MakeDiagonalMatrix(double value);
+  void SetUp() override;
+};
+
+std::shared_ptr<system::MPISparseMatrix>
+SolverGroupReflectiveBlockGroupSolverTest::MakeDiagonalMatrix(double value) {
+  auto matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  matrix_ptr->reinit(matrix_1);
+  *matrix_ptr = 0;
+  auto [local_begin, local_end] = matrix_ptr->local_range();
+  for (auto row = local_begin; row < local_end; ++row)
+    matrix_ptr->set(row, row, value);
+  matrix_ptr->compress(dealii::VectorOperation::insert);
+  return matrix_ptr;
+}
+
+void SolverGroupReflectiveBlockGroupSolverTest::SetUp() {
+  SetUpDealii();
+  linear_solver_ptr_ = std::make_unique<LinearSolver>();
+  linear_solver_obs_ptr_ = linear_solver_ptr_.get();
+
+  auto rhs_ptr = std::make_unique<RightHandSide>();
+  auto lhs_ptr = std::make_unique<LeftHandSide>();
+  rhs_obs_ptr_ = rhs_ptr.get();
+  lhs_obs_ptr_ = lhs_ptr.get();
+  test_system_.right_hand_side_ptr_ = std::move(rhs_ptr);
+  test_system_.left_hand_side_ptr_ = std::move(lhs_ptr);
+
+  ON_CALL(solution_, total_angles())
+      .WillByDefault(Return(total_angles_));
+}
+
+TEST_F(SolverGroupReflectiveBlockGroupSolverTest, Constructor) {
+  TestSolver test_solver(std::move(linear_solver_ptr_), 150, 1e-8);
+  EXPECT_NE(dynamic_cast<LinearSolver*>(test_solver.linear_solver_ptr()),
+            nullptr);
+  EXPECT_EQ(test_solver.max_iterations(), 150);
+  EXPECT_EQ(test_solver.convergence_tolerance(), 1e-8);
+}
+
+TEST_F(SolverGroupReflectiveBlockGroupSolverTest, ConstructorBadValues) {
+  EXPECT_ANY_THROW({ TestSolver test_solver(nullptr); });
+  EXPECT_ANY_THROW({
+    TestSolver test_solver(std::make_unique<LinearSolver>(), 0, 1e-8); });
+  EXPECT_ANY_THROW({
+    TestSolver test_solver(std::make_unique<LinearSolver>(), 100, 0); });
+}
+
+TEST_F(SolverGroupReflectiveBlockGroupSolverTest, GetAngleOrbits) {
+  for (const system::AngleCouplingIndex index : {system::AngleCouplingIndex{0, 3},
+                                                 system::AngleCouplingIndex{3, 0},
+                                                 system::AngleCouplingIndex{1, 4}})
+    test_system_.reflective_coupling_terms[index] = nullptr;
+
+  const std::vector<TestSolver::AngleOrbit> expected_orbits{{0, 3}, {1, 4},
+                                                            {2}};
+  EXPECT_EQ(TestSolver::GetAngleOrbits(test_system_, 5), expected_orbits);
+  EXPECT_ANY_THROW(TestSolver::GetAngleOrbits(test_system_, 4));
+}
+
+/* Angles 0 and 1 are coupled, with diagonal blocks 2I and coupling blocks -I,
+ * and a right hand side of 1. The block system has the solution 1 for both
+ * angles. Angle 2 is not coupled and is passed to the linear solver. */
+TEST_F(SolverGroupReflectiveBlockGroupSolverTest, SolveGroup) {
+  TestSolver test_solver(std::move(linear_solver_ptr_), 100, 1e-12);
+
+  std::vector<system::MPIVector> solution_vectors(total_angles_);
+  std::vector<std::shared_ptr<system::MPIVector>> rhs_vectors(total_angles_);
+  std::vector<std::shared_ptr<system::MPISparseMatrix>> lhs_matrices(total_angles_);
+
+  for (int angle = 0; angle < total_angles_; ++angle) {
+    system::Index index{test_group_, angle};
+    solution_vectors.at(angle).reinit(vector_1);
+    rhs_vectors.at(angle) = std::make_shared<system::MPIVector>();
+    rhs_vectors.at(angle)->reinit(vector_1);
+    *rhs_vectors.at(angle) = 1.0;
+    lhs_matrices.at(angle) = MakeDiagonalMatrix(2.0);
+
+    ON_CALL(solution_, BracketOp(angle))
+        .WillByDefault(ReturnRef(solution_vectors.at(angle)));
+    EXPECT_CALL(*lhs_obs_ptr_, GetFullTermPtr(index))
+        .WillOnce(Return(lhs_matrices.at(angle)));
+    EXPECT_CALL(*rhs_obs_ptr_, GetFullTermPtr(index))
+        .WillOnce(Return(rhs_vectors.at(angle)));
+  }
+
+  test_system_.reflective_coupling_terms[{0, 1}] = MakeDiagonalMatrix(-1.0);
+  test_system_.reflective_coupling_terms[{1, 0}] = MakeDiagonalMatrix(-1.0);
+
+  EXPECT_CALL(*linear_solver_obs_ptr_, Solve(
+      lhs_matrices.at(2).get(), Pointee(solution_vectors.at(2)),
+      rhs_vectors.at(2).get(), _));
+
+  test_solver.SolveGroup(test_group_, test_system_, solution_);
+
+  for (const int angle : {0, 1}) {
+    for (const auto entry : solution_vectors.at(angle).locally_owned_elements())
+      EXPECT_NEAR(solution_vectors.at(angle)(entry), 1.0, 1e-8);
+  }
+}
+
+} // namespace
@@ -1,5 +1,6 @@
 #include "solver/group/single_group_solver.h"
 
+#include <map>
 #include <memory>
 
 #include "system/system.h"
@@ -118,6 +119,68 @@ TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupOperation) {
   test_solver.SolveGroup(test_group_, test_system_, solution_);
 }
 
+TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupPreconditionerReused) {
+  solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_));
+
+  std::map<int, solver::group::SingleGroupSolver::Preconditioner*> preconditioners;
+  int factory_calls = 0;
+  test_solver.SetPreconditioner(
+      [&](const dealii::PETScWrappers::MatrixBase& matrix) {
+        ++factory_calls;
+        std::unique_ptr<solver::group::SingleGroupSolver::Preconditioner>
+            return_ptr = std::make_unique<dealii::PETScWrappers::PreconditionNone>(
+                matrix);
+        return return_ptr; });
+
+  const int n_solves = 2;
+  std::vector<system::MPIVector> solution_vectors_(total_angles_);
+  std::vector<std::shared_ptr<system::MPISparseMatrix>> lhs_matrices_(total_angles_);
+  std::vector<std::shared_ptr<system::MPIVector>> rhs_vectors_(total_angles_);
+
+  EXPECT_CALL(solution_, total_angles())
+      .Times(n_solves)
+      .WillRepeatedly(Return(total_angles_));
+
+  for (int angle = 0; angle < total_angles_; ++angle) {
+    system::Index index{test_group_, angle};
+
+    rhs_vectors_[angle] = std::make_shared<system::MPIVector>();
+    lhs_matrices_[angle] = std::make_shared<system::MPISparseMatrix>();
+    lhs_matrices_[angle]->reinit(matrix_1);
+    lhs_matrices_[angle]->copy_from(matrix_1);
+
+    EXPECT_CALL(solution_, BracketOp(angle))
+        .Times(n_solves)
+        .WillRepeatedly(ReturnRef(solution_vectors_[angle]));
+    EXPECT_CALL(*lhs_obs_ptr_, GetFullTermPtr(index))
+        .Times(n_solves)
+        .WillRepeatedly(Return(lhs_matrices_[angle]));
+    EXPECT_CALL(*rhs_obs_ptr_, GetFullTermPtr(index))
+        .Times(n_solves)
+        .WillRepeatedly(Return(rhs_vectors_[angle]));
+    EXPECT_CALL(*linear_solver_obs_ptr_, Solve(
+        lhs_matrices_[angle].get(),
+        Pointee(solution_vectors_[angle]),
+        rhs_vectors_[angle].get(),
+        _))
+        .Times(n_solves)
+        .WillRepeatedly(::testing::WithArg<3>(::testing::Invoke(
+            [&preconditioners, angle](
+                dealii::PETScWrappers::PreconditionerBase* preconditioner) {
+              // The same preconditioner is used for each solve of an angle
+              if (preconditioners.count(angle) == 0)
+                preconditioners[angle] = preconditioner;
+              EXPECT_EQ(preconditioners.at(angle), preconditioner); })));
+  }
+
+  for (int solve = 0; solve < n_solves; ++solve)
+    test_solver.SolveGroup(test_group_, test_system_, solution_);
+
+  EXPECT_EQ(factory_calls, total_angles_);
+  ASSERT_EQ(preconditioners.size(), total_angles_);
+  EXPECT_NE(preconditioners.at(0), preconditioners.at(1));
+}
+
 TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupBadAngles) {
   solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_));
 
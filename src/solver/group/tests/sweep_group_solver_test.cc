@@ -0,0 +1,344 @@
+#include "solver/group/sweep_group_solver.h"
+
+#include <cmath>
+#include <memory>
+
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
+
+#include "data/cross_sections.h"
+#include "domain/definition.h"
+#include "domain/finite_element/finite_element_gaussian.h"
+#include "domain/mesh/mesh_cartesian.h"
+#include "domain/tests/definition_mock.h"
+#include "formulation/angular/upwind_transport.h"
+#include "formulation/angular/tests/upwind_transport_mock.h"
+#include "material/tests/mock_material.h"
+#include "quadrature/tests/quadrature_point_mock.h"
+#include "quadrature/tests/quadrature_set_mock.h"
+#include "system/system.h"
+#include "system/system_functions.h"
+#include "system/solution/mpi_group_angular_solution.h"
+#include "system/terms/tests/linear_term_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return, ::testing::_;
+
+/* Tests for the sweep group solver. Sweeps are run using the real upwind
+ * formulation on a real discontinuous domain on the unit cube with piecewise
+ * constant basis functions, for which the upwind equations reduce to a
+ * particle balance in each cell.
+ */
+template <typename DimensionWrapper>
+class SolverGroupSweepGroupSolverTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using FiniteElementType = domain::finite_element::FiniteElementGaussian<dim>;
+  using FormulationType = formulation::angular::UpwindTransport<dim>;
+  using QuadraturePointType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+  using QuadratureSetType = NiceMock<quadrature::QuadratureSetMock<dim>>;
+  using SolverType = solver::group::SweepGroupSolver<dim>;
+
+  std::shared_ptr<FiniteElementType> finite_element_ptr_;
+  std::shared_ptr<FormulationType> formulation_ptr_;
+  std::shared_ptr<domain::Definition<dim>> domain_ptr_;
+  std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+  std::vector<std::shared_ptr<QuadraturePointType>> quadrature_points_;
+  NiceMock<btest::MockMaterial> mock_material_;
+
+  system::System test_system_;
+  system::terms::LinearTermMock* rhs_obs_ptr_;
+  std::shared_ptr<system::MPIVector> right_hand_side_ptr_;
+
+  const int n_cells_ = dim == 3 ? 3 : 4;
+  const double cell_width_ = 1.0 / n_cells_;
+  const double sigma_t_ = 1.5;
+  const double source_ = 2.0;
+  const int total_angles_ = 2;
+  const int test_group_ = 0;
+
+  void SetUp() override;
+  double NormalDotOmega(const int face, const int angle) const {
+    const auto omega = quadrature_points_.at(angle)->cartesian_position_tensor();
+    return (face % 2 == 0 ? -1.0 : 1.0) * omega[face / 2];
+  }
+};
+
+template <typename DimensionWrapper>
+void SolverGroupSweepGroupSolverTest<DimensionWrapper>::SetUp() {
+  const int material_id = 1;
+  std::unordered_map<int, std::vector<double>> sigma_t{{material_id, {sigma_t_}}};
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t));
+  auto cross_sections_ptr = std::make_shared<data::CrossSections>(mock_material_);
+
+  finite_element_ptr_ = std::make_shared<FiniteElementType>(
+      problem::DiscretizationType::kDiscontinuousFEM, 0);
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(
+      std::vector<double>(dim, 1.0), std::vector<int>(dim, n_cells_),
+      std::to_string(material_id));
+  domain_ptr_ = std::make_shared<domain::Definition<dim>>(
+      std::move(mesh_ptr), finite_element_ptr_,
+      problem::DiscretizationType::kDiscontinuousFEM);
+  domain_ptr_->SetUpMesh().SetUpDOF();
+
+  // Two opposite angles, not aligned with any face
+  quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
+  for (int angle = 0; angle < total_angles_; ++angle) {
+    dealii::Tensor<1, dim> omega;
+    for (int i = 0; i < dim; ++i)
+      omega[i] = (angle == 0 ? 1.0 : -1.0) * (0.2 + 0.3 * i);
+    auto quadrature_point_ptr = std::make_shared<QuadraturePointType>();
+    ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+        .WillByDefault(Return(omega));
+    ON_CALL(*quadrature_set_ptr_,
+            GetQuadraturePoint(quadrature::QuadraturePointIndex(angle)))
+        .WillByDefault(Return(quadrature_point_ptr));
+    quadrature_points_.push_back(quadrature_point_ptr);
+  }
+
+  formulation_ptr_ = std::make_shared<FormulationType>(
+      finite_element_ptr_, cross_sections_ptr, quadrature_set_ptr_);
+
+  // Right hand side is a uniform source integrated over each cell
+  right_hand_side_ptr_ = domain_ptr_->MakeSystemVector();
+  for (const auto index : right_hand_side_ptr_->locally_owned_elements())
+    (*right_hand_side_ptr_)[index] = source_ * std::pow(cell_width_, dim);
+  right_hand_side_ptr_->compress(dealii::VectorOperation::insert);
+
+  auto rhs_ptr = std::make_unique<NiceMock<system::terms::LinearTermMock>>();
+  rhs_obs_ptr_ = rhs_ptr.get();
+  ON_CALL(*rhs_obs_ptr_, GetFullTermPtr(_))
+      .WillByDefault(Return(right_hand_side_ptr_));
+  test_system_.right_hand_side_ptr_ = std::move(rhs_ptr);
+}
+
+TYPED_TEST_SUITE(SolverGroupSweepGroupSolverTest, bart::testing::AllDimensions);
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, Constructor) {
+  using SolverType = typename TestFixture::SolverType;
+  SolverType test_solver(this->formulation_ptr_, this->domain_ptr_,
+                         this->quadrature_set_ptr_);
+  EXPECT_EQ(test_solver.formulation_ptr(), this->formulation_ptr_.get());
+  EXPECT_EQ(test_solver.domain_ptr(), this->domain_ptr_.get());
+  EXPECT_EQ(test_solver.quadrature_set_ptr(), this->quadrature_set_ptr_.get());
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, ConstructorBadDependencies) {
+  constexpr int dim = this->dim;
+  using SolverType = typename TestFixture::SolverType;
+  using FormulationType = formulation::angular::UpwindTransportMock<dim>;
+  using DomainType = NiceMock<domain::DefinitionMock<dim>>;
+
+  auto continuous_domain_ptr = std::make_shared<DomainType>();
+  ON_CALL(*continuous_domain_ptr, discretization_type())
+      .WillByDefault(Return(problem::DiscretizationType::kContinuousFEM));
+  auto formulation_ptr = std::make_shared<FormulationType>();
+
+  EXPECT_ANY_THROW({
+    SolverType test_solver(formulation_ptr, continuous_domain_ptr,
+                           this->quadrature_set_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    SolverType test_solver(nullptr, this->domain_ptr_,
+                           this->quadrature_set_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    SolverType test_solver(formulation_ptr, nullptr,
+                           this->quadrature_set_ptr_);
+  });
+  EXPECT_ANY_THROW({
+    SolverType test_solver(formulation_ptr, this->domain_ptr_, nullptr);
+  });
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, SweepOrderIsDownwind) {
+  constexpr int dim = this->dim;
+  using SolverType = typename TestFixture::SolverType;
+  SolverType test_solver(this->formulation_ptr_, this->domain_ptr_,
+                         this->quadrature_set_ptr_);
+
+  for (int angle = 0; angle < this->total_angles_; ++angle) {
+    const auto& sweep_order = test_solver.GetSweepOrder(angle);
+    ASSERT_EQ(sweep_order.size(), this->domain_ptr_->Cells().size());
+
+    std::vector<int> position(sweep_order.size());
+    for (int i = 0; i < static_cast<int>(sweep_order.size()); ++i)
+      position.at(sweep_order.at(i)->active_cell_index()) = i;
+
+    for (const auto& cell : sweep_order) {
+      for (int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+        if (!cell->at_boundary(face) && this->NormalDotOmega(face, angle) < 0) {
+          EXPECT_LT(position.at(cell->neighbor(face)->active_cell_index()),
+                    position.at(cell->active_cell_index()));
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, SolveGroupCellBalance) {
+  constexpr int dim = this->dim;
+  using SolverType = typename TestFixture::SolverType;
+  SolverType test_solver(this->formulation_ptr_, this->domain_ptr_,
+                         this->quadrature_set_ptr_);
+  system::solution::MPIGroupAngularSolution group_solution(this->total_angles_);
+  system::SetUpMPIAngularSolution(group_solution, *this->domain_ptr_, 0.0);
+
+  for (int angle = 0; angle < this->total_angles_; ++angle) {
+    EXPECT_CALL(*this->rhs_obs_ptr_,
+                GetFullTermPtr(system::Index{this->test_group_, angle}))
+        .WillOnce(Return(this->right_hand_side_ptr_));
+  }
+
+  test_solver.SolveGroup(this->test_group_, this->test_system_, group_solution);
+
+  /* For piecewise constant basis functions, the solution in each cell balances
+   * collision and net outflow with the source, using the upwind angular flux
+   * on each face and no incoming flux on the boundary. */
+  const double cell_volume = std::pow(this->cell_width_, dim);
+  const double face_area = std::pow(this->cell_width_, dim - 1);
+  std::vector<dealii::types::global_dof_index> dof(1);
+  auto angular_flux = [&](const auto& cell, const int angle) -> double {
+    cell->get_dof_indices(dof);
+    return group_solution[angle][dof.at(0)];
+  };
+
+  for (int angle = 0; angle < this->total_angles_; ++angle) {
+    for (const auto& cell : this->domain_ptr_->Cells()) {
+      const double cell_flux = angular_flux(cell, angle);
+      EXPECT_GT(cell_flux, 0);
+      double balance = this->sigma_t_ * cell_flux * cell_volume;
+      for (int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+        const double normal_dot_omega = this->NormalDotOmega(face, angle);
+        if (normal_dot_omega > 0) {
+          balance += normal_dot_omega * face_area * cell_flux;
+        } else if (!cell->at_boundary(face)) {
+          balance += normal_dot_omega * face_area *
+              angular_flux(cell->neighbor(face), angle);
+        }
+      }
+      EXPECT_NEAR(balance, this->source_ * cell_volume, 1e-10);
+    }
+  }
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, SolveGroupCellBalanceMPI) {
+  constexpr int dim = this->dim;
+  using SolverType = typename TestFixture::SolverType;
+  SolverType test_solver(this->formulation_ptr_, this->domain_ptr_,
+                         this->quadrature_set_ptr_);
+  system::solution::MPIGroupAngularSolution group_solution(this->total_angles_);
+  system::SetUpMPIAngularSolution(group_solution, *this->domain_ptr_, 0.0);
+  const int n_processes =
+      dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  if (dim == 1 && n_processes > 1) {
+    EXPECT_ANY_THROW(test_solver.SolveGroup(this->test_group_,
+                                            this->test_system_, group_solution));
+    return;
+  }
+
+  for (int angle = 0; angle < this->total_angles_; ++angle) {
+    EXPECT_CALL(*this->rhs_obs_ptr_,
+                GetFullTermPtr(system::Index{this->test_group_, angle}))
+        .WillOnce(Return(this->right_hand_side_ptr_));
+  }
+
+  test_solver.SolveGroup(this->test_group_, this->test_system_, group_solution);
+
+  // Angular flux in neighbors owned by other processors is read from ghosts
+  const auto locally_owned_dofs = this->domain_ptr_->locally_owned_dofs();
+  auto ghost_dofs = dim == 1 ? dealii::IndexSet(locally_owned_dofs.size()) :
+                    this->domain_ptr_->locally_relevant_dofs();
+  ghost_dofs.subtract_set(locally_owned_dofs);
+
+  const double cell_volume = std::pow(this->cell_width_, dim);
+  const double face_area = std::pow(this->cell_width_, dim - 1);
+  std::vector<dealii::types::global_dof_index> dof(1);
+
+  for (int angle = 0; angle < this->total_angles_; ++angle) {
+    system::MPIVector angular_flux(locally_owned_dofs, ghost_dofs,
+                                   MPI_COMM_WORLD);
+    angular_flux = group_solution[angle];
+    auto cell_angular_flux = [&](const auto& cell) -> double {
+      cell->get_dof_indices(dof);
+      return angular_flux[dof.at(0)];
+    };
+
+    for (const auto& cell : this->domain_ptr_->Cells()) {
+      const double cell_flux = cell_angular_flux(cell);
+      EXPECT_GT(cell_flux, 0);
+      double balance = this->sigma_t_ * cell_flux * cell_volume;
+      for (int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+        const double normal_dot_omega = this->NormalDotOmega(face, angle);
+        if (normal_dot_omega > 0) {
+          balance += normal_dot_omega * face_area * cell_flux;
+        } else if (!cell->at_boundary(face)) {
+          balance += normal_dot_omega * face_area *
+              cell_angular_flux(cell->neighbor(face));
+        }
+      }
+      EXPECT_NEAR(balance, this->source_ * cell_volume, 1e-10);
+    }
+  }
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, SolveGroupParallelEfficiency) {
+  using SolverType = typename TestFixture::SolverType;
+  SolverType test_solver(this->formulation_ptr_, this->domain_ptr_,
+                         this->quadrature_set_ptr_);
+  system::solution::MPIGroupAngularSolution group_solution(this->total_angles_);
+  system::SetUpMPIAngularSolution(group_solution, *this->domain_ptr_, 0.0);
+
+  test_solver.SolveGroup(this->test_group_, this->test_system_, group_solution);
+
+  // On a single processor there is no pipeline to fill
+  const auto parallel_efficiency = test_solver.parallel_efficiency();
+  EXPECT_DOUBLE_EQ(parallel_efficiency.model, 1.0);
+  EXPECT_GT(parallel_efficiency.measured, 0);
+  EXPECT_LE(parallel_efficiency.measured, 1.0);
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, AngleOrderGroupedByOctant) {
+  constexpr int dim = this->dim;
+  using SolverType = typename TestFixture::SolverType;
+  using QuadraturePointType = typename TestFixture::QuadraturePointType;
+  using QuadratureSetType = typename TestFixture::QuadratureSetType;
+
+  // Angles alternate between the first and last octant
+  const int total_angles = 4;
+  auto quadrature_set_ptr = std::make_shared<QuadratureSetType>();
+  std::vector<std::shared_ptr<QuadraturePointType>> quadrature_points;
+  for (int angle = 0; angle < total_angles; ++angle) {
+    dealii::Tensor<1, dim> omega;
+    for (int i = 0; i < dim; ++i)
+      omega[i] = (angle % 2 == 0 ? 1.0 : -1.0) * (0.1 + 0.2 * angle);
+    auto quadrature_point_ptr = std::make_shared<QuadraturePointType>();
+    ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+        .WillByDefault(Return(omega));
+    ON_CALL(*quadrature_set_ptr,
+            GetQuadraturePoint(quadrature::QuadraturePointIndex(angle)))
+        .WillByDefault(Return(quadrature_point_ptr));
+    quadrature_points.push_back(quadrature_point_ptr);
+  }
+
+  SolverType test_solver(this->formulation_ptr_, this->domain_ptr_,
+                         quadrature_set_ptr);
+  EXPECT_EQ(test_solver.GetAngleOrder(total_angles),
+            std::vector<int>({0, 2, 1, 3}));
+}
+
+TYPED_TEST(SolverGroupSweepGroupSolverTest, SolveGroupBadAngles) {
+  using SolverType = typename TestFixture::SolverType;
+  SolverType test_solver(this->formulation_ptr_, this->domain_ptr_,
+                         this->quadrature_set_ptr_);
+  system::solution::MPIGroupAngularSolution group_solution(0);
+  EXPECT_ANY_THROW(test_solver.SolveGroup(this->test_group_,
+                                          this->test_system_, group_solution));
+}
+
+} // namespace
@@ -0,0 +1,41 @@
+#ifndef BART_SRC_SOLVER_LINEAR_CG_H_
+#define BART_SRC_SOLVER_LINEAR_CG_H_
+
+#include <memory>
+
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_vector_base.h>
+
+#include "linear_i.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief Conjugate gradient linear solver.
+ *
+ * Only valid for symmetric positive definite systems, such as those stored
+ * using symmetric (upper triangular) matrix storage.
+ */
+class CG : public bart::solver::linear::LinearI {
+ public:
+  CG(int max_iterations = 100, double convergence_tolerance = 1e-10);
+  ~CG() = default;
+
+  void Solve(dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
+  int max_iterations() const { return solver_control_.max_steps(); };
+  double convergence_tolerance() const { return solver_control_.tolerance(); };
+
+  const dealii::SolverControl& solver_control() const { return solver_control_;};
+
+ private:
+  dealii::SolverControl solver_control_;
+  static bool is_registered_;
+};
+
+} // namespace bart::solver::linear
+
+#endif // BART_SRC_SOLVER_LINEAR_CG_H_
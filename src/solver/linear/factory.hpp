@@ -10,6 +10,8 @@ class LinearI;
 
 enum class LinearSolverName {
   kGMRES = 0, //solver::linear::GMRES
+  kCG = 1, //solver::linear::CG
+  kMixedPrecisionGMRES = 2, //solver::linear::MixedPrecisionGMRES
 };
 
 BART_INTERFACE_FACTORY(LinearI, LinearSolverName)
@@ -18,6 +20,10 @@ BART_INTERFACE_FACTORY(LinearI, LinearSolverName)
   switch (to_convert) {
     case LinearSolverName::kGMRES:
       return std::string{"LinearSolverName::kGMRES"};
+    case LinearSolverName::kCG:
+      return std::string{"LinearSolverName::kCG"};
+    case LinearSolverName::kMixedPrecisionGMRES:
+      return std::string{"LinearSolverName::kMixedPrecisionGMRES"};
   }
 }
 
@@ -5,6 +5,8 @@
 #include <deal.II/lac/petsc_matrix_base.h>
 #include <deal.II/lac/petsc_vector_base.h>
 
+#include "system/system_types.h"
+
 namespace bart::solver::linear {
 /*! \brief Linear solver class.
  *
@@ -19,6 +21,18 @@ class LinearI {
       dealii::PETScWrappers::VectorBase *x,
       dealii::PETScWrappers::VectorBase *b,
       dealii::PETScWrappers::PreconditionerBase *preconditioner) = 0;
+  /*! \brief Solves the system for a group and angle.
+   *
+   * Solvers that cache data for each system (such as a copy of \f$A\f$) use
+   * the index to identify it. By default the index is ignored.
+   */
+  virtual void Solve(
+      const system::Index& /*index*/,
+      dealii::PETScWrappers::MatrixBase *A,
+      dealii::PETScWrappers::VectorBase *x,
+      dealii::PETScWrappers::VectorBase *b,
+      dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+    Solve(A, x, b, preconditioner); }
 };
 
 } // namespace bart::solver::linear
@@ -0,0 +1,141 @@
+#include "solver/linear/mixed_precision_gmres.h"
+#include "solver/linear/factory.hpp"
+#include "linear_i.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/petsc_solver.h>
+#include <deal.II/lac/petsc_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/vector.h>
+
+namespace bart::solver::linear {
+
+namespace {
+/* Each correction solve reduces the residual by this factor, well above the
+ * rounding error of single precision. */
+constexpr double kCorrectionReduction{ 1e-4 };
+} // namespace
+
+MixedPrecisionGMRES::MixedPrecisionGMRES(int max_iterations,
+                                         double convergence_tolerance,
+                                         int max_refinements)
+    : max_iterations_(max_iterations),
+      solver_control_(max_refinements, convergence_tolerance) {
+  AssertThrow(max_iterations > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "MixedPrecisionGMRES, max iterations must be "
+                                 "greater than 0"))
+  AssertThrow(max_refinements > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "MixedPrecisionGMRES, max refinements must "
+                                 "be greater than 0"))
+}
+
+void MixedPrecisionGMRES::Solve(
+    dealii::PETScWrappers::MatrixBase *A,
+    dealii::PETScWrappers::VectorBase *x,
+    dealii::PETScWrappers::VectorBase *b,
+    dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+  dealii::SolverControl solver_control(max_iterations_,
+                                       solver_control_.tolerance());
+  dealii::PETScWrappers::SolverGMRES solver(solver_control, MPI_COMM_WORLD);
+  solver.solve(*A, *x, *b, *preconditioner);
+}
+
+void MixedPrecisionGMRES::Solve(
+    const system::Index& index,
+    dealii::PETScWrappers::MatrixBase *A,
+    dealii::PETScWrappers::VectorBase *x,
+    dealii::PETScWrappers::VectorBase *b,
+    dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+  if (dealii::Utilities::MPI::n_mpi_processes(A->get_mpi_communicator()) > 1)
+    return Solve(A, x, b, preconditioner);
+
+  using SinglePrecisionVector = dealii::Vector<float>;
+  const auto& single_precision_A = GetSinglePrecisionMatrix(index, *A);
+  dealii::PreconditionJacobi<SinglePrecisionMatrix> jacobi_preconditioner;
+  jacobi_preconditioner.initialize(single_precision_A);
+
+  const auto n_dofs = b->size();
+  system::MPIVector residual(A->get_mpi_communicator(), n_dofs, n_dofs);
+  SinglePrecisionVector single_precision_residual(n_dofs), correction(n_dofs);
+  std::vector<dealii::types::global_dof_index> indices(n_dofs);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::vector<PetscScalar> update(n_dofs);
+
+  double residual_norm = A->residual(residual, *x, *b);
+  int step = 0;
+  while (solver_control_.check(step, residual_norm) ==
+      dealii::SolverControl::iterate) {
+    single_precision_residual = dealii::Vector<double>(residual);
+    correction = 0;
+    dealii::ReductionControl correction_control(
+        max_iterations_, 0, kCorrectionReduction);
+    dealii::SolverGMRES<SinglePrecisionVector> solver(correction_control);
+    // An incomplete correction still reduces the residual, convergence is
+    // checked by the refinement loop
+    try {
+      solver.solve(single_precision_A, correction, single_precision_residual,
+                   jacobi_preconditioner);
+    } catch (dealii::SolverControl::NoConvergence&) {}
+
+    std::copy(correction.begin(), correction.end(), update.begin());
+    x->add(indices, update);
+    x->compress(dealii::VectorOperation::add);
+    residual_norm = A->residual(residual, *x, *b);
+    ++step;
+  }
+
+  AssertThrow(solver_control_.last_check() == dealii::SolverControl::success,
+              dealii::SolverControl::NoConvergence(solver_control_.last_step(),
+                                                   solver_control_.last_value()))
+}
+
+auto MixedPrecisionGMRES::GetSinglePrecisionMatrix(
+    const system::Index& index,
+    const dealii::PETScWrappers::MatrixBase& matrix)
+-> const SinglePrecisionMatrix& {
+  const Mat petsc_matrix = matrix;
+  PetscObjectState petsc_matrix_state;
+  const auto ierr = PetscObjectStateGet(
+      reinterpret_cast<PetscObject>(petsc_matrix), &petsc_matrix_state);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+
+  // The object state is increased by PETSc each time the matrix is modified
+  auto& copy_ptr = single_precision_matrices_[index];
+  if (copy_ptr != nullptr && copy_ptr->petsc_matrix == petsc_matrix &&
+      copy_ptr->petsc_matrix_state == petsc_matrix_state)
+    return copy_ptr->matrix;
+
+  copy_ptr = std::make_unique<SinglePrecisionCopy>();
+  copy_ptr->petsc_matrix = petsc_matrix;
+  copy_ptr->petsc_matrix_state = petsc_matrix_state;
+  dealii::DynamicSparsityPattern dynamic_sparsity_pattern(matrix.m(), matrix.n());
+  for (unsigned int row = 0; row < matrix.m(); ++row) {
+    for (auto it = matrix.begin(row); it != matrix.end(row); ++it)
+      dynamic_sparsity_pattern.add(row, it->column());
+  }
+  copy_ptr->sparsity_pattern.copy_from(dynamic_sparsity_pattern);
+  copy_ptr->matrix.reinit(copy_ptr->sparsity_pattern);
+  for (unsigned int row = 0; row < matrix.m(); ++row) {
+    for (auto it = matrix.begin(row); it != matrix.end(row); ++it)
+      copy_ptr->matrix.set(row, it->column(), static_cast<float>(it->value()));
+  }
+  return copy_ptr->matrix;
+}
+
+bool MixedPrecisionGMRES::is_registered_ = LinearIFactory<int, double>::get()
+    .RegisterConstructor(LinearSolverName::kMixedPrecisionGMRES,
+                         [] (int max_iterations, double convergence_tolerance) {
+                           std::unique_ptr<LinearI> return_ptr;
+                           return_ptr = std::make_unique<MixedPrecisionGMRES>(
+                               max_iterations, convergence_tolerance);
+                           return return_ptr; });
+
+} // namespace bart::solver::linear
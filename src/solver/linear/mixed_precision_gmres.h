@@ -0,0 +1,99 @@
+#ifndef BART_SRC_SOLVER_LINEAR_MIXED_PRECISION_GMRES_H_
+#define BART_SRC_SOLVER_LINEAR_MIXED_PRECISION_GMRES_H_
+
+#include <map>
+#include <memory>
+
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_vector_base.h>
+
+#include "linear_i.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief GMRES linear solver using mixed-precision iterative refinement.
+ *
+ * Systems solved for a group and angle on a single process are solved using
+ * an outer iterative refinement loop in double precision. Each refinement
+ * step calculates the residual \f$r_k = b - Ax_k\f$ in double precision, then
+ * solves the correction equation \f$A d_k = r_k\f$ using Jacobi
+ * preconditioned GMRES in single precision, and updates
+ * \f$x_{k+1} = x_k + d_k\f$. The Krylov iteration only reads a single
+ * precision copy of \f$A\f$, halving the memory traffic of each
+ * matrix-vector product, while the solution converges to the double precision
+ * tolerance. The PETSc preconditioner passed is not used by these solves.
+ *
+ * The single precision copy of \f$A\f$ is made the first time each group and
+ * angle is solved, and reused by later solves of the same group and angle
+ * while the PETSc object state of the matrix is unchanged. A different matrix,
+ * or a matrix that has been modified since the copy was made (for example if
+ * the fixed terms are stamped again), is copied again.
+ *
+ * PETSc is compiled for one precision only, so systems distributed over more
+ * than one process, or solved without an index, are solved using double
+ * precision GMRES.
+ */
+class MixedPrecisionGMRES : public bart::solver::linear::LinearI {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param max_iterations maximum GMRES iterations for each correction solve.
+   * @param convergence_tolerance tolerance for the residual of the solution.
+   * @param max_refinements maximum iterative refinement steps.
+   */
+  MixedPrecisionGMRES(int max_iterations = 100,
+                      double convergence_tolerance = 1e-10,
+                      int max_refinements = 20);
+  ~MixedPrecisionGMRES() = default;
+
+  void Solve(dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
+  void Solve(const system::Index& index,
+             dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
+
+  /*! \brief Removes the single precision copies made by previous solves. */
+  void ClearCache() { single_precision_matrices_.clear(); }
+
+  int max_iterations() const { return max_iterations_; };
+  double convergence_tolerance() const { return solver_control_.tolerance(); };
+  int max_refinements() const { return solver_control_.max_steps(); };
+  /*! \brief Refinement steps used by the last single precision solve */
+  int refinement_steps() const { return solver_control_.last_step(); };
+  int n_cached_matrices() const { return single_precision_matrices_.size(); }
+
+  const dealii::SolverControl& solver_control() const { return solver_control_;};
+
+ private:
+  using SinglePrecisionMatrix = dealii::SparseMatrix<float>;
+  //! Copy of a matrix, with the sparsity pattern it is stored with
+  struct SinglePrecisionCopy {
+    dealii::SparsityPattern sparsity_pattern;
+    SinglePrecisionMatrix matrix;
+    //! Copied PETSc matrix and its object state when it was copied
+    Mat petsc_matrix{ nullptr };
+    PetscObjectState petsc_matrix_state{ -1 };
+  };
+  const SinglePrecisionMatrix& GetSinglePrecisionMatrix(
+      const system::Index& index,
+      const dealii::PETScWrappers::MatrixBase& matrix);
+
+  const int max_iterations_;
+  //! Controls the outer refinement loop
+  dealii::SolverControl solver_control_;
+  //! Single precision copies of the left hand side, one for each group and angle
+  std::map<system::Index, std::unique_ptr<SinglePrecisionCopy>> single_precision_matrices_;
+  static bool is_registered_;
+};
+
+} // namespace bart::solver::linear
+
+#endif // BART_SRC_SOLVER_LINEAR_MIXED_PRECISION_GMRES_H_
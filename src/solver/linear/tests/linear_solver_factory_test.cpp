@@ -1,6 +1,8 @@
 #include "solver/linear/factory.hpp"
 
+#include "solver/linear/cg.h"
 #include "solver/linear/gmres.h"
+#include "solver/linear/mixed_precision_gmres.h"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_helper_functions.h"
 
@@ -23,4 +25,32 @@ TEST(SolverFactoryTest, GMRES) {
   EXPECT_EQ(dynamic_ptr->convergence_tolerance(), tolerance);
 }
 
+TEST(SolverFactoryTest, CG) {
+  using ExpectedType = solver::linear::CG;
+  using SolverName = solver::linear::LinearSolverName;
+  const int max_iterations{test_helpers::RandomInt(200, 1000)};
+  const double tolerance{test_helpers::RandomDouble(1e-16, 1e-10)};
+  auto cg_ptr = solver::linear::LinearIFactory<int, double>::get()
+      .GetConstructor(SolverName::kCG)(max_iterations, tolerance);
+  ASSERT_NE(cg_ptr, nullptr);
+  auto dynamic_ptr = dynamic_cast<ExpectedType*>(cg_ptr.get());
+  ASSERT_NE(dynamic_ptr, nullptr);
+  EXPECT_EQ(dynamic_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(dynamic_ptr->convergence_tolerance(), tolerance);
+}
+
+TEST(SolverFactoryTest, MixedPrecisionGMRES) {
+  using ExpectedType = solver::linear::MixedPrecisionGMRES;
+  using SolverName = solver::linear::LinearSolverName;
+  const int max_iterations{test_helpers::RandomInt(200, 1000)};
+  const double tolerance{test_helpers::RandomDouble(1e-16, 1e-10)};
+  auto gmres_ptr = solver::linear::LinearIFactory<int, double>::get()
+      .GetConstructor(SolverName::kMixedPrecisionGMRES)(max_iterations, tolerance);
+  ASSERT_NE(gmres_ptr, nullptr);
+  auto dynamic_ptr = dynamic_cast<ExpectedType*>(gmres_ptr.get());
+  ASSERT_NE(dynamic_ptr, nullptr);
+  EXPECT_EQ(dynamic_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(dynamic_ptr->convergence_tolerance(), tolerance);
+}
+
 } // namespace
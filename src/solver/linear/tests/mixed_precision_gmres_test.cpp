@@ -0,0 +1,181 @@
+#include "solver/linear/mixed_precision_gmres.h"
+
+#include <deal.II/lac/petsc_full_matrix.h>
+#include <deal.II/lac/petsc_sparse_matrix.h>
+#include <deal.II/lac/petsc_vector.h>
+
+#include "test_helpers/test_helper_functions.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+namespace solver = bart::solver;
+namespace test_helpers = bart::test_helpers;
+
+class SolverLinearMixedPrecisionGMRESTest : public ::testing::Test {
+ protected:
+  using FullMatrix = dealii::PETScWrappers::FullMatrix;
+  using Vector = dealii::PETScWrappers::MPI::Vector;
+  using MixedPrecisionGMRES = solver::linear::MixedPrecisionGMRES;
+  static constexpr int default_max_iterations_{ 100 };
+  static constexpr double default_tolerance_{ 1e-10 };
+  static constexpr int default_max_refinements_{ 20 };
+
+  const std::vector<double> b_{5, 7, 8};
+  const std::vector<double> x_{-15, 8, 2};
+  const std::vector<std::vector<double>> A_{{1, 3, -2}, {3, 5, 6}, {2, 4, 3}};
+};
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, ConstructorDefaultValues) {
+  MixedPrecisionGMRES solver;
+  EXPECT_EQ(solver.max_iterations(), default_max_iterations_);
+  EXPECT_EQ(solver.convergence_tolerance(), default_tolerance_);
+  EXPECT_EQ(solver.max_refinements(), default_max_refinements_);
+  EXPECT_EQ(solver.n_cached_matrices(), 0);
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, ConstructorProvidedValues) {
+  const int max_iterations{ test_helpers::RandomInt(100, 200) };
+  const double tolerance { test_helpers::RandomDouble(1e-10, 1e-6) };
+  const int max_refinements{ test_helpers::RandomInt(5, 10) };
+
+  MixedPrecisionGMRES solver(max_iterations, tolerance, max_refinements);
+  EXPECT_EQ(solver.max_iterations(), max_iterations);
+  EXPECT_EQ(solver.convergence_tolerance(), tolerance);
+  EXPECT_EQ(solver.max_refinements(), max_refinements);
+  EXPECT_EQ(solver.solver_control().tolerance(), tolerance);
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, ConstructorBadValues) {
+  EXPECT_ANY_THROW({ MixedPrecisionGMRES solver(0, 1e-10, 10); });
+  EXPECT_ANY_THROW({ MixedPrecisionGMRES solver(100, 1e-10, 0); });
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, SolveTestNoPrecon) {
+  std::vector<unsigned int> indices{0,1,2};
+  std::vector<double> zeroes(3,0);
+
+  Vector petsc_b(MPI_COMM_WORLD, 3, 3);
+  petsc_b.set(indices, b_);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  Vector petsc_x(MPI_COMM_WORLD, 3, 3);
+  petsc_x.set(indices, zeroes);
+  petsc_x.compress(dealii::VectorOperation::insert);
+
+  FullMatrix petsc_A(3,3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      petsc_A.set(i, j, A_[i][j]);
+    }
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  MixedPrecisionGMRES solver(100, 1e-6);
+  solver.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(petsc_x[i], x_[i], 1e-6);
+  }
+}
+
+/* A larger non-symmetric system, where a single precision solve alone cannot
+ * reach the tolerance, requires more than one refinement. */
+TEST_F(SolverLinearMixedPrecisionGMRESTest, SolveTestIndexedRefinement) {
+  const int size = 50;
+  dealii::PETScWrappers::SparseMatrix petsc_A(size, size, 3);
+  Vector petsc_x(MPI_COMM_SELF, size, size), petsc_b(MPI_COMM_SELF, size, size);
+  Vector residual(MPI_COMM_SELF, size, size);
+  for (int i = 0; i < size; ++i) {
+    petsc_A.set(i, i, 4.0 + 1.0 / (i + 1));
+    if (i > 0)
+      petsc_A.set(i, i - 1, -1.5);
+    if (i < size - 1)
+      petsc_A.set(i, i + 1, -1.0 / 3.0);
+    petsc_b[i] = 1.0 + 1.0 / (i + 7);
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  MixedPrecisionGMRES solver(100, 1e-10);
+  const bart::system::Index index{0, 1};
+  solver.Solve(index, &petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+
+  // Converges to the double precision tolerance
+  EXPECT_LE(petsc_A.residual(residual, petsc_x, petsc_b), 1e-10);
+  EXPECT_GT(solver.refinement_steps(), 1);
+  EXPECT_EQ(solver.n_cached_matrices(), 1);
+
+  // Solving the same index again reuses the single precision copy
+  petsc_x = 0;
+  solver.Solve(index, &petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+  EXPECT_LE(petsc_A.residual(residual, petsc_x, petsc_b), 1e-10);
+  EXPECT_EQ(solver.n_cached_matrices(), 1);
+
+  // Other groups and angles get their own copy, even for the same matrix
+  petsc_x = 0;
+  solver.Solve({1, 1}, &petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+  EXPECT_EQ(solver.n_cached_matrices(), 2);
+
+  solver.ClearCache();
+  EXPECT_EQ(solver.n_cached_matrices(), 0);
+}
+
+/* Changing the values of a matrix of the same size, as when fixed terms are
+ * stamped again, replaces the cached single precision copy. */
+TEST_F(SolverLinearMixedPrecisionGMRESTest, SolveTestChangedMatrixRecopied) {
+  const int size = 50;
+  dealii::PETScWrappers::SparseMatrix petsc_A(size, size, 3);
+  Vector petsc_x(MPI_COMM_SELF, size, size), petsc_b(MPI_COMM_SELF, size, size);
+  Vector residual(MPI_COMM_SELF, size, size);
+  for (int i = 0; i < size; ++i) {
+    petsc_A.set(i, i, 4.0);
+    if (i > 0)
+      petsc_A.set(i, i - 1, -1.0);
+    petsc_b[i] = 1.0;
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  MixedPrecisionGMRES solver(100, 1e-10);
+  const bart::system::Index index{0, 0};
+  solver.Solve(index, &petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+  EXPECT_LE(petsc_A.residual(residual, petsc_x, petsc_b), 1e-10);
+
+  for (int i = 0; i < size; ++i) {
+    petsc_A.set(i, i, 10.0 + i);
+    if (i > 0)
+      petsc_A.set(i, i - 1, 2.0);
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+
+  petsc_x = 0;
+  solver.Solve(index, &petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+  EXPECT_LE(petsc_A.residual(residual, petsc_x, petsc_b), 1e-10);
+  EXPECT_EQ(solver.n_cached_matrices(), 1);
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, SolveTestNoIndexNotCached) {
+  const int size = 3;
+  dealii::PETScWrappers::SparseMatrix petsc_A(size, size, size);
+  Vector petsc_x(MPI_COMM_SELF, size, size), petsc_b(MPI_COMM_SELF, size, size);
+  for (int i = 0; i < size; ++i) {
+    petsc_b[i] = b_[i];
+    for (int j = 0; j < size; ++j)
+      petsc_A.set(i, j, A_[i][j]);
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  MixedPrecisionGMRES solver(100, 1e-10);
+  solver.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner);
+  for (int i = 0; i < size; ++i)
+    EXPECT_NEAR(petsc_x[i], x_[i], 1e-6);
+  EXPECT_EQ(solver.n_cached_matrices(), 0);
+}
+
+} // namespace
@@ -0,0 +1,146 @@
+#include "solver/preconditioner/geometric_multigrid.h"
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/lac/exceptions.h>
+
+namespace bart::solver::preconditioner {
+
+GeometricMultigrid::GeometricMultigrid(
+    const ProlongationMatrices& prolongation_matrices,
+    const problem::PreconditionerType smoother,
+    const int smoothing_steps)
+    : prolongation_matrices_(prolongation_matrices),
+      smoother_(smoother),
+      smoothing_steps_(smoothing_steps) {
+  AssertThrow(!prolongation_matrices_.empty(),
+              dealii::ExcMessage("Error in GeometricMultigrid constructor, at "
+                                 "least one prolongation matrix is required"))
+  for (const auto& prolongation_ptr : prolongation_matrices_) {
+    AssertThrow(prolongation_ptr != nullptr,
+                dealii::ExcMessage("Error in GeometricMultigrid constructor, "
+                                   "prolongation matrix pointers must not be "
+                                   "null"))
+  }
+  AssertThrow(smoother_ == problem::PreconditionerType::kJacobi ||
+              smoother_ == problem::PreconditionerType::kBlockJacobi ||
+              smoother_ == problem::PreconditionerType::kBlockSSOR,
+              dealii::ExcMessage("Error in GeometricMultigrid constructor, "
+                                 "smoother must be Jacobi, block Jacobi or "
+                                 "block SSOR"))
+  AssertThrow(smoothing_steps_ > 0,
+              dealii::ExcMessage("Error in GeometricMultigrid constructor, "
+                                 "smoothing steps must be > 0"))
+}
+
+GeometricMultigrid::~GeometricMultigrid() {
+  if (preconditioner_matrix_ != nullptr)
+    MatDestroy(&preconditioner_matrix_);
+}
+
+void GeometricMultigrid::initialize(
+    const dealii::PETScWrappers::MatrixBase& matrix_to_precondition) {
+  clear();
+  PetscErrorCode ierr;
+  if (preconditioner_matrix_ != nullptr) {
+    ierr = MatDestroy(&preconditioner_matrix_);
+    AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  }
+
+  const Mat system_matrix = static_cast<Mat>(matrix_to_precondition);
+  PetscBool is_symmetric_storage;
+  ierr = PetscObjectTypeCompareAny(reinterpret_cast<PetscObject>(system_matrix),
+                                   &is_symmetric_storage, MATSBAIJ,
+                                   MATSEQSBAIJ, MATMPISBAIJ, "");
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  AssertThrow(!is_symmetric_storage,
+              dealii::ExcMessage("Error in GeometricMultigrid initialize, "
+                                 "Galerkin coarse operators require a full "
+                                 "storage system matrix"))
+  ierr = PetscObjectReference(reinterpret_cast<PetscObject>(system_matrix));
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  preconditioner_matrix_ = system_matrix;
+
+  // Linear solvers pass this matrix to PETSc as the preconditioner matrix
+  matrix = preconditioner_matrix_;
+  create_pc();
+
+  ierr = PCSetType(pc, PCMG);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = PCMGSetLevels(pc, n_levels(), nullptr);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = PCMGSetType(pc, PC_MG_MULTIPLICATIVE);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = PCMGSetCycleType(pc, PC_MG_CYCLE_V);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = PCMGSetGalerkin(pc, PC_MG_GALERKIN_BOTH);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+
+  for (int level = 1; level < n_levels(); ++level) {
+    ierr = PCMGSetInterpolation(
+        pc, level, prolongation_matrices_.at(level - 1)->petsc_matrix());
+    AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+
+    KSP smoother_ksp;
+    ierr = PCMGGetSmoother(pc, level, &smoother_ksp);
+    AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+    SetUpSmoother(smoother_ksp);
+  }
+
+  KSP coarse_ksp;
+  PC coarse_pc;
+  ierr = PCMGGetCoarseSolve(pc, &coarse_ksp);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = KSPSetType(coarse_ksp, KSPPREONLY);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = KSPGetPC(coarse_ksp, &coarse_pc);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  // Coarsest level is gathered on each process and solved using LU
+  ierr = PCSetType(coarse_pc, PCREDUNDANT);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+
+  ierr = PCSetUp(pc);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+}
+
+void GeometricMultigrid::SetUpSmoother(KSP smoother_ksp) const {
+  PetscErrorCode ierr;
+  PC smoother_pc;
+  ierr = KSPSetType(smoother_ksp, KSPRICHARDSON);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = KSPSetTolerances(smoother_ksp, PETSC_DEFAULT, PETSC_DEFAULT,
+                          PETSC_DEFAULT, smoothing_steps_);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = KSPSetNormType(smoother_ksp, KSP_NORM_NONE);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  ierr = KSPGetPC(smoother_ksp, &smoother_pc);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+
+  switch (smoother_) {
+    case problem::PreconditionerType::kJacobi: {
+      // Damped Jacobi, damping of 2/3 gives the best smoothing of the
+      // Laplacian
+      ierr = KSPRichardsonSetScale(smoother_ksp, 2.0/3.0);
+      AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+      ierr = PCSetType(smoother_pc, PCJACOBI);
+      break;
+    }
+    case problem::PreconditionerType::kBlockJacobi: {
+      ierr = PCSetType(smoother_pc, PCBJACOBI);
+      break;
+    }
+    case problem::PreconditionerType::kBlockSSOR: {
+      ierr = PCSetType(smoother_pc, PCSOR);
+      AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+      ierr = PCSORSetSymmetric(smoother_pc, SOR_LOCAL_SYMMETRIC_SWEEP);
+      break;
+    }
+    default: {
+      AssertThrow(false,
+                  dealii::ExcMessage("Error in GeometricMultigrid, "
+                                     "unsupported smoother"))
+    }
+  }
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+}
+
+} // namespace bart::solver::preconditioner
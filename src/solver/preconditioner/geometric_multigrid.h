@@ -0,0 +1,76 @@
+#ifndef BART_SRC_SOLVER_PRECONDITIONER_GEOMETRIC_MULTIGRID_H_
+#define BART_SRC_SOLVER_PRECONDITIONER_GEOMETRIC_MULTIGRID_H_
+
+#include <memory>
+#include <vector>
+
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_precondition.h>
+
+#include <petscksp.h>
+
+#include "problem/parameter_types.h"
+#include "system/system_types.h"
+
+namespace bart::solver::preconditioner {
+
+/*! \brief Geometric multigrid preconditioner for diffusion systems.
+ *
+ * Applies one multiplicative V-cycle over a hierarchy of globally refined
+ * meshes, using the PETSc PCMG preconditioner. The hierarchy is defined by
+ * prolongation matrices between consecutive levels, such as those made by
+ * domain::Definition::MakeProlongationMatrices. Only the finest level system
+ * is assembled, coarse level systems are the Galerkin operators
+ * \f$\mathbf{A}_{l} = \mathbf{P}_l^T\mathbf{A}_{l+1}\mathbf{P}_l\f$. The
+ * coarsest level is solved directly.
+ *
+ * Forming the Galerkin operators requires a full storage (AIJ) system
+ * matrix, initializing with a symmetric (SBAIJ) storage matrix throws.
+ *
+ * Example use:
+ * \code{.cpp}
+ * auto prolongation_matrices = domain.MakeProlongationMatrices();
+ * GeometricMultigrid preconditioner(prolongation_matrices);
+ * preconditioner.initialize(system_matrix);
+ * linear_solver.Solve(&system_matrix, &x, &b, &preconditioner);
+ * \endcode
+ */
+class GeometricMultigrid : public dealii::PETScWrappers::PreconditionerBase {
+ public:
+  using ProlongationMatrices = std::vector<std::shared_ptr<system::MPISparseMatrix>>;
+
+  /*! \brief Constructor.
+   *
+   * @param prolongation_matrices prolongation matrices, ordered from the
+   *        coarsest to the finest level.
+   * @param smoother smoother used on each level, Jacobi, block Jacobi or
+   *        block SSOR.
+   * @param smoothing_steps pre- and post-smoothing steps on each level.
+   */
+  GeometricMultigrid(const ProlongationMatrices& prolongation_matrices,
+                     problem::PreconditionerType smoother =
+                         problem::PreconditionerType::kJacobi,
+                     int smoothing_steps = 2);
+  ~GeometricMultigrid();
+
+  /*! \brief Sets up the multigrid hierarchy for the given system matrix. */
+  void initialize(const dealii::PETScWrappers::MatrixBase& matrix_to_precondition);
+
+  int n_levels() const { return prolongation_matrices_.size() + 1; }
+  problem::PreconditionerType smoother() const { return smoother_; }
+  int smoothing_steps() const { return smoothing_steps_; }
+
+ private:
+  //! Sets the smoother of one level
+  void SetUpSmoother(KSP smoother_ksp) const;
+
+  const ProlongationMatrices prolongation_matrices_;
+  const problem::PreconditionerType smoother_;
+  const int smoothing_steps_;
+  //! Reference to the system matrix used to set up the hierarchy
+  Mat preconditioner_matrix_ = nullptr;
+};
+
+} // namespace bart::solver::preconditioner
+
+#endif //BART_SRC_SOLVER_PRECONDITIONER_GEOMETRIC_MULTIGRID_H_
@@ -0,0 +1,203 @@
+#include "solver/preconditioner/geometric_multigrid.h"
+
+#include <memory>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/petsc_solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include "domain/definition.h"
+#include "domain/finite_element/tests/finite_element_mock.h"
+#include "domain/mesh/tests/mesh_mock.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::_, ::testing::NiceMock, ::testing::Return;
+
+template <typename DimensionWrapper>
+class SolverPreconditionerGeometricMultigridTest : public ::testing::Test {
+ protected:
+  static constexpr int dim = DimensionWrapper::value;
+  using GeometricMultigrid = solver::preconditioner::GeometricMultigrid;
+  using Domain = domain::Definition<dim>;
+
+  SolverPreconditionerGeometricMultigridTest() : fe_(1) {}
+
+  dealii::FE_Q<dim> fe_;
+  std::shared_ptr<domain::finite_element::FiniteElementMock<dim>> fe_ptr_;
+
+  void SetUp() override;
+  //! Makes a uniformly refined domain on the unit hypercube
+  std::unique_ptr<Domain> MakeDomain(const int global_refinements);
+  //! Assembles a diffusion operator with absorption
+  void AssembleDiffusion(const Domain& domain,
+                         system::MPISparseMatrix& to_fill) const;
+  //! Solves a system with CG preconditioned by GMG, returning the iterations
+  int SolveIterations(const int global_refinements);
+  static bool IsSupported() {
+    return dim > 1 ||
+        dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) == 1;
+  }
+  static void SetTriangulation(dealii::Triangulation<dim>& to_fill) {
+    dealii::GridGenerator::hyper_cube(to_fill, 0, 1);
+  }
+};
+
+TYPED_TEST_CASE(SolverPreconditionerGeometricMultigridTest,
+                bart::testing::AllDimensions);
+
+template <typename DimensionWrapper>
+void SolverPreconditionerGeometricMultigridTest<DimensionWrapper>::SetUp() {
+  fe_ptr_ = std::make_shared<NiceMock<domain::finite_element::FiniteElementMock<dim>>>();
+  ON_CALL(*fe_ptr_, finite_element()).WillByDefault(Return(&fe_));
+}
+
+template <typename DimensionWrapper>
+auto SolverPreconditionerGeometricMultigridTest<DimensionWrapper>::MakeDomain(
+    const int global_refinements) -> std::unique_ptr<Domain> {
+  auto mesh_ptr = std::make_unique<NiceMock<domain::mesh::MeshMock<dim>>>();
+  ON_CALL(*mesh_ptr, has_material_mapping()).WillByDefault(Return(true));
+  ON_CALL(*mesh_ptr, FillTriangulation(_))
+      .WillByDefault(::testing::Invoke(SetTriangulation));
+  auto domain_ptr = std::make_unique<Domain>(std::move(mesh_ptr), fe_ptr_);
+  domain_ptr->SetUpMesh(global_refinements);
+  domain_ptr->SetUpDOF();
+  return domain_ptr;
+}
+
+template <typename DimensionWrapper>
+void SolverPreconditionerGeometricMultigridTest<DimensionWrapper>::AssembleDiffusion(
+    const Domain& domain, system::MPISparseMatrix& to_fill) const {
+  const double diffusion_coefficient = 1.0, absorption = 0.1;
+  const dealii::QGauss<dim> quadrature(2);
+  dealii::FEValues<dim> fe_values(fe_, quadrature,
+                                  dealii::update_values |
+                                  dealii::update_gradients |
+                                  dealii::update_JxW_values);
+  dealii::FullMatrix<double> cell_matrix(fe_.dofs_per_cell, fe_.dofs_per_cell);
+  std::vector<dealii::types::global_dof_index> cell_dofs(fe_.dofs_per_cell);
+
+  for (const auto& cell : domain.Cells()) {
+    fe_values.reinit(cell);
+    cell_matrix = 0;
+    for (unsigned int q = 0; q < quadrature.size(); ++q) {
+      for (unsigned int i = 0; i < fe_.dofs_per_cell; ++i) {
+        for (unsigned int j = 0; j < fe_.dofs_per_cell; ++j) {
+          cell_matrix(i, j) += (
+              diffusion_coefficient * fe_values.shape_grad(i, q) *
+                  fe_values.shape_grad(j, q) +
+              absorption * fe_values.shape_value(i, q) *
+                  fe_values.shape_value(j, q)) * fe_values.JxW(q);
+        }
+      }
+    }
+    cell->get_dof_indices(cell_dofs);
+    to_fill.add(cell_dofs, cell_matrix);
+  }
+  to_fill.compress(dealii::VectorOperation::add);
+}
+
+template <typename DimensionWrapper>
+int SolverPreconditionerGeometricMultigridTest<DimensionWrapper>::SolveIterations(
+    const int global_refinements) {
+  auto domain_ptr = MakeDomain(global_refinements);
+  auto matrix_ptr = domain_ptr->MakeSystemMatrix();
+  AssembleDiffusion(*domain_ptr, *matrix_ptr);
+
+  GeometricMultigrid preconditioner(domain_ptr->MakeProlongationMatrices());
+  preconditioner.initialize(*matrix_ptr);
+  EXPECT_EQ(preconditioner.n_levels(), global_refinements + 1);
+
+  // Right hand side is set so that the solution is a vector of ones
+  auto solution_ptr = domain_ptr->MakeSystemVector();
+  auto right_hand_side_ptr = domain_ptr->MakeSystemVector();
+  *solution_ptr = 1.0;
+  matrix_ptr->vmult(*right_hand_side_ptr, *solution_ptr);
+  *solution_ptr = 0;
+
+  dealii::SolverControl solver_control(200, 1e-10 * right_hand_side_ptr->l2_norm());
+  dealii::PETScWrappers::SolverCG solver(solver_control, MPI_COMM_WORLD);
+  solver.solve(*matrix_ptr, *solution_ptr, *right_hand_side_ptr, preconditioner);
+
+  for (const auto dof : domain_ptr->locally_owned_dofs())
+    EXPECT_NEAR((*solution_ptr)[dof], 1.0, 1e-6);
+  return solver_control.last_step();
+}
+
+TYPED_TEST(SolverPreconditionerGeometricMultigridTest, Constructor) {
+  using GeometricMultigrid = solver::preconditioner::GeometricMultigrid;
+  GeometricMultigrid::ProlongationMatrices prolongation_matrices{
+      std::make_shared<system::MPISparseMatrix>(),
+      std::make_shared<system::MPISparseMatrix>()};
+
+  GeometricMultigrid test_preconditioner(prolongation_matrices,
+                                         problem::PreconditionerType::kBlockSSOR,
+                                         3);
+  EXPECT_EQ(test_preconditioner.n_levels(), 3);
+  EXPECT_EQ(test_preconditioner.smoother(),
+            problem::PreconditionerType::kBlockSSOR);
+  EXPECT_EQ(test_preconditioner.smoothing_steps(), 3);
+
+  GeometricMultigrid default_preconditioner(prolongation_matrices);
+  EXPECT_EQ(default_preconditioner.smoother(),
+            problem::PreconditionerType::kJacobi);
+  EXPECT_EQ(default_preconditioner.smoothing_steps(), 2);
+}
+
+TYPED_TEST(SolverPreconditionerGeometricMultigridTest, ConstructorBadParameters) {
+  using GeometricMultigrid = solver::preconditioner::GeometricMultigrid;
+  GeometricMultigrid::ProlongationMatrices prolongation_matrices{
+      std::make_shared<system::MPISparseMatrix>()};
+
+  EXPECT_ANY_THROW({
+    GeometricMultigrid test_preconditioner(GeometricMultigrid::ProlongationMatrices{});
+  });
+  EXPECT_ANY_THROW({
+    GeometricMultigrid test_preconditioner(
+        GeometricMultigrid::ProlongationMatrices{nullptr});
+  });
+  for (const auto bad_smoother : {problem::PreconditionerType::kAMG,
+                                  problem::PreconditionerType::kNone,
+                                  problem::PreconditionerType::kGeometricMultigrid}) {
+    EXPECT_ANY_THROW({
+      GeometricMultigrid test_preconditioner(prolongation_matrices, bad_smoother);
+    });
+  }
+  EXPECT_ANY_THROW({
+    GeometricMultigrid test_preconditioner(
+        prolongation_matrices, problem::PreconditionerType::kJacobi, 0);
+  });
+}
+
+TYPED_TEST(SolverPreconditionerGeometricMultigridTest, MeshIndependentConvergenceMPI) {
+  if (!this->IsSupported())
+    return;
+  const int coarse_refinements = this->dim == 3 ? 2 : 3;
+  const int coarse_iterations = this->SolveIterations(coarse_refinements);
+  const int fine_iterations = this->SolveIterations(coarse_refinements + 2);
+
+  EXPECT_LE(coarse_iterations, 20);
+  EXPECT_LE(fine_iterations, coarse_iterations + 3);
+}
+
+TYPED_TEST(SolverPreconditionerGeometricMultigridTest, SymmetricStorageThrowsMPI) {
+  if (!this->IsSupported())
+    return;
+  auto domain_ptr = this->MakeDomain(2);
+  auto matrix_ptr = domain_ptr->MakeSymmetricSystemMatrix();
+  this->AssembleDiffusion(*domain_ptr, *matrix_ptr);
+
+  solver::preconditioner::GeometricMultigrid preconditioner(
+      domain_ptr->MakeProlongationMatrices());
+  EXPECT_ANY_THROW(preconditioner.initialize(*matrix_ptr));
+}
+
+} // namespace
@@ -0,0 +1,87 @@
+#include "system/moments/moment_block.h"
+
+#include <utility>
+
+namespace bart {
+
+namespace system {
+
+namespace moments {
+
+template <typename Number>
+MomentBlock<Number>::MomentBlock(const int total_groups,
+                                 const int max_harmonic_l,
+                                 const std::size_t moment_size) {
+  reinit(total_groups, max_harmonic_l, moment_size);
+}
+
+template <typename Number>
+void MomentBlock<Number>::reinit(const int total_groups,
+                                 const int max_harmonic_l,
+                                 const std::size_t moment_size) {
+  AssertThrow(total_groups > 0,
+              dealii::ExcMessage("Error in MomentBlock reinit, total_groups "
+                                 "must be > 0"))
+  AssertThrow(max_harmonic_l >= 0,
+              dealii::ExcMessage("Error in MomentBlock reinit, l_max must be "
+                                 ">= 0"))
+  if (total_groups == total_groups_ && max_harmonic_l == max_harmonic_l_ &&
+      moment_size == moment_size_)
+    return;
+  total_groups_ = total_groups;
+  max_harmonic_l_ = max_harmonic_l;
+  moment_size_ = moment_size;
+  values_.assign(total_groups_ * harmonics_per_group() * moment_size_, 0);
+}
+
+template <typename Number>
+void MomentBlock<Number>::swap(MomentBlock& other) noexcept {
+  values_.swap(other.values_);
+  std::swap(total_groups_, other.total_groups_);
+  std::swap(max_harmonic_l_, other.max_harmonic_l_);
+  std::swap(moment_size_, other.moment_size_);
+}
+
+template <typename Number>
+auto MomentBlock<Number>::operator[](const MomentIndex index) -> View {
+  return View(values_.data() + Offset(index), moment_size_);
+}
+
+template <typename Number>
+auto MomentBlock<Number>::operator[](const MomentIndex index) const
+-> ConstView {
+  return ConstView(values_.data() + Offset(index), moment_size_);
+}
+
+template <typename Number>
+auto MomentBlock<Number>::group(const int group) -> View {
+  return View(values_.data() + Offset({group, 0, 0}),
+              harmonics_per_group() * moment_size_);
+}
+
+template <typename Number>
+auto MomentBlock<Number>::group(const int group) const -> ConstView {
+  return ConstView(values_.data() + Offset({group, 0, 0}),
+                   harmonics_per_group() * moment_size_);
+}
+
+template <typename Number>
+std::size_t MomentBlock<Number>::Offset(const MomentIndex index) const {
+  const auto [group, l, m] = index;
+  AssertThrow(group >= 0 && group < total_groups_ && l >= 0 &&
+              l <= max_harmonic_l_ && m >= -l && m <= l,
+              dealii::ExcMessage("Error in MomentBlock, moment index is out "
+                                 "of range"))
+  // Harmonics (l, m) are ordered by degree, then order
+  const int harmonic = l * l + l + m;
+  return (group * harmonics_per_group() + harmonic) * moment_size_;
+}
+
+template class MomentBlock<float>;
+template class MomentBlock<double>;
+
+} // namespace moments
+
+} // namespace system
+
+} // namespace bart
@@ -0,0 +1,94 @@
+#ifndef BART_SRC_SYSTEM_MOMENTS_MOMENT_BLOCK_H_
+#define BART_SRC_SYSTEM_MOMENTS_MOMENT_BLOCK_H_
+
+#include <vector>
+
+#include <deal.II/base/array_view.h>
+
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace system {
+
+namespace moments {
+
+/*! \brief Stores all spherical harmonic moments in one contiguous block.
+ *
+ * Moments are stored group by group, and within each group by harmonic, so
+ * that the block is shaped \f$G \times (\ell_{\text{max}} + 1)^2 \times N\f$,
+ * where \f$N\f$ is the size of each moment. The moments of a group are
+ * therefore contiguous, and each moment is accessed through a non-owning view
+ * into the block instead of a separately allocated vector.
+ *
+ * Two blocks with the same shape can be double buffered by swapping their
+ * storage, no values are copied.
+ *
+ * \code{cpp}
+ * // two groups, l_max = 1, and 10 degrees of freedom per moment
+ * system::moments::MomentBlock<float> moments(2, 1, 10);
+ * auto scalar_flux = moments[{0, 0, 0}];
+ * \endcode
+ *
+ * @tparam Number type used to store moment values.
+ */
+template <typename Number>
+class MomentBlock {
+ public:
+  //! Non-owning view of a moment, or the moments of a group
+  using View = dealii::ArrayView<Number>;
+  //! Non-owning view of a constant moment, or the moments of a group
+  using ConstView = dealii::ArrayView<const Number>;
+
+  MomentBlock() = default;
+  MomentBlock(const int total_groups, const int max_harmonic_l,
+              const std::size_t moment_size);
+
+  /*! \brief Sets the shape of the block.
+   *
+   * Existing storage, and the values it holds, are kept if the shape is
+   * unchanged. Otherwise all values are set to zero.
+   */
+  void reinit(const int total_groups, const int max_harmonic_l,
+              const std::size_t moment_size);
+
+  /*! \brief Exchanges storage with another block, no values are copied. */
+  void swap(MomentBlock& other) noexcept;
+
+  View operator[](const MomentIndex index);
+  ConstView operator[](const MomentIndex index) const;
+
+  /*! \brief Returns a view of all moments of a group. */
+  View group(const int group);
+  /*! \brief Returns a view of all moments of a group. */
+  ConstView group(const int group) const;
+
+  int total_groups() const { return total_groups_; }
+  int max_harmonic_l() const { return max_harmonic_l_; }
+  std::size_t moment_size() const { return moment_size_; }
+  /*! \brief Returns the total number of stored values. */
+  std::size_t size() const { return values_.size(); }
+  /*! \brief Returns the memory used to store the moments in bytes. */
+  std::size_t memory_consumption() const { return size() * sizeof(Number); }
+
+ private:
+  std::size_t Offset(const MomentIndex index) const;
+  int harmonics_per_group() const {
+    return (max_harmonic_l_ + 1) * (max_harmonic_l_ + 1); }
+
+  std::vector<Number> values_ = {};
+  int total_groups_ = 0;
+  int max_harmonic_l_ = 0;
+  std::size_t moment_size_ = 0;
+};
+
+//! Lagged moments stored in single precision
+using SinglePrecisionMoments = MomentBlock<float>;
+
+} // namespace moments
+
+} // namespace system
+
+} // namespace bart
+
+#endif // BART_SRC_SYSTEM_MOMENTS_MOMENT_BLOCK_H_
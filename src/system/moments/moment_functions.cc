@@ -0,0 +1,84 @@
+#include "system/moments/moment_functions.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace bart {
+
+namespace system {
+
+namespace moments {
+
+namespace {
+
+template <typename SecondVector>
+double L1NormOfDifferenceImpl(const MomentVector& first,
+                              const SecondVector& second) {
+  AssertThrow(first.size() == second.size(),
+              dealii::ExcMessage("Error in L1NormOfDifference, moments must "
+                                 "be the same size"))
+  const auto size = first.size();
+  const double* first_values = first.begin();
+  const auto* second_values = second.begin();
+  double norm = 0;
+  for (MomentVector::size_type i = 0; i < size; ++i)
+    norm += std::abs(first_values[i] - static_cast<double>(second_values[i]));
+  return norm;
+}
+
+} // namespace
+
+void SwapGroupMoments(SphericalHarmonicI& first, SphericalHarmonicI& second,
+                      const int group) {
+  const int max_harmonic_l = first.max_harmonic_l();
+  for (int l = 0; l <= max_harmonic_l; ++l) {
+    for (int m = -l; m <= l; ++m) {
+      first[{group, l, m}].swap(second[{group, l, m}]);
+    }
+  }
+}
+
+void CopyGroupMoments(const SphericalHarmonicI& from, SphericalHarmonicI& to,
+                      const int group) {
+  const int max_harmonic_l = from.max_harmonic_l();
+  for (int l = 0; l <= max_harmonic_l; ++l) {
+    for (int m = -l; m <= l; ++m) {
+      to[{group, l, m}] = from[{group, l, m}];
+    }
+  }
+}
+
+void StoreGroupMoments(const SphericalHarmonicI& from,
+                       SinglePrecisionMoments& to,
+                       const int group) {
+  const int max_harmonic_l = from.max_harmonic_l();
+  AssertThrow(max_harmonic_l == to.max_harmonic_l(),
+              dealii::ExcMessage("Error in StoreGroupMoments, moments must "
+                                 "have the same maximum harmonic"))
+  for (int l = 0; l <= max_harmonic_l; ++l) {
+    for (int m = -l; m <= l; ++m) {
+      const auto& moment = from[{group, l, m}];
+      auto stored_moment = to[{group, l, m}];
+      AssertThrow(moment.size() == stored_moment.size(),
+                  dealii::ExcMessage("Error in StoreGroupMoments, moments "
+                                     "must be the same size"))
+      std::copy(moment.begin(), moment.end(), stored_moment.begin());
+    }
+  }
+}
+
+double L1NormOfDifference(const MomentVector& first,
+                          const MomentVector& second) {
+  return L1NormOfDifferenceImpl(first, second);
+}
+
+double L1NormOfDifference(const MomentVector& first,
+                          const SinglePrecisionMomentView& second) {
+  return L1NormOfDifferenceImpl(first, second);
+}
+
+} // namespace moments
+
+} // namespace system
+
+} // namespace bart
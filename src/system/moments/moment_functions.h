@@ -0,0 +1,62 @@
+#ifndef BART_SRC_SYSTEM_MOMENTS_MOMENT_FUNCTIONS_H_
+#define BART_SRC_SYSTEM_MOMENTS_MOMENT_FUNCTIONS_H_
+
+#include "system/moments/moment_block.h"
+#include "system/moments/spherical_harmonic_i.h"
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace system {
+
+namespace moments {
+
+/*! \brief Exchanges the moments of a group between two sets of moments.
+ *
+ * Only the storage of each moment is exchanged, no values are copied. This
+ * allows current and previous iteration moments to be double buffered.
+ *
+ * @param first first set of moments.
+ * @param second second set of moments, must have the same maximum harmonic.
+ * @param group group of the moments to exchange.
+ */
+void SwapGroupMoments(SphericalHarmonicI& first, SphericalHarmonicI& second,
+                      const int group);
+
+/*! \brief Copies the moments of a group into another set of moments.
+ *
+ * Existing storage of the destination moments is reused if it is the correct
+ * size.
+ */
+void CopyGroupMoments(const SphericalHarmonicI& from, SphericalHarmonicI& to,
+                      const int group);
+
+/*! \brief Stores the moments of a group in single precision.
+ *
+ * The destination must already have the shape of the stored moments (see
+ * MomentBlock::reinit), no storage is allocated.
+ */
+void StoreGroupMoments(const SphericalHarmonicI& from,
+                       SinglePrecisionMoments& to,
+                       const int group);
+
+/*! \brief Returns the L1 norm of the difference between two moments,
+ * \f$|\phi_1 - \phi_2|_1\f$, without forming the difference.
+ */
+double L1NormOfDifference(const MomentVector& first,
+                          const MomentVector& second);
+
+/*! \brief Returns the L1 norm of the difference between a moment and a moment
+ * stored in single precision. The difference is accumulated in double
+ * precision.
+ */
+double L1NormOfDifference(const MomentVector& first,
+                          const SinglePrecisionMomentView& second);
+
+} // namespace moments
+
+} // namespace system
+
+} // namespace bart
+
+#endif //BART_SRC_SYSTEM_MOMENTS_MOMENT_FUNCTIONS_H_
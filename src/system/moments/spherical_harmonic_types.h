@@ -3,6 +3,7 @@
 
 #include <map>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/lac/vector.h>
 
 namespace bart {
@@ -27,6 +28,9 @@ using MomentVector = dealii::Vector<double>; //!< Vector for storing moments
 
 using MomentsMap = std::map<MomentIndex, MomentVector>;
 
+//! Non-owning view of a moment stored in single precision
+using SinglePrecisionMomentView = dealii::ArrayView<const float>;
+
 } // namespace moments
 
 } // namespace system
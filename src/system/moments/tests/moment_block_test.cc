@@ -0,0 +1,125 @@
+#include "system/moments/moment_block.h"
+
+#include <array>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+class SystemMomentsMomentBlockTest : public ::testing::Test {
+ protected:
+
+  SystemMomentsMomentBlockTest()
+      : test_moments(total_groups, max_harmonic_l, moment_size) {}
+
+  // Test objects
+  system::moments::MomentBlock<double> test_moments;
+
+  // Test parameters
+  static constexpr int max_harmonic_l = 2;
+  static constexpr int total_groups = 2;
+  static constexpr int moment_size = 5;
+  static constexpr int harmonics_per_group =
+      (max_harmonic_l + 1) * (max_harmonic_l + 1);
+};
+
+TEST_F(SystemMomentsMomentBlockTest, Constructor) {
+  EXPECT_EQ(test_moments.total_groups(), total_groups);
+  EXPECT_EQ(test_moments.max_harmonic_l(), max_harmonic_l);
+  EXPECT_EQ(test_moments.moment_size(), moment_size);
+  EXPECT_EQ(test_moments.size(),
+            total_groups * harmonics_per_group * moment_size);
+  EXPECT_EQ(test_moments.memory_consumption(),
+            test_moments.size() * sizeof(double));
+  for (const double value : test_moments.group(0))
+    EXPECT_EQ(value, 0);
+}
+
+TEST_F(SystemMomentsMomentBlockTest, BadGroupsAndHarmonics) {
+  std::array<int, 2> bad_groups{0, -1};
+
+  for (const auto group : bad_groups) {
+    EXPECT_ANY_THROW({
+      system::moments::MomentBlock<double> bad_moments(group, 0, moment_size);
+    });
+  }
+  EXPECT_ANY_THROW({
+    system::moments::MomentBlock<double> bad_moments(1, -1, moment_size);
+  });
+}
+
+TEST_F(SystemMomentsMomentBlockTest, BracketOperatorIsContiguous) {
+  const double* block_start = test_moments.group(0).begin();
+  int expected_harmonic = 0;
+  for (int group = 0; group < total_groups; ++group) {
+    for (int l = 0; l <= max_harmonic_l; ++l) {
+      for (int m = -l; m <= l; ++m) {
+        auto moment = test_moments[{group, l, m}];
+        ASSERT_EQ(moment.size(), moment_size);
+        EXPECT_EQ(moment.begin(),
+                  block_start + expected_harmonic * moment_size);
+        ++expected_harmonic;
+      }
+    }
+  }
+
+  auto group_one = test_moments.group(1);
+  EXPECT_EQ(group_one.size(), harmonics_per_group * moment_size);
+  EXPECT_EQ(group_one.begin(), test_moments[{1, 0, 0}].begin());
+}
+
+TEST_F(SystemMomentsMomentBlockTest, ViewsModifyBlock) {
+  auto moment = test_moments[{1, 1, -1}];
+  for (auto& value : moment)
+    value = 3;
+
+  const auto& const_test_moments = test_moments;
+  for (const double value : const_test_moments[{1, 1, -1}])
+    EXPECT_EQ(value, 3);
+  for (const double value : const_test_moments[{1, 1, 0}])
+    EXPECT_EQ(value, 0);
+}
+
+TEST_F(SystemMomentsMomentBlockTest, BadIndex) {
+  std::array<system::moments::MomentIndex, 4> bad_indices{{
+      {total_groups, 0, 0}, {-1, 0, 0}, {0, max_harmonic_l + 1, 0},
+      {0, 1, 2}}};
+  for (const auto& index : bad_indices) {
+    EXPECT_ANY_THROW(test_moments[index]);
+  }
+}
+
+TEST_F(SystemMomentsMomentBlockTest, Reinit) {
+  test_moments[{0, 0, 0}][0] = 2;
+  const double* storage = test_moments.group(0).begin();
+
+  // Unchanged shape keeps the existing storage and values
+  test_moments.reinit(total_groups, max_harmonic_l, moment_size);
+  EXPECT_EQ(test_moments.group(0).begin(), storage);
+  EXPECT_EQ(test_moments[{0, 0, 0}][0], 2);
+
+  test_moments.reinit(1, 0, moment_size + 1);
+  EXPECT_EQ(test_moments.total_groups(), 1);
+  EXPECT_EQ(test_moments.max_harmonic_l(), 0);
+  EXPECT_EQ(test_moments.size(), moment_size + 1);
+  EXPECT_EQ(test_moments[{0, 0, 0}][0], 0);
+}
+
+TEST_F(SystemMomentsMomentBlockTest, Swap) {
+  system::moments::MomentBlock<double> other_moments(1, 0, moment_size);
+  other_moments[{0, 0, 0}][0] = 4;
+  const double* storage = test_moments.group(0).begin();
+  const double* other_storage = other_moments.group(0).begin();
+
+  test_moments.swap(other_moments);
+
+  EXPECT_EQ(test_moments.group(0).begin(), other_storage);
+  EXPECT_EQ(other_moments.group(0).begin(), storage);
+  EXPECT_EQ(test_moments.total_groups(), 1);
+  EXPECT_EQ(other_moments.total_groups(), total_groups);
+  EXPECT_EQ(test_moments[{0, 0, 0}][0], 4);
+}
+
+} // namespace
@@ -0,0 +1,141 @@
+#include "system/moments/moment_functions.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "system/moments/spherical_harmonic.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+class SystemMomentsMomentFunctionsTest : public ::testing::Test {
+ protected:
+  using Moments = system::moments::SphericalHarmonic;
+
+  SystemMomentsMomentFunctionsTest()
+      : first_moments(total_groups, max_harmonic_l),
+        second_moments(total_groups, max_harmonic_l) {}
+
+  Moments first_moments, second_moments;
+
+  static constexpr int max_harmonic_l = 1;
+  static constexpr int total_groups = 2;
+  static constexpr int n_dofs = 3;
+
+  void SetUp() override;
+};
+
+void SystemMomentsMomentFunctionsTest::SetUp() {
+  for (auto& [index, moment] : first_moments) {
+    moment.reinit(n_dofs);
+    moment = index[0] + 1;
+  }
+  for (auto& [index, moment] : second_moments) {
+    moment.reinit(n_dofs);
+    moment = -(index[0] + 1);
+  }
+}
+
+TEST_F(SystemMomentsMomentFunctionsTest, SwapGroupMoments) {
+  const double* first_storage = first_moments[{1, 0, 0}].begin();
+  const double* second_storage = second_moments[{1, 0, 0}].begin();
+
+  system::moments::SwapGroupMoments(first_moments, second_moments, 1);
+
+  for (const auto& [index, moment] : first_moments.moments()) {
+    const double expected_value = (index[0] == 1) ? -2 : 1;
+    for (const double value : moment)
+      EXPECT_DOUBLE_EQ(value, expected_value);
+  }
+  for (const auto& [index, moment] : second_moments.moments()) {
+    const double expected_value = (index[0] == 1) ? 2 : -1;
+    for (const double value : moment)
+      EXPECT_DOUBLE_EQ(value, expected_value);
+  }
+  // Storage is exchanged, not copied
+  EXPECT_EQ(first_moments[{1, 0, 0}].begin(), second_storage);
+  EXPECT_EQ(second_moments[{1, 0, 0}].begin(), first_storage);
+}
+
+TEST_F(SystemMomentsMomentFunctionsTest, CopyGroupMoments) {
+  const double* storage = second_moments[{0, 1, -1}].begin();
+
+  system::moments::CopyGroupMoments(first_moments, second_moments, 0);
+
+  for (const auto& [index, moment] : second_moments.moments()) {
+    const double expected_value = (index[0] == 0) ? 1 : -2;
+    for (const double value : moment)
+      EXPECT_DOUBLE_EQ(value, expected_value);
+  }
+  EXPECT_EQ(second_moments[{0, 1, -1}].begin(), storage);
+}
+
+TEST_F(SystemMomentsMomentFunctionsTest, L1NormOfDifference) {
+  const auto& first_moment = first_moments[{1, 1, 0}];
+  const auto& second_moment = second_moments[{0, 0, 0}];
+  EXPECT_DOUBLE_EQ(system::moments::L1NormOfDifference(first_moment,
+                                                       second_moment),
+                   n_dofs * 3.0);
+  EXPECT_DOUBLE_EQ(system::moments::L1NormOfDifference(first_moment,
+                                                       first_moment), 0);
+
+  system::moments::MomentVector bad_size_moment(n_dofs + 1);
+  EXPECT_ANY_THROW(system::moments::L1NormOfDifference(first_moment,
+                                                       bad_size_moment));
+}
+
+TEST_F(SystemMomentsMomentFunctionsTest, StoreGroupMoments) {
+  system::moments::SinglePrecisionMoments stored_moments(total_groups,
+                                                         max_harmonic_l, n_dofs);
+
+  system::moments::StoreGroupMoments(first_moments, stored_moments, 1);
+
+  // Only the moments of the stored group are set
+  for (const float value : stored_moments.group(0))
+    EXPECT_FLOAT_EQ(value, 0);
+  for (const float value : stored_moments.group(1))
+    EXPECT_FLOAT_EQ(value, 2);
+
+  // Existing storage is reused
+  const float* storage = stored_moments[{1, 1, 1}].begin();
+  system::moments::StoreGroupMoments(second_moments, stored_moments, 1);
+  EXPECT_EQ(stored_moments[{1, 1, 1}].begin(), storage);
+  for (const float value : stored_moments.group(1))
+    EXPECT_FLOAT_EQ(value, -2);
+}
+
+TEST_F(SystemMomentsMomentFunctionsTest, StoreGroupMomentsBadShape) {
+  system::moments::SinglePrecisionMoments bad_harmonic_moments(
+      total_groups, max_harmonic_l + 1, n_dofs);
+  EXPECT_ANY_THROW(system::moments::StoreGroupMoments(
+      first_moments, bad_harmonic_moments, 1));
+
+  system::moments::SinglePrecisionMoments bad_size_moments(
+      total_groups, max_harmonic_l, n_dofs + 1);
+  EXPECT_ANY_THROW(system::moments::StoreGroupMoments(
+      first_moments, bad_size_moments, 1));
+}
+
+TEST_F(SystemMomentsMomentFunctionsTest, L1NormOfDifferenceSinglePrecision) {
+  const auto& first_moment = first_moments[{1, 1, 0}];
+  std::vector<float> second_moment(n_dofs, -1);
+  EXPECT_DOUBLE_EQ(system::moments::L1NormOfDifference(
+                       first_moment, dealii::make_array_view(second_moment)),
+                   n_dofs * 3.0);
+
+  // Differences smaller than single precision are accumulated in double
+  system::moments::MomentVector moment(n_dofs);
+  moment = 1.0 + 1e-10;
+  std::fill(second_moment.begin(), second_moment.end(), 1);
+  EXPECT_NEAR(system::moments::L1NormOfDifference(
+                  moment, dealii::make_array_view(second_moment)),
+              n_dofs * 1e-10, 1e-15);
+
+  std::vector<float> bad_size_moment(n_dofs + 1);
+  EXPECT_ANY_THROW(system::moments::L1NormOfDifference(
+      first_moment, dealii::make_array_view(bad_size_moment)));
+}
+
+} // namespace
@@ -0,0 +1,136 @@
+#include "system/solution/boundary_angular_solution.h"
+
+#include <algorithm>
+
+namespace bart {
+
+namespace system {
+
+namespace solution {
+
+BoundaryAngularSolution::BoundaryAngularSolution(
+    const std::vector<DoFIndex>& boundary_dofs,
+    const dealii::IndexSet& locally_owned_dofs,
+    const int total_groups,
+    const int total_angles,
+    const StoragePrecision precision)
+    : total_groups_(total_groups),
+      total_angles_(total_angles),
+      precision_(precision),
+      locally_owned_dofs_(locally_owned_dofs),
+      boundary_dofs_(boundary_dofs) {
+  AssertThrow(total_groups_ > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "BoundaryAngularSolution, total groups must "
+                                 "be greater than 0"))
+  AssertThrow(total_angles_ > 0,
+              dealii::ExcMessage("Error in constructor of "
+                                 "BoundaryAngularSolution, total angles must "
+                                 "be greater than 0"))
+  std::sort(boundary_dofs_.begin(), boundary_dofs_.end());
+  boundary_dofs_.erase(std::unique(boundary_dofs_.begin(), boundary_dofs_.end()),
+                       boundary_dofs_.end());
+
+  dealii::IndexSet ghost_dofs(locally_owned_dofs_.size());
+  for (int i = 0; i < static_cast<int>(boundary_dofs_.size()); ++i) {
+    const auto dof = boundary_dofs_.at(i);
+    AssertThrow(dof < locally_owned_dofs_.size(),
+                dealii::ExcMessage("Error in constructor of "
+                                   "BoundaryAngularSolution, boundary degree "
+                                   "of freedom index is out of range"))
+    compact_index_[dof] = i;
+    if (!locally_owned_dofs_.is_element(dof))
+      ghost_dofs.add_index(dof);
+  }
+  ghost_dofs.compress();
+
+  ghosted_solution_.reinit(locally_owned_dofs_, ghost_dofs, MPI_COMM_WORLD);
+}
+
+void BoundaryAngularSolution::Store(const SolutionIndex index,
+                                    const MPIVector& angular_solution) {
+  ValidateIndex(index, __FUNCTION__);
+  ghosted_solution_ = angular_solution;
+  if (ghosted_solution_.has_ghost_elements())
+    ghosted_solution_.update_ghost_values();
+
+  // Values are rounded to the storage precision as they are extracted
+  if (precision_ == StoragePrecision::kSingle) {
+    auto& stored_values = single_stored_values_[index];
+    stored_values.reinit(boundary_dofs_.size(), true);
+    ghosted_solution_.extract_subvector_to(boundary_dofs_.begin(),
+                                           boundary_dofs_.end(),
+                                           stored_values.begin());
+  } else {
+    auto& stored_values = stored_values_[index];
+    stored_values.reinit(boundary_dofs_.size(), true);
+    ghosted_solution_.extract_subvector_to(boundary_dofs_.begin(),
+                                           boundary_dofs_.end(),
+                                           stored_values.begin());
+  }
+}
+
+template <typename Number>
+void BoundaryAngularSolution::FillFrom(
+    const std::map<SolutionIndex, dealii::Vector<Number>>& stored,
+    const SolutionIndex index,
+    const std::vector<DoFIndex>& cell_dofs,
+    std::vector<double>& to_fill) const {
+  to_fill.assign(cell_dofs.size(), 0);
+  auto stored_it = stored.find(index);
+  if (stored_it == stored.end())
+    return;
+  const auto& stored_values = stored_it->second;
+  for (int i = 0; i < static_cast<int>(cell_dofs.size()); ++i) {
+    if (auto compact_it = compact_index_.find(cell_dofs[i]);
+        compact_it != compact_index_.end())
+      to_fill[i] = stored_values[compact_it->second];
+  }
+}
+
+void BoundaryAngularSolution::FillCellValues(
+    const SolutionIndex index,
+    const std::vector<DoFIndex>& cell_dofs,
+    std::vector<double>& to_fill) const {
+  ValidateIndex(index, __FUNCTION__);
+  if (precision_ == StoragePrecision::kSingle)
+    FillFrom(single_stored_values_, index, cell_dofs, to_fill);
+  else
+    FillFrom(stored_values_, index, cell_dofs, to_fill);
+}
+
+double BoundaryAngularSolution::Value(const SolutionIndex index,
+                                      const DoFIndex dof) const {
+  ValidateIndex(index, __FUNCTION__);
+  const auto compact_it = compact_index_.find(dof);
+  AssertThrow(compact_it != compact_index_.end(),
+              dealii::ExcMessage("Error in BoundaryAngularSolution::Value, "
+                                 "degree of freedom is not a stored boundary "
+                                 "degree of freedom"))
+  if (precision_ == StoragePrecision::kSingle) {
+    if (auto stored_it = single_stored_values_.find(index);
+        stored_it != single_stored_values_.end())
+      return stored_it->second[compact_it->second];
+  } else if (auto stored_it = stored_values_.find(index);
+             stored_it != stored_values_.end()) {
+    return stored_it->second[compact_it->second];
+  }
+  return 0;
+}
+
+void BoundaryAngularSolution::ValidateIndex(
+    const SolutionIndex index, const std::string& function_name) const {
+  const int group = index.first.get(), angle = index.second.get();
+  AssertThrow(group >= 0 && group < total_groups_,
+              dealii::ExcMessage("Error in BoundaryAngularSolution::" +
+                                 function_name + ", invalid group index"))
+  AssertThrow(angle >= 0 && angle < total_angles_,
+              dealii::ExcMessage("Error in BoundaryAngularSolution::" +
+                                 function_name + ", invalid angle index"))
+}
+
+} // namespace solution
+
+} // namespace system
+
+} // namespace bart
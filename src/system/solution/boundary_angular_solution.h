@@ -0,0 +1,123 @@
+#ifndef BART_SRC_SYSTEM_SOLUTION_BOUNDARY_ANGULAR_SOLUTION_H_
+#define BART_SRC_SYSTEM_SOLUTION_BOUNDARY_ANGULAR_SOLUTION_H_
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/lac/vector.h>
+
+#include "system/system_types.h"
+
+namespace bart {
+
+namespace system {
+
+namespace solution {
+
+/*! \brief Stores angular solutions only at reflective boundary degrees of
+ * freedom.
+ *
+ * Reflective boundary conditions only need the angular solution at the
+ * degrees of freedom on reflective faces. Instead of a full length serial copy
+ * of each angular solution, this class keeps, for each (group, angle), the
+ * values at the given boundary degrees of freedom of the locally owned cells.
+ * These may include degrees of freedom owned by other processors, which are
+ * retrieved using a ghosted copy of the solution when it is stored.
+ *
+ * Values are stored in a compact vector, ordered by increasing global degree of
+ * freedom index, and mapped to global indices using boundary_dofs(). Values
+ * may be stored in single precision (see StoragePrecision), they are always
+ * returned in double precision.
+ */
+class BoundaryAngularSolution {
+ public:
+  using DoFIndex = dealii::types::global_dof_index;
+
+  /*! \brief Constructor.
+   *
+   * @param boundary_dofs global indices of the degrees of freedom to store.
+   * @param locally_owned_dofs degrees of freedom owned by this processor,
+   *        the size of this set is the total number of degrees of freedom.
+   * @param total_groups total energy groups.
+   * @param total_angles total angles.
+   * @param precision precision of the stored values.
+   */
+  BoundaryAngularSolution(const std::vector<DoFIndex>& boundary_dofs,
+                          const dealii::IndexSet& locally_owned_dofs,
+                          const int total_groups,
+                          const int total_angles,
+                          const StoragePrecision precision =
+                              StoragePrecision::kDouble);
+
+  /*! \brief Stores the boundary values of an angular solution.
+   *
+   * This must be called by all processors, as it may require communication to
+   * retrieve boundary values owned by other processors.
+   */
+  void Store(const SolutionIndex index, const MPIVector& angular_solution);
+
+  /*! \brief Fills the values at a set of degrees of freedom, usually those of
+   * a cell.
+   *
+   * The vector is resized to the number of degrees of freedom. Degrees of
+   * freedom that are not stored boundary degrees of freedom, and all degrees of
+   * freedom if no solution has been stored for the index, are set to zero.
+   */
+  void FillCellValues(const SolutionIndex index,
+                      const std::vector<DoFIndex>& cell_dofs,
+                      std::vector<double>& to_fill) const;
+
+  /*! \brief Returns the stored value at a boundary degree of freedom. */
+  double Value(const SolutionIndex index, const DoFIndex dof) const;
+
+  /*! \brief Returns true if a solution has been stored for the index. */
+  bool is_stored(const SolutionIndex index) const {
+    return stored_values_.count(index) > 0 ||
+        single_stored_values_.count(index) > 0; }
+  /*! \brief Returns the bytes required to store the boundary values of every
+   * group and angle. */
+  std::size_t storage_bytes() const {
+    return n_boundary_dofs() * total_groups_ * total_angles_ *
+        (precision_ == StoragePrecision::kSingle ? sizeof(float) :
+         sizeof(double)); }
+  StoragePrecision precision() const { return precision_; }
+  const std::vector<DoFIndex>& boundary_dofs() const { return boundary_dofs_; }
+  int n_boundary_dofs() const { return boundary_dofs_.size(); }
+  DoFIndex total_degrees_of_freedom() const {
+    return locally_owned_dofs_.size(); }
+  int total_groups() const { return total_groups_; }
+  int total_angles() const { return total_angles_; }
+
+ private:
+  void ValidateIndex(const SolutionIndex index,
+                     const std::string& function_name) const;
+  template <typename Number>
+  void FillFrom(const std::map<SolutionIndex, dealii::Vector<Number>>& stored,
+                const SolutionIndex index,
+                const std::vector<DoFIndex>& cell_dofs,
+                std::vector<double>& to_fill) const;
+  const int total_groups_;
+  const int total_angles_;
+  const StoragePrecision precision_;
+  const dealii::IndexSet locally_owned_dofs_;
+  //! Sorted global indices of stored degrees of freedom
+  std::vector<DoFIndex> boundary_dofs_;
+  //! Maps global degree of freedom index to position in the compact storage
+  std::unordered_map<DoFIndex, int> compact_index_;
+  //! Copy of the solution used to access off-processor boundary values
+  MPIVector ghosted_solution_;
+  std::map<SolutionIndex, dealii::Vector<double>> stored_values_;
+  //! Stored values if using single precision storage
+  std::map<SolutionIndex, dealii::Vector<float>> single_stored_values_;
+};
+
+} // namespace solution
+
+} // namespace system
+
+} // namespace bart
+
+#endif //BART_SRC_SYSTEM_SOLUTION_BOUNDARY_ANGULAR_SOLUTION_H_
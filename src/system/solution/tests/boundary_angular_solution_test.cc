@@ -0,0 +1,154 @@
+#include "system/solution/boundary_angular_solution.h"
+
+#include <limits>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace {
+
+using namespace bart;
+
+class SystemSolutionBoundaryAngularSolutionTest : public ::testing::Test {
+ protected:
+  using DoFIndex = dealii::types::global_dof_index;
+  using TestSolution = system::solution::BoundaryAngularSolution;
+
+  static constexpr int total_dofs_ = 6;
+  static constexpr int total_groups_ = 2;
+  static constexpr int total_angles_ = 3;
+
+  dealii::IndexSet locally_owned_dofs_{total_dofs_};
+  const std::vector<DoFIndex> boundary_dofs_{4, 0, 5, 0};
+  system::MPIVector angular_solution_;
+
+  void SetUp() override;
+};
+
+void SystemSolutionBoundaryAngularSolutionTest::SetUp() {
+  locally_owned_dofs_.add_range(0, total_dofs_);
+  angular_solution_.reinit(locally_owned_dofs_, MPI_COMM_WORLD);
+  for (int i = 0; i < total_dofs_; ++i)
+    angular_solution_(i) = 10.0 * (i + 1);
+  angular_solution_.compress(dealii::VectorOperation::insert);
+}
+
+TEST_F(SystemSolutionBoundaryAngularSolutionTest, Constructor) {
+  TestSolution test_solution(boundary_dofs_, locally_owned_dofs_,
+                             total_groups_, total_angles_);
+  const std::vector<DoFIndex> expected_dofs{0, 4, 5};
+  EXPECT_EQ(test_solution.boundary_dofs(), expected_dofs);
+  EXPECT_EQ(test_solution.n_boundary_dofs(), 3);
+  EXPECT_EQ(test_solution.total_degrees_of_freedom(), total_dofs_);
+  EXPECT_EQ(test_solution.total_groups(), total_groups_);
+  EXPECT_EQ(test_solution.total_angles(), total_angles_);
+  EXPECT_FALSE(test_solution.is_stored({system::EnergyGroup(0),
+                                        system::AngleIdx(0)}));
+}
+
+TEST_F(SystemSolutionBoundaryAngularSolutionTest, ConstructorBadValues) {
+  EXPECT_ANY_THROW({
+    TestSolution test_solution(boundary_dofs_, locally_owned_dofs_, 0,
+                               total_angles_); });
+  EXPECT_ANY_THROW({
+    TestSolution test_solution(boundary_dofs_, locally_owned_dofs_,
+                               total_groups_, 0); });
+  EXPECT_ANY_THROW({
+    TestSolution test_solution({0, total_dofs_}, locally_owned_dofs_,
+                               total_groups_, total_angles_); });
+}
+
+TEST_F(SystemSolutionBoundaryAngularSolutionTest, StoreAndRetrieve) {
+  TestSolution test_solution(boundary_dofs_, locally_owned_dofs_,
+                             total_groups_, total_angles_);
+  const system::SolutionIndex index{system::EnergyGroup(1), system::AngleIdx(2)};
+  const system::SolutionIndex other_index{system::EnergyGroup(0),
+                                          system::AngleIdx(2)};
+
+  test_solution.Store(index, angular_solution_);
+  EXPECT_TRUE(test_solution.is_stored(index));
+  EXPECT_FALSE(test_solution.is_stored(other_index));
+
+  for (const DoFIndex dof : {0, 4, 5}) {
+    EXPECT_DOUBLE_EQ(test_solution.Value(index, dof), 10.0 * (dof + 1));
+    EXPECT_DOUBLE_EQ(test_solution.Value(other_index, dof), 0);
+  }
+  EXPECT_ANY_THROW(test_solution.Value(index, 1));
+
+  const std::vector<DoFIndex> cell_dofs{5, 1, 0};
+  std::vector<double> cell_values;
+  test_solution.FillCellValues(index, cell_dofs, cell_values);
+  const std::vector<double> expected_values{60, 0, 10};
+  ASSERT_EQ(cell_values.size(), cell_dofs.size());
+  for (int i = 0; i < static_cast<int>(cell_dofs.size()); ++i)
+    EXPECT_DOUBLE_EQ(cell_values[i], expected_values[i]);
+
+  test_solution.FillCellValues(other_index, cell_dofs, cell_values);
+  ASSERT_EQ(cell_values.size(), cell_dofs.size());
+  for (const auto value : cell_values)
+    EXPECT_DOUBLE_EQ(value, 0);
+}
+
+TEST_F(SystemSolutionBoundaryAngularSolutionTest, StorageBytes) {
+  TestSolution double_solution(boundary_dofs_, locally_owned_dofs_,
+                               total_groups_, total_angles_);
+  TestSolution single_solution(boundary_dofs_, locally_owned_dofs_,
+                               total_groups_, total_angles_,
+                               system::StoragePrecision::kSingle);
+  EXPECT_EQ(double_solution.precision(), system::StoragePrecision::kDouble);
+  EXPECT_EQ(single_solution.precision(), system::StoragePrecision::kSingle);
+  EXPECT_EQ(double_solution.storage_bytes(),
+            3 * total_groups_ * total_angles_ * sizeof(double));
+  EXPECT_EQ(single_solution.storage_bytes(),
+            3 * total_groups_ * total_angles_ * sizeof(float));
+}
+
+TEST_F(SystemSolutionBoundaryAngularSolutionTest, StoreAndRetrieveSingle) {
+  TestSolution test_solution(boundary_dofs_, locally_owned_dofs_,
+                             total_groups_, total_angles_,
+                             system::StoragePrecision::kSingle);
+  const system::SolutionIndex index{system::EnergyGroup(1), system::AngleIdx(2)};
+  const system::SolutionIndex other_index{system::EnergyGroup(0),
+                                          system::AngleIdx(2)};
+  // Values that are not exactly representable in single precision
+  for (int i = 0; i < total_dofs_; ++i)
+    angular_solution_(i) = 1.0 / (i + 3);
+  angular_solution_.compress(dealii::VectorOperation::insert);
+
+  test_solution.Store(index, angular_solution_);
+  EXPECT_TRUE(test_solution.is_stored(index));
+  EXPECT_FALSE(test_solution.is_stored(other_index));
+
+  std::vector<DoFIndex> all_dofs(total_dofs_);
+  for (int i = 0; i < total_dofs_; ++i)
+    all_dofs[i] = i;
+  std::vector<double> cell_values;
+  test_solution.FillCellValues(index, all_dofs, cell_values);
+  ASSERT_EQ(cell_values.size(), total_dofs_);
+  for (const DoFIndex dof : {0, 4, 5}) {
+    const double expected_value = static_cast<float>(1.0 / (dof + 3));
+    EXPECT_DOUBLE_EQ(test_solution.Value(index, dof), expected_value);
+    EXPECT_DOUBLE_EQ(cell_values[dof], expected_value);
+    EXPECT_NEAR(cell_values[dof], 1.0 / (dof + 3),
+                std::numeric_limits<float>::epsilon());
+    EXPECT_DOUBLE_EQ(test_solution.Value(other_index, dof), 0);
+  }
+  for (const DoFIndex dof : {1, 2, 3})
+    EXPECT_DOUBLE_EQ(cell_values[dof], 0);
+}
+
+TEST_F(SystemSolutionBoundaryAngularSolutionTest, BadIndices) {
+  TestSolution test_solution(boundary_dofs_, locally_owned_dofs_,
+                             total_groups_, total_angles_);
+  for (const auto& index : {
+      system::SolutionIndex{system::EnergyGroup(-1), system::AngleIdx(0)},
+      system::SolutionIndex{system::EnergyGroup(total_groups_), system::AngleIdx(0)},
+      system::SolutionIndex{system::EnergyGroup(0), system::AngleIdx(-1)},
+      system::SolutionIndex{system::EnergyGroup(0), system::AngleIdx(total_angles_)}}) {
+    EXPECT_ANY_THROW(test_solution.Store(index, angular_solution_));
+    EXPECT_ANY_THROW(test_solution.Value(index, 0));
+    std::vector<double> cell_values;
+    EXPECT_ANY_THROW(test_solution.FillCellValues(index, {0}, cell_values));
+  }
+}
+
+} // namespace
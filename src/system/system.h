@@ -1,6 +1,7 @@
 #ifndef BART_DATA_SYSTEM_SYSTEM_H_
 #define BART_DATA_SYSTEM_SYSTEM_H_
 
+#include <map>
 #include <memory>
 #include <optional>
 
@@ -24,6 +25,16 @@ struct System {
   std::unique_ptr<system::moments::SphericalHarmonicI> current_moments = nullptr;
   //! Flux moments for the previous iteration
   std::unique_ptr<system::moments::SphericalHarmonicI> previous_moments = nullptr;
+  /*! Matrices coupling each angle to its reflection across implicit
+   * reflective boundaries, indexed by (angle, reflected angle). These are
+   * independent of energy group. */
+  std::map<system::AngleCouplingIndex,
+           std::shared_ptr<system::MPISparseMatrix>> reflective_coupling_terms{};
+  /*! Matrices coupling each group to its source groups in a multigroup block
+   * system, indexed by (group, source group). These are added to the left
+   * hand side and are independent of angle. */
+  std::map<system::GroupCouplingIndex,
+           std::shared_ptr<system::MPISparseMatrix>> group_coupling_terms{};
   //! System k_effective
   std::optional<double> k_effective = std::nullopt;
   //! Total system groups
@@ -1,5 +1,8 @@
 #include "system/system_functions.h"
 
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/fe/fe.h>
+
 #include "system/terms/term.h"
 #include "system/moments/spherical_harmonic.h"
 #include "system/solution/mpi_group_angular_solution.h"
@@ -33,7 +36,8 @@ void InitializeSystem(system::System &system_to_setup,
                  const int total_groups,
                  const int total_angles,
                  const bool is_eigenvalue_problem,
-                 const bool is_rhs_boundary_term_variable) {
+                 const bool is_rhs_boundary_term_variable,
+                 const int max_harmonic_l) {
   using VariableLinearTerms = system::terms::VariableLinearTerms;
 
   std::string error_start{"Error: attempting to call Initialize System on a "
@@ -64,17 +68,23 @@ void InitializeSystem(system::System &system_to_setup,
 
   system_to_setup.right_hand_side_ptr_ = std::move(
       std::make_unique<system::terms::MPILinearTerm>(rhs_variable_terms));
+  // Boundary terms are set only for angles that share their fixed term
   system_to_setup.left_hand_side_ptr_ = std::move(
-      std::make_unique<system::terms::MPIBilinearTerm>());
+      std::make_unique<system::terms::MPIBilinearTerm>(
+          std::unordered_set<system::terms::VariableBilinearTerms>{
+              system::terms::VariableBilinearTerms::kBoundary}));
   system_to_setup.current_moments = std::move(
-      std::make_unique<system::moments::SphericalHarmonic>(total_groups, 0));
+      std::make_unique<system::moments::SphericalHarmonic>(total_groups,
+                                                           max_harmonic_l));
   system_to_setup.previous_moments = std::move(
-      std::make_unique<system::moments::SphericalHarmonic>(total_groups, 0));
+      std::make_unique<system::moments::SphericalHarmonic>(total_groups,
+                                                           max_harmonic_l));
 }
 
 template <int dim>
 void SetUpSystemTerms(system::System& system_to_setup,
-                      const domain::DefinitionI<dim>& domain_definition) {
+                      const domain::DefinitionI<dim>& domain_definition,
+                      const bool is_symmetric) {
   const auto variable_terms =
       system_to_setup.right_hand_side_ptr_->GetVariableTerms();
   const int total_groups = system_to_setup.total_groups;
@@ -86,7 +96,9 @@ void SetUpSystemTerms(system::System& system_to_setup,
       auto& lhs = system_to_setup.left_hand_side_ptr_;
       auto& rhs = system_to_setup.right_hand_side_ptr_;
 
-      lhs->SetFixedTermPtr(index, domain_definition.MakeSystemMatrix());
+      lhs->SetFixedTermPtr(index, is_symmetric ?
+                                  domain_definition.MakeSymmetricSystemMatrix() :
+                                  domain_definition.MakeSystemMatrix());
       rhs->SetFixedTermPtr(index, domain_definition.MakeSystemVector());
 
       for (const auto variable_term : variable_terms) {
@@ -97,8 +109,82 @@ void SetUpSystemTerms(system::System& system_to_setup,
   }
 }
 
+template <int dim>
+void SetUpSharedReflectedTerms(
+    system::System& system_to_setup,
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::set<system::AngleCouplingIndex>& reflected_angles,
+    const bool is_symmetric) {
+  using VariableBilinearTerms = system::terms::VariableBilinearTerms;
+  auto& lhs = system_to_setup.left_hand_side_ptr_;
+  AssertThrow(lhs->GetVariableTerms().count(VariableBilinearTerms::kBoundary),
+              dealii::ExcMessage("Error in SetUpSharedReflectedTerms, left "
+                                 "hand side does not have a variable boundary "
+                                 "term"))
+  std::set<system::AngleIndex> shared_angles;
+  for (const auto& [angle, reflected_angle] : reflected_angles) {
+    AssertThrow(angle != reflected_angle,
+                dealii::ExcMessage("Error in SetUpSharedReflectedTerms, an "
+                                   "angle cannot share a term with itself"))
+    AssertThrow(shared_angles.insert(angle).second &&
+                shared_angles.insert(reflected_angle).second,
+                dealii::ExcMessage("Error in SetUpSharedReflectedTerms, an "
+                                   "angle can share a term with only one "
+                                   "other angle"))
+  }
+
+  for (int group = 0; group < system_to_setup.total_groups; ++group) {
+    for (const auto& [angle, reflected_angle] : reflected_angles) {
+      auto shared_matrix_ptr = lhs->GetFixedTermPtr({group, angle});
+      AssertThrow(shared_matrix_ptr != nullptr,
+                  dealii::ExcMessage("Error in SetUpSharedReflectedTerms, "
+                                     "fixed terms have not been set up"))
+      // The fixed term matrix previously set for the reflection is released
+      lhs->SetFixedTermPtr({group, reflected_angle}, shared_matrix_ptr);
+      for (const int shared_angle : {angle, reflected_angle}) {
+        lhs->SetVariableTermPtr(
+            {group, shared_angle}, VariableBilinearTerms::kBoundary,
+            domain_definition.MakeBoundarySystemMatrix(is_symmetric));
+      }
+    }
+  }
+}
+
+template <int dim>
+void SetUpReflectiveCouplingTerms(
+    system::System& system_to_setup,
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::set<system::AngleCouplingIndex>& coupled_angles) {
+  for (const auto& coupling_index : coupled_angles) {
+    AssertThrow(coupling_index.first != coupling_index.second,
+                dealii::ExcMessage("Error in SetUpReflectiveCouplingTerms, an "
+                                   "angle cannot be coupled to itself"))
+    system_to_setup.reflective_coupling_terms.insert_or_assign(
+        coupling_index, domain_definition.MakeSystemMatrix());
+  }
+}
+
+template <int dim>
+void SetUpGroupCouplingTerms(
+    system::System& system_to_setup,
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::set<system::GroupCouplingIndex>& coupled_groups) {
+  for (const auto& [group, source_group] : coupled_groups) {
+    AssertThrow(group != source_group,
+                dealii::ExcMessage("Error in SetUpGroupCouplingTerms, a group "
+                                   "cannot be coupled to itself"))
+    AssertThrow(group >= 0 && group < system_to_setup.total_groups &&
+                source_group >= 0 && source_group < system_to_setup.total_groups,
+                dealii::ExcMessage("Error in SetUpGroupCouplingTerms, coupled "
+                                   "group index is not a valid group"))
+    system_to_setup.group_coupling_terms.insert_or_assign(
+        {group, source_group}, domain_definition.MakeSystemMatrix());
+  }
+}
+
 void SetUpSystemMoments(system::System& system_to_setup,
-                        const std::size_t solution_size) {
+                        const std::size_t solution_size,
+                        const StoragePrecision lagged_moment_precision) {
 
   auto initialize_moments = [=](system::moments::SphericalHarmonicI& to_initialize) {
     for (auto& moment : to_initialize) {
@@ -108,29 +194,106 @@ void SetUpSystemMoments(system::System& system_to_setup,
   };
 
   initialize_moments(*system_to_setup.current_moments);
-  initialize_moments(*system_to_setup.previous_moments);
+  if (lagged_moment_precision == StoragePrecision::kDouble)
+    initialize_moments(*system_to_setup.previous_moments);
 }
-void SetUpEnergyGroupToAngularSolutionPtrMap(
-    solution::EnergyGroupToAngularSolutionPtrMap& to_setup,
-    const int total_groups,
-    const int total_angles) {
-  using SolutionType = system::solution::MPIGroupAngularSolution;
 
-  for (int group = 0; group < total_groups; ++group) {
-    for (int angle = 0; angle < total_angles; ++angle) {
-      to_setup.insert({system::SolutionIndex(group, angle),
-                       std::make_shared<dealii::Vector<double>>()});
-    };
+void SetInitialSolution(system::System& system_to_setup,
+                        const system::moments::MomentsMap& moments,
+                        const std::optional<double> k_effective) {
+  AssertThrow(system_to_setup.current_moments != nullptr &&
+              system_to_setup.previous_moments != nullptr,
+              dealii::ExcMessage("Error in SetInitialSolution, system moments "
+                                 "have not been set up"))
+  for (const auto& [index, moment] : moments) {
+    for (auto& system_moments : {system_to_setup.current_moments.get(),
+                                 system_to_setup.previous_moments.get()}) {
+      AssertThrow(system_moments->moments().count(index) > 0,
+                  dealii::ExcMessage("Error in SetInitialSolution, system "
+                                     "does not have a moment with the given "
+                                     "index"))
+      auto& system_moment = (*system_moments)[index];
+      if (system_moments == system_to_setup.previous_moments.get() &&
+          system_moment.size() == 0)
+        continue;
+      AssertThrow(system_moment.size() == moment.size(),
+                  dealii::ExcMessage("Error in SetInitialSolution, moment size "
+                                     "does not match system moment size"))
+      system_moment = moment;
+    }
+  }
+  if (k_effective.has_value())
+    system_to_setup.k_effective = k_effective;
+}
+
+template <int dim>
+std::vector<dealii::types::global_dof_index> GetBoundaryDoFs(
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::unordered_set<problem::Boundary>& boundaries) {
+  std::set<dealii::types::global_dof_index> boundary_dofs;
+  const int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+
+  for (const auto& cell : domain_definition.Cells()) {
+    if (!cell->at_boundary())
+      continue;
+    const auto& finite_element = cell->get_fe();
+    std::vector<dealii::types::global_dof_index> cell_dofs(
+        finite_element.dofs_per_cell);
+    cell->get_dof_indices(cell_dofs);
+    for (int face = 0; face < faces_per_cell; ++face) {
+      if (cell->face(face)->at_boundary() && boundaries.count(
+          static_cast<problem::Boundary>(cell->face(face)->boundary_id()))) {
+        for (unsigned int i = 0; i < finite_element.dofs_per_cell; ++i) {
+          if (finite_element.has_support_on_face(i, face))
+            boundary_dofs.insert(cell_dofs[i]);
+        }
+      }
+    }
   }
+  return {boundary_dofs.begin(), boundary_dofs.end()};
+}
+
+template <int dim>
+std::shared_ptr<solution::BoundaryAngularSolution> MakeBoundaryAngularSolution(
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::unordered_set<problem::Boundary>& reflective_boundaries,
+    const int total_groups,
+    const int total_angles,
+    const StoragePrecision precision) {
+  return std::make_shared<solution::BoundaryAngularSolution>(
+      GetBoundaryDoFs(domain_definition, reflective_boundaries),
+      domain_definition.locally_owned_dofs(),
+      total_groups,
+      total_angles,
+      precision);
 }
 
 template void SetUpMPIAngularSolution<1>(system::solution::MPIGroupAngularSolutionI&, const domain::DefinitionI<1>&, const double);
 template void SetUpMPIAngularSolution<2>(system::solution::MPIGroupAngularSolutionI&, const domain::DefinitionI<2>&, const double);
 template void SetUpMPIAngularSolution<3>(system::solution::MPIGroupAngularSolutionI&, const domain::DefinitionI<3>&, const double);
 
-template void SetUpSystemTerms(system::System&, const domain::DefinitionI<1>&);
-template void SetUpSystemTerms(system::System&, const domain::DefinitionI<2>&);
-template void SetUpSystemTerms(system::System&, const domain::DefinitionI<3>&);
+template void SetUpSystemTerms(system::System&, const domain::DefinitionI<1>&, const bool);
+template void SetUpSystemTerms(system::System&, const domain::DefinitionI<2>&, const bool);
+template void SetUpSystemTerms(system::System&, const domain::DefinitionI<3>&, const bool);
+
+template void SetUpSharedReflectedTerms(system::System&, const domain::DefinitionI<1>&, const std::set<system::AngleCouplingIndex>&, const bool);
+template void SetUpSharedReflectedTerms(system::System&, const domain::DefinitionI<2>&, const std::set<system::AngleCouplingIndex>&, const bool);
+template void SetUpSharedReflectedTerms(system::System&, const domain::DefinitionI<3>&, const std::set<system::AngleCouplingIndex>&, const bool);
+
+template void SetUpReflectiveCouplingTerms(system::System&, const domain::DefinitionI<1>&, const std::set<system::AngleCouplingIndex>&);
+template void SetUpReflectiveCouplingTerms(system::System&, const domain::DefinitionI<2>&, const std::set<system::AngleCouplingIndex>&);
+template void SetUpReflectiveCouplingTerms(system::System&, const domain::DefinitionI<3>&, const std::set<system::AngleCouplingIndex>&);
+template void SetUpGroupCouplingTerms(system::System&, const domain::DefinitionI<1>&, const std::set<system::GroupCouplingIndex>&);
+template void SetUpGroupCouplingTerms(system::System&, const domain::DefinitionI<2>&, const std::set<system::GroupCouplingIndex>&);
+template void SetUpGroupCouplingTerms(system::System&, const domain::DefinitionI<3>&, const std::set<system::GroupCouplingIndex>&);
+
+template std::vector<dealii::types::global_dof_index> GetBoundaryDoFs(const domain::DefinitionI<1>&, const std::unordered_set<problem::Boundary>&);
+template std::vector<dealii::types::global_dof_index> GetBoundaryDoFs(const domain::DefinitionI<2>&, const std::unordered_set<problem::Boundary>&);
+template std::vector<dealii::types::global_dof_index> GetBoundaryDoFs(const domain::DefinitionI<3>&, const std::unordered_set<problem::Boundary>&);
+
+template std::shared_ptr<solution::BoundaryAngularSolution> MakeBoundaryAngularSolution(const domain::DefinitionI<1>&, const std::unordered_set<problem::Boundary>&, const int, const int, const StoragePrecision);
+template std::shared_ptr<solution::BoundaryAngularSolution> MakeBoundaryAngularSolution(const domain::DefinitionI<2>&, const std::unordered_set<problem::Boundary>&, const int, const int, const StoragePrecision);
+template std::shared_ptr<solution::BoundaryAngularSolution> MakeBoundaryAngularSolution(const domain::DefinitionI<3>&, const std::unordered_set<problem::Boundary>&, const int, const int, const StoragePrecision);
 
 } // namespace system
 
@@ -1,10 +1,17 @@
 #ifndef BART_SRC_SYSTEM_SYSTEM_FUNCTIONS_H_
 #define BART_SRC_SYSTEM_SYSTEM_FUNCTIONS_H_
 
+#include <memory>
+#include <optional>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+#include "system/solution/boundary_angular_solution.h"
 #include "system/solution/mpi_group_angular_solution_i.h"
 #include "domain/definition_i.h"
+#include "problem/parameter_types.h"
 #include "system/system.h"
-#include "system/solution/solution_types.h"
 
 namespace bart {
 
@@ -27,24 +34,137 @@ void SetUpMPIAngularSolution(
  * @param total_groups total number of energy group
  * @param total_angles total number of angles
  * @param is_eigenvalue_problem identifies if problem is an eigenvalue problem
+ * @param is_rhs_boundary_term_variable if true, the right hand side has a
+ *        variable reflective boundary condition term
+ * @param max_harmonic_l maximum degree of the flux moments stored
  */
 void InitializeSystem(system::System& system_to_setup,
                       const int total_groups,
                       const int total_angles,
                       const bool is_eigenvalue_problem = true,
-                      const bool is_rhs_boundary_term_variable = false);
+                      const bool is_rhs_boundary_term_variable = false,
+                      const int max_harmonic_l = 0);
 
+/*! \brief Sets up the fixed and variable terms for each group and angle.
+ *
+ * @param system_to_setup system to set up
+ * @param domain_definition domain used to make system matrices and vectors
+ * @param is_symmetric if true, the left hand side matrices use symmetric
+ *        (upper triangular) storage, these can only be solved with solvers and
+ *        preconditioners for symmetric systems.
+ */
 template <int dim>
 void SetUpSystemTerms(system::System& system_to_setup,
-                      const domain::DefinitionI<dim>& domain_definition);
+                      const domain::DefinitionI<dim>& domain_definition,
+                      const bool is_symmetric = false);
+
+/*! \brief Shares the fixed left hand side term of angles and their
+ * reflections.
+ *
+ * The streaming and collision terms of an angle and its reflection are the
+ * same, only the boundary terms differ. For each pair, both angles use the
+ * fixed term matrix of the first angle and have a variable boundary term that
+ * only stores couplings of boundary cells. Must be called after
+ * SetUpSystemTerms.
+ *
+ * @param system_to_setup system with left hand side fixed terms set up.
+ * @param domain_definition domain used to make the boundary term matrices.
+ * @param reflected_angles pairs of (angle, reflected angle), each angle may be
+ *        in only one pair.
+ * @param is_symmetric if true, boundary term matrices use symmetric storage,
+ *        this must match the fixed term matrices.
+ */
+template <int dim>
+void SetUpSharedReflectedTerms(
+    system::System& system_to_setup,
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::set<system::AngleCouplingIndex>& reflected_angles,
+    const bool is_symmetric = false);
+
+/*! \brief Sets up the matrices that couple angles across implicit reflective
+ * boundaries.
+ *
+ * @param system_to_setup system to add the coupling matrices to.
+ * @param domain_definition domain used to generate the matrices.
+ * @param coupled_angles pairs of (incoming angle, reflected angle) to couple.
+ */
+template <int dim>
+void SetUpReflectiveCouplingTerms(
+    system::System& system_to_setup,
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::set<system::AngleCouplingIndex>& coupled_angles);
+
+/*! \brief Sets up the matrices that couple energy groups in a multigroup
+ * block system.
+ *
+ * @param system_to_setup system to add the coupling matrices to.
+ * @param domain_definition domain used to generate the matrices.
+ * @param coupled_groups pairs of (group, source group) to couple.
+ */
+template <int dim>
+void SetUpGroupCouplingTerms(
+    system::System& system_to_setup,
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::set<system::GroupCouplingIndex>& coupled_groups);
 
+/*! \brief Initializes the current and previous moments of a system to one.
+ *
+ * If the lagged moments are stored in single precision by the iteration that
+ * uses them (see GroupSolveIteration::StoreLaggedMomentsInSinglePrecision),
+ * the previous moments are not used and are left unallocated.
+ *
+ * @param system_to_setup system with moments to initialize.
+ * @param solution_size size of each moment.
+ * @param lagged_moment_precision precision used to store the lagged moments.
+ */
 void SetUpSystemMoments(system::System& system_to_setup,
-                        const std::size_t solution_size);
+                        const std::size_t solution_size,
+                        const StoragePrecision lagged_moment_precision =
+                            StoragePrecision::kDouble);
+
+/*! \brief Sets the initial guess of a system to a previous solution.
+ *
+ * Current and previous moments are set to the given moments and, if provided,
+ * k_effective is set to the given value. This is used to start a solve from
+ * the solution of the same problem on a different mesh. Previous moments that
+ * have not been allocated (see SetUpSystemMoments) are skipped.
+ *
+ * @param system_to_setup system with moments that have been set up.
+ * @param moments moments to set, each must match the size of the system moment
+ *        with the same index.
+ * @param k_effective initial k_effective.
+ */
+void SetInitialSolution(system::System& system_to_setup,
+                        const system::moments::MomentsMap& moments,
+                        const std::optional<double> k_effective = std::nullopt);
 
-void SetUpEnergyGroupToAngularSolutionPtrMap(
-    solution::EnergyGroupToAngularSolutionPtrMap& to_setup,
+/*! \brief Returns the degrees of freedom of locally owned cells that have
+ * support on the given boundaries.
+ *
+ * Degrees of freedom are identified using the support of the cell shape
+ * functions on each boundary face, so this is valid for both continuous and
+ * discontinuous finite elements.
+ */
+template <int dim>
+std::vector<dealii::types::global_dof_index> GetBoundaryDoFs(
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::unordered_set<problem::Boundary>& boundaries);
+
+/*! \brief Creates storage for angular solutions on reflective boundaries.
+ *
+ * @param domain_definition domain used to identify boundary degrees of freedom.
+ * @param reflective_boundaries reflective boundaries.
+ * @param total_groups total number of energy groups.
+ * @param total_angles total number of angles.
+ * @param precision precision of the stored angular solutions.
+ */
+template <int dim>
+std::shared_ptr<solution::BoundaryAngularSolution> MakeBoundaryAngularSolution(
+    const domain::DefinitionI<dim>& domain_definition,
+    const std::unordered_set<problem::Boundary>& reflective_boundaries,
     const int total_groups,
-    const int total_angles);
+    const int total_angles,
+    const StoragePrecision precision = StoragePrecision::kDouble);
 
 } // namespace system
 
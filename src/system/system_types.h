@@ -26,6 +26,10 @@ using AngleIndex = int;
 //! Index used to store and access rhs vectors and lhs matrices
 using Index = std::pair<GroupNumber, AngleIndex>;
 using SolutionIndex = std::pair<EnergyGroup, AngleIdx>;
+//! Index of a pair of coupled angles, (angle, coupled angle)
+using AngleCouplingIndex = std::pair<AngleIndex, AngleIndex>;
+//! Index of a pair of coupled energy groups, (group, source group)
+using GroupCouplingIndex = std::pair<GroupNumber, GroupNumber>;
 
 //! Sparse MPI vector for use in various system terms.
 using MPIVector = dealii::PETScWrappers::MPI::Vector;
@@ -33,6 +37,17 @@ using MPIVector = dealii::PETScWrappers::MPI::Vector;
 //! Sparse MPI matrix used for left-hand-side matrices
 using MPISparseMatrix = dealii::PETScWrappers::MPI::SparseMatrix;
 
+/*! \brief Precision used to store solutions between iterations.
+ *
+ * Single precision halves the memory used (and read each iteration) by stored
+ * solutions. Stored values are converted to double precision when they are
+ * used, so all accumulation is done in double precision.
+ */
+enum class StoragePrecision {
+  kDouble = 0,
+  kSingle = 1,
+};
+
 } // namespace system
 
 } // namespace bart
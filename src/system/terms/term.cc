@@ -2,12 +2,28 @@
 
 #include <utility>
 
+#include <deal.II/lac/exceptions.h>
+
 namespace bart {
 
 namespace system {
 
 namespace terms {
 
+namespace {
+
+std::pair<PetscObject, PetscObjectState> GetObjectState(
+    const system::MPISparseMatrix& matrix) {
+  const auto petsc_object =
+      reinterpret_cast<PetscObject>(static_cast<Mat>(matrix));
+  PetscObjectState state;
+  const auto ierr = PetscObjectStateGet(petsc_object, &state);
+  AssertThrow(ierr == 0, dealii::ExcPETScError(ierr))
+  return {petsc_object, state};
+}
+
+} // namespace
+
 template <typename TermPair>
 Term<TermPair>::Term(std::unordered_set<VariableTermType> variable_terms)
     : variable_terms_(variable_terms)
@@ -82,34 +98,74 @@ std::shared_ptr<system::MPIVector> Term<MPILinearTermPair>::GetFullTermPtr(
     Index index) const {
 
   auto& fixed_term_vector = *fixed_term_ptrs_.at(index);
-  auto return_vector_ptr =
-      std::make_shared<system::MPIVector>(fixed_term_vector);
+  auto& full_term_ptr = full_term_ptrs_[index];
+  if (full_term_ptr == nullptr)
+    full_term_ptr = std::make_shared<system::MPIVector>(fixed_term_vector);
+  else
+    *full_term_ptr = fixed_term_vector;
 
   for (auto& variable_term_pair : variable_term_ptrs_) {
     auto& variable_term_vector = *variable_term_pair.second.at(index);
-    return_vector_ptr->add(1, variable_term_vector);
-    return_vector_ptr->compress(dealii::VectorOperation::add);
+    full_term_ptr->add(1, variable_term_vector);
+    full_term_ptr->compress(dealii::VectorOperation::add);
   }
 
-  return return_vector_ptr;
+  return full_term_ptr;
 }
 
 template <>
 std::shared_ptr<system::MPISparseMatrix> Term<MPIBilinearTermPair>::GetFullTermPtr(
     Index index) const {
-  auto return_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
   auto& fixed_term_matrix = *fixed_term_ptrs_.at(index);
-
-  return_matrix_ptr->reinit(fixed_term_matrix);
-  return_matrix_ptr->copy_from(fixed_term_matrix);
-
-  for (auto& variable_term_pair : variable_term_ptrs_) {
-    auto& variable_term_matrix = *variable_term_pair.second.at(index);
-    return_matrix_ptr->add(1, variable_term_matrix);
-    return_matrix_ptr->compress(dealii::VectorOperation::add);
+  auto& full_term_ptr = full_term_ptrs_[index];
+  auto& term_states = full_term_states_[index];
+
+  // Variable bilinear terms, such as boundary terms of angles sharing a fixed
+  // term, may be set for only some indices
+  auto for_each_variable_term = [&](auto&& function) {
+    for (auto& variable_term_pair : variable_term_ptrs_) {
+      auto variable_term_it = variable_term_pair.second.find(index);
+      if (variable_term_it != variable_term_pair.second.end() &&
+          variable_term_it->second != nullptr)
+        function(*variable_term_it->second);
+    }
+  };
+
+  // The full term is current if it and all summed terms are unchanged
+  bool is_current = full_term_ptr != nullptr;
+  std::size_t n_terms = 0;
+  auto check_state = [&](const system::MPISparseMatrix& matrix) {
+    is_current = is_current && n_terms < term_states.size() &&
+        term_states[n_terms] == GetObjectState(matrix);
+    ++n_terms;
+  };
+  if (is_current) {
+    check_state(*full_term_ptr);
+    check_state(fixed_term_matrix);
+    for_each_variable_term(check_state);
+    is_current = is_current && n_terms == term_states.size();
   }
+  if (is_current)
+    return full_term_ptr;
 
-  return return_matrix_ptr;
+  if (full_term_ptr == nullptr) {
+    full_term_ptr = std::make_shared<system::MPISparseMatrix>();
+    full_term_ptr->reinit(fixed_term_matrix);
+  }
+  full_term_ptr->copy_from(fixed_term_matrix);
+  for_each_variable_term([&](const system::MPISparseMatrix& variable_term) {
+    full_term_ptr->add(1, variable_term);
+    full_term_ptr->compress(dealii::VectorOperation::add);
+  });
+
+  term_states.clear();
+  term_states.push_back(GetObjectState(*full_term_ptr));
+  term_states.push_back(GetObjectState(fixed_term_matrix));
+  for_each_variable_term([&](const system::MPISparseMatrix& variable_term) {
+    term_states.push_back(GetObjectState(variable_term));
+  });
+
+  return full_term_ptr;
 }
 
 template class Term<system::terms::MPILinearTermPair>;
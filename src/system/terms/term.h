@@ -3,6 +3,8 @@
 
 #include <memory>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include "system/system_types.h"
 #include "system/terms/term_i.h"
@@ -28,6 +30,11 @@ namespace terms {
  * Overloads are provided that only require group number, which will retrieve
  * and store those with an angle index of zero.
  *
+ * The full term of each index is stored and updated in place by
+ * GetFullTermPtr, so repeated calls do not allocate. A full bilinear term is
+ * only assembled again if the PETSc object state of one of the terms summed
+ * into it, or of the full term itself, has changed.
+ *
  * @tparam TermPair a std::pair that includes two types, (1) the storage type
  * and (2) an enum holding the possible variable terms.
  *
@@ -96,6 +103,12 @@ class Term : public TermI<TermPair> {
   TermPtrMap fixed_term_ptrs_;
 
   std::map<VariableTermType, TermPtrMap> variable_term_ptrs_;
+
+  //! Full term of each index, updated in place
+  mutable TermPtrMap full_term_ptrs_;
+  //! PETSc objects and their states when each full bilinear term was assembled
+  mutable std::map<Index, std::vector<std::pair<PetscObject, PetscObjectState>>>
+      full_term_states_;
 };
 
 using MPILinearTerm = Term<system::terms::MPILinearTermPair>;
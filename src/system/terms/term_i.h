@@ -23,6 +23,8 @@ class TermI {
    * value of the FullTerm.
    *
    * This function will combine the underlying objects to return a single one.
+   * The returned object may be reused and updated by later calls with the same
+   * index.
    */
   virtual std::shared_ptr<StorageType> GetFullTermPtr(Index index) const = 0;
 
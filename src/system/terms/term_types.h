@@ -20,6 +20,7 @@ enum class VariableLinearTerms {
 //! Bilinear Terms that may vary iteration-to-iteration
 enum class VariableBilinearTerms {
   kOther = 0,            //!< Other source
+  kBoundary = 1,         //!< Boundary terms of angles sharing a fixed term
 };
 
 //! Standard pair types for terms
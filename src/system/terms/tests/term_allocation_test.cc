@@ -0,0 +1,66 @@
+#include "system/terms/term.h"
+
+#include "test_helpers/allocation_counter.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+/* Checks that full terms are updated in place, so that getting the full term
+ * for each group and angle solve does not allocate.
+ *
+ * This test is built into bart_allocation_test, the only executable that
+ * replaces the global operator new. */
+class SystemTermsFullTermAllocationTest : public ::testing::Test,
+                                          public bart::testing::DealiiTestDomain<2> {
+ protected:
+  void SetUp() override { SetUpDealii(); }
+};
+
+TEST_F(SystemTermsFullTermAllocationTest, RepeatedFullTerms) {
+  auto other_bilinear_term = system::terms::VariableBilinearTerms::kOther;
+  auto other_linear_term = system::terms::VariableLinearTerms::kOther;
+  system::terms::MPIBilinearTerm test_bilinear_term({other_bilinear_term});
+  system::terms::MPILinearTerm test_linear_term({other_linear_term});
+
+  auto fixed_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  auto variable_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  fixed_matrix_ptr->reinit(matrix_1);
+  variable_matrix_ptr->reinit(matrix_2);
+  StampMatrix(*fixed_matrix_ptr, 2);
+  StampMatrix(*variable_matrix_ptr, 1);
+  auto fixed_vector_ptr = std::make_shared<system::MPIVector>(vector_1);
+  auto variable_vector_ptr = std::make_shared<system::MPIVector>(vector_1);
+
+  test_bilinear_term.SetFixedTermPtr({0, 0}, fixed_matrix_ptr);
+  test_bilinear_term.SetVariableTermPtr({0, 0}, other_bilinear_term,
+                                        variable_matrix_ptr);
+  test_linear_term.SetFixedTermPtr({0, 0}, fixed_vector_ptr);
+  test_linear_term.SetVariableTermPtr({0, 0}, other_linear_term,
+                                      variable_vector_ptr);
+
+  // The first calls make the full terms
+  test_bilinear_term.GetFullTermPtr({0, 0});
+  test_linear_term.GetFullTermPtr({0, 0});
+
+  test_helpers::AllocationCounter unchanged_counter;
+  test_bilinear_term.GetFullTermPtr({0, 0});
+  test_linear_term.GetFullTermPtr({0, 0});
+  const auto unchanged_allocations = unchanged_counter.allocations();
+
+  // Changed terms are summed into the existing full terms
+  *variable_matrix_ptr = 0;
+  StampMatrix(*variable_matrix_ptr, 3);
+  *variable_vector_ptr = 2;
+  test_helpers::AllocationCounter changed_counter;
+  test_bilinear_term.GetFullTermPtr({0, 0});
+  test_linear_term.GetFullTermPtr({0, 0});
+  const auto changed_allocations = changed_counter.allocations();
+
+  EXPECT_EQ(unchanged_allocations, 0);
+  EXPECT_EQ(changed_allocations, 0);
+}
+
+} // namespace
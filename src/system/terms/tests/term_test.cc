@@ -83,6 +83,90 @@ TEST_F(SystemTermsFullTermTest, BilinearFullTermOperationMPI) {
   EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *term_matrix_ptr));
 }
 
+TEST_F(SystemTermsFullTermTest, BilinearFullTermOperationSharedFixedMPI) {
+  auto boundary_term = system::terms::VariableBilinearTerms::kBoundary;
+  system::terms::MPIBilinearTerm test_bilinear_term({boundary_term});
+
+  // Both indices share one fixed term, only the first has a boundary term
+  auto fixed_term_ptr = std::make_shared<system::MPISparseMatrix>();
+  auto boundary_term_ptr = std::make_shared<system::MPISparseMatrix>();
+
+  fixed_term_ptr->reinit(matrix_1);
+  boundary_term_ptr->reinit(matrix_2);
+
+  StampMatrix(*fixed_term_ptr, 2);
+  StampMatrix(*boundary_term_ptr, 1);
+  StampMatrix(matrix_3, 3);
+
+  test_bilinear_term.SetFixedTermPtr({0, 0}, fixed_term_ptr);
+  test_bilinear_term.SetFixedTermPtr({0, 1}, fixed_term_ptr);
+  test_bilinear_term.SetVariableTermPtr({0, 0}, boundary_term, boundary_term_ptr);
+
+  auto term_matrix_ptr = test_bilinear_term.GetFullTermPtr({0, 0});
+  EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *term_matrix_ptr));
+  auto unset_term_matrix_ptr = test_bilinear_term.GetFullTermPtr({0, 1});
+  EXPECT_TRUE(bart::test_helpers::AreEqual(*fixed_term_ptr,
+                                           *unset_term_matrix_ptr));
+}
+
+TEST_F(SystemTermsFullTermTest, BilinearFullTermUpdatedInPlaceMPI) {
+  auto other_source = system::terms::VariableBilinearTerms::kOther;
+  system::terms::MPIBilinearTerm test_bilinear_term({other_source});
+
+  auto fixed_term_ptr = std::make_shared<system::MPISparseMatrix>();
+  auto variable_term_ptr = std::make_shared<system::MPISparseMatrix>();
+
+  fixed_term_ptr->reinit(matrix_1);
+  variable_term_ptr->reinit(matrix_2);
+
+  StampMatrix(*fixed_term_ptr, 2);
+  StampMatrix(*variable_term_ptr, 1);
+
+  test_bilinear_term.SetFixedTermPtr({0, 0}, fixed_term_ptr);
+  test_bilinear_term.SetVariableTermPtr({0, 0}, other_source, variable_term_ptr);
+
+  auto term_matrix_ptr = test_bilinear_term.GetFullTermPtr({0, 0});
+  // Unchanged terms return the same full term without assembling it again
+  const Mat full_term_matrix = *term_matrix_ptr;
+  PetscObjectState full_term_state, unchanged_full_term_state;
+  PetscObjectStateGet(reinterpret_cast<PetscObject>(full_term_matrix),
+                      &full_term_state);
+  EXPECT_EQ(test_bilinear_term.GetFullTermPtr({0, 0}), term_matrix_ptr);
+  PetscObjectStateGet(reinterpret_cast<PetscObject>(full_term_matrix),
+                      &unchanged_full_term_state);
+  EXPECT_EQ(unchanged_full_term_state, full_term_state);
+
+  // Changing a summed term updates the same full term
+  *variable_term_ptr = 0;
+  StampMatrix(*variable_term_ptr, 4);
+  StampMatrix(matrix_3, 6);
+  EXPECT_EQ(test_bilinear_term.GetFullTermPtr({0, 0}), term_matrix_ptr);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *term_matrix_ptr));
+}
+
+TEST_F(SystemTermsFullTermTest, LinearFullTermUpdatedInPlaceMPI) {
+  using VariableTerms = system::terms::VariableLinearTerms;
+  system::terms::MPILinearTerm test_linear_term({VariableTerms::kOther});
+
+  auto fixed_term_ptr = std::make_shared<system::MPIVector>(vector_1);
+  auto other_term_ptr = std::make_shared<system::MPIVector>(vector_1);
+  *fixed_term_ptr = 1;
+  *other_term_ptr = 2;
+
+  test_linear_term.SetFixedTermPtr({0, 0}, fixed_term_ptr);
+  test_linear_term.SetVariableTermPtr({0, 0}, VariableTerms::kOther,
+                                      other_term_ptr);
+
+  auto term_vector_ptr = test_linear_term.GetFullTermPtr({0, 0});
+  vector_1 = 3;
+  EXPECT_TRUE(bart::test_helpers::AreEqual(vector_1, *term_vector_ptr));
+
+  *other_term_ptr = 5;
+  EXPECT_EQ(test_linear_term.GetFullTermPtr({0, 0}), term_vector_ptr);
+  vector_1 = 6;
+  EXPECT_TRUE(bart::test_helpers::AreEqual(vector_1, *term_vector_ptr));
+}
+
 TEST_F(SystemTermsFullTermTest, LinearFullTermOperationMPI) {
   using VariableTerms = system::terms::VariableLinearTerms;
   system::terms::MPILinearTerm test_linear_term({VariableTerms::kFissionSource,
@@ -1,5 +1,8 @@
 #include "system/system_functions.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "domain/tests/definition_mock.h"
 #include "system/solution/tests/mpi_group_angular_solution_mock.h"
 #include "system/solution/mpi_group_angular_solution.h"
@@ -15,7 +18,6 @@
 #include "system/moments/tests/spherical_harmonic_mock.h"
 #include "system/terms/tests/linear_term_mock.h"
 #include "system/terms/tests/bilinear_term_mock.h"
-#include "system/solution/solution_types.h"
 
 namespace  {
 
@@ -151,6 +153,9 @@ TEST_F(SystemFunctionsInitializeSystemTest, DefaultCall) {
   ASSERT_THAT(test_system.left_hand_side_ptr_.get(),
               WhenDynamicCastTo<ExpectedLHSType *>(NotNull()));
   EXPECT_EQ(test_system.right_hand_side_ptr_->GetVariableTerms(), source_terms);
+  EXPECT_EQ(test_system.left_hand_side_ptr_->GetVariableTerms(),
+            std::unordered_set<system::terms::VariableBilinearTerms>{
+                system::terms::VariableBilinearTerms::kBoundary});
   ASSERT_THAT(test_system.current_moments.get(),
               WhenDynamicCastTo<ExpectedMomentsType *>(NotNull()));
   ASSERT_THAT(test_system.previous_moments.get(),
@@ -218,6 +223,24 @@ TEST_F(SystemFunctionsInitializeSystemTest, BoundaryConditions) {
   EXPECT_EQ(test_system.previous_moments->moments().size(), total_groups);
 }
 
+TEST_F(SystemFunctionsInitializeSystemTest, HigherMoments) {
+  const int total_groups = bart::test_helpers::RandomDouble(1, 10);
+  const int total_angles = total_groups + 1;
+  const int max_harmonic_l = 2;
+
+  system::InitializeSystem(test_system, total_groups, total_angles, false,
+                           false, max_harmonic_l);
+
+  // Moments for each l in [0, max_l] and m in [-l, l]
+  const int moments_per_group = (max_harmonic_l + 1) * (max_harmonic_l + 1);
+  for (auto moments_ptr : {test_system.current_moments.get(),
+                           test_system.previous_moments.get()}) {
+    ASSERT_NE(moments_ptr, nullptr);
+    EXPECT_EQ(moments_ptr->max_harmonic_l(), max_harmonic_l);
+    EXPECT_EQ(moments_ptr->moments().size(), total_groups * moments_per_group);
+  }
+}
+
 TEST_F(SystemFunctionsInitializeSystemTest, ErrorOnSecondCall) {
   using VariableLinearTerms = system::terms::VariableLinearTerms;
   using ExpectedRHSType = bart::system::terms::MPILinearTerm;
@@ -288,6 +311,8 @@ void SystemFunctionsSetUpSystemTermsTests<DimensionWrapper>::SetUp() {
 
   ON_CALL(*domain_mock_obs_ptr_, MakeSystemMatrix())
       .WillByDefault(Return(system_matrix_ptr_));
+  ON_CALL(*domain_mock_obs_ptr_, MakeSymmetricSystemMatrix())
+      .WillByDefault(Return(system_matrix_ptr_));
   ON_CALL(*domain_mock_obs_ptr_, MakeSystemVector())
       .WillByDefault(Return(system_vector_ptr_));
 }
@@ -322,6 +347,155 @@ TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpProperly) {
   bart::system::SetUpSystemTerms(test_system, *this->definition_ptr);
 }
 
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpSymmetric) {
+  auto& test_system = this->test_system;
+  const int total_groups = test_system.total_groups;
+  const int total_angles = test_system.total_angles;
+
+  EXPECT_CALL(*this->rhs_mock_obs_ptr_, GetVariableTerms())
+      .WillOnce(DoDefault());
+
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSymmetricSystemMatrix())
+      .Times(total_angles * total_groups)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemMatrix()).Times(0);
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemVector())
+      .Times(total_groups * total_angles * (1 + this->source_terms_.size()))
+      .WillRepeatedly(DoDefault());
+
+  for (int group = 0; group < total_groups; ++group) {
+    for (int angle = 0; angle < total_angles; ++angle) {
+      bart::system::Index index{group, angle};
+      EXPECT_CALL(*this->lhs_mock_obs_ptr_, SetFixedTermPtr(index, NotNull()));
+    }
+  }
+
+  bart::system::SetUpSystemTerms(test_system, *this->definition_ptr, true);
+}
+
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpSharedReflectedTerms) {
+  using VariableBilinearTerms = bart::system::terms::VariableBilinearTerms;
+  auto& test_system = this->test_system;
+  const int total_groups = test_system.total_groups;
+  const std::set<bart::system::AngleCouplingIndex> reflected_angles{{0, 2},
+                                                                    {1, 3}};
+  auto boundary_matrix_ptr = std::make_shared<bart::system::MPISparseMatrix>();
+
+  EXPECT_CALL(*this->lhs_mock_obs_ptr_, GetVariableTerms())
+      .WillOnce(Return(std::unordered_set<VariableBilinearTerms>{
+          VariableBilinearTerms::kBoundary}));
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeBoundarySystemMatrix(true))
+      .Times(total_groups * 2 * reflected_angles.size())
+      .WillRepeatedly(Return(boundary_matrix_ptr));
+  for (int group = 0; group < total_groups; ++group) {
+    for (const auto& [angle, reflected_angle] : reflected_angles) {
+      EXPECT_CALL(*this->lhs_mock_obs_ptr_, GetFixedTermPtr(
+          bart::system::Index{group, angle}))
+          .WillOnce(Return(this->system_matrix_ptr_));
+      EXPECT_CALL(*this->lhs_mock_obs_ptr_, SetFixedTermPtr(
+          bart::system::Index{group, reflected_angle}, this->system_matrix_ptr_));
+      for (const int shared_angle : {angle, reflected_angle}) {
+        EXPECT_CALL(*this->lhs_mock_obs_ptr_, SetVariableTermPtr(
+            bart::system::Index{group, shared_angle},
+            VariableBilinearTerms::kBoundary, boundary_matrix_ptr));
+      }
+    }
+  }
+
+  bart::system::SetUpSharedReflectedTerms(test_system, *this->definition_ptr,
+                                          reflected_angles, true);
+}
+
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpSharedReflectedTermsBadAngles) {
+  using VariableBilinearTerms = bart::system::terms::VariableBilinearTerms;
+  ON_CALL(*this->lhs_mock_obs_ptr_, GetVariableTerms())
+      .WillByDefault(Return(std::unordered_set<VariableBilinearTerms>{
+          VariableBilinearTerms::kBoundary}));
+  for (const auto& reflected_angles :
+      {std::set<bart::system::AngleCouplingIndex>{{0, 0}},
+       std::set<bart::system::AngleCouplingIndex>{{0, 1}, {1, 2}}}) {
+    EXPECT_ANY_THROW({
+      bart::system::SetUpSharedReflectedTerms(this->test_system,
+                                              *this->definition_ptr,
+                                              reflected_angles);
+    });
+  }
+  // Left hand side without a variable boundary term
+  ON_CALL(*this->lhs_mock_obs_ptr_, GetVariableTerms())
+      .WillByDefault(Return(std::unordered_set<VariableBilinearTerms>{}));
+  const std::set<bart::system::AngleCouplingIndex> reflected_angles{{0, 1}};
+  EXPECT_ANY_THROW({
+    bart::system::SetUpSharedReflectedTerms(this->test_system,
+                                            *this->definition_ptr,
+                                            reflected_angles);
+  });
+}
+
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpReflectiveCoupling) {
+  auto& test_system = this->test_system;
+  const std::set<bart::system::AngleCouplingIndex> coupled_angles{
+      {0, 1}, {1, 0}, {2, 3}};
+
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemMatrix())
+      .Times(coupled_angles.size())
+      .WillRepeatedly(DoDefault());
+
+  bart::system::SetUpReflectiveCouplingTerms(test_system,
+                                             *this->definition_ptr,
+                                             coupled_angles);
+
+  ASSERT_EQ(test_system.reflective_coupling_terms.size(),
+            coupled_angles.size());
+  for (const auto& coupling_index : coupled_angles) {
+    ASSERT_EQ(test_system.reflective_coupling_terms.count(coupling_index), 1);
+    EXPECT_NE(test_system.reflective_coupling_terms.at(coupling_index),
+              nullptr);
+  }
+}
+
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpReflectiveCouplingSelf) {
+  const std::set<bart::system::AngleCouplingIndex> coupled_angles{{0, 1},
+                                                                  {2, 2}};
+  EXPECT_ANY_THROW({
+    bart::system::SetUpReflectiveCouplingTerms(this->test_system,
+                                               *this->definition_ptr,
+                                               coupled_angles);
+  });
+}
+
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpGroupCoupling) {
+  auto& test_system = this->test_system;
+  const std::set<bart::system::GroupCouplingIndex> coupled_groups{
+      {0, 1}, {1, 0}};
+
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemMatrix())
+      .Times(coupled_groups.size())
+      .WillRepeatedly(DoDefault());
+
+  bart::system::SetUpGroupCouplingTerms(test_system, *this->definition_ptr,
+                                        coupled_groups);
+
+  ASSERT_EQ(test_system.group_coupling_terms.size(), coupled_groups.size());
+  for (const auto& coupling_index : coupled_groups) {
+    ASSERT_EQ(test_system.group_coupling_terms.count(coupling_index), 1);
+    EXPECT_NE(test_system.group_coupling_terms.at(coupling_index), nullptr);
+  }
+}
+
+TYPED_TEST(SystemFunctionsSetUpSystemTermsTests, SetUpGroupCouplingBadGroups) {
+  const int total_groups = this->test_system.total_groups;
+  for (const auto& coupled_groups :
+      {std::set<bart::system::GroupCouplingIndex>{{0, 1}, {1, 1}},
+       std::set<bart::system::GroupCouplingIndex>{{0, total_groups}},
+       std::set<bart::system::GroupCouplingIndex>{{-1, 0}}}) {
+    EXPECT_ANY_THROW({
+      bart::system::SetUpGroupCouplingTerms(this->test_system,
+                                            *this->definition_ptr,
+                                            coupled_groups);
+    });
+  }
+}
+
 // ===== SetUpSystemMomentsTests ===============================================
 
 class SystemFunctionsSetUpSystemMomentsTests : public ::testing::Test {
@@ -405,38 +579,185 @@ TEST_F(SystemFunctionsSetUpSystemMomentsTests, SetUpProperly) {
   }
 }
 
-// ===== SetUpSystemAngularSolution Tests ======================================
+TEST_F(SystemFunctionsSetUpSystemMomentsTests, SinglePrecisionLaggedMoments) {
+  EXPECT_CALL(*current_moments_obs_ptr_, begin()).WillOnce(DoDefault());
+  EXPECT_CALL(*current_moments_obs_ptr_, end()).WillOnce(DoDefault());
+  EXPECT_CALL(*previous_moments_obs_ptr_, begin()).Times(0);
+  EXPECT_CALL(*previous_moments_obs_ptr_, end()).Times(0);
+
+  system::SetUpSystemMoments(test_system, solution_size,
+                             system::StoragePrecision::kSingle);
+  dealii::Vector<double> expected(solution_size);
+  expected = 1;
+
+  for (const auto& moment_pair : current_moments_) {
+    ASSERT_EQ(moment_pair.second.size(), solution_size);
+    EXPECT_EQ(moment_pair.second, expected);
+  }
+  for (const auto& moment_pair : previous_moments_)
+    EXPECT_EQ(moment_pair.second.size(), 0);
+}
+
+// ===== SetInitialSolution Tests =============================================
 
-class SystemFunctionsSetUpEnergyGroupToAngularSolutionPtrMapIntTests
-    : public ::testing::Test {
+class SystemFunctionsSetInitialSolutionTests : public ::testing::Test {
  public:
-  system::solution::EnergyGroupToAngularSolutionPtrMap solution_map_;
+  bart::system::System test_system;
+  const int n_groups = 2;
+  const int max_harmonic_l = 1;
+  const int solution_size = 5;
+
+  void SetUp() override {
+    test_system.current_moments =
+        std::make_unique<system::moments::SphericalHarmonic>(n_groups,
+                                                             max_harmonic_l);
+    test_system.previous_moments =
+        std::make_unique<system::moments::SphericalHarmonic>(n_groups,
+                                                             max_harmonic_l);
+    test_system.k_effective = 1.0;
+    system::SetUpSystemMoments(test_system, solution_size);
+  }
+};
+
+TEST_F(SystemFunctionsSetInitialSolutionTests, SetsMomentsAndKEffective) {
+  system::moments::MomentsMap initial_moments;
+  for (const auto& [index, moment] : test_system.current_moments->moments()) {
+    initial_moments[index] = dealii::Vector<double>(solution_size);
+    for (int i = 0; i < solution_size; ++i)
+      initial_moments[index][i] = test_helpers::RandomDouble(0, 10);
+  }
+
+  system::SetInitialSolution(test_system, initial_moments, 1.25);
+
+  for (const auto& [index, moment] : initial_moments) {
+    EXPECT_EQ(test_system.current_moments->GetMoment(index), moment);
+    EXPECT_EQ(test_system.previous_moments->GetMoment(index), moment);
+  }
+  ASSERT_TRUE(test_system.k_effective.has_value());
+  EXPECT_EQ(test_system.k_effective.value(), 1.25);
+}
+
+TEST_F(SystemFunctionsSetInitialSolutionTests, KeepsKEffectiveIfNotProvided) {
+  system::moments::MomentsMap initial_moments;
+  initial_moments[{1, 0, 0}] = dealii::Vector<double>(solution_size);
+  initial_moments[{1, 0, 0}] = 2.0;
 
-  const int total_groups_ = test_helpers::RandomDouble(2, 4);
-  const int total_angles_{total_groups_ + 1};
+  system::SetInitialSolution(test_system, initial_moments);
 
+  dealii::Vector<double> unchanged_moment(solution_size);
+  unchanged_moment = 1.0;
+  EXPECT_EQ(test_system.current_moments->GetMoment({1, 0, 0}),
+            initial_moments.at({1, 0, 0}));
+  EXPECT_EQ(test_system.current_moments->GetMoment({0, 0, 0}),
+            unchanged_moment);
+  EXPECT_EQ(test_system.k_effective.value(), 1.0);
+}
+
+TEST_F(SystemFunctionsSetInitialSolutionTests, BadMoments) {
+  system::moments::MomentsMap bad_index_moments;
+  bad_index_moments[{n_groups, 0, 0}] = dealii::Vector<double>(solution_size);
+  EXPECT_ANY_THROW({
+    system::SetInitialSolution(test_system, bad_index_moments);
+  });
+
+  system::moments::MomentsMap bad_size_moments;
+  bad_size_moments[{0, 0, 0}] = dealii::Vector<double>(solution_size + 1);
+  EXPECT_ANY_THROW({
+    system::SetInitialSolution(test_system, bad_size_moments);
+  });
+}
+
+TEST_F(SystemFunctionsSetInitialSolutionTests, UnallocatedPreviousMoments) {
+  test_system.previous_moments =
+      std::make_unique<system::moments::SphericalHarmonic>(n_groups,
+                                                           max_harmonic_l);
+  system::moments::MomentsMap initial_moments;
+  initial_moments[{0, 0, 0}] = dealii::Vector<double>(solution_size);
+  initial_moments[{0, 0, 0}] = 3.0;
+
+  EXPECT_NO_THROW({
+    system::SetInitialSolution(test_system, initial_moments);
+  });
+  EXPECT_EQ(test_system.current_moments->GetMoment({0, 0, 0}),
+            initial_moments.at({0, 0, 0}));
+  EXPECT_EQ(test_system.previous_moments->GetMoment({0, 0, 0}).size(), 0);
+}
+
+// ===== GetBoundaryDoFs Tests ==================================================
+
+template <typename DimensionWrapper>
+class SystemFunctionsGetBoundaryDoFsTests
+    : public ::testing::Test,
+      public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using DomainType = NiceMock<domain::DefinitionMock<dim>>;
+  using Boundary = problem::Boundary;
+
+  DomainType domain_mock_;
+  void SetUp() override;
 };
 
-TEST_F(SystemFunctionsSetUpEnergyGroupToAngularSolutionPtrMapIntTests,
-       DefaultCall) {
-  system::SetUpEnergyGroupToAngularSolutionPtrMap(solution_map_,
-                                                  total_groups_,
-                                                  total_angles_);
-
-  using ExpectedType = dealii::Vector<double>;
-  std::vector<int> energy_groups{};
-  EXPECT_EQ(solution_map_.size(), total_groups_ * total_angles_);
-  for (auto& [index, solution_ptr] : solution_map_) {
-    auto [energy_group, angle] = index;
-    ASSERT_THAT(solution_ptr.get(),
-                WhenDynamicCastTo<ExpectedType*>(NotNull()));
-    EXPECT_LT(energy_group.get(), total_groups_);
-    EXPECT_GE(energy_group.get(), 0);
-    EXPECT_LT(angle.get(), total_angles_);
-    EXPECT_GE(angle.get(), 0);
+template <typename DimensionWrapper>
+void SystemFunctionsGetBoundaryDoFsTests<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  // Boundary faces at x = 0 are XMin, all other boundary faces are XMax
+  for (auto& cell : this->cells_) {
+    for (unsigned int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+      if (cell->face(face)->at_boundary()) {
+        const bool is_x_min = std::abs(cell->face(face)->center()[0]) < 1e-12;
+        cell->face(face)->set_boundary_id(
+            static_cast<int>(is_x_min ? Boundary::kXMin : Boundary::kXMax));
+      }
+    }
   }
+  ON_CALL(domain_mock_, Cells()).WillByDefault(Return(this->cells_));
+  ON_CALL(domain_mock_, locally_owned_dofs())
+      .WillByDefault(Return(this->locally_owned_dofs_));
 }
 
+TYPED_TEST_SUITE(SystemFunctionsGetBoundaryDoFsTests, bart::testing::AllDimensions);
 
+TYPED_TEST(SystemFunctionsGetBoundaryDoFsTests, GetBoundaryDoFs) {
+  constexpr int dim = this->dim;
+  using Boundary = problem::Boundary;
+  // Test domain has 4 linear cells in each direction, so 5 nodes per direction
+  const std::size_t expected_size = std::pow(5, dim - 1);
+
+  auto boundary_dofs = system::GetBoundaryDoFs(this->domain_mock_,
+                                               {Boundary::kXMin});
+  EXPECT_EQ(boundary_dofs.size(), expected_size);
+  EXPECT_TRUE(std::is_sorted(boundary_dofs.begin(), boundary_dofs.end()));
+  EXPECT_TRUE(std::adjacent_find(boundary_dofs.begin(), boundary_dofs.end())
+                  == boundary_dofs.end());
+
+  EXPECT_TRUE(system::GetBoundaryDoFs(this->domain_mock_, {}).empty());
+}
+
+TYPED_TEST(SystemFunctionsGetBoundaryDoFsTests, MakeBoundaryAngularSolution) {
+  constexpr int dim = this->dim;
+  using Boundary = problem::Boundary;
+  const int total_groups = 2, total_angles = 3;
+
+  auto boundary_solution_ptr = system::MakeBoundaryAngularSolution(
+      this->domain_mock_, {Boundary::kXMin}, total_groups, total_angles);
+  ASSERT_NE(boundary_solution_ptr, nullptr);
+  EXPECT_EQ(boundary_solution_ptr->n_boundary_dofs(), std::pow(5, dim - 1));
+  EXPECT_EQ(boundary_solution_ptr->total_degrees_of_freedom(),
+            this->locally_owned_dofs_.size());
+  EXPECT_EQ(boundary_solution_ptr->total_groups(), total_groups);
+  EXPECT_EQ(boundary_solution_ptr->total_angles(), total_angles);
+  EXPECT_EQ(boundary_solution_ptr->precision(),
+            system::StoragePrecision::kDouble);
+
+  auto single_solution_ptr = system::MakeBoundaryAngularSolution(
+      this->domain_mock_, {Boundary::kXMin}, total_groups, total_angles,
+      system::StoragePrecision::kSingle);
+  ASSERT_NE(single_solution_ptr, nullptr);
+  EXPECT_EQ(single_solution_ptr->precision(),
+            system::StoragePrecision::kSingle);
+  EXPECT_EQ(2 * single_solution_ptr->storage_bytes(),
+            boundary_solution_ptr->storage_bytes());
+}
 
 } // namespace
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "system/workspace.h"
+
+#include <deal.II/base/exceptions.h>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+class SystemWorkspaceTest : public ::testing::Test {
+ protected:
+  static constexpr int cell_dofs_{4};
+  static constexpr int cell_quadrature_points_{9};
+  static constexpr int total_dofs_{25};
+};
+
+TEST_F(SystemWorkspaceTest, Constructor) {
+  system::Workspace test_workspace(cell_dofs_, cell_quadrature_points_,
+                                   total_dofs_);
+  EXPECT_EQ(test_workspace.cell_degrees_of_freedom(), cell_dofs_);
+  EXPECT_EQ(test_workspace.cell_quadrature_points(), cell_quadrature_points_);
+  EXPECT_EQ(test_workspace.total_degrees_of_freedom(), total_dofs_);
+
+  EXPECT_EQ(test_workspace.cell_matrix().m(), cell_dofs_);
+  EXPECT_EQ(test_workspace.cell_matrix().n(), cell_dofs_);
+  EXPECT_EQ(test_workspace.cell_vector().size(), cell_dofs_);
+  EXPECT_EQ(test_workspace.local_dof_indices().size(), cell_dofs_);
+  EXPECT_EQ(test_workspace.source_at_quadrature().size(),
+            cell_quadrature_points_);
+  EXPECT_EQ(test_workspace.moment_at_quadrature().size(),
+            cell_quadrature_points_);
+  EXPECT_EQ(test_workspace.current_scalar_flux().size(), total_dofs_);
+  EXPECT_EQ(test_workspace.previous_scalar_flux().size(), total_dofs_);
+}
+
+TEST_F(SystemWorkspaceTest, ConstructorBadSizes) {
+  EXPECT_ANY_THROW({
+    system::Workspace test_workspace(0, cell_quadrature_points_, total_dofs_);
+  });
+  EXPECT_ANY_THROW({
+    system::Workspace test_workspace(cell_dofs_, 0, total_dofs_);
+  });
+  EXPECT_ANY_THROW({
+    system::Workspace test_workspace(cell_dofs_, cell_quadrature_points_, -1);
+  });
+}
+
+} // namespace
@@ -0,0 +1,35 @@
+#include "system/workspace.h"
+
+#include <deal.II/base/exceptions.h>
+
+namespace bart {
+
+namespace system {
+
+Workspace::Workspace(const int cell_degrees_of_freedom,
+                     const int cell_quadrature_points,
+                     const int total_degrees_of_freedom)
+    : cell_degrees_of_freedom_(cell_degrees_of_freedom),
+      cell_quadrature_points_(cell_quadrature_points),
+      total_degrees_of_freedom_(total_degrees_of_freedom),
+      cell_matrix_(cell_degrees_of_freedom, cell_degrees_of_freedom),
+      cell_vector_(cell_degrees_of_freedom),
+      local_dof_indices_(cell_degrees_of_freedom),
+      source_at_quadrature_(cell_quadrature_points),
+      moment_at_quadrature_(cell_quadrature_points),
+      current_scalar_flux_(total_degrees_of_freedom),
+      previous_scalar_flux_(total_degrees_of_freedom) {
+  AssertThrow(cell_degrees_of_freedom > 0,
+              dealii::ExcMessage("Error in constructor of Workspace, cell "
+                                 "degrees of freedom must be greater than 0"))
+  AssertThrow(cell_quadrature_points > 0,
+              dealii::ExcMessage("Error in constructor of Workspace, cell "
+                                 "quadrature points must be greater than 0"))
+  AssertThrow(total_degrees_of_freedom > 0,
+              dealii::ExcMessage("Error in constructor of Workspace, total "
+                                 "degrees of freedom must be greater than 0"))
+}
+
+} // namespace system
+
+} // namespace bart
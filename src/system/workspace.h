@@ -0,0 +1,85 @@
+#ifndef BART_SRC_SYSTEM_WORKSPACE_H_
+#define BART_SRC_SYSTEM_WORKSPACE_H_
+
+#include <vector>
+
+#include <deal.II/base/types.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "system/moments/spherical_harmonic_types.h"
+
+namespace bart {
+
+namespace system {
+
+/*! \brief Preallocated scratch storage for assembly and iteration loops.
+ *
+ * Holds the scratch buffers used repeatedly inside iteration loops, so that
+ * once the workspace is built no heap allocations are required to stamp
+ * system terms, evaluate sources at quadrature points, or check the
+ * convergence of group fluxes. The workspace is sized once, by the framework
+ * builder, using the finite element and the number of degrees of freedom.
+ *
+ * Buffers are handed out by reference and are not guarded. Each buffer is
+ * only used by one class (documented on each accessor), so they are not
+ * overwritten by nested calls. A workspace must not be shared between
+ * threads; each thread of assembly requires its own workspace.
+ */
+class Workspace {
+ public:
+  using DoFIndices = std::vector<dealii::types::global_dof_index>;
+  using QuadratureValues = std::vector<double>;
+
+  /*! \brief Constructor.
+   *
+   * \param cell_degrees_of_freedom degrees of freedom per cell.
+   * \param cell_quadrature_points quadrature points per cell.
+   * \param total_degrees_of_freedom total degrees of freedom in the domain,
+   *        the size of a moment vector.
+   */
+  Workspace(int cell_degrees_of_freedom,
+            int cell_quadrature_points,
+            int total_degrees_of_freedom);
+
+  //! Cell matrix, used by formulation::Stamper
+  dealii::FullMatrix<double>& cell_matrix() { return cell_matrix_; }
+  //! Cell vector, used by formulation::Stamper
+  dealii::Vector<double>& cell_vector() { return cell_vector_; }
+  //! Cell degree of freedom indices, used by formulation::Stamper
+  DoFIndices& local_dof_indices() { return local_dof_indices_; }
+
+  //! Accumulated source at the cell quadrature points, used by formulations
+  QuadratureValues& source_at_quadrature() { return source_at_quadrature_; }
+  //! Moment values at the cell quadrature points, used by formulations
+  QuadratureValues& moment_at_quadrature() { return moment_at_quadrature_; }
+
+  //! Scalar flux of the current group iteration, used by group iterations
+  moments::MomentVector& current_scalar_flux() { return current_scalar_flux_; }
+  //! Scalar flux of the previous group iteration, used by group iterations
+  moments::MomentVector& previous_scalar_flux() {
+    return previous_scalar_flux_; }
+
+  int cell_degrees_of_freedom() const { return cell_degrees_of_freedom_; }
+  int cell_quadrature_points() const { return cell_quadrature_points_; }
+  int total_degrees_of_freedom() const { return total_degrees_of_freedom_; }
+
+ private:
+  const int cell_degrees_of_freedom_;
+  const int cell_quadrature_points_;
+  const int total_degrees_of_freedom_;
+
+  dealii::FullMatrix<double> cell_matrix_;
+  dealii::Vector<double> cell_vector_;
+  DoFIndices local_dof_indices_;
+  QuadratureValues source_at_quadrature_;
+  QuadratureValues moment_at_quadrature_;
+  moments::MomentVector current_scalar_flux_;
+  moments::MomentVector previous_scalar_flux_;
+};
+
+} // namespace system
+
+} // namespace bart
+
+#endif //BART_SRC_SYSTEM_WORKSPACE_H_
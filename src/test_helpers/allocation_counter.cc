@@ -0,0 +1,46 @@
+#include "test_helpers/allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+
+void* CountedAllocate(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (size == 0)
+    size = 1;
+  if (void* ptr = std::malloc(size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return CountedAllocate(size); }
+void* operator new[](std::size_t size) { return CountedAllocate(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace bart {
+
+namespace test_helpers {
+
+AllocationCounter::AllocationCounter()
+    : start_count_(total_allocations()) {}
+
+std::size_t AllocationCounter::allocations() const {
+  return total_allocations() - start_count_;
+}
+
+std::size_t AllocationCounter::total_allocations() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+} // namespace test_helpers
+
+} // namespace bart
@@ -0,0 +1,49 @@
+#ifndef BART_SRC_TEST_HELPERS_ALLOCATION_COUNTER_H_
+#define BART_SRC_TEST_HELPERS_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace bart {
+
+namespace test_helpers {
+
+/*! \brief Counts heap allocations made while it is in scope.
+ *
+ * The allocation test executable, bart_allocation_test, replaces the global
+ * operator new, incrementing a counter on each allocation. An
+ * AllocationCounter records the counter when it is constructed, and
+ * allocations returns the number of allocations made since then. This is used
+ * to verify that iteration loops do not allocate once their workspaces have
+ * been built.
+ *
+ * Only tests named <tt>*allocation*_test.cc</tt> are built into
+ * bart_allocation_test, and this class is not available to bart_test.
+ *
+ * \code
+ * AllocationCounter counter;
+ * // ... code under test
+ * const auto allocations = counter.allocations();
+ * EXPECT_EQ(allocations, 0);
+ * \endcode
+ *
+ * Note that gtest assertions may themselves allocate, so the count should be
+ * stored before it is checked.
+ */
+class AllocationCounter {
+ public:
+  AllocationCounter();
+  //! Number of heap allocations since construction
+  std::size_t allocations() const;
+
+  //! Total number of heap allocations made by the executable
+  static std::size_t total_allocations();
+
+ private:
+  const std::size_t start_count_;
+};
+
+} // namespace test_helpers
+
+} // namespace bart
+
+#endif //BART_SRC_TEST_HELPERS_ALLOCATION_COUNTER_H_
@@ -0,0 +1,44 @@
+#include "test_helpers/allocation_counter.h"
+
+#include <memory>
+#include <vector>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+class TestHelpersAllocationCounterTest : public ::testing::Test {
+ protected:
+};
+
+TEST_F(TestHelpersAllocationCounterTest, CountsAllocations) {
+  test_helpers::AllocationCounter counter;
+  auto int_ptr = std::make_unique<int>(1);
+  auto array_ptr = std::make_unique<double[]>(10);
+  const auto allocations = counter.allocations();
+  EXPECT_EQ(allocations, 2);
+}
+
+TEST_F(TestHelpersAllocationCounterTest, NoAllocations) {
+  std::vector<double> vector;
+  vector.reserve(10);
+  test_helpers::AllocationCounter counter;
+  for (int i = 0; i < 10; ++i)
+    vector.push_back(i);
+  const auto allocations = counter.allocations();
+  EXPECT_EQ(allocations, 0);
+}
+
+TEST_F(TestHelpersAllocationCounterTest, TotalAllocations) {
+  const auto start_total = test_helpers::AllocationCounter::total_allocations();
+  test_helpers::AllocationCounter counter;
+  auto int_ptr = std::make_unique<int>(1);
+  const auto allocations = counter.allocations();
+  const auto end_total = test_helpers::AllocationCounter::total_allocations();
+  EXPECT_EQ(allocations, 1);
+  EXPECT_EQ(end_total - start_total, 1);
+}
+
+} // namespace